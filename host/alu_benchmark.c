@@ -0,0 +1,96 @@
+// Host microbenchmark for the 8080 ALU
+//
+// Runs a loop of the add, subtract, rotate and decimal adjust instructions
+// the BASIC floating point routines are made of and times a fixed number of
+// 8080 cycles. Build with and without the ALU tables and compare:
+//
+//   cc -O2 -Iinc host/alu_benchmark.c src/i8080.c -o alu_benchmark
+//   cc -O2 -Iinc -DI8080_ALU_TABLES host/alu_benchmark.c src/i8080.c -o alu_benchmark
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "i8080.h"
+
+#define MEMORY_SIZE (64 * 1024)
+
+#define DEFAULT_CYCLES 1000000000U
+
+#define SLICE_CYCLES 1000000
+
+#ifdef I8080_ALU_TABLES
+#define ALU "tables"
+#else
+#define ALU "arithmetic"
+#endif
+
+#ifdef I8080_LAZY_FLAGS
+#define FLAGS "lazy"
+#else
+#define FLAGS "eager"
+#endif
+
+static const uint8_t program[] = {
+  0x78,             // MOV A,B
+  0x89,             // ADC C
+  0x47,             // MOV B,A
+  0x7A,             // MOV A,D
+  0x9B,             // SBB E
+  0x57,             // MOV D,A
+  0x1F,             // RAR
+  0x5F,             // MOV E,A
+  0x7C,             // MOV A,H
+  0x8D,             // ADC L
+  0x27,             // DAA
+  0x67,             // MOV H,A
+  0x17,             // RAL
+  0x95,             // SUB L
+  0x6F,             // MOV L,A
+  0xCE, 0x35,       // ACI 35H
+  0xDE, 0x11,       // SBI 11H
+  0x4F,             // MOV C,A
+  0xC3, 0x00, 0x00  // JMP 0000H
+};
+
+static char memory[MEMORY_SIZE];
+
+int main(int argc, char **argv) {
+  uint cycles = argc > 1 ? strtoul(argv[1], NULL, 10) : DEFAULT_CYCLES;
+
+  struct i8080 cpu;
+
+  i8080_reset(&cpu);
+
+  cpu.memory = memory;
+  cpu.memsize = MEMORY_SIZE;
+
+  memset(memory, 0, MEMORY_SIZE);
+  memcpy(memory, program, sizeof(program));
+
+  struct timespec start, end;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+
+  while (cpu.cyc < cycles) {
+    uint remaining = cycles - cpu.cyc;
+    i8080_run(&cpu, remaining < SLICE_CYCLES ? remaining : SLICE_CYCLES);
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &end);
+
+  double seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+  i8080_sync_flags(&cpu);
+
+  printf("alu:          %s\n", ALU);
+  printf("flags:        %s\n", FLAGS);
+  printf("cycles:       %u\n", cpu.cyc);
+  printf("seconds:      %.3f\n", seconds);
+  printf("8080 MHz:     %.1f\n", cpu.cyc / seconds / 1e6);
+  printf("state:        A=%02X BC=%04X DE=%04X HL=%04X F=%02X\n",
+         cpu.A, cpu.BC, cpu.DE, cpu.HL, cpu.flags);
+
+  return 0;
+}
@@ -0,0 +1,163 @@
+// Host benchmark for the batch of machines in lockstep
+//
+// Boots the embedded Extended Disk BASIC image in every lane of a batch,
+// types a slightly different numeric program into each through its own
+// SIO ports and times a fixed number of 8080 cycles per lane. The same
+// machines are then run one after another with i8080_run and timed, and
+// each lane's registers and memory are checked against its scalar twin.
+//
+//   cc -O2 -Iinc host/batch_benchmark.c src/i8080.c src/i8080_io.c src/i8080_batch.c -o batch_benchmark
+//   cc -O3 -march=native -Iinc host/batch_benchmark.c src/i8080.c src/i8080_io.c src/i8080_batch.c -o batch_benchmark
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "i8080.h"
+#include "i8080_io.h"
+#include "i8080_batch.h"
+#include "basicdisk24k50.h"
+
+#define LANES I8080_BATCH_LANES
+
+#define MEMORY_SIZE (64 * 1024)
+
+#define DEFAULT_CYCLES 20000000U
+
+#define SLICE_CYCLES 100000
+
+#define SCRIPT_SIZE 256
+
+struct sio {
+  char script[SCRIPT_SIZE];
+  size_t index;
+};
+
+struct machine {
+  struct i8080 cpu;
+  struct i8080_io io;
+  struct sio sio;
+  char memory[MEMORY_SIZE];
+};
+
+static struct machine batched[LANES];
+static struct machine scalar[LANES];
+
+static struct i8080_batch batch;
+
+static uint sio_input(struct i8080 *cpu, void *state, uint port) {
+  struct sio *sio = state;
+  uint pending = sio->script[sio->index] != '\0';
+
+  if (port == 0x10) {
+    return 0x02 | pending;
+  }
+
+  return pending ? sio->script[sio->index++] : 0x00;
+}
+
+static uint disk_input(struct i8080 *cpu, void *state, uint port) {
+  return 0xFF; // No disk drive enabled
+}
+
+// Each lane divides by a different number, so the lanes run the same
+// interpreter code on different values
+static void boot(struct machine *machine, uint lane) {
+  struct i8080_device sio_device = {&machine->sio, sio_input, NULL};
+  struct i8080_device disk_device = {NULL, disk_input, NULL};
+
+  snprintf(machine->sio.script, SCRIPT_SIZE,
+           "\rC\r0\r\r\r"
+           "10 FOR I=1 TO 100000\r"
+           "20 A=A+I*I/%u:B$=STR$(A)\r"
+           "30 IF SQR(A)<0 THEN PRINT B$\r"
+           "40 NEXT\r"
+           "RUN\r", lane + 2);
+  machine->sio.index = 0;
+
+  i8080_io_init(&machine->io);
+  i8080_io_map(&machine->io, &disk_device, 0x08, 0x08);
+  i8080_io_map(&machine->io, &sio_device, 0x10, 0x11);
+
+  i8080_reset(&machine->cpu);
+
+  machine->cpu.memory = machine->memory;
+  machine->cpu.memsize = MEMORY_SIZE;
+  i8080_set_io(&machine->cpu, &machine->io);
+
+  memset(machine->memory, 0, MEMORY_SIZE);
+  memcpy(machine->memory, basicdisk24k50, sizeof(basicdisk24k50));
+}
+
+static double elapsed(struct timespec *start) {
+  struct timespec end;
+  clock_gettime(CLOCK_MONOTONIC, &end);
+
+  return (end.tv_sec - start->tv_sec) + (end.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+int main(int argc, char **argv) {
+  uint cycles = argc > 1 ? strtoul(argv[1], NULL, 10) : DEFAULT_CYCLES;
+
+  struct timespec start;
+
+  i8080_batch_init(&batch);
+
+  for (uint l=0;l<LANES;l++) {
+    boot(&batched[l], l);
+    boot(&scalar[l], l);
+    i8080_batch_load(&batch, l, &batched[l].cpu);
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+
+  for (uint run=0;run<cycles;run+=SLICE_CYCLES) {
+    i8080_batch_run(&batch, cycles - run < SLICE_CYCLES ? cycles - run : SLICE_CYCLES);
+  }
+
+  double batch_seconds = elapsed(&start);
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+
+  // In the same slices as the batch, so each machine stops on the same
+  // instruction
+  for (uint l=0;l<LANES;l++) {
+    for (uint run=0;run<cycles;run+=SLICE_CYCLES) {
+      i8080_run(&scalar[l].cpu, cycles - run < SLICE_CYCLES ? cycles - run : SLICE_CYCLES);
+    }
+  }
+
+  double scalar_seconds = elapsed(&start);
+
+  uint mismatches = 0;
+  unsigned long long total = 0;
+
+  for (uint l=0;l<LANES;l++) {
+    struct i8080 *a = &batched[l].cpu;
+    struct i8080 *b = &scalar[l].cpu;
+
+    i8080_batch_save(&batch, l, a);
+    i8080_sync_flags(b);
+
+    if (a->A != b->A || a->BC != b->BC || a->DE != b->DE || a->HL != b->HL ||
+        a->flags != b->flags || a->SP != b->SP || a->PC != b->PC || a->cyc != b->cyc ||
+        memcmp(batched[l].memory, scalar[l].memory, MEMORY_SIZE) != 0) {
+      printf("lane %u differs from its scalar run\n", l);
+      mismatches++;
+    }
+
+    total += a->cyc;
+  }
+
+  printf("lanes:        %u\n", LANES);
+  printf("cycles:       %llu\n", total);
+  printf("vector steps: %u\n", batch.vector_steps);
+  printf("scalar steps: %u\n", batch.scalar_steps);
+  printf("batch:        %.3f s, %.1f 8080 MHz\n", batch_seconds, total / batch_seconds / 1e6);
+  printf("one by one:   %.3f s, %.1f 8080 MHz\n", scalar_seconds, total / scalar_seconds / 1e6);
+  printf("mismatches:   %u\n", mismatches);
+
+  return mismatches > 0;
+}
@@ -0,0 +1,203 @@
+// Differential check of the batch engine against i8080_run
+//
+// Every test fills memory with random bytes, the same in every lane so the
+// lanes run the same code and are stepped together, and gives each lane its
+// own random registers and flags so the vector forms work on different
+// values. Each lane has a scalar twin with the same start. The batch runs
+// i8080_batch_run for random budgets of up to MAX_BUDGET cycles, or now and
+// then up to MAX_LONG_BUDGET so lanes that drift apart fall back to
+// i8080_run, and the twins run i8080_run for the same budgets. After each
+// run every lane's registers, flags and memory are compared with its twin.
+//
+//   cc -O2 -Iinc host/batch_lockstep.c src/i8080.c src/i8080_io.c src/i8080_batch.c -o batch_lockstep
+//   ./batch_lockstep [tests] [seed]
+//
+// A test that diverges is rerun on its own by passing 1 and the seed printed.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "i8080.h"
+#include "i8080_batch.h"
+
+#define LANES I8080_BATCH_LANES
+
+#define MEMORY_SIZE (64 * 1024)
+
+#define DEFAULT_TESTS 200
+
+#define DEFAULT_SEED 1
+
+// Cycles per lane in each test
+#define TEST_CYCLES 100000
+
+// Most cycles per run, so lanes are compared every few instructions
+#define MAX_BUDGET 64
+
+// One run in LONG_BUDGET_SHARE instead gets up to MAX_LONG_BUDGET cycles,
+// long enough for i8080_batch_run to give up on lanes that have drifted
+#define LONG_BUDGET_SHARE 8
+#define MAX_LONG_BUDGET 65536
+
+// Memory differences to list
+#define MAX_DIFFERENCES 8
+
+struct machine {
+  struct i8080 cpu;
+  char memory[MEMORY_SIZE];
+};
+
+static struct machine batched[LANES];
+static struct machine scalar[LANES];
+
+static struct i8080_batch batch;
+
+// splitmix64, which takes any seed
+static uint64_t next_random(uint64_t *state) {
+  uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+// Random registers, with the flag bits that are fixed on the 8080 set as
+// PUSH PSW would store them
+static void start_machine(struct machine *machine, uint64_t *random, const char *memory, uint pc) {
+  struct i8080 *cpu = &machine->cpu;
+
+  i8080_reset(cpu);
+
+  memcpy(machine->memory, memory, MEMORY_SIZE);
+  cpu->memory = machine->memory;
+  cpu->memsize = MEMORY_SIZE;
+
+  cpu->A = next_random(random) & 0xFF;
+  cpu->B = next_random(random) & 0xFF;
+  cpu->C = next_random(random) & 0xFF;
+  cpu->D = next_random(random) & 0xFF;
+  cpu->E = next_random(random) & 0xFF;
+  cpu->H = next_random(random) & 0xFF;
+  cpu->L = next_random(random) & 0xFF;
+  cpu->flags = (next_random(random) & 0xD5) | 0x02;
+  cpu->SP = next_random(random) & 0xFFFF;
+  cpu->PC = pc;
+}
+
+static void generate_test(uint64_t seed) {
+  static char memory[MEMORY_SIZE];
+  uint64_t random = seed;
+
+  for (uint i=0;i<MEMORY_SIZE;i++) {
+    memory[i] = next_random(&random) & 0xFF;
+  }
+
+  uint pc = next_random(&random) & 0xFFFF;
+
+  i8080_batch_init(&batch);
+
+  for (uint l=0;l<LANES;l++) {
+    uint64_t lane_random = next_random(&random);
+    uint64_t twin_random = lane_random;
+
+    start_machine(&batched[l], &lane_random, memory, pc);
+    start_machine(&scalar[l], &twin_random, memory, pc);
+    i8080_batch_load(&batch, l, &batched[l].cpu);
+  }
+}
+
+static int same_state(const struct i8080 *a, const struct i8080 *b) {
+  return a->A == b->A && a->BC == b->BC && a->DE == b->DE && a->HL == b->HL &&
+         a->flags == b->flags && a->SP == b->SP && a->PC == b->PC &&
+         a->INTE == b->INTE && a->halted == b->halted && a->cyc == b->cyc;
+}
+
+static void print_state(const char *name, const struct i8080 *cpu) {
+  printf("  %-7s A=%02X B=%02X C=%02X D=%02X E=%02X H=%02X L=%02X F=%02X SP=%04X PC=%04X INTE=%d halted=%d cyc=%u\n",
+         name, cpu->A, cpu->B, cpu->C, cpu->D, cpu->E, cpu->H, cpu->L,
+         cpu->flags, cpu->SP, cpu->PC, cpu->INTE, cpu->halted, cpu->cyc);
+}
+
+static void print_divergence(uint lane, const struct i8080 *a, const struct i8080 *b) {
+  uint differences = 0;
+
+  printf("Lane %u differs from its twin\n", lane);
+  print_state("batch", a);
+  print_state("twin", b);
+
+  for (uint addr=0;addr<MEMORY_SIZE && differences<MAX_DIFFERENCES;addr++) {
+    if (batched[lane].memory[addr] != scalar[lane].memory[addr]) {
+      printf("  memory %04X: batch %02X twin %02X\n", addr,
+             batched[lane].memory[addr] & 0xFF, scalar[lane].memory[addr] & 0xFF);
+      differences++;
+    }
+  }
+}
+
+// Runs the test, returning 1 after printing the first lane that diverges
+static int run_test(uint64_t seed, unsigned long long *cycles, unsigned long long *vector_steps) {
+  uint64_t budgets = ~seed;
+  uint run = 0;
+
+  while (run < TEST_CYCLES) {
+    uint budget;
+
+    if (next_random(&budgets) % LONG_BUDGET_SHARE == 0) {
+      budget = 1 + next_random(&budgets) % MAX_LONG_BUDGET;
+    } else {
+      budget = 1 + next_random(&budgets) % MAX_BUDGET;
+    }
+
+    uint running = i8080_batch_run(&batch, budget);
+
+    for (uint l=0;l<LANES;l++) {
+      struct i8080 *a = &batched[l].cpu;
+      struct i8080 *b = &scalar[l].cpu;
+
+      i8080_run(b, budget);
+      i8080_batch_save(&batch, l, a);
+      i8080_sync_flags(b);
+
+      if (!same_state(a, b) || memcmp(batched[l].memory, scalar[l].memory, MEMORY_SIZE) != 0) {
+        printf("Test with seed %llu diverged in the run from cycle %u\n", (unsigned long long) seed, run);
+        print_divergence(l, a, b);
+        return 1;
+      }
+    }
+
+    run += budget;
+
+    if (running == 0) {
+      break;
+    }
+  }
+
+  for (uint l=0;l<LANES;l++) {
+    *cycles += scalar[l].cpu.cyc;
+  }
+  *vector_steps += batch.vector_steps;
+
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  uint tests = argc > 1 ? strtoul(argv[1], NULL, 10) : DEFAULT_TESTS;
+  uint64_t seed = argc > 2 ? strtoull(argv[2], NULL, 10) : DEFAULT_SEED;
+
+  unsigned long long cycles = 0;
+  unsigned long long vector_steps = 0;
+
+  for (uint i=0;i<tests;i++) {
+    generate_test(seed + i);
+
+    if (run_test(seed + i, &cycles, &vector_steps)) {
+      return 1;
+    }
+  }
+
+  printf("%u tests of %u lanes, %llu cycles, %llu vector steps, no divergence\n",
+         tests, LANES, cycles, vector_steps);
+
+  return 0;
+}
@@ -0,0 +1,207 @@
+// Host benchmark for the 8080 core
+//
+// Boots the embedded Extended Disk BASIC image, types in a short numeric
+// program through the SIO ports and times a fixed number of 8080 cycles.
+// Build once per engine and compare the results:
+//
+//   cc -O2 -Iinc host/benchmark.c src/i8080.c -o benchmark
+//   cc -O2 -Iinc -DI8080_DISPATCH_TABLE host/benchmark.c src/i8080.c -o benchmark
+//   cc -O2 -Iinc -DI8080_LAZY_FLAGS host/benchmark.c src/i8080.c -o benchmark
+//   cc -O2 -Iinc -DI8080_ALU_TABLES host/benchmark.c src/i8080.c -o benchmark
+//   cc -O2 -Iinc -DI8080_MEMORY_64K host/benchmark.c src/i8080.c -o benchmark
+//   cc -O2 -Iinc -DI8080_BLOCK_CACHE host/benchmark.c src/i8080.c -o benchmark
+//   cc -O2 -Iinc -DI8080_BLOCK_CACHE -DI8080_SUPERINSTRUCTIONS host/benchmark.c src/i8080.c -o benchmark
+//   cc -O2 -Iinc -DI8080_BLOCK_CACHE -DI8080_FLAG_LIVENESS host/benchmark.c src/i8080.c -o benchmark
+//   cc -O2 -Iinc -DI8080_JIT host/benchmark.c src/i8080.c src/i8080_jit.c -o benchmark
+//   cc -O2 -Iinc -DI8080_PRECOMPILED='"basicdisk24k50_precompiled.h"' host/benchmark.c src/i8080.c -o benchmark
+//   cc -O2 -Iinc -DI8080_PAGE_CACHE host/benchmark.c src/i8080.c -o benchmark
+//   cc -O2 -Iinc -DI8080_LAZY_MEMORY host/benchmark.c src/i8080.c -o benchmark
+//   cc -O2 -Iinc -DI8080_DIRTY_PAGES host/benchmark.c src/i8080.c -o benchmark
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "i8080.h"
+#ifdef I8080_JIT
+#include "i8080_jit.h"
+#endif
+#include "basicdisk24k50.h"
+
+#define MEMORY_SIZE (64 * 1024)
+
+#define DEFAULT_CYCLES 2000000000U
+
+#define SLICE_CYCLES 1000000
+
+#ifdef I8080_DISPATCH_TABLE
+#define ENGINE "table"
+#else
+#define ENGINE "switch"
+#endif
+
+#ifdef I8080_MEMORY_64K
+#define MEMORY "64k"
+#else
+#define MEMORY "bounded"
+#endif
+
+#if defined(I8080_JIT)
+#define CACHE "jit"
+#elif defined(I8080_PRECOMPILED)
+#define CACHE "precompiled"
+#elif defined(I8080_SUPERINSTRUCTIONS)
+#define CACHE "superinstructions"
+#elif defined(I8080_BLOCK_CACHE)
+#define CACHE "blocks"
+#else
+#define CACHE "none"
+#endif
+
+#ifdef I8080_LAZY_FLAGS
+#define FLAGS "lazy"
+#else
+#define FLAGS "eager"
+#endif
+
+#ifdef I8080_ALU_TABLES
+#define ALU "tables"
+#else
+#define ALU "arithmetic"
+#endif
+
+// Answers to the start-up questions, then a program that keeps the
+// floating point, string and interpreter loops busy
+static const char *script =
+  "\r"
+  "C\r"
+  "0\r"
+  "\r"
+  "\r"
+  "10 FOR I=1 TO 100000\r"
+  "20 A=A+I*I/3:B$=STR$(A)\r"
+  "30 IF SQR(A)<0 THEN PRINT B$\r"
+  "40 NEXT\r"
+  "RUN\r";
+
+static size_t script_index;
+
+static char memory[MEMORY_SIZE];
+
+#ifdef I8080_BLOCK_CACHE
+static struct i8080_block_cache block_cache;
+#endif
+
+#ifdef I8080_PRECOMPILED
+static struct i8080_precompiled precompiled;
+#endif
+
+#ifdef I8080_PAGE_CACHE
+static struct i8080_page_cache page_cache;
+#endif
+
+static uint input_handler(struct i8080 *cpu, uint device) {
+  uint pending = script[script_index] != '\0';
+
+  switch (device) {
+    case 0x08: return 0xFF; // No disk drive enabled
+    case 0x10: return 0x02 | pending;
+    case 0x11: return pending ? script[script_index++] : 0x00;
+    default: return 0x00;
+  }
+}
+
+static void output_handler(struct i8080 *cpu, uint device, uint data) {
+}
+
+int main(int argc, char **argv) {
+  uint cycles = argc > 1 ? strtoul(argv[1], NULL, 10) : DEFAULT_CYCLES;
+
+  struct i8080 cpu;
+
+  i8080_reset(&cpu);
+
+  cpu.memory = memory;
+  cpu.memsize = MEMORY_SIZE;
+  cpu.input_handler = input_handler;
+  cpu.output_handler = output_handler;
+
+#ifdef I8080_LAZY_MEMORY
+  i8080_clear_memory(&cpu);
+  i8080_map_image(&cpu, basicdisk24k50, sizeof(basicdisk24k50));
+#else
+  memset(memory, 0, MEMORY_SIZE);
+  memcpy(memory, basicdisk24k50, sizeof(basicdisk24k50));
+#endif
+
+#ifdef I8080_BLOCK_CACHE
+  i8080_set_block_cache(&cpu, &block_cache);
+#endif
+
+#ifdef I8080_PRECOMPILED
+  i8080_set_precompiled(&cpu, &precompiled);
+#endif
+
+#ifdef I8080_JIT
+  struct i8080_jit *jit = i8080_jit_create();
+  i8080_set_jit(&cpu, jit);
+#endif
+
+#ifdef I8080_PAGE_CACHE
+  i8080_set_page_cache(&cpu, &page_cache);
+#endif
+
+  struct timespec start, end;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+
+  while (cpu.cyc < cycles) {
+    uint remaining = cycles - cpu.cyc;
+    i8080_run(&cpu, remaining < SLICE_CYCLES ? remaining : SLICE_CYCLES);
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &end);
+
+  double seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+  printf("engine:       %s\n", ENGINE);
+  printf("flags:        %s\n", FLAGS);
+  printf("alu:          %s\n", ALU);
+  printf("memory:       %s\n", MEMORY);
+  printf("cache:        %s\n", CACHE);
+  printf("cycles:       %u\n", cpu.cyc);
+  printf("seconds:      %.3f\n", seconds);
+  printf("8080 MHz:     %.1f\n", cpu.cyc / seconds / 1e6);
+#ifdef I8080_BLOCK_CACHE
+  printf("block hits:   %u\n", block_cache.hits);
+  printf("block misses: %u\n", block_cache.misses);
+  printf("invalidated:  %u\n", block_cache.invalidations);
+#endif
+#ifdef I8080_FLAG_LIVENESS
+  printf("dead flags:   %u\n", block_cache.dead_flags);
+#endif
+#ifdef I8080_PRECOMPILED
+  printf("block hits:   %u\n", precompiled.hits);
+  printf("interpreted:  %u\n", precompiled.misses);
+#endif
+#ifdef I8080_PAGE_CACHE
+  printf("page hits:    %u\n", page_cache.hits);
+  printf("page misses:  %u\n", page_cache.misses);
+  printf("hit rate:     %.2f%%\n", 100.0 * page_cache.hits / (page_cache.hits + page_cache.misses));
+  printf("write backs:  %u\n", page_cache.writebacks);
+#endif
+#ifdef I8080_DIRTY_PAGES
+  printf("dirty pages:  %u of %u\n", i8080_count_dirty_pages(&cpu), I8080_PAGES);
+#endif
+#ifdef I8080_JIT
+  struct i8080_jit_stats stats = i8080_jit_get_stats(jit);
+  printf("translated:   %u\n", stats.translations);
+  printf("invalidated:  %u\n", stats.invalidations);
+  printf("flushes:      %u\n", stats.flushes);
+
+  i8080_jit_destroy(jit);
+#endif
+
+  return 0;
+}
@@ -0,0 +1,524 @@
+// Differential check of an optimised engine against i8080_step
+//
+// Loads two builds of the core, each a shared library made with
+// host/lockstep_engine.c: a reference built with no options and a candidate
+// built with the options under test. Every test starts both from the same
+// random registers and memory, or from an image file at address 0, and
+// answers IN from the same random stream. Some tests without an image start
+// on a loop that writes over its own code, which a block cache has to notice
+// mid-block, or over the last byte of a block as long as superinstructions
+// make one.
+//
+// State is compared once per chunk, not after every instruction, as an
+// optimised engine runs whole blocks and can only stop between them. For each
+// chunk the candidate runs i8080_run for a random budget of up to MAX_BUDGET
+// cycles, or now and then up to MAX_LONG_BUDGET so whole cached blocks run.
+// The reference then steps to the same cycle, and registers, flags, memory
+// and the IN and OUT traffic are compared. The short budgets keep most
+// chunks to a few instructions. A divergence is shrunk by clearing registers
+// and memory for as long as it persists, and printed with the instructions
+// of the chunk that produced it.
+//
+//   cc -O2 -Iinc -shared -fPIC -Wl,-Bsymbolic host/lockstep_engine.c src/i8080.c -o reference.so
+//   cc -O2 -Iinc -shared -fPIC -Wl,-Bsymbolic -DI8080_BLOCK_CACHE host/lockstep_engine.c src/i8080.c -o candidate.so
+//   cc -O2 host/lockstep.c -ldl -o lockstep
+//   ./lockstep ./reference.so ./candidate.so [tests] [seed] [image]
+//
+// Build the candidate with src/i8080_jit.c as well for -DI8080_JIT. A test
+// that diverges is rerun on its own by passing 1 and the seed printed.
+
+#include <dlfcn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "lockstep.h"
+
+#define MEMORY_SIZE (64 * 1024)
+
+#define DEFAULT_TESTS 1000
+
+#define DEFAULT_SEED 1
+
+// Instructions per test
+#define TEST_INSTRUCTIONS 10000
+
+// Most cycles per i8080_run, so state is compared every few instructions
+#define MAX_BUDGET 64
+
+// One run in LONG_BUDGET_SHARE instead gets up to MAX_LONG_BUDGET cycles,
+// enough for caches to run blocks and loops without falling back to stepping
+#define LONG_BUDGET_SHARE 8
+#define MAX_LONG_BUDGET 4096
+
+// One test in SELF_MODIFYING_SHARE starts on a self-modifying loop
+#define SELF_MODIFYING_SHARE 4
+
+// Most one byte instructions between the write and the jump back
+#define MAX_SELF_MODIFYING_LENGTH 12
+
+// Uops in the longest block, I8080_BLOCK_LENGTH by default
+#define BLOCK_UOPS 8
+
+// Memory differences to list
+#define MAX_DIFFERENCES 8
+
+struct engine {
+  void *library;
+  lockstep_load_fn load;
+  lockstep_save_fn save;
+  lockstep_step_fn step;
+  lockstep_run_fn run;
+  lockstep_disassemble_fn disassemble;
+};
+
+struct ports {
+  struct lockstep_io io;
+  uint64_t random; // Answers to IN
+  uint64_t traffic; // Hash of every IN and OUT
+};
+
+struct test {
+  struct lockstep_state state;
+  uint8_t memory[MEMORY_SIZE];
+  uint64_t seed; // Budgets and answers to IN
+};
+
+struct divergence {
+  unsigned from; // Instructions before the run that diverged
+  unsigned to;   // Instructions after it
+  struct lockstep_state reference;
+  struct lockstep_state candidate;
+  struct ports reference_ports;
+  struct ports candidate_ports;
+};
+
+static struct engine reference;
+static struct engine candidate;
+
+static char reference_memory[MEMORY_SIZE];
+static char candidate_memory[MEMORY_SIZE];
+
+static uint8_t image[MEMORY_SIZE];
+static size_t image_size;
+
+static struct test test;
+
+static uint8_t saved[MEMORY_SIZE];
+
+// splitmix64, which takes any seed
+static uint64_t next_random(uint64_t *state) {
+  uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+static void mix(uint64_t *hash, uint64_t value) {
+  *hash = (*hash ^ value) * 0x100000001B3ULL;
+}
+
+static unsigned port_input(struct lockstep_io *io, unsigned port) {
+  struct ports *ports = (struct ports *) io;
+  unsigned data = next_random(&ports->random) & 0xFF;
+
+  mix(&ports->traffic, 0x10000 | (port << 8) | data);
+  return data;
+}
+
+static void port_output(struct lockstep_io *io, unsigned port, unsigned data) {
+  struct ports *ports = (struct ports *) io;
+
+  mix(&ports->traffic, 0x20000 | (port << 8) | data);
+}
+
+static void open_ports(struct ports *ports, uint64_t seed) {
+  ports->io.input = port_input;
+  ports->io.output = port_output;
+  ports->random = seed;
+  ports->traffic = 0xCBF29CE484222325ULL;
+}
+
+static void *find_symbol(void *library, const char *path, const char *name) {
+  void *symbol = dlsym(library, name);
+
+  if (symbol == NULL) {
+    fprintf(stderr, "%s has no %s, build it with host/lockstep_engine.c\n", path, name);
+    exit(1);
+  }
+
+  return symbol;
+}
+
+// Each library keeps its own copy of the core, so the reference and
+// candidate can be built with different options
+static void open_engine(struct engine *engine, const char *path) {
+  engine->library = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+
+  if (engine->library == NULL) {
+    fprintf(stderr, "%s\n", dlerror());
+    exit(1);
+  }
+
+  engine->load = (lockstep_load_fn) find_symbol(engine->library, path, "lockstep_load");
+  engine->save = (lockstep_save_fn) find_symbol(engine->library, path, "lockstep_save");
+  engine->step = (lockstep_step_fn) find_symbol(engine->library, path, "lockstep_step");
+  engine->run = (lockstep_run_fn) find_symbol(engine->library, path, "lockstep_run");
+  engine->disassemble = (lockstep_disassemble_fn) find_symbol(engine->library, path, "lockstep_disassemble");
+}
+
+static void load_image(const char *path) {
+  FILE *file = fopen(path, "rb");
+
+  if (file == NULL) {
+    fprintf(stderr, "Could not open %s\n", path);
+    exit(1);
+  }
+
+  image_size = fread(image, 1, MEMORY_SIZE, file);
+  fclose(file);
+}
+
+// At pc, a loop that increments a byte of its own body with INR M and jumps
+// back, so the code after the write is in the same block as the write and
+// changes every time round. The body starts as MOV and ALU instructions,
+// which become other opcodes as the byte counts up.
+static void plant_self_modifying(uint64_t *random, unsigned pc) {
+  unsigned length = 1 + next_random(random) % MAX_SELF_MODIFYING_LENGTH;
+  unsigned target = pc + 4 + next_random(random) % length;
+
+  test.memory[pc] = 0x21; // LXI H,target
+  test.memory[pc + 1] = target & 0xFF;
+  test.memory[pc + 2] = target >> 8;
+  test.memory[pc + 3] = 0x34; // INR M
+
+  for (unsigned i=0;i<length;i++) {
+    uint8_t opcode;
+    do {
+      opcode = 0x40 + next_random(random) % 0x80;
+    } while (opcode == 0x76); // HLT
+    test.memory[pc + 4 + i] = opcode;
+  }
+
+  test.memory[pc + 4 + length] = 0xC3; // JMP pc
+  test.memory[pc + 5 + length] = pc & 0xFF;
+  test.memory[pc + 6 + length] = pc >> 8;
+}
+
+// At pc, a block of BLOCK_UOPS fused uops, 5 bytes each: LXI D / DAD D /
+// POP D and then MOV H,B / MOV L,C / SHLD, as fused in
+// inc/i8080_superinstructions.h. The loop after it increments the high byte
+// of the SHLD address, the last byte of the block and further from its start
+// than BLOCK_UOPS instructions can reach, and jumps back.
+static void plant_long_block(uint64_t *random, unsigned pc) {
+  unsigned addr = pc;
+
+  for (unsigned i=0;i<BLOCK_UOPS-1;i++) {
+    test.memory[addr++] = 0x11; // LXI D
+    test.memory[addr++] = next_random(random) & 0xFF;
+    test.memory[addr++] = next_random(random) & 0xFF;
+    test.memory[addr++] = 0x19; // DAD D
+    test.memory[addr++] = 0xD1; // POP D
+  }
+
+  test.memory[addr++] = 0x60; // MOV H,B
+  test.memory[addr++] = 0x69; // MOV L,C
+  test.memory[addr++] = 0x22; // SHLD, into the other half of memory
+  test.memory[addr++] = next_random(random) & 0xFF;
+  test.memory[addr++] = 0x80 | (next_random(random) & 0x7F);
+
+  unsigned last = addr - 1;
+
+  test.memory[addr++] = 0x21; // LXI H,last
+  test.memory[addr++] = last & 0xFF;
+  test.memory[addr++] = last >> 8;
+  test.memory[addr++] = 0x34; // INR M
+  test.memory[addr++] = 0xC3; // JMP pc
+  test.memory[addr++] = pc & 0xFF;
+  test.memory[addr++] = pc >> 8;
+}
+
+// Random registers, with the flag bits that are fixed on the 8080 set as
+// PUSH PSW would store them, and random memory or the image
+static void generate_test(uint64_t seed) {
+  uint64_t random = seed;
+
+  test.seed = next_random(&random);
+
+  for (int i=0;i<MEMORY_SIZE;i++) {
+    if (image_size > 0) {
+      test.memory[i] = i < image_size ? image[i] : 0;
+    } else {
+      test.memory[i] = next_random(&random) & 0xFF;
+    }
+  }
+
+  test.state.A = next_random(&random) & 0xFF;
+  test.state.B = next_random(&random) & 0xFF;
+  test.state.C = next_random(&random) & 0xFF;
+  test.state.D = next_random(&random) & 0xFF;
+  test.state.E = next_random(&random) & 0xFF;
+  test.state.H = next_random(&random) & 0xFF;
+  test.state.L = next_random(&random) & 0xFF;
+  test.state.flags = (next_random(&random) & 0xD5) | 0x02;
+  test.state.SP = next_random(&random) & 0xFFFF;
+  test.state.PC = image_size > 0 ? 0 : next_random(&random) & 0xFFFF;
+  test.state.INTE = next_random(&random) & 1;
+  test.state.halted = 0;
+  test.state.cyc = 0;
+
+  // Planted code stays clear of the top of memory so it does not wrap
+  if (image_size == 0 && next_random(&random) % SELF_MODIFYING_SHARE == 0) {
+    test.state.PC &= 0x7FFF;
+    if (next_random(&random) & 1) {
+      plant_self_modifying(&random, test.state.PC);
+    } else {
+      plant_long_block(&random, test.state.PC);
+    }
+  }
+}
+
+static int same_state(const struct lockstep_state *a, const struct lockstep_state *b) {
+  return a->A == b->A && a->B == b->B && a->C == b->C && a->D == b->D &&
+         a->E == b->E && a->H == b->H && a->L == b->L && a->flags == b->flags &&
+         a->SP == b->SP && a->PC == b->PC && a->INTE == b->INTE &&
+         a->halted == b->halted && a->cyc == b->cyc;
+}
+
+// Runs the test for up to max_instructions, returning 1 and filling in
+// divergence at the first comparison that fails. divergence->to is the
+// number of instructions run either way.
+static int lockstep(unsigned max_instructions, struct divergence *divergence) {
+  struct ports reference_ports;
+  struct ports candidate_ports;
+  struct lockstep_state r;
+  struct lockstep_state c;
+
+  open_ports(&reference_ports, test.seed);
+  open_ports(&candidate_ports, test.seed);
+
+  memcpy(reference_memory, test.memory, MEMORY_SIZE);
+  memcpy(candidate_memory, test.memory, MEMORY_SIZE);
+
+  reference.load(&test.state, reference_memory, &reference_ports.io);
+  candidate.load(&test.state, candidate_memory, &candidate_ports.io);
+
+  uint64_t budgets = ~test.seed;
+  unsigned instructions = 0;
+
+  while (instructions < max_instructions) {
+    unsigned from = instructions;
+    unsigned budget;
+
+    if (next_random(&budgets) % LONG_BUDGET_SHARE == 0) {
+      budget = 1 + next_random(&budgets) % MAX_LONG_BUDGET;
+    } else {
+      budget = 1 + next_random(&budgets) % MAX_BUDGET;
+    }
+
+    candidate.run(budget);
+    candidate.save(&c);
+
+    reference.save(&r);
+    while ((int) (c.cyc - r.cyc) > 0 && !r.halted) {
+      reference.step();
+      reference.save(&r);
+      instructions++;
+    }
+
+    if (!same_state(&r, &c) ||
+        memcmp(reference_memory, candidate_memory, MEMORY_SIZE) != 0 ||
+        reference_ports.traffic != candidate_ports.traffic) {
+      divergence->from = from;
+      divergence->to = instructions;
+      divergence->reference = r;
+      divergence->candidate = c;
+      divergence->reference_ports = reference_ports;
+      divergence->candidate_ports = candidate_ports;
+      return 1;
+    }
+
+    if (c.halted) {
+      break;
+    }
+  }
+
+  divergence->to = instructions;
+  return 0;
+}
+
+static void shrink_register(uint8_t *reg, uint8_t cleared, unsigned *max_instructions) {
+  struct divergence divergence;
+  uint8_t value = *reg;
+
+  if (value == cleared) {
+    return;
+  }
+
+  *reg = cleared;
+  if (lockstep(*max_instructions, &divergence)) {
+    *max_instructions = divergence.to;
+  } else {
+    *reg = value;
+  }
+}
+
+// Clears registers, then memory in halving chunks, keeping each change the
+// divergence survives. Cleared memory is NOP, so what is left is the code
+// and data the divergence depends on.
+static void minimise(unsigned *max_instructions) {
+  struct divergence divergence;
+
+  shrink_register(&test.state.A, 0, max_instructions);
+  shrink_register(&test.state.B, 0, max_instructions);
+  shrink_register(&test.state.C, 0, max_instructions);
+  shrink_register(&test.state.D, 0, max_instructions);
+  shrink_register(&test.state.E, 0, max_instructions);
+  shrink_register(&test.state.H, 0, max_instructions);
+  shrink_register(&test.state.L, 0, max_instructions);
+  shrink_register(&test.state.flags, 0x02, max_instructions);
+
+  for (unsigned size=MEMORY_SIZE/2;size>0;size/=2) {
+    for (unsigned addr=0;addr<MEMORY_SIZE;addr+=size) {
+      unsigned used = 0;
+      for (unsigned i=0;i<size && !used;i++) {
+        used = test.memory[addr + i];
+      }
+      if (!used) {
+        continue;
+      }
+
+      memcpy(saved, &test.memory[addr], size);
+      memset(&test.memory[addr], 0, size);
+
+      if (lockstep(*max_instructions, &divergence)) {
+        *max_instructions = divergence.to;
+      } else {
+        memcpy(&test.memory[addr], saved, size);
+      }
+    }
+  }
+}
+
+static void print_state(const char *name, const struct lockstep_state *state) {
+  printf("  %-10s A=%02X B=%02X C=%02X D=%02X E=%02X H=%02X L=%02X F=%02X SP=%04X PC=%04X INTE=%d halted=%d cyc=%u\n",
+         name, state->A, state->B, state->C, state->D, state->E, state->H, state->L,
+         state->flags, state->SP, state->PC, state->INTE, state->halted, state->cyc);
+}
+
+static void print_memory(void) {
+  for (unsigned addr=0;addr<MEMORY_SIZE;addr+=16) {
+    unsigned used = 0;
+    for (unsigned i=0;i<16;i++) {
+      used |= test.memory[addr + i];
+    }
+    if (!used) {
+      continue;
+    }
+
+    printf("  %04X:", addr);
+    for (unsigned i=0;i<16;i++) {
+      printf(" %02X", test.memory[addr + i]);
+    }
+    printf("\n");
+  }
+}
+
+// Replays the reference alone to list the instructions of the run that
+// diverged, as it executed them
+static void print_instructions(const struct divergence *divergence) {
+  struct ports ports;
+  struct lockstep_state state;
+  char buffer[32];
+
+  open_ports(&ports, test.seed);
+  memcpy(reference_memory, test.memory, MEMORY_SIZE);
+  reference.load(&test.state, reference_memory, &ports.io);
+
+  for (unsigned i=0;i<divergence->to;i++) {
+    if (i >= divergence->from) {
+      reference.save(&state);
+      reference.disassemble(state.PC, buffer, sizeof(buffer));
+      printf("  %04X  %s\n", state.PC, buffer);
+    }
+    reference.step();
+  }
+}
+
+static void print_divergence(const struct divergence *divergence) {
+  unsigned differences = 0;
+
+  printf("Divergence after %u instructions, in the run from instruction %u\n", divergence->to, divergence->from);
+
+  print_state("reference", &divergence->reference);
+  print_state("candidate", &divergence->candidate);
+
+  for (unsigned addr=0;addr<MEMORY_SIZE && differences<MAX_DIFFERENCES;addr++) {
+    if (reference_memory[addr] != candidate_memory[addr]) {
+      printf("  memory %04X: reference %02X candidate %02X\n", addr,
+             reference_memory[addr] & 0xFF, candidate_memory[addr] & 0xFF);
+      differences++;
+    }
+  }
+
+  if (divergence->reference_ports.traffic != divergence->candidate_ports.traffic) {
+    printf("  IN and OUT traffic differs\n");
+  }
+}
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    fprintf(stderr, "Usage: %s reference.so candidate.so [tests] [seed] [image]\n", argv[0]);
+    return 1;
+  }
+
+  unsigned tests = argc > 3 ? strtoul(argv[3], NULL, 10) : DEFAULT_TESTS;
+  uint64_t seed = argc > 4 ? strtoull(argv[4], NULL, 10) : DEFAULT_SEED;
+
+  if (argc > 5) {
+    load_image(argv[5]);
+  }
+
+  open_engine(&reference, argv[1]);
+  open_engine(&candidate, argv[2]);
+
+  if (reference.library == candidate.library) {
+    fprintf(stderr, "The reference and candidate must be different files\n");
+    return 1;
+  }
+
+  unsigned long long total = 0;
+
+  for (unsigned i=0;i<tests;i++) {
+    struct divergence divergence;
+
+    generate_test(seed + i);
+
+    if (!lockstep(TEST_INSTRUCTIONS, &divergence)) {
+      total += divergence.to;
+      continue;
+    }
+
+    printf("Test with seed %llu diverged after %u instructions\n\n", (unsigned long long) (seed + i), divergence.to);
+
+    unsigned max_instructions = divergence.to;
+    minimise(&max_instructions);
+    lockstep(max_instructions, &divergence);
+
+    print_divergence(&divergence);
+
+    printf("\nMinimised start, with budgets and IN answers from %016llX\n", (unsigned long long) test.seed);
+    print_state("start", &test.state);
+    print_memory();
+
+    printf("\nInstructions in the run that diverged\n");
+    print_instructions(&divergence);
+
+    return 1;
+  }
+
+  printf("%u tests, %llu instructions, no divergence\n", tests, total);
+
+  return 0;
+}
@@ -0,0 +1,44 @@
+// Interface between host/lockstep.c and the engines it loads
+//
+// Each engine is the core built as a shared library with its own options,
+// so the layout of struct i8080 differs between them. Processor state
+// crosses the boundary in this form instead.
+
+#ifndef LOCKSTEP_H_
+#define LOCKSTEP_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct lockstep_state {
+  uint8_t A, B, C, D, E, H, L, flags;
+  uint16_t SP;
+  uint16_t PC;
+  int INTE;
+  int halted;
+  unsigned cyc;
+};
+
+struct lockstep_io {
+  unsigned (*input)(struct lockstep_io *, unsigned port);
+  void (*output)(struct lockstep_io *, unsigned port, unsigned data);
+};
+
+// Exported by host/lockstep_engine.c
+
+// Resets the engine to state, running from memory, a flat 64 KiB, and
+// attaches whatever caches it was built with
+typedef void (*lockstep_load_fn)(const struct lockstep_state *, char *memory, struct lockstep_io *);
+
+// Current state, with the flags brought up to date
+typedef void (*lockstep_save_fn)(struct lockstep_state *);
+
+// One instruction through i8080_step
+typedef void (*lockstep_step_fn)(void);
+
+// i8080_run for budget cycles, returning the cycles run
+typedef unsigned (*lockstep_run_fn)(unsigned budget);
+
+typedef unsigned (*lockstep_disassemble_fn)(unsigned addr, char *buffer, size_t size);
+
+#endif
@@ -0,0 +1,119 @@
+// One engine for host/lockstep.c
+//
+// Build with the core as a shared library, once with no options for the
+// reference and once with the options under test for the candidate. See
+// host/lockstep.c for the commands.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "i8080.h"
+#ifdef I8080_JIT
+#include "i8080_jit.h"
+#endif
+#include "lockstep.h"
+
+static struct i8080 cpu;
+
+static struct lockstep_io *io;
+
+#ifdef I8080_BLOCK_CACHE
+static struct i8080_block_cache block_cache;
+#endif
+
+#ifdef I8080_JIT
+static struct i8080_jit *jit;
+#endif
+
+#ifdef I8080_PRECOMPILED
+static struct i8080_precompiled precompiled;
+#endif
+
+#ifdef I8080_PAGE_CACHE
+static struct i8080_page_cache page_cache;
+#endif
+
+static uint input(struct i8080 *cpu, uint port) {
+  return io->input(io, port);
+}
+
+static void output(struct i8080 *cpu, uint port, uint data) {
+  io->output(io, port, data);
+}
+
+void lockstep_load(const struct lockstep_state *state, char *memory, struct lockstep_io *callbacks) {
+  i8080_reset(&cpu);
+
+  cpu.memory = memory;
+  cpu.memsize = 0x10000;
+
+  io = callbacks;
+  cpu.input_handler = input;
+  cpu.output_handler = output;
+
+  cpu.A = state->A;
+  cpu.B = state->B;
+  cpu.C = state->C;
+  cpu.D = state->D;
+  cpu.E = state->E;
+  cpu.H = state->H;
+  cpu.L = state->L;
+  cpu.flags = state->flags;
+  cpu.SP = state->SP;
+  cpu.PC = state->PC;
+  cpu.INTE = state->INTE;
+  cpu.halted = state->halted;
+  cpu.cyc = state->cyc;
+
+#ifdef I8080_BLOCK_CACHE
+  i8080_set_block_cache(&cpu, &block_cache);
+#endif
+
+#ifdef I8080_JIT
+  if (jit == NULL) {
+    jit = i8080_jit_create();
+  }
+  i8080_set_jit(&cpu, jit);
+#endif
+
+#ifdef I8080_PRECOMPILED
+  i8080_set_precompiled(&cpu, &precompiled);
+#endif
+
+#ifdef I8080_PAGE_CACHE
+  i8080_set_page_cache(&cpu, &page_cache);
+#endif
+}
+
+void lockstep_save(struct lockstep_state *state) {
+  i8080_sync_flags(&cpu);
+#ifdef I8080_PAGE_CACHE
+  i8080_flush_page_cache(&cpu); // The checker compares memory directly
+#endif
+
+  state->A = cpu.A;
+  state->B = cpu.B;
+  state->C = cpu.C;
+  state->D = cpu.D;
+  state->E = cpu.E;
+  state->H = cpu.H;
+  state->L = cpu.L;
+  state->flags = cpu.flags;
+  state->SP = cpu.SP;
+  state->PC = cpu.PC;
+  state->INTE = cpu.INTE;
+  state->halted = cpu.halted;
+  state->cyc = cpu.cyc;
+}
+
+void lockstep_step(void) {
+  i8080_step(&cpu);
+}
+
+unsigned lockstep_run(unsigned budget) {
+  return i8080_run(&cpu, budget).cycles;
+}
+
+unsigned lockstep_disassemble(unsigned addr, char *buffer, size_t size) {
+  return i8080_disassemble(&cpu, addr, buffer, size);
+}
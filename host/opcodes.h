@@ -0,0 +1,40 @@
+#ifndef HOST_OPCODES_H_
+#define HOST_OPCODES_H_
+
+// Opcode tables shared by the host tools that generate code for the core
+
+// Names of the handlers in src/i8080.c that the block cache decodes to
+static const char *handlers[256] = {
+#define I8080_OPCODE(OPCODE, MNEMONIC, LENGTH, CYCLES, TAKEN, READS, WRITES, ENDS, STORES, HANDLER) #HANDLER,
+#include "i8080_opcodes.h"
+#undef I8080_OPCODE
+};
+
+static const uint8_t opcode_length[256] = {
+#define I8080_OPCODE(OPCODE, MNEMONIC, LENGTH, CYCLES, TAKEN, READS, WRITES, ENDS, STORES, HANDLER) LENGTH,
+#include "i8080_opcodes.h"
+#undef I8080_OPCODE
+};
+
+// Longest time each opcode can take, for fitting a whole block in the budget
+static const uint8_t opcode_cycles[256] = {
+#define I8080_OPCODE(OPCODE, MNEMONIC, LENGTH, CYCLES, TAKEN, READS, WRITES, ENDS, STORES, HANDLER) TAKEN,
+#include "i8080_opcodes.h"
+#undef I8080_OPCODE
+};
+
+// Jumps, calls, returns, restarts, PCHL, HLT, IN and OUT
+static const uint8_t opcode_ends_block[256] = {
+#define I8080_OPCODE(OPCODE, MNEMONIC, LENGTH, CYCLES, TAKEN, READS, WRITES, ENDS, STORES, HANDLER) ENDS,
+#include "i8080_opcodes.h"
+#undef I8080_OPCODE
+};
+
+// Instructions whose result goes through i8080_write_byte or i8080_write_word
+static const uint8_t opcode_writes_memory[256] = {
+#define I8080_OPCODE(OPCODE, MNEMONIC, LENGTH, CYCLES, TAKEN, READS, WRITES, ENDS, STORES, HANDLER) STORES,
+#include "i8080_opcodes.h"
+#undef I8080_OPCODE
+};
+
+#endif
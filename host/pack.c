@@ -0,0 +1,196 @@
+// Packer for the embedded BASIC image
+//
+// Packs basicdisk24k50.h into the format read by i8080_unpack (see
+// i8080_unpack.h), checks that it unpacks to the same bytes, and writes it
+// as a header for the firmware to build in place of the raw array:
+//
+//   cc -O2 -Iinc host/pack.c src/i8080_unpack.c -o pack
+//   ./pack > inc/basicdisk24k50_packed.h
+//
+// Matches are found through hash chains over the whole image, with one step
+// of lazy matching. A run of zeros is preferred to a match of the same
+// length, as it unpacks without reading memory back.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "i8080_unpack.h"
+#include "basicdisk24k50.h"
+
+#define IMAGE basicdisk24k50
+#define IMAGE_SIZE sizeof(basicdisk24k50)
+
+#define HASH_BITS 14
+#define MAX_CHAIN 4096
+#define MAX_OFFSET 0xFFFF
+
+static int head[1 << HASH_BITS];
+static int chain[IMAGE_SIZE];
+
+static uint8_t packed[IMAGE_SIZE * 2];
+static size_t packed_size;
+
+static char unpacked[IMAGE_SIZE];
+
+static uint hash(const uint8_t *bytes) {
+  uint32_t word = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | ((uint32_t) bytes[3] << 24);
+  return (word * 2654435761u) >> (32 - HASH_BITS);
+}
+
+static void insert(uint pos) {
+  if (pos + I8080_UNPACK_MIN_MATCH <= IMAGE_SIZE) {
+    uint h = hash(&IMAGE[pos]);
+    chain[pos] = head[h];
+    head[h] = pos;
+  }
+}
+
+static uint zero_run(uint pos) {
+  uint length = 0;
+  while (pos + length < IMAGE_SIZE && IMAGE[pos + length] == 0) {
+    length++;
+  }
+  return length;
+}
+
+// Longest earlier copy of the bytes at pos, as its length and offset
+static uint longest_match(uint pos, uint *offset) {
+  uint best = 0;
+
+  if (pos + I8080_UNPACK_MIN_MATCH > IMAGE_SIZE) {
+    return 0;
+  }
+
+  int candidate = head[hash(&IMAGE[pos])];
+  for (int steps=0;candidate >= 0 && steps < MAX_CHAIN;steps++) {
+    if (pos - candidate > MAX_OFFSET) {
+      break;
+    }
+
+    uint length = 0;
+    while (pos + length < IMAGE_SIZE && IMAGE[candidate + length] == IMAGE[pos + length]) {
+      length++;
+    }
+    if (length > best) {
+      best = length;
+      *offset = pos - candidate;
+    }
+
+    candidate = chain[candidate];
+  }
+
+  return best;
+}
+
+// The better of a run of zeros or a match at pos, with offset 0 for zeros
+static uint best_match(uint pos, uint *offset) {
+  uint zeros = zero_run(pos);
+  uint length = longest_match(pos, offset);
+
+  if (zeros >= length) {
+    *offset = 0;
+    return zeros;
+  }
+
+  return length;
+}
+
+static void emit(uint byte) {
+  packed[packed_size++] = byte;
+}
+
+static void emit_length(size_t length) {
+  while (length >= 255) {
+    emit(255);
+    length -= 255;
+  }
+  emit(length);
+}
+
+static void emit_sequence(uint literal_start, uint literals, uint length, uint offset) {
+  uint match = length >= I8080_UNPACK_MIN_MATCH ? length - I8080_UNPACK_MIN_MATCH : 0;
+
+  emit(((literals < 15 ? literals : 15) << 4) | (match < 15 ? match : 15));
+  if (literals >= 15) {
+    emit_length(literals - 15);
+  }
+
+  memcpy(&packed[packed_size], &IMAGE[literal_start], literals);
+  packed_size += literals;
+
+  if (length == 0) {
+    return; // The last sequence
+  }
+
+  emit(offset & 0xFF);
+  emit(offset >> 8);
+  if (match >= 15) {
+    emit_length(match - 15);
+  }
+}
+
+static void pack(void) {
+  uint literal_start = 0;
+  uint pos = 0;
+
+  memset(head, -1, sizeof(head));
+
+  while (pos < IMAGE_SIZE) {
+    uint offset;
+    uint length = best_match(pos, &offset);
+
+    // Take a literal instead if the next byte starts a longer match
+    if (length >= I8080_UNPACK_MIN_MATCH && pos + 1 < IMAGE_SIZE) {
+      uint next_offset;
+      insert(pos);
+      uint next_length = best_match(pos + 1, &next_offset);
+
+      if (next_length > length + 1) {
+        pos++;
+        continue;
+      }
+    } else {
+      insert(pos);
+    }
+
+    if (length < I8080_UNPACK_MIN_MATCH) {
+      pos++;
+      continue;
+    }
+
+    emit_sequence(literal_start, pos - literal_start, length, offset);
+
+    for (uint i=1;i<length;i++) {
+      insert(pos + i);
+    }
+    pos += length;
+    literal_start = pos;
+  }
+
+  emit_sequence(literal_start, pos - literal_start, 0, 0);
+}
+
+int main(int argc, char **argv) {
+  pack();
+
+  if (i8080_unpack(unpacked, IMAGE_SIZE, packed, packed_size) != IMAGE_SIZE ||
+      memcmp(unpacked, IMAGE, IMAGE_SIZE) != 0) {
+    fprintf(stderr, "packed image does not unpack to the original\n");
+    exit(1);
+  }
+
+  printf("// basicdisk24k50.h packed by host/pack.c, to be written into memory\n");
+  printf("// with i8080_unpack\n\n");
+  printf("const uint8_t basicdisk24k50_packed[%zu] = {", packed_size);
+  for (size_t i=0;i<packed_size;i++) {
+    printf("%s0x%02X%s", i % 16 == 0 ? "\n\t" : "", packed[i], i + 1 < packed_size ? "," : "");
+  }
+  printf("};\n");
+
+  fprintf(stderr, "image:        %zu bytes\n", IMAGE_SIZE);
+  fprintf(stderr, "packed:       %zu bytes\n", packed_size);
+
+  return 0;
+}
@@ -0,0 +1,400 @@
+// Static recompiler for the embedded BASIC image
+//
+// Walks the code reachable from the reset and restart vectors of
+// basicdisk24k50.h, and from the addresses BASIC branches to while running a
+// short script, and writes C for each basic block it finds, to be built
+// into the core with I8080_PRECOMPILED (see i8080.h):
+//
+//   cc -O2 -Iinc host/precompile.c src/i8080.c -o precompile
+//   ./precompile 1000 > inc/basicdisk24k50_precompiled.h
+//
+// An optional argument limits the output to that many blocks, keeping the
+// ones the script ran most, to save flash. The header in inc is made with
+// 1000; leave it out for every block.
+//
+// Each block calls the core's per-opcode handlers in turn, so the compiler
+// can inline them into straight-line code with no fetch or decode. Operands
+// are read from memory as the block runs, as BASIC patches the immediates of
+// its floating point routines, and only opcodes are guarded: the core hashes
+// the guarded bytes of each granule when the code is attached and tracks
+// writes to them afterwards, and a block over a changed granule is left to
+// the interpreter.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "i8080.h"
+#include "basicdisk24k50.h"
+#include "opcodes.h"
+
+#define IMAGE basicdisk24k50
+#define IMAGE_NAME "basicdisk24k50.h"
+#define IMAGE_SIZE ((unsigned) sizeof(IMAGE))
+
+#define MEMORY_SIZE (64 * 1024)
+
+// Must match I8080_PRECOMPILED_GRANULE_SHIFT in i8080.h
+#define GRANULE_SHIFT 4
+#define GRANULE_COUNT ((IMAGE_SIZE + (1 << GRANULE_SHIFT) - 1) >> GRANULE_SHIFT)
+
+#define WORD_COUNT ((IMAGE_SIZE + 31) / 32)
+
+// Most instructions in one block, which bounds how far a block can run past
+// the end of a cycle budget check
+#define BLOCK_LENGTH 32
+
+// 8080 cycles BASIC runs the script below for, to find code only reached
+// through tables of addresses
+#define TRACE_CYCLES 200000000U
+
+// Answers to the start-up questions, then statements and functions for the
+// trace to pass through
+static const char *script =
+  "\r"
+  "C\r"
+  "0\r"
+  "\r"
+  "\r"
+  "10 DIM X(20):DEF FNF(X)=X*X+1\r"
+  "20 FOR I=1 TO 20:X(I)=FNF(I)/7:A=A+X(I)^2:NEXT\r"
+  "30 B$=STR$(A)+\"!\":C$=MID$(B$,2,3)+LEFT$(B$,2)+RIGHT$(B$,1)\r"
+  "40 D=SQR(A)+SIN(A)+COS(A)+TAN(A)+ATN(A)+LOG(A)+EXP(1)+INT(A)+ABS(-A)\r"
+  "50 D#=A/3:E%=LEN(C$)+ASC(C$)+VAL(\"12\"):F!=SGN(D)*RND(1)\r"
+  "60 IF A>D AND NOT E%<0 OR F!=0 THEN GOSUB 100 ELSE GOSUB 100\r"
+  "70 PRINT A;B$;C$;D;D#;E%;F!;HEX$(E%);OCT$(E%);CHR$(65);STRING$(3,42)\r"
+  "80 PRINT USING \"##.##\";D:E%=E%\\2:ON E% MOD 2+1 GOTO 90,90\r"
+  "90 SWAP A,D:ERASE X:END\r"
+  "100 K=K+1:RETURN\r"
+  "RUN\r"
+  "LIST\r";
+
+static size_t script_index;
+
+static char memory[MEMORY_SIZE];
+
+static uint8_t is_entry[0x10000];
+static uint8_t is_emitted[0x10000];
+static unsigned trace_count[0x10000];
+static uint8_t is_guarded[0x10000];
+
+static unsigned pending[0x10000];
+static unsigned pending_count;
+
+// Conditional jumps and returns, which blocks carry on past when the
+// condition fails
+static int falls_through(unsigned opcode) {
+  return (opcode & 0xC7) == 0xC2 || (opcode & 0xC7) == 0xC0;
+}
+
+// Stops before instructions that run off the end of the image
+static int fits(unsigned addr) {
+  return addr < IMAGE_SIZE && addr + opcode_length[IMAGE[addr]] <= IMAGE_SIZE;
+}
+
+static unsigned operand(unsigned addr) {
+  unsigned length = opcode_length[IMAGE[addr]];
+
+  if (length == 2) {
+    return IMAGE[addr + 1];
+  } else if (length == 3) {
+    return (IMAGE[addr + 2] << 8) | IMAGE[addr + 1];
+  }
+
+  return 0;
+}
+
+static void add_entry(unsigned addr) {
+  if (addr < IMAGE_SIZE && !is_entry[addr]) {
+    is_entry[addr] = 1;
+    pending[pending_count++] = addr;
+  }
+}
+
+static uint input_handler(struct i8080 *cpu, uint device) {
+  uint pending = script[script_index] != '\0';
+
+  switch (device) {
+    case 0x08: return 0xFF; // No disk drive enabled
+    case 0x10: return 0x02 | pending;
+    case 0x11: return pending ? script[script_index++] : 0x00;
+    default: return 0x00;
+  }
+}
+
+static void output_handler(struct i8080 *cpu, uint device, uint data) {
+}
+
+// Runs the script in the interpreter, counting the instructions run at each
+// address, and adds every address reached by a jump, call, return or restart
+static void trace(void) {
+  struct i8080 cpu;
+
+  i8080_reset(&cpu);
+
+  cpu.memory = memory;
+  cpu.memsize = MEMORY_SIZE;
+  cpu.input_handler = input_handler;
+  cpu.output_handler = output_handler;
+
+  memcpy(memory, IMAGE, IMAGE_SIZE);
+
+  while (cpu.cyc < TRACE_CYCLES) {
+    uint opcode = i8080_read_byte(&cpu, cpu.PC);
+    uint next = (cpu.PC + opcode_length[opcode]) & 0xFFFF;
+
+    trace_count[cpu.PC]++;
+    i8080_step(&cpu);
+
+    if (opcode_ends_block[opcode] && !(falls_through(opcode) && cpu.PC == next)) {
+      add_entry(cpu.PC);
+    }
+  }
+}
+
+// Follows fall-through, jump and call targets and the return address of
+// calls and restarts from the vectors and the traced entries, along with
+// addresses that LXI loads for a PUSH, as BASIC pushes return addresses
+static void walk(void) {
+  add_entry(0x0000);
+  for (unsigned vector=0x08;vector<=0x38;vector+=8) {
+    add_entry(vector);
+  }
+
+  while (pending_count > 0) {
+    unsigned addr = pending[--pending_count];
+    unsigned count = 0;
+
+    while (fits(addr) && count++ < BLOCK_LENGTH) {
+      unsigned opcode = IMAGE[addr];
+      unsigned next = addr + opcode_length[opcode];
+
+      if ((opcode & 0xC7) == 0xC2 || (opcode & 0xC7) == 0xC4 ||
+          opcode == 0xC3 || opcode == 0xCB || (opcode & 0x0F) == 0x0D) {
+        add_entry(operand(addr));
+      }
+
+      // LXI B, D or H straight before PUSH of the same pair
+      if ((opcode & 0xCF) == 0x01 && opcode != 0x31 && next < IMAGE_SIZE &&
+          IMAGE[next] == (opcode | 0xC4)) {
+        add_entry(operand(addr));
+      }
+
+      if (opcode_ends_block[opcode] && !falls_through(opcode)) {
+        // Unconditional jumps, returns, PCHL and HLT do not fall through
+        if (opcode != 0xC3 && opcode != 0xCB && opcode != 0xC9 &&
+            opcode != 0xD9 && opcode != 0xE9 && opcode != 0x76) {
+          add_entry(next);
+        }
+        break;
+      }
+
+      addr = next;
+    }
+
+    // A block cut short by its length carries on in a block of its own
+    if (count > BLOCK_LENGTH) {
+      add_entry(addr);
+    }
+  }
+}
+
+// A block runs up to the next entry, so code is not repeated in the blocks
+// that fall into it, and past conditional jumps and returns that are not
+// taken
+static unsigned block_end(unsigned pc, unsigned *cycles) {
+  unsigned addr = pc;
+
+  *cycles = 0;
+  while (fits(addr) && (addr == pc || !is_entry[addr])) {
+    unsigned opcode = IMAGE[addr];
+
+    *cycles += opcode_cycles[opcode];
+    addr += opcode_length[opcode];
+
+    if (opcode_ends_block[opcode] && !falls_through(opcode)) {
+      break;
+    }
+  }
+
+  return addr;
+}
+
+static void write_operand(unsigned addr) {
+  unsigned opcode = IMAGE[addr];
+
+  if (opcode_length[opcode] == 2) {
+    printf("%s(cpu, i8080_read_byte(cpu, 0x%04X));\n", handlers[opcode], addr + 1);
+  } else if (opcode_length[opcode] == 3) {
+    printf("%s(cpu, i8080_read_word(cpu, 0x%04X));\n", handlers[opcode], addr + 1);
+  } else {
+    printf("%s(cpu, 0);\n", handlers[opcode]);
+  }
+}
+
+// PC is only stored where it can be seen: before branches, halts and I/O,
+// which only come last apart from conditional branches, and on leaving
+// early after a branch is taken or a write lands on the block
+static void write_block(unsigned pc) {
+  unsigned cycles;
+  unsigned end = block_end(pc, &cycles);
+  unsigned first = pc >> GRANULE_SHIFT;
+  unsigned last = (end - 1) >> GRANULE_SHIFT;
+  unsigned opcode = 0;
+
+  printf("static int block_%04X(struct i8080 *cpu) {\n", pc);
+  printf("  if (!precompiled_enter(cpu, 0x%03X, 0x%03X, %u)) return 0;\n",
+         first, last, cycles);
+
+  for (unsigned addr=pc;addr<end;addr+=opcode_length[opcode]) {
+    unsigned next;
+
+    opcode = IMAGE[addr];
+    next = addr + opcode_length[opcode];
+    is_guarded[addr] = 1;
+
+    if (opcode_ends_block[opcode]) {
+      printf("  cpu->PC = 0x%04X; ", next);
+    } else {
+      printf("  ");
+    }
+    write_operand(addr);
+
+    if (falls_through(opcode) && next < end) {
+      printf("  if (cpu->PC != 0x%04X) return 1;\n", next);
+    }
+
+    if (opcode_writes_memory[opcode] && next < end) {
+      printf("  if (precompiled_changed(cpu, 0x%03X, 0x%03X)) {\n", first, last);
+      printf("    cpu->PC = 0x%04X;\n", next);
+      printf("    return 1;\n");
+      printf("  }\n");
+    }
+  }
+
+  if (!opcode_ends_block[opcode]) {
+    printf("  cpu->PC = 0x%04X;\n", end);
+  }
+  printf("  return 1;\n");
+  printf("}\n\n");
+}
+
+static uint32_t granule_hash(unsigned granule) {
+  uint32_t hash = 2166136261u;
+
+  for (unsigned i=0;i<(1 << GRANULE_SHIFT);i++) {
+    unsigned addr = (granule << GRANULE_SHIFT) + i;
+    if (addr < IMAGE_SIZE && is_guarded[addr]) {
+      hash = (hash ^ IMAGE[addr]) * 16777619u;
+    }
+  }
+
+  return hash;
+}
+
+static int by_count(const void *a, const void *b) {
+  unsigned x = trace_count[*(const unsigned *) a];
+  unsigned y = trace_count[*(const unsigned *) b];
+
+  return x < y ? 1 : x > y ? -1 : (int) (*(const unsigned *) a - *(const unsigned *) b);
+}
+
+// Marks the blocks to write, dropping those whose first instruction ran
+// least beyond max_blocks
+static unsigned select_blocks(unsigned max_blocks) {
+  unsigned count = 0;
+
+  for (unsigned pc=0;pc<IMAGE_SIZE;pc++) {
+    if (is_entry[pc]) {
+      pending[count++] = pc;
+    }
+  }
+
+  qsort(pending, count, sizeof(pending[0]), by_count);
+
+  if (count > max_blocks) {
+    count = max_blocks;
+  }
+  for (unsigned i=0;i<count;i++) {
+    is_emitted[pending[i]] = 1;
+  }
+
+  return count;
+}
+
+int main(int argc, char **argv) {
+  unsigned max_blocks = argc > 1 ? strtoul(argv[1], NULL, 10) : IMAGE_SIZE;
+
+  trace();
+  walk();
+
+  unsigned blocks = select_blocks(max_blocks);
+
+  printf("// Generated by host/precompile.c from %s, do not edit\n", IMAGE_NAME);
+  printf("//\n");
+  printf("// Included by src/i8080.c when built with I8080_PRECOMPILED\n");
+  if (argc > 1) {
+    printf("//\n");
+    printf("// Limited to the %u blocks BASIC ran most\n", max_blocks);
+  }
+  printf("\n");
+  printf("#define PRECOMPILED_SIZE %u\n\n", IMAGE_SIZE);
+
+  for (unsigned pc=0;pc<IMAGE_SIZE;pc++) {
+    if (is_emitted[pc]) {
+      write_block(pc);
+    }
+  }
+
+  printf("// Bytes the blocks depend on, one bit per byte\n");
+  printf("static const uint8_t precompiled_guarded[%u] = {", (IMAGE_SIZE + 7) / 8);
+  for (unsigned i=0;i<(IMAGE_SIZE + 7) / 8;i++) {
+    unsigned bits = 0;
+    for (unsigned bit=0;bit<8;bit++) {
+      bits |= is_guarded[i * 8 + bit] << bit;
+    }
+    printf("%s0x%02X,", i % 16 == 0 ? "\n  " : " ", bits);
+  }
+  printf("\n};\n\n");
+
+  printf("// FNV-1a hash of the guarded bytes of each granule\n");
+  printf("static const uint32_t precompiled_hashes[%u] = {", GRANULE_COUNT);
+  for (unsigned i=0;i<GRANULE_COUNT;i++) {
+    printf("%s0x%08Xu,", i % 6 == 0 ? "\n  " : " ", granule_hash(i));
+  }
+  printf("\n};\n\n");
+
+  printf("// One bit per address a block starts at\n");
+  printf("static const uint32_t precompiled_entries[%u] = {", WORD_COUNT);
+  for (unsigned i=0;i<WORD_COUNT;i++) {
+    uint32_t bits = 0;
+    for (unsigned bit=0;bit<32;bit++) {
+      bits |= (uint32_t) is_emitted[i * 32 + bit] << bit;
+    }
+    printf("%s0x%08Xu,", i % 6 == 0 ? "\n  " : " ", bits);
+  }
+  printf("\n};\n\n");
+
+  printf("// Blocks starting before each word of precompiled_entries\n");
+  printf("static const uint16_t precompiled_ranks[%u] = {", WORD_COUNT);
+  for (unsigned i=0, rank=0;i<WORD_COUNT;i++) {
+    printf("%s%u,", i % 12 == 0 ? "\n  " : " ", rank);
+    for (unsigned bit=0;bit<32;bit++) {
+      rank += is_emitted[i * 32 + bit];
+    }
+  }
+  printf("\n};\n\n");
+
+  printf("static int (*const precompiled_blocks[%u])(struct i8080 *) = {", blocks);
+  for (unsigned pc=0, i=0;pc<IMAGE_SIZE;pc++) {
+    if (is_emitted[pc]) {
+      printf("%sblock_%04X,", i++ % 6 == 0 ? "\n  " : " ", pc);
+    }
+  }
+  printf("\n};\n");
+
+  fprintf(stderr, "%u blocks\n", blocks);
+
+  return 0;
+}
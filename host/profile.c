@@ -0,0 +1,289 @@
+// Opcode sequence profiler for the embedded BASIC image
+//
+// Boots Extended Disk BASIC in the interpreter, runs a few programs through
+// the SIO ports and counts the pairs and triples of opcodes that run one
+// after the other without a branch. The sequences that save the most
+// dispatches are written as superinstructions for the block cache, built in
+// with I8080_SUPERINSTRUCTIONS (see i8080.h):
+//
+//   cc -O2 -Iinc host/profile.c src/i8080.c -o profile
+//   ./profile > inc/i8080_superinstructions.h
+//
+// Only the last instruction of a sequence may branch, halt, do I/O or write
+// memory, so a block that writes over its own code still stops before the
+// next instruction, and at most one may have an operand.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "i8080.h"
+#include "basicdisk24k50.h"
+#include "opcodes.h"
+
+#define MEMORY_SIZE (64 * 1024)
+
+// 8080 cycles each program runs for
+#define PROGRAM_CYCLES 100000000U
+
+#define MAX_SUPERINSTRUCTIONS 32
+
+// Answers to the start-up questions, then the program
+#define START "\rC\r0\r\r\r"
+
+static const char *programs[] = {
+  START
+  "10 FOR I=1 TO 100000\r"
+  "20 A=A+I*I/3:B$=STR$(A)\r"
+  "30 IF SQR(A)<0 THEN PRINT B$\r"
+  "40 NEXT\r"
+  "RUN\r",
+
+  START
+  "10 FOR I=1 TO 10000:A$=\"\"\r"
+  "20 FOR J=1 TO 20:A$=A$+CHR$(64+J):NEXT\r"
+  "30 B$=MID$(A$,5,10)+LEFT$(A$,3):IF INSTR(B$,\"Z\") THEN PRINT B$\r"
+  "40 NEXT\r"
+  "RUN\r",
+
+  START
+  "10 DIM P(1000):FOR I=2 TO 1000:P(I)=1:NEXT\r"
+  "20 FOR I=2 TO 1000:IF P(I)=0 THEN 40\r"
+  "30 PRINT I;:FOR J=I*I TO 1000 STEP I:P(J)=0:NEXT\r"
+  "40 NEXT:PRINT:GOTO 10\r"
+  "RUN\r",
+};
+
+struct sequence {
+  uint8_t length;
+  uint8_t opcodes[3];
+  uint64_t saved; // Dispatches saved by fusing the sequence where it ran
+};
+
+static const char *script;
+static size_t script_index;
+
+static char memory[MEMORY_SIZE];
+
+// Per address: the opcode last run there, how often it ran and how often it
+// carried straight on to the next instruction
+static uint8_t opcodes[0x10000];
+static uint64_t runs[0x10000];
+static uint64_t flows[0x10000];
+
+// Addresses taken by the superinstructions chosen so far
+static uint8_t covered[0x10000];
+
+static uint64_t instructions;
+
+// Savings of every pair, and of triples in an open addressed table keyed by
+// their opcodes
+#define TRIPLE_TABLE_SIZE 0x10000
+
+struct triple {
+  uint32_t key; // Opcodes plus one, 0 if empty
+  uint64_t saved;
+};
+
+static uint64_t pairs[256][256];
+static struct triple triples[TRIPLE_TABLE_SIZE];
+
+static uint input_handler(struct i8080 *cpu, uint device) {
+  uint pending = script[script_index] != '\0';
+
+  switch (device) {
+    case 0x08: return 0xFF; // No disk drive enabled
+    case 0x10: return 0x02 | pending;
+    case 0x11: return pending ? script[script_index++] : 0x00;
+    default: return 0x00;
+  }
+}
+
+static void output_handler(struct i8080 *cpu, uint device, uint data) {
+}
+
+// Anything but the last instruction of a sequence must carry on to the next
+static int leads(uint opcode) {
+  return !opcode_ends_block[opcode] && !opcode_writes_memory[opcode];
+}
+
+static void run_program(const char *program) {
+  struct i8080 cpu;
+
+  i8080_reset(&cpu);
+
+  cpu.memory = memory;
+  cpu.memsize = MEMORY_SIZE;
+  cpu.input_handler = input_handler;
+  cpu.output_handler = output_handler;
+
+  memset(memory, 0, MEMORY_SIZE);
+  memcpy(memory, basicdisk24k50, sizeof(basicdisk24k50));
+
+  script = program;
+  script_index = 0;
+
+  while (cpu.cyc < PROGRAM_CYCLES) {
+    uint pc = cpu.PC;
+    uint opcode = i8080_read_byte(&cpu, pc);
+
+    i8080_step(&cpu);
+
+    opcodes[pc] = opcode;
+    runs[pc]++;
+    instructions++;
+
+    if (leads(opcode) && cpu.PC == ((pc + opcode_length[opcode]) & 0xFFFF)) {
+      flows[pc]++;
+    }
+  }
+}
+
+static int operands(uint length, const uint8_t *opcodes) {
+  int count = 0;
+
+  for (uint i=0;i<length;i++) {
+    count += opcode_length[opcodes[i]] > 1;
+  }
+
+  return count;
+}
+
+static uint64_t *triple_saved(const uint8_t *sequence) {
+  uint32_t key = ((sequence[0] << 16) | (sequence[1] << 8) | sequence[2]) + 1;
+  uint32_t slot = (key * 2654435761u) >> 16;
+
+  while (triples[slot].key != 0 && triples[slot].key != key) {
+    slot = (slot + 1) & (TRIPLE_TABLE_SIZE - 1);
+  }
+
+  triples[slot].key = key;
+  return &triples[slot].saved;
+}
+
+// Reads the sequence of length instructions at pc, returning how many times
+// it ran straight through, or 0 if it never did or overlaps a chosen one
+static uint64_t sequence_at(uint pc, uint length, uint8_t *sequence) {
+  uint64_t count = UINT64_MAX;
+
+  for (uint i=0;i<length;i++) {
+    if (covered[pc] || runs[pc] == 0) {
+      return 0;
+    }
+
+    sequence[i] = opcodes[pc];
+    if (i < length - 1) {
+      count = flows[pc] < count ? flows[pc] : count;
+      pc = (pc + opcode_length[opcodes[pc]]) & 0xFFFF;
+    }
+  }
+
+  return operands(length, sequence) <= 1 ? count : 0;
+}
+
+// Finds the sequence that saves the most dispatches where it ran, leaving
+// out addresses already taken
+static struct sequence best_sequence(void) {
+  struct sequence best = {0, {0, 0, 0}, 0};
+  uint8_t sequence[3];
+
+  memset(pairs, 0, sizeof(pairs));
+  memset(triples, 0, sizeof(triples));
+
+  for (uint pc=0;pc<0x10000;pc++) {
+    uint64_t count = sequence_at(pc, 2, sequence);
+    if (count > 0) {
+      uint64_t *saved = &pairs[sequence[0]][sequence[1]];
+      *saved += count;
+      if (*saved > best.saved) {
+        struct sequence pair = {2, {sequence[0], sequence[1], 0}, *saved};
+        best = pair;
+      }
+    }
+
+    count = sequence_at(pc, 3, sequence);
+    if (count > 0) {
+      uint64_t *saved = triple_saved(sequence);
+      *saved += count * 2;
+      if (*saved > best.saved) {
+        struct sequence triple = {3, {sequence[0], sequence[1], sequence[2]}, *saved};
+        best = triple;
+      }
+    }
+  }
+
+  return best;
+}
+
+// Takes the addresses where the block cache would decode the sequence
+static void cover(struct sequence *best) {
+  uint8_t sequence[3];
+
+  for (uint pc=0;pc<0x10000;pc++) {
+    if (sequence_at(pc, best->length, sequence) > 0 &&
+        memcmp(sequence, best->opcodes, best->length) == 0) {
+      for (uint i=0;i<best->length;i++) {
+        covered[pc] = 1;
+        pc = (pc + opcode_length[opcodes[pc]]) & 0xFFFF;
+      }
+    }
+  }
+}
+
+// Orders by first opcode, then longest first, so the core finds the longest
+// match by looking on from the first with the same opcode
+static int compare_sequences(const void *a, const void *b) {
+  const struct sequence *x = a;
+  const struct sequence *y = b;
+
+  if (x->opcodes[0] != y->opcodes[0]) {
+    return x->opcodes[0] - y->opcodes[0];
+  }
+  return y->length - x->length;
+}
+
+int main(int argc, char **argv) {
+  struct sequence chosen[MAX_SUPERINSTRUCTIONS];
+  uint count = 0;
+
+  for (uint i=0;i<sizeof(programs)/sizeof(programs[0]);i++) {
+    run_program(programs[i]);
+  }
+
+  while (count < MAX_SUPERINSTRUCTIONS) {
+    struct sequence best = best_sequence();
+
+    if (best.saved == 0) {
+      break;
+    }
+
+    cover(&best);
+    chosen[count++] = best;
+  }
+
+  qsort(chosen, count, sizeof(chosen[0]), compare_sequences);
+
+  printf("// Generated by host/profile.c, do not edit\n");
+  printf("//\n");
+  printf("// Opcode sequences BASIC runs most, by first opcode, with the dispatches\n");
+  printf("// each saves as a share of the instructions profiled\n\n");
+
+  for (uint i=0;i<count;i++) {
+    struct sequence *best = &chosen[i];
+
+    if (best->length == 2) {
+      printf("SUPERINSTRUCTION2(0x%02X, 0x%02X, %s, %s)",
+             best->opcodes[0], best->opcodes[1],
+             handlers[best->opcodes[0]], handlers[best->opcodes[1]]);
+    } else {
+      printf("SUPERINSTRUCTION3(0x%02X, 0x%02X, 0x%02X, %s, %s, %s)",
+             best->opcodes[0], best->opcodes[1], best->opcodes[2],
+             handlers[best->opcodes[0]], handlers[best->opcodes[1]],
+             handlers[best->opcodes[2]]);
+    }
+    printf(" // %.2f%%\n", 100.0 * best->saved / instructions);
+  }
+
+  return 0;
+}
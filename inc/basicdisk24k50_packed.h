@@ -0,0 +1,1307 @@
+// basicdisk24k50.h packed by host/pack.c, to be written into memory
+// with i8080_unpack
+
+const uint8_t basicdisk24k50_packed[20834] = {
+	0xF1,0x0C,0xF3,0xC3,0x58,0x56,0x1C,0x32,0x38,0x32,0x7E,0xE3,0xBE,0x23,0xE3,0xC2,
+	0x10,0x0D,0x23,0x7E,0xFE,0x3A,0xD0,0xC3,0x97,0x12,0xC3,0x94,0x52,0x00,0x00,0xFF,
+	0x6E,0x7C,0x92,0xC0,0x7D,0x93,0xC9,0x01,0x0D,0x3A,0x58,0x0C,0xB7,0xC2,0xF6,0x30,
+	0xC9,0x3A,0xCC,0x0B,0xFE,0x08,0xC3,0x06,0x1E,0xC9,0xB4,0x0B,0x4B,0x13,0xBB,0x11,
+	0x61,0x1A,0x66,0x16,0x65,0x19,0x5B,0x1E,0x96,0x19,0x8A,0x16,0x16,0x16,0xDD,0x15,
+	0xAD,0x17,0x3C,0x13,0xFE,0x15,0x4B,0x16,0x68,0x16,0x46,0x13,0xF0,0x17,0xB4,0x15,
+	0x2C,0x27,0x19,0x0F,0xEC,0x16,0xAE,0x13,0xC0,0x26,0xCB,0x20,0x8A,0x29,0x9B,0x13,
+	0xBA,0x28,0xF5,0x28,0xB1,0x26,0xE8,0x17,0x27,0x27,0xE4,0x26,0xF3,0x26,0x68,0x16,
+	0xC0,0x13,0xC1,0x13,0xC6,0x13,0xA3,0x14,0x6C,0x2B,0x6E,0x17,0x33,0x17,0x7C,0x28,
+	0x79,0x17,0x61,0x2D,0x2C,0x15,0x2F,0x15,0x32,0x15,0x35,0x15,0x10,0x19,0x00,0x00,
+	0x01,0xFF,0x51,0xFA,0x43,0x90,0x40,0x7F,0x40,0xEF,0x44,0x40,0x40,0x19,0x41,0x18,
+	0x41,0xC6,0x40,0x37,0x43,0xA7,0x43,0xD3,0x42,0x7F,0x42,0x30,0x43,0x96,0x3F,0x95,
+	0x3F,0xCC,0x43,0x85,0x40,0x04,0x25,0x35,0x25,0x3F,0x25,0x26,0x31,0xD4,0x32,0x13,
+	0x31,0x56,0x3D,0x39,0x3E,0xD9,0x3E,0xA3,0x2F,0xA8,0x3D,0xD3,0x3E,0x36,0x3F,0x4B,
+	0x3F,0x51,0x20,0xA7,0x26,0x79,0x20,0x9A,0x24,0x0E,0x22,0x5B,0x25,0xA6,0x24,0xB6,
+	0x24,0x83,0x29,0xE7,0x24,0x02,0x22,0x08,0x22,0x73,0x20,0x1C,0x32,0x50,0x32,0x7A,
+	0x32,0xC5,0x32,0x00,0x00,0x01,0xF0,0x07,0x27,0x44,0x23,0x40,0x26,0x40,0x29,0x40,
+	0xE9,0x40,0xEF,0x3F,0xF4,0x40,0x04,0x41,0x0A,0x40,0x0D,0x40,0x10,0x40,0x00,0x00,
+	0xF0,0xF1,0x73,0x01,0x84,0x01,0x85,0x01,0xC1,0x01,0xFE,0x01,0x23,0x02,0x39,0x02,
+	0x4B,0x02,0x50,0x02,0x66,0x02,0x67,0x02,0x6C,0x02,0xA0,0x02,0xBE,0x02,0xD1,0x02,
+	0xE1,0x02,0xF5,0x02,0xF6,0x02,0x26,0x03,0x55,0x03,0x6C,0x03,0x7B,0x03,0x85,0x03,
+	0x8F,0x03,0x93,0x03,0x94,0x03,0x4E,0xC4,0xF7,0x42,0xD3,0x06,0x54,0xCE,0x0E,0x53,
+	0xC3,0x15,0x55,0x54,0xCF,0xAB,0x00,0x00,0x4F,0x4E,0x53,0x4F,0x4C,0xC5,0xA0,0x4C,
+	0x4F,0x53,0xC5,0xC3,0x4F,0x4E,0xD4,0x9A,0x4C,0x45,0x41,0xD2,0x92,0x4C,0x4F,0x41,
+	0xC4,0x9C,0x53,0x41,0x56,0xC5,0x9B,0x49,0x4E,0xD4,0x1C,0x53,0x4E,0xC7,0x1D,0x44,
+	0x42,0xCC,0x1E,0x56,0xC9,0x2B,0x56,0xD3,0x2C,0x56,0xC4,0x2D,0x4F,0xD3,0x0C,0x48,
+	0x52,0xA4,0x16,0x00,0x41,0x54,0xC1,0x84,0x49,0xCD,0x86,0x45,0x46,0x53,0x54,0xD2,
+	0xAD,0x45,0x46,0x49,0x4E,0xD4,0xAE,0x45,0x46,0x53,0x4E,0xC7,0xAF,0x45,0x46,0x44,
+	0x42,0xCC,0xB0,0x53,0x4B,0x4F,0xA4,0xBC,0x45,0xC6,0x98,0x45,0x4C,0x45,0x54,0xC5,
+	0xAA,0x53,0x4B,0x49,0xA4,0x2A,0x53,0x4B,0xC6,0x2E,0x53,0x4B,0x49,0x4E,0xC9,0xCC,
+	0x00,0x4E,0xC4,0x81,0x4C,0x53,0xC5,0xA2,0x52,0x41,0x53,0xC5,0xA6,0x44,0x49,0xD4,
+	0xA7,0x52,0x52,0x4F,0xD2,0xA8,0x52,0xCC,0xD6,0x52,0xD2,0xD7,0x58,0xD0,0x0B,0x4F,
+	0xC6,0x2F,0x51,0xD6,0xFA,0x00,0x4F,0xD2,0x82,0x49,0x45,0x4C,0xC4,0xC0,0x49,0x4C,
+	0x45,0xD3,0xC6,0xCE,0xD3,0x52,0xC5,0x0F,0x49,0xD8,0x1F,0x00,0x4F,0x54,0xCF,0x89,
+	0x4F,0x20,0x05,0x00,0xF0,0x96,0x53,0x55,0xC2,0x8D,0x45,0xD4,0xC1,0x00,0x45,0x58,
+	0xA4,0x1A,0x00,0x4E,0x50,0x55,0xD4,0x85,0xC6,0x8B,0x4E,0x53,0x54,0xD2,0xDA,0x4E,
+	0xD4,0x05,0x4E,0xD0,0x10,0x4D,0xD0,0xFB,0x00,0x00,0x49,0x4C,0xCC,0xC8,0x00,0x45,
+	0xD4,0x88,0x49,0x4E,0xC5,0xB1,0x4F,0x41,0xC4,0xC4,0x53,0x45,0xD4,0xC9,0x50,0x52,
+	0x49,0x4E,0xD4,0x9E,0x49,0x53,0xD4,0x93,0x4C,0x49,0x53,0xD4,0x9F,0x50,0x4F,0xD3,
+	0x1B,0x4F,0xC7,0x0A,0x4F,0xC3,0x30,0x45,0xCE,0x12,0x45,0x46,0x54,0xA4,0x01,0x4F,
+	0xC6,0x31,0x00,0x4F,0x55,0x4E,0xD4,0xBE,0x45,0x52,0x47,0xC5,0xC5,0x4F,0xC4,0xFC,
+	0x4B,0x49,0xA4,0x32,0x4B,0x53,0xA4,0x33,0x4B,0x44,0xA4,0x34,0x49,0x44,0xA4,0x03,
+	0x00,0x45,0x58,0xD4,0x83,0x55,0x4C,0xCC,0x96,0x41,0x4D,0xC5,0xC7,0x45,0xD7,0x94,
+	0x4F,0xD4,0xD5,0x00,0x55,0xD4,0x9D,0xCE,0x95,0x50,0x45,0xCE,0xBF,0xD2,0xF8,0x43,
+	0x54,0xA4,0x19,0x00,0x55,0xD4,0xC2,0x4F,0x4B,0xC5,0x99,0x6C,0x00,0xF0,0x72,0x91,
+	0x4F,0xD3,0x11,0x45,0x45,0xCB,0x17,0x00,0x00,0x45,0x41,0xC4,0x87,0x55,0xCE,0x8A,
+	0x45,0x53,0x54,0x4F,0x52,0xC5,0x8C,0x45,0x54,0x55,0x52,0xCE,0x8E,0x45,0xCD,0x8F,
+	0x45,0x53,0x55,0x4D,0xC5,0xA9,0x53,0x45,0xD4,0xCA,0x49,0x47,0x48,0x54,0xA4,0x02,
+	0x4E,0xC4,0x08,0x45,0x4E,0x55,0xCD,0xAC,0x00,0x54,0x4F,0xD0,0x90,0x57,0x41,0xD0,
+	0xA5,0x41,0x56,0xC5,0xCB,0x50,0x43,0xA8,0xD4,0x54,0x45,0xD0,0xD1,0x47,0xCE,0x04,
+	0x51,0xD2,0x07,0x49,0xCE,0x09,0x54,0x52,0xA4,0x13,0x54,0x52,0x49,0x4E,0x47,0xA4,
+	0xD8,0x50,0x41,0x43,0x45,0xA4,0x18,0x00,0x52,0x4F,0xCE,0xA3,0x52,0x4F,0x46,0xC6,
+	0xA4,0x41,0x42,0xA8,0xD0,0xCF,0xCE,0x48,0x45,0xCE,0xCF,0x41,0xCE,0x0D,0x00,0x4E,
+	0xD3,0x01,0xF0,0x7E,0xBD,0x53,0x49,0x4E,0xC7,0xD9,0x53,0xD2,0xD2,0x00,0x41,0xCC,
+	0x14,0x41,0x52,0x50,0x54,0xD2,0xDC,0x00,0x49,0x44,0x54,0xC8,0xA1,0x41,0x49,0xD4,
+	0x97,0x00,0x4F,0xD2,0xF9,0x00,0x00,0x00,0xAB,0xF2,0xAD,0xF3,0xAA,0xF4,0xAF,0xF5,
+	0xDE,0xF6,0xDC,0xFD,0xA7,0xDB,0xBE,0xEF,0xBD,0xF0,0xBC,0xF1,0x00,0x79,0x79,0x7C,
+	0x7C,0x7F,0x50,0x46,0x3C,0x32,0x28,0x7A,0x7B,0x7A,0x32,0x00,0x00,0x1C,0x32,0x93,
+	0x32,0x50,0x32,0x6D,0x34,0x66,0x34,0xA5,0x35,0xEB,0x35,0x15,0x32,0xA7,0x2E,0xA4,
+	0x2E,0xDE,0x2F,0x39,0x30,0xAC,0x31,0x78,0x33,0x6C,0x33,0x98,0x33,0x4E,0x1C,0xD7,
+	0x31,0x00,0x4E,0x45,0x58,0x54,0x20,0x57,0x49,0x54,0x48,0x4F,0x55,0x54,0x20,0x46,
+	0x4F,0x52,0x00,0x53,0x59,0x4E,0x54,0x41,0x58,0x20,0x45,0x52,0x52,0x4F,0x52,0x00,
+	0x52,0xFA,0x00,0x15,0x4E,0x20,0x00,0x60,0x47,0x4F,0x53,0x55,0x42,0x00,0x0A,0x00,
+	0xF4,0x17,0x4F,0x46,0x20,0x44,0x41,0x54,0x41,0x00,0x49,0x4C,0x4C,0x45,0x47,0x41,
+	0x4C,0x20,0x46,0x55,0x4E,0x43,0x54,0x49,0x4F,0x4E,0x20,0x43,0x41,0x4C,0x4C,0x00,
+	0x4F,0x56,0x45,0x52,0x46,0x4C,0x4F,0x57,0x2B,0x00,0xA0,0x4D,0x45,0x4D,0x4F,0x52,
+	0x59,0x00,0x55,0x4E,0x44,0x80,0x02,0xF3,0x0A,0x45,0x44,0x20,0x4C,0x49,0x4E,0x45,
+	0x20,0x4E,0x55,0x4D,0x42,0x45,0x52,0x00,0x53,0x55,0x42,0x53,0x43,0x52,0x49,0x50,
+	0x54,0x20,0x2E,0x00,0xF0,0x01,0x52,0x41,0x4E,0x47,0x45,0x00,0x52,0x45,0x44,0x49,
+	0x4D,0x45,0x4E,0x53,0x49,0x4F,0x31,0x00,0xA0,0x41,0x52,0x52,0x41,0x59,0x00,0x44,
+	0x49,0x56,0x49,0x11,0x00,0x85,0x20,0x42,0x59,0x20,0x5A,0x45,0x52,0x4F,0x7F,0x00,
+	0xF4,0x05,0x44,0x49,0x52,0x45,0x43,0x54,0x00,0x54,0x59,0x50,0x45,0x20,0x4D,0x49,
+	0x53,0x4D,0x41,0x54,0x43,0x48,0x7D,0x00,0x11,0x53,0x7B,0x01,0x20,0x20,0x53,0x7B,
+	0x01,0x13,0x00,0x0D,0x00,0x84,0x54,0x4F,0x4F,0x20,0x4C,0x4F,0x4E,0x47,0x10,0x00,
+	0x71,0x46,0x4F,0x52,0x4D,0x55,0x4C,0x41,0x18,0x00,0xF7,0x07,0x43,0x4F,0x4D,0x50,
+	0x4C,0x45,0x58,0x00,0x43,0x41,0x4E,0x27,0x54,0x20,0x43,0x4F,0x4E,0x54,0x49,0x4E,
+	0x55,0x45,0xBD,0x00,0x45,0x55,0x53,0x45,0x52,0xF1,0x00,0x50,0x00,0x4E,0x4F,0x20,
+	0x52,0x17,0x02,0x00,0xB2,0x00,0x00,0x07,0x00,0x05,0x2D,0x01,0x02,0x42,0x01,0x20,
+	0x55,0x4E,0xC6,0x02,0x53,0x54,0x41,0x42,0x4C,0x45,0x12,0x00,0x40,0x4D,0x49,0x53,
+	0x53,0x74,0x00,0x81,0x4F,0x50,0x45,0x52,0x41,0x4E,0x44,0x00,0x0C,0x01,0x75,0x42,
+	0x55,0x46,0x46,0x45,0x52,0x20,0x39,0x01,0x56,0x46,0x49,0x45,0x4C,0x44,0x0F,0x00,
+	0x83,0x49,0x4E,0x54,0x45,0x52,0x4E,0x41,0x4C,0x43,0x00,0x75,0x42,0x41,0x44,0x20,
+	0x46,0x49,0x4C,0x43,0x01,0x02,0x0C,0x00,0x10,0x4F,0xC1,0x01,0x36,0x55,0x4E,0x44,
+	0x1F,0x00,0x42,0x4D,0x4F,0x44,0x45,0x1D,0x00,0x70,0x41,0x4C,0x52,0x45,0x41,0x44,
+	0x59,0x75,0x00,0x61,0x4E,0x00,0x44,0x49,0x53,0x4B,0x2F,0x00,0x72,0x4D,0x4F,0x55,
+	0x4E,0x54,0x45,0x44,0x11,0x00,0x33,0x49,0x2F,0x4F,0x5F,0x00,0x09,0x32,0x00,0xF1,
+	0x03,0x45,0x58,0x49,0x53,0x54,0x53,0x00,0x53,0x45,0x54,0x20,0x54,0x4F,0x20,0x4E,
+	0x4F,0x4E,0x2D,0x2E,0x00,0x02,0x39,0x01,0x02,0x3A,0x00,0x04,0x2B,0x00,0x09,0x4F,
+	0x00,0xF3,0x02,0x46,0x55,0x4C,0x4C,0x00,0x49,0x4E,0x50,0x55,0x54,0x20,0x50,0x41,
+	0x53,0x54,0x20,0x45,0x99,0x00,0x64,0x52,0x45,0x43,0x4F,0x52,0x44,0xBA,0x00,0x06,
+	0xCA,0x00,0x40,0x41,0x4D,0x45,0x00,0xB0,0x00,0x15,0x2D,0xC0,0x01,0x02,0xD5,0x01,
+	0xD1,0x20,0x53,0x54,0x41,0x54,0x45,0x4D,0x45,0x4E,0x54,0x20,0x49,0x4E,0x2C,0x00,
+	0x10,0x00,0xA6,0x01,0x41,0x4D,0x41,0x4E,0x59,0x0E,0x00,0x26,0x53,0x00,0x37,0x02,
+	0xA2,0x44,0x4F,0x4D,0x20,0x42,0x4C,0x4F,0x43,0x4B,0x53,0xC4,0x00,0x47,0x4C,0x49,
+	0x4E,0x4B,0x33,0x01,0x03,0x22,0x00,0x9E,0x53,0x45,0x43,0x54,0x4F,0x52,0x00,0x72,
+	0x15,0x02,0x00,0x07,0x00,0x00,0xA4,0x48,0x38,0x00,0x00,0xFA,0x58,0xFF,0xFF,0xFB,
+	0x58,0x00,0x00,0x1F,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xAC,0x1F,0x2C,0x00,0x00,0xD9,
+	0xF0,0x05,0x71,0x52,0xED,0x52,0xFC,0x52,0x39,0x12,0x94,0x53,0xBD,0x53,0xF0,0x06,
+	0x25,0x54,0x23,0x55,0x17,0x53,0x00,0x00,0x1C,0x03,0x00,0x00,0x5F,0xDF,0x0B,0x0B,
+	0x48,0x58,0x00,0x00,0x08,0x0F,0x1E,0x00,0x01,0x2F,0xFA,0x58,0x00,0x00,0x2F,0x2F,
+	0xDF,0x0B,0x00,0x00,0x1C,0x00,0xFC,0x05,0xF0,0xAA,0x00,0x4F,0x4B,0x0D,0x0A,0x00,
+	0x42,0x52,0x45,0x41,0x4B,0x00,0x21,0x04,0x00,0x39,0x7E,0x23,0xFE,0x82,0xC0,0x4E,
+	0x23,0x46,0x23,0xE5,0x69,0x60,0x7A,0xB3,0xEB,0xCA,0xAE,0x0C,0xEB,0xE7,0x01,0x0E,
+	0x00,0xE1,0xC8,0x09,0xC3,0x9A,0x0C,0xCD,0xCF,0x0C,0xC5,0xE3,0xC1,0xE7,0x7E,0x02,
+	0xC8,0x0B,0x2B,0xC3,0xBD,0x0C,0xE5,0x2A,0x26,0x0C,0x06,0x00,0x09,0x09,0x3E,0xE5,
+	0x3E,0xCA,0x95,0x6F,0x3E,0xFF,0x9C,0xDA,0xDE,0x0C,0x67,0x39,0xE1,0xD8,0x1E,0x07,
+	0xC3,0x21,0x0D,0xCD,0xFD,0x0E,0x2A,0x00,0x07,0x2B,0x36,0x00,0xC3,0x9F,0x0D,0x01,
+	0x9E,0x0D,0xC3,0x2D,0x0D,0x2A,0xFE,0x06,0x7C,0xA5,0x3C,0xCA,0x5E,0x13,0x3A,0x1B,
+	0x0C,0xB7,0x1E,0x13,0xC2,0x21,0x0D,0xC3,0x5E,0x13,0x2A,0x04,0x0C,0x22,0xFE,0x06,
+	0x1E,0x02,0x01,0x1E,0x0B,0x01,0x1E,0x01,0x01,0x1E,0x0A,0x01,0x1E,0x12,0x01,0x1E,
+	0x14,0x2A,0xFE,0x06,0x22,0x13,0x0C,0x22,0x15,0x0C,0x01,0x33,0x0D,0x2A,0x11,0x0C,
+	0xC3,0x6A,0x0F,0xC1,0x7B,0x4B,0x32,0xED,0x06,0x2A,0x0F,0x0C,0x22,0x17,0x0C,0xEB,
+	0x2A,0x13,0x0C,0x4B,0x00,0xF0,0x4D,0x50,0x0D,0x22,0x1E,0x0C,0xEB,0x22,0x20,0x0C,
+	0x2A,0x19,0x0C,0x7C,0xB5,0xEB,0x21,0x1B,0x0C,0xCA,0x65,0x0D,0xA6,0xC2,0x65,0x0D,
+	0x35,0xEB,0xC3,0x53,0x12,0xAF,0x77,0x59,0x32,0xFB,0x06,0xCD,0x5F,0x18,0x21,0xDE,
+	0x03,0x7B,0xFE,0x47,0xD2,0x81,0x0D,0xFE,0x31,0xD2,0x83,0x0D,0xFE,0x18,0xDA,0x86,
+	0x0D,0x3E,0x2F,0xD6,0x1A,0x5F,0xCD,0x68,0x16,0x1D,0x23,0xC2,0x86,0x0D,0xE5,0x2A,
+	0x13,0x0C,0xE3,0xCD,0xBF,0x22,0xE1,0x7C,0xA5,0x3C,0xC4,0xC6,0x37,0x3E,0xC1,0xCD,
+	0x25,0x54,0xAF,0x3B,0x00,0x20,0x96,0x45,0x3E,0x00,0xF0,0xFF,0x37,0x8B,0x0C,0xCD,
+	0x58,0x56,0x3A,0xED,0x06,0xD6,0x02,0xCC,0x5E,0x2B,0x21,0xFF,0xFF,0x22,0xFE,0x06,
+	0x3A,0xEE,0x06,0xB7,0xCA,0x01,0x0E,0x2A,0x0B,0x0C,0xE5,0xCD,0xCE,0x37,0xD1,0xD5,
+	0xCD,0xDF,0x0E,0x3E,0x2A,0xDA,0xDA,0x0D,0x3E,0x20,0xDF,0xCD,0x6A,0x51,0xD1,0xD2,
+	0xE9,0x0D,0xAF,0x32,0xEE,0x06,0xC3,0x9F,0x0D,0x2A,0x0D,0x0C,0x19,0xDA,0xE2,0x0D,
+	0xD5,0x11,0xF9,0xFF,0xE7,0xD1,0xD2,0xE2,0x0D,0x22,0x0B,0x0C,0xF6,0xFF,0xC3,0x3B,
+	0x2D,0xCD,0x6A,0x51,0xDA,0xBA,0x0D,0xD7,0x3C,0x3D,0xCA,0xBA,0x0D,0xF5,0xCD,0x82,
+	0x15,0xCD,0xA8,0x11,0x7E,0xFE,0x20,0xCC,0x66,0x31,0xD5,0xCD,0x8C,0x0F,0xD1,0xF1,
+	0x22,0x0F,0x0C,0xD2,0x9F,0x47,0xD5,0xC5,0xD7,0xB7,0xF5,0xEB,0x22,0x15,0x0C,0xEB,
+	0xCD,0xDF,0x0E,0xDA,0x3C,0x0E,0xF1,0xF5,0xCA,0x46,0x16,0xB7,0xC5,0xF5,0xE5,0xCD,
+	0x90,0x2E,0xE1,0xF1,0xC1,0xC5,0xDC,0xA2,0x28,0xD1,0xF1,0xD5,0xCA,0x7B,0x0E,0xD1,
+	0x2A,0x22,0x0C,0xE3,0xC1,0xE5,0x09,0xE5,0xCD,0xB7,0x0C,0xE1,0x22,0x22,0x0C,0xEB,
+	0x74,0xC1,0xD1,0xE5,0x23,0x23,0x73,0x23,0x72,0x23,0x11,0x89,0x09,0x0B,0x0B,0x0B,
+	0x0B,0x1A,0x77,0x23,0x13,0x0B,0x79,0xB0,0xC2,0x71,0x0E,0xD1,0xCD,0x9A,0x0E,0x2A,
+	0x64,0x09,0x22,0x1C,0x0C,0xCD,0x2D,0x0F,0xE5,0x2A,0x1C,0x0C,0x22,0x64,0x09,0xCD,
+	0xD2,0x40,0xE1,0xC3,0xBA,0x0D,0x2A,0x00,0x07,0xEB,0x62,0x6B,0x7E,0x23,0xB6,0xC8,
+	0x23,0x23,0x23,0x7E,0xB7,0xCA,0xB9,0x0E,0xFE,0x20,0xD2,0xA2,0x0E,0xFE,0x0B,0xDA,
+	0xA2,0x0E,0xCD,0x93,0x12,0xD7,0xC3,0xA4,0x0E,0x23,0xEB,0x73,0x23,0x72,0xC3,0x9A,
+	0x0E,0x11,0x00,0x00,0xD5,0xCA,0xD2,0x0E,0xD1,0xCD,0x77,0x15,0xD5,0xCA,0xDB,0x0E,
+	0xCF,0xF3,0x11,0xFA,0xFF,0xC4,0x77,0x15,0xC2,0x10,0x0D,0xEB,0xD1,0xE3,0xE5,0x2A,
+	0x00,0x07,0x44,0x4D,0x7E,0x23,0xB6,0x2B,0xC8,0x23,0x23,0x7E,0x23,0x66,0x6F,0xE7,
+	0x60,0x69,0x07,0x00,0xF0,0x28,0x3F,0xC8,0x3F,0xD0,0xC3,0xE2,0x0E,0x3A,0x88,0x09,
+	0x47,0x21,0x68,0x09,0xAF,0x04,0x5E,0x23,0x56,0x23,0x12,0x05,0xC2,0x06,0x0F,0xCD,
+	0xBC,0x40,0xCD,0x90,0x40,0xAF,0xC3,0x1D,0x0F,0xC0,0xCD,0xBC,0x40,0x2A,0x00,0x07,
+	0xCD,0xC1,0x13,0x32,0x0A,0x0C,0x77,0x23,0x77,0x23,0x22,0x22,0x0C,0x47,0x02,0xF0,
+	0x08,0x22,0x08,0x0C,0x3E,0x1A,0x21,0x2D,0x0C,0x36,0x04,0x23,0x3D,0xC2,0x39,0x0F,
+	0x32,0x1B,0x0C,0x6F,0x67,0x22,0x19,0x0C,0xFB,0x01,0xF0,0xA0,0xDB,0x0B,0x22,0x00,
+	0x0C,0xAF,0x77,0x2B,0x77,0x2B,0x77,0xCD,0x3C,0x13,0x2A,0x22,0x0C,0x22,0x24,0x0C,
+	0x22,0x26,0x0C,0xC1,0x2A,0xFC,0x06,0x22,0x11,0x0C,0xF9,0x21,0xDF,0x0B,0x22,0xDD,
+	0x0B,0xCD,0x25,0x54,0xCD,0x04,0x19,0xAF,0x67,0x6F,0x32,0x06,0x0C,0xE5,0xC5,0x2A,
+	0x08,0x0C,0xC9,0x3E,0x3F,0xDF,0x3E,0x20,0xDF,0xC3,0x6A,0x51,0xAF,0x32,0xCE,0x0B,
+	0x32,0xCD,0x0B,0x01,0x3B,0x01,0x11,0x89,0x09,0x7E,0xFE,0x22,0xCA,0x4D,0x11,0xFE,
+	0x20,0xCA,0x23,0x11,0xB7,0xCA,0x56,0x11,0x3A,0xCD,0x0B,0xB7,0x7E,0xC2,0x23,0x11,
+	0xFE,0x3F,0x3E,0x91,0xCA,0x23,0x11,0xD5,0xC5,0x11,0x95,0x03,0xCD,0x76,0x11,0xCD,
+	0x66,0x15,0xDA,0x6A,0x10,0xE5,0x21,0x3F,0x01,0xD6,0x41,0x87,0x4F,0x06,0x00,0x09,
+	0x5E,0x23,0x56,0xE1,0x23,0xE5,0xCD,0x76,0x11,0x4F,0x1A,0xE6,0x7F,0xCA,0x81,0x11,
+	0xB9,0x23,0xC2,0x06,0x10,0x1A,0x13,0xB7,0xF2,0xD6,0x0F,0xF1,0x1A,0xB7,0xFA,0x11,
+	0x10,0xC1,0xD1,0xF6,0x80,0xF5,0x3E,0xFF,0xCD,0x6B,0x11,0x6F,0x00,0x80,0xF1,0xCD,
+	0x6B,0x11,0xC3,0x99,0x0F,0xE1,0x22,0x00,0xF0,0x2B,0x07,0x10,0x13,0xC3,0xD5,0x0F,
+	0x2B,0xF5,0xFE,0xA2,0xCA,0x43,0x10,0x01,0x43,0x10,0xC5,0xFE,0xAB,0xC8,0xFE,0xAC,
+	0xC8,0xFE,0xAA,0xC8,0xFE,0xA7,0xC8,0xFE,0xA9,0xC8,0xFE,0xD6,0xC8,0xFE,0x8A,0xC8,
+	0xFE,0x93,0xC8,0xFE,0x9F,0xC8,0xFE,0x89,0xC8,0xFE,0xCF,0xC8,0xFE,0x8D,0xC8,0xF1,
+	0xAF,0xC2,0x3E,0x01,0x49,0x00,0xF1,0x03,0xFE,0x7E,0xC1,0xD1,0xFE,0xA2,0xC2,0x57,
+	0x10,0xF5,0xCD,0x69,0x11,0xF1,0xFE,0xDB,0xC2,0xF3,0x0A,0x00,0xF2,0x23,0x3E,0x8F,
+	0xCD,0x6B,0x11,0xF1,0xF5,0xC3,0x4F,0x11,0x7E,0xFE,0x2E,0xCA,0x7A,0x10,0xFE,0x3A,
+	0xD2,0x10,0x11,0xFE,0x30,0xDA,0x10,0x11,0x3A,0xCE,0x0B,0xB7,0x7E,0xC1,0xD1,0xFA,
+	0x23,0x11,0xCA,0xA6,0x10,0xFE,0x2E,0xCA,0x23,0x11,0x3E,0x0E,0xCD,0x6B,0x11,0xD5,
+	0x84,0x02,0x82,0xE3,0xEB,0x7D,0xCD,0x6B,0x11,0x7C,0xE1,0xA0,0x00,0xC0,0xD5,0xC5,
+	0x7E,0xCD,0x6E,0x36,0xCD,0xA8,0x11,0xC1,0xD1,0xE5,0x82,0x10,0xA0,0x02,0xC2,0xD2,
+	0x10,0x2A,0x55,0x0C,0x7C,0xB7,0x3E,0x0A,0x00,0xF0,0x13,0x7D,0x65,0x2E,0x0F,0xFE,
+	0x0A,0xD2,0x9A,0x10,0xC6,0x11,0xC3,0x9F,0x10,0xF5,0x0F,0xC6,0x1B,0xCD,0x6B,0x11,
+	0x21,0x55,0x0C,0xF7,0xDA,0xE3,0x10,0x21,0x51,0x0C,0xF1,0xF5,0x7E,0x84,0x00,0xF0,
+	0x0B,0x23,0x3D,0xC2,0xE4,0x10,0xE1,0xC3,0x99,0x0F,0xFE,0x26,0xC2,0x23,0x11,0xE5,
+	0xD7,0xFE,0x48,0xE1,0x3E,0x0B,0xC2,0x04,0x11,0x3E,0x0C,0x76,0x00,0xC0,0xC5,0xCD,
+	0x13,0x1D,0xC1,0xC3,0x98,0x10,0x11,0x94,0x03,0x13,0x3A,0x01,0xD0,0x8A,0x11,0xBE,
+	0x13,0x1A,0xC2,0x13,0x11,0xC3,0x9C,0x11,0x23,0xF5,0x3F,0x00,0xF0,0x18,0xD6,0x3A,
+	0xCA,0x35,0x11,0xFE,0x4A,0xC2,0x3B,0x11,0x3E,0x01,0x32,0xCD,0x0B,0x32,0xCE,0x0B,
+	0xD6,0x55,0xC2,0x99,0x0F,0xF5,0x7E,0xB7,0xE3,0x7C,0xE1,0xCA,0x56,0x11,0xBE,0xCA,
+	0x23,0x11,0xF5,0x7E,0x23,0xB0,0x00,0xF0,0x09,0x41,0x11,0x21,0x40,0x01,0x7D,0x91,
+	0x4F,0x7C,0x98,0x47,0x21,0x88,0x09,0xAF,0x12,0x13,0x12,0x13,0x12,0xC9,0x3E,0x3A,
+	0x12,0xF8,0x02,0xF0,0x2F,0xC0,0x1E,0x17,0xC3,0x21,0x0D,0x7E,0xFE,0x61,0xD8,0xFE,
+	0x7B,0xD0,0xE6,0x5F,0x77,0xC9,0xE1,0x2B,0x3D,0x32,0xCE,0x0B,0xC3,0x4A,0x10,0x7E,
+	0xFE,0x20,0xD2,0x9C,0x11,0xFE,0x09,0xCA,0x9C,0x11,0xFE,0x0A,0xCA,0x9C,0x11,0x3E,
+	0x20,0xF5,0x3A,0xCE,0x0B,0x3C,0xCA,0x45,0x10,0x3D,0xC3,0x45,0x10,0x2B,0x7E,0xFE,
+	0x20,0xCA,0xA8,0x1F,0x00,0x10,0xA8,0x1F,0x00,0xF2,0x5C,0xA8,0x11,0x23,0xC9,0x3E,
+	0x64,0x32,0x06,0x0C,0xCD,0x8A,0x16,0xE3,0xCD,0x96,0x0C,0xD1,0xC2,0xD0,0x11,0x09,
+	0xF9,0x22,0x11,0x0C,0xEB,0x0E,0x08,0xCD,0xC6,0x0C,0xE5,0xCD,0x66,0x16,0xE3,0xE5,
+	0x2A,0xFE,0x06,0xE3,0xCF,0xCE,0xF7,0xCA,0x95,0x32,0xD2,0x95,0x32,0xF5,0xCD,0xE4,
+	0x1A,0xF1,0xE5,0xF2,0x08,0x12,0xCD,0x1C,0x32,0xE3,0x11,0x01,0x00,0x7E,0xFE,0xD1,
+	0xCC,0x0C,0x27,0xD5,0xE5,0xEB,0xCD,0x3A,0x31,0xC3,0x29,0x12,0xCD,0x50,0x32,0xCD,
+	0x5C,0x31,0xE1,0xC5,0xD5,0x01,0x00,0x81,0x51,0x5A,0x7E,0xFE,0xD1,0x3E,0x01,0xC2,
+	0x2A,0x12,0xCD,0xE5,0x1A,0xE5,0x1A,0x00,0xF0,0x0D,0xEF,0xE1,0xC5,0xD5,0x4F,0xF7,
+	0x47,0xC5,0xE5,0x2A,0x08,0x0C,0xE3,0x06,0x82,0xC5,0x33,0xCD,0xFC,0x52,0x22,0x0F,
+	0x0C,0xEB,0x21,0x00,0x00,0x39,0x77,0x00,0x71,0x7E,0xFE,0x3A,0xCA,0x74,0x12,0xB7,
+	0x42,0x12,0xA0,0x23,0xB6,0xCA,0xF5,0x0C,0x23,0x5E,0x23,0x56,0xEB,0xA1,0x04,0xF1,
+	0x21,0x4F,0x0C,0xB7,0xCA,0x73,0x12,0xD5,0x3E,0x5B,0xDF,0xCD,0xCE,0x37,0x3E,0x5D,
+	0xDF,0xD1,0xEB,0xD7,0x11,0x39,0x12,0xD5,0xC8,0xD6,0x81,0xDA,0x8A,0x16,0xFE,0x4C,
+	0xD2,0x10,0x26,0x07,0x4F,0x06,0x00,0xEB,0x21,0x3B,0x00,0x09,0x4E,0x23,0x46,0xC5,
+	0xEB,0x82,0x12,0xF0,0x57,0xFE,0x20,0xCA,0x92,0x12,0xD2,0x05,0x13,0xFE,0x0B,0xDA,
+	0xFB,0x12,0xFE,0x1E,0xC2,0xAE,0x12,0x3A,0xD1,0x0B,0xB7,0xC9,0xFE,0x10,0xC2,0xB9,
+	0x12,0x2A,0xCF,0x0B,0xC3,0x93,0x12,0xF5,0x23,0x32,0xD1,0x0B,0xD6,0x1C,0xD2,0xE0,
+	0x12,0xD6,0xF5,0xD2,0xCF,0x12,0xFE,0xFE,0xC2,0xDF,0x12,0x7E,0x23,0xE5,0x6F,0x26,
+	0x00,0x22,0xD3,0x0B,0x3E,0x02,0x32,0xD2,0x0B,0xE1,0xC3,0xF2,0x12,0xAF,0x3C,0x07,
+	0x32,0xD2,0x0B,0xD5,0xC5,0x11,0xD3,0x0B,0xEB,0x47,0xCD,0x75,0x31,0xEB,0xC1,0xD1,
+	0x22,0xCF,0x0B,0xF1,0x21,0x0B,0x13,0xB7,0xC9,0xFE,0x0B,0x61,0x00,0xF1,0x12,0x09,
+	0xD2,0x92,0x12,0xFE,0x30,0x3F,0x3C,0x3D,0xC9,0x1E,0x10,0x3A,0xD1,0x0B,0xFE,0x0F,
+	0xD2,0x2D,0x13,0xFE,0x0D,0xDA,0x2D,0x13,0x2A,0xD3,0x0B,0xC2,0x27,0x13,0x23,0x23,
+	0xC9,0x00,0xF1,0x07,0xCD,0x4A,0x34,0xC3,0xB3,0x12,0x21,0xD3,0x0B,0x3A,0xD2,0x0B,
+	0x32,0xCC,0x0B,0xCD,0x96,0x31,0xC3,0xB3,0x12,0xEB,0x10,0x04,0xE0,0x28,0x0C,0xEB,
+	0xC9,0xC0,0x3C,0xC3,0x51,0x13,0xC0,0xF5,0xCC,0xBC,0x40,0x31,0x05,0x02,0xE9,0x03,
+	0xF0,0x03,0x21,0xF6,0xFF,0xC1,0x2A,0xFE,0x06,0xE5,0xF5,0x7D,0xA4,0x3C,0xCA,0x72,
+	0x13,0x22,0x1E,0x0C,0x33,0x06,0x21,0x20,0x0C,0xD0,0x05,0xF0,0x22,0x25,0x54,0xCD,
+	0x5F,0x18,0xF1,0x21,0x90,0x0C,0xC2,0x93,0x0D,0xC3,0x9E,0x0D,0x3E,0x0F,0xF5,0xD6,
+	0x03,0xC2,0x91,0x13,0x32,0xFB,0x06,0x3E,0x5E,0xDF,0xF1,0xC6,0x40,0xDF,0xC3,0x67,
+	0x18,0x2A,0x20,0x0C,0x7C,0xB5,0x1E,0x11,0xCA,0x21,0x0D,0xEB,0x2A,0x1E,0x9C,0x06,
+	0xF0,0x40,0xEB,0xC9,0xCD,0x1A,0x27,0xC0,0x3A,0xF8,0x06,0x47,0x7B,0x3C,0xB8,0xD2,
+	0x72,0x15,0x32,0x26,0x00,0xC9,0x3E,0xAF,0x32,0x4F,0x0C,0xC9,0xCD,0x60,0x1E,0xD5,
+	0xE5,0x21,0x47,0x0C,0xCD,0x71,0x31,0x2A,0x24,0x0C,0xE3,0xF7,0xF5,0xCF,0x2C,0xCD,
+	0x60,0x1E,0xC1,0xF7,0xB8,0xC2,0x95,0x32,0xE3,0xEB,0xE5,0x2A,0x24,0x0C,0xE7,0xC2,
+	0x72,0x15,0xD1,0xE1,0xE3,0x78,0xB7,0xC2,0x91,0x14,0x7E,0xB7,0xCA,0x8A,0x14,0xE5,
+	0xD5,0xD9,0x00,0xF1,0x08,0x2A,0xFC,0x06,0xEB,0xE7,0xC1,0xE3,0xE5,0xC5,0xE1,0xE5,
+	0xD2,0x18,0x14,0x7E,0xB7,0xC2,0x5D,0x14,0xD1,0xE1,0xC1,0xC3,0x24,0x00,0x25,0x4E,
+	0x14,0x22,0x00,0xF0,0x07,0xDA,0x4E,0x14,0xEB,0xC1,0xE1,0x22,0x2A,0x0C,0xE1,0xD5,
+	0xE5,0xC5,0xD1,0x2A,0x2A,0x0C,0x4E,0x06,0x00,0xE3,0x09,0xD7,0x05,0x32,0xEB,0xD1,
+	0x4E,0x09,0x00,0x75,0xE1,0xEB,0xC3,0x91,0x14,0xD1,0xE1,0x19,0x00,0x95,0xE1,0xC3,
+	0x91,0x14,0xE1,0xD1,0xC1,0xD5,0xE5,0x45,0x00,0x20,0xEB,0xC1,0x3E,0x00,0x23,0xD2,
+	0x7A,0x62,0x00,0x00,0x2B,0x00,0x17,0xD1,0x3C,0x00,0xD1,0xEB,0x7E,0xB7,0xC2,0x60,
+	0x14,0xEB,0xD5,0xCD,0x71,0x31,0xE1,0x11,0xCB,0x00,0xF0,0x09,0xE1,0xC9,0x06,0xFF,
+	0xD7,0x78,0xFE,0xAF,0x32,0x08,0x0C,0x3E,0x01,0x32,0x06,0x0C,0xC3,0x60,0x1E,0x32,
+	0x06,0x0C,0x44,0x4D,0x47,0x06,0xF0,0x2B,0x0B,0x3A,0x08,0x0C,0xB7,0xC2,0xED,0x14,
+	0x19,0xE5,0x2B,0x7B,0xB2,0xCA,0xCE,0x14,0x36,0x00,0x1B,0xC3,0xC2,0x14,0xE1,0xEB,
+	0x2A,0x26,0x0C,0xE7,0x1A,0x02,0x13,0x03,0xC2,0xD3,0x14,0x0B,0x60,0x69,0x22,0x26,
+	0x0C,0xCD,0x8C,0x23,0xE1,0x7E,0xFE,0x2C,0xC0,0xD7,0xC3,0xA3,0x14,0xF5,0xEB,0x19,
+	0xEB,0x4E,0x28,0x08,0xF0,0x0E,0x23,0x06,0xD2,0xFA,0x06,0x15,0x78,0xCD,0xB4,0x28,
+	0xCD,0xB4,0x28,0xC3,0x13,0x15,0x0E,0x04,0xCD,0x0F,0x54,0xB8,0xC2,0x06,0x15,0x0D,
+	0xC2,0x08,0x15,0x31,0x03,0xF0,0x09,0xE7,0xCA,0x29,0x15,0xF1,0xF5,0x7E,0xF4,0x19,
+	0x54,0xFC,0x0F,0x54,0x77,0x23,0xC3,0x17,0x15,0xF1,0xE1,0xC9,0x1E,0x03,0x01,0x1F,
+	0x08,0xF0,0x17,0x04,0x01,0x1E,0x08,0xCD,0x65,0x15,0x01,0x10,0x0D,0xC5,0xD8,0xD6,
+	0x41,0x4F,0x47,0xD7,0xFE,0xF3,0xC2,0x52,0x15,0xD7,0xCD,0x65,0x15,0xD8,0xD6,0x41,
+	0x47,0xD7,0x78,0x91,0xD8,0x3C,0xE3,0x21,0x2D,0x90,0x08,0xF1,0x08,0x73,0x23,0x3D,
+	0xC2,0x5D,0x15,0xE1,0xC9,0x7E,0xFE,0x41,0xD8,0xFE,0x5B,0x3F,0xC9,0xD7,0xCD,0x0D,
+	0x27,0xF0,0x1E,0x05,0x01,0x04,0xF1,0x07,0x2E,0xEB,0x2A,0x15,0x0C,0xEB,0xCA,0x92,
+	0x12,0x2B,0xD7,0xFE,0x0E,0xCA,0x8B,0x15,0xFE,0x0D,0xEB,0x2A,0xD3,0x0B,0x11,0x00,
+	0xF0,0x4F,0x11,0x00,0x00,0xD7,0xD0,0xE5,0xF5,0x21,0x98,0x19,0xE7,0xDA,0x10,0x0D,
+	0x62,0x6B,0x19,0x29,0x19,0x29,0xF1,0xD6,0x30,0x5F,0x16,0x00,0x19,0xEB,0xE1,0xC3,
+	0x97,0x15,0xCA,0x31,0x0F,0xCD,0x6E,0x15,0x2B,0xD7,0xC0,0xE5,0x2A,0xDB,0x0B,0x7D,
+	0x93,0x5F,0x7C,0x9A,0x57,0xDA,0xDE,0x0C,0x2A,0x22,0x0C,0x01,0x28,0x00,0x09,0xE7,
+	0xD2,0xDE,0x0C,0xEB,0x22,0xFC,0x06,0xE1,0xC3,0x31,0x0F,0xC2,0xE8,0x15,0xF5,0xCD,
+	0xBC,0x40,0xF1,0xC3,0x2D,0x0F,0xFE,0x0E,0xCA,0xF2,0x15,0xFE,0x0D,0xC2,0x36,0x43,
+	0xE3,0x06,0xF1,0x03,0x31,0x0F,0x01,0x39,0x12,0xC3,0x15,0x16,0x0E,0x03,0xCD,0xC6,
+	0x0C,0xCD,0x82,0x15,0xC1,0xE5,0x2D,0x04,0xC0,0x3E,0x8D,0xF5,0x33,0xC5,0xC3,0x19,
+	0x16,0xC5,0xCD,0x82,0x15,0x0C,0x03,0xC0,0x0D,0xEB,0xC8,0xEB,0xE5,0x2A,0xCF,0x0B,
+	0xE3,0xCD,0x68,0x16,0x21,0x00,0xF0,0x15,0xE7,0xE1,0x23,0xDC,0xE2,0x0E,0xD4,0xDF,
+	0x0E,0xD2,0x46,0x16,0x0B,0x3E,0x0D,0x32,0x0A,0x0C,0xE1,0xCD,0x87,0x2E,0x60,0x69,
+	0xC9,0x1E,0x08,0xC3,0x21,0x0D,0xC0,0x16,0xFF,0xCD,0x96,0x0C,0x85,0x04,0xF0,0x26,
+	0xFE,0x8D,0x1E,0x03,0xC2,0x21,0x0D,0xE1,0x22,0xFE,0x06,0x21,0x39,0x12,0xE3,0x3E,
+	0xE1,0x01,0x3A,0x0E,0x00,0x06,0x00,0x79,0x48,0x47,0x2B,0xD7,0xB7,0xC8,0xB8,0xC8,
+	0x23,0xFE,0x22,0xCA,0x6C,0x16,0x3C,0xCA,0x70,0x16,0xD6,0x8C,0xC2,0x6F,0x16,0xB8,
+	0x8A,0x57,0xC3,0x6F,0x16,0xC4,0x02,0xE1,0xF7,0xF5,0xCF,0xF0,0xEB,0x22,0x08,0x0C,
+	0xEB,0xC3,0x9D,0x16,0xD5,0xF7,0xB3,0x04,0xF2,0x01,0xE3,0xC6,0x03,0xCD,0x98,0x21,
+	0xCD,0xA3,0x31,0xE5,0xC2,0xE6,0x16,0x2A,0x55,0x0C,0x50,0x02,0xF0,0x17,0x00,0x07,
+	0xE7,0xD2,0xD0,0x16,0x2A,0xFC,0x06,0xE7,0xD1,0xD2,0xD8,0x16,0x2A,0x22,0x0C,0xE7,
+	0xCA,0xCF,0x16,0xD2,0xD8,0x16,0x3E,0xD1,0xCD,0x68,0x24,0xEB,0xCD,0x1B,0x22,0xCD,
+	0x68,0x24,0xE1,0xE5,0x44,0x02,0xF0,0x1B,0xCD,0x8C,0x22,0xE1,0xC9,0xCD,0x71,0x31,
+	0xD1,0xE1,0xC9,0xFE,0xA8,0xC2,0x17,0x17,0xD7,0xCF,0x89,0xCD,0x82,0x15,0x7A,0xB3,
+	0xCA,0x05,0x17,0xCD,0xDD,0x0E,0x50,0x59,0xE1,0xD2,0x46,0x16,0xEB,0x22,0x19,0x0C,
+	0xEB,0xD8,0x0D,0x0A,0xF2,0x38,0xC8,0x3A,0xED,0x06,0x5F,0xC3,0x2A,0x0D,0xCD,0x1A,
+	0x27,0x7E,0x47,0xFE,0x8D,0xCA,0x24,0x17,0xCF,0x89,0x2B,0x4B,0x0D,0x78,0xCA,0x7A,
+	0x12,0xCD,0x83,0x15,0xFE,0x2C,0xC0,0xC3,0x25,0x17,0x11,0x1B,0x0C,0x1A,0xB7,0xCA,
+	0x1F,0x0D,0x3C,0x32,0xED,0x06,0x12,0x7E,0xFE,0x83,0xCA,0x53,0x17,0xCD,0x82,0x15,
+	0xC0,0x7A,0xB3,0xC2,0x19,0x16,0x3C,0xC3,0x55,0x17,0xD7,0xC0,0x2A,0x19,0x0A,0x00,
+	0xB3,0x03,0x70,0xC0,0x7E,0xB7,0xC2,0x6A,0x17,0x23,0x01,0x00,0x30,0xC3,0x66,0x16,
+	0xC0,0x03,0xF0,0x0F,0xB7,0xCA,0x72,0x15,0xC3,0x21,0x0D,0x11,0x0A,0x00,0xD5,0xCA,
+	0x99,0x17,0xCD,0x77,0x15,0xEB,0xE3,0xCA,0x9A,0x17,0xEB,0xCF,0x2C,0xEB,0x2A,0x0D,
+	0x0C,0xEB,0x13,0x00,0x11,0x82,0xBE,0x08,0xF0,0x1D,0x7C,0xB5,0xCA,0x72,0x15,0x22,
+	0x0D,0x0C,0x32,0xEE,0x06,0xE1,0x22,0x0B,0x0C,0xC1,0xC3,0xBA,0x0D,0xCD,0xE4,0x1A,
+	0x7E,0xFE,0x2C,0xCC,0x92,0x12,0xFE,0x89,0xCA,0xBE,0x17,0xCF,0xCF,0x2B,0xE5,0xCD,
+	0x30,0x31,0xE1,0xCA,0xD4,0x17,0x43,0x02,0xF0,0x6C,0x16,0x16,0xFE,0x0D,0xCA,0x16,
+	0x16,0xC3,0x79,0x12,0x16,0x01,0xCD,0x66,0x16,0xB7,0xC8,0xD7,0xFE,0xA2,0xC2,0xD6,
+	0x17,0x15,0xC2,0xD6,0x17,0xC3,0xC6,0x17,0x3E,0x01,0x32,0xF1,0x06,0xC3,0xF5,0x17,
+	0x0E,0x02,0xCD,0x11,0x47,0x2B,0xD7,0xCC,0x67,0x18,0xCA,0x04,0x19,0xFE,0xD9,0xCA,
+	0xAF,0x29,0xFE,0xD0,0xCA,0xC6,0x18,0xFE,0xD4,0xCA,0xC6,0x18,0xE5,0xFE,0x2C,0xCA,
+	0x8F,0x18,0xFE,0x3B,0xCA,0xFF,0x18,0xC1,0xCD,0xE4,0x1A,0xE5,0xF7,0xCA,0x58,0x18,
+	0xCD,0xDC,0x37,0xCD,0x3D,0x22,0x2A,0x64,0x09,0x7C,0xB5,0xC2,0x51,0x18,0x2A,0x55,
+	0x0C,0x3A,0xF1,0x06,0xB7,0xCA,0x45,0x18,0x3A,0xF0,0x06,0x86,0xE5,0x21,0xF6,0x06,
+	0xBE,0xE1,0xC3,0x4E,0x18,0x93,0x04,0xF0,0x0F,0x3A,0x27,0x00,0x86,0xB8,0xD4,0x67,
+	0x18,0xCD,0xC2,0x22,0x3E,0x20,0xDF,0xB7,0xCC,0xC2,0x22,0xE1,0xC3,0xF5,0x17,0x3A,
+	0x27,0x00,0xB7,0xC8,0xC3,0x67,0x18,0x36,0x00,0xA1,0xC2,0x28,0x54,0x3E,0x0D,0xDF,
+	0x3E,0x0A,0xDF,0xE5,0x4F,0x00,0xF1,0x06,0xE1,0xCA,0x80,0x18,0xAF,0xC9,0x3A,0x26,
+	0x00,0x3D,0x32,0x27,0x00,0xC8,0xF5,0xAF,0xDF,0xF1,0xC3,0x83,0x18,0x1A,0x00,0x71,
+	0x01,0x09,0x00,0x09,0x7E,0xC2,0xBD,0x35,0x00,0x20,0xCA,0xAF,0x6B,0x00,0x30,0xE5,
+	0x21,0xF7,0x6A,0x00,0x41,0xB7,0x18,0x3A,0xF9,0x6A,0x00,0x00,0x69,0x00,0xF8,0x0A,
+	0xD2,0xFF,0x18,0xD6,0x0E,0xD2,0xBD,0x18,0x2F,0xC3,0xF6,0x18,0xF5,0xCD,0x19,0x27,
+	0xCF,0x29,0x2B,0xF1,0xD6,0xD4,0xE5,0xCA,0xF1,0x45,0x00,0x12,0xF1,0x45,0x00,0x10,
+	0xEE,0x45,0x00,0xF0,0x28,0xC3,0xF1,0x18,0x3A,0x27,0x00,0x2F,0x83,0xD2,0xFF,0x18,
+	0x3C,0x47,0x3E,0x20,0xDF,0x05,0xC2,0xFA,0x18,0xE1,0xD7,0xC3,0xFA,0x17,0xAF,0x32,
+	0xF1,0x06,0xE5,0x67,0x6F,0x22,0x64,0x09,0xE1,0xC9,0xCF,0x85,0xFE,0x23,0xCA,0x50,
+	0x4C,0xCD,0x6E,0x19,0xCD,0x60,0x1E,0xCD,0x93,0x32,0xD5,0xE5,0x47,0x0B,0xF0,0x09,
+	0xC1,0xDA,0x5B,0x13,0xC5,0xD5,0x06,0x00,0xCD,0x40,0x22,0xE1,0xAF,0xC3,0xA1,0x16,
+	0x3F,0x52,0x45,0x44,0x4F,0x20,0x46,0x52,0x6F,0x12,0xF0,0x34,0x54,0x41,0x52,0x54,
+	0x0D,0x0A,0x00,0x3A,0x07,0x0C,0xB7,0xC2,0x0A,0x0D,0xC1,0x21,0x36,0x19,0xCD,0xBF,
+	0x22,0x2A,0x0F,0x0C,0xC9,0xCD,0x0F,0x47,0xE5,0x21,0xC7,0x0A,0xC3,0x91,0x19,0xFE,
+	0x23,0xCA,0x5B,0x19,0x01,0x81,0x19,0xC5,0xFE,0x22,0x3E,0x00,0x32,0xFB,0x06,0xC0,
+	0xCD,0x3E,0x22,0xCF,0x3B,0xE5,0xCD,0xC2,0x22,0xE1,0xC9,0xE5,0xCD,0x83,0x0F,0x5F,
+	0x00,0xF1,0x09,0x23,0x7E,0xB7,0x2B,0xC5,0xCA,0x65,0x16,0x36,0x2C,0xC3,0x9B,0x19,
+	0xE5,0x2A,0x28,0x0C,0xF6,0xAF,0x32,0x07,0x0C,0xE3,0x01,0xCA,0x05,0x81,0xE3,0xD5,
+	0x7E,0xFE,0x2C,0xCA,0xC9,0x19,0x65,0x00,0x98,0x3F,0x1A,0x3E,0x3F,0xDF,0xCD,0x83,
+	0x0F,0xD1,0x37,0x00,0x21,0xD5,0xEB,0xF6,0x00,0xF0,0x32,0xEB,0xC2,0x67,0x4C,0xF7,
+	0xF5,0xC2,0xF2,0x19,0xD7,0x57,0x47,0xFE,0x22,0xCA,0xE5,0x19,0x16,0x3A,0x06,0x2C,
+	0x2B,0xCD,0x41,0x22,0xF1,0xEB,0x21,0xFF,0x19,0xE3,0xD5,0xC3,0xA2,0x16,0xD7,0xF1,
+	0xF5,0x01,0xE8,0x19,0xC5,0xDA,0x6E,0x36,0xD2,0x67,0x36,0x2B,0xD7,0xCA,0x09,0x1A,
+	0xFE,0x2C,0xC2,0x49,0x19,0xE3,0x2B,0xD7,0xC2,0xA1,0x19,0xD1,0x62,0x00,0x45,0xEB,
+	0xC2,0x41,0x13,0x50,0x00,0xF0,0x0F,0x2A,0x1A,0xB6,0x21,0x2E,0x1A,0xC4,0xBF,0x22,
+	0xE1,0xC3,0x04,0x19,0x3F,0x45,0x58,0x54,0x52,0x41,0x20,0x49,0x47,0x4E,0x4F,0x52,
+	0x45,0x44,0x0D,0x0A,0x00,0x69,0x02,0x30,0xC2,0x58,0x1A,0xF4,0x07,0x52,0x1E,0x04,
+	0xCA,0x21,0x0D,0xF6,0x07,0xF0,0x0C,0x04,0x0C,0xEB,0xD7,0xFE,0x84,0xC2,0x3F,0x1A,
+	0xC3,0xC9,0x19,0x11,0x00,0x00,0xC4,0x60,0x1E,0x22,0x08,0x0C,0xCD,0x96,0x0C,0xC2,
+	0x16,0x0D,0x1F,0x04,0xF0,0x13,0xD5,0x7E,0x23,0xF5,0xD5,0x7E,0x23,0xB7,0xFA,0x96,
+	0x1A,0xCD,0x4E,0x31,0xE3,0xE5,0xCD,0x9B,0x2E,0xE1,0xCD,0x68,0x31,0xE1,0xCD,0x5F,
+	0x31,0xE5,0xCD,0xAC,0x31,0xC3,0xBF,0x1A,0x2F,0x03,0x00,0xFB,0x0D,0xA0,0xE3,0x5E,
+	0x23,0x56,0xE5,0x69,0x60,0xCD,0x78,0x33,0xF6,0x09,0xB0,0x04,0xCA,0x49,0x2F,0xEB,
+	0xE1,0x72,0x2B,0x73,0xE1,0xD5,0xB1,0x0B,0xD0,0xE3,0xCD,0xD7,0x31,0xE1,0xC1,0x90,
+	0xCD,0x5F,0x31,0xCA,0xD1,0x1A,0x6B,0x08,0x50,0x69,0x60,0xC3,0x35,0x12,0x61,0x00,
+	0xF0,0x06,0x2A,0x08,0x0C,0x7E,0xFE,0x2C,0xC2,0x39,0x12,0xD7,0xCD,0x64,0x1A,0xCF,
+	0x28,0x2B,0x16,0x00,0xD5,0x0E,0x01,0xEA,0x04,0xF0,0x5C,0x5D,0x1C,0x22,0x1C,0x0C,
+	0x2A,0x1C,0x0C,0xC1,0x7E,0x16,0x00,0xD6,0xEF,0xDA,0x14,0x1B,0xFE,0x03,0xD2,0x14,
+	0x1B,0xFE,0x01,0x17,0xAA,0xBA,0x57,0xDA,0x10,0x0D,0x22,0x02,0x0C,0xD7,0xC3,0xFA,
+	0x1A,0x7A,0xB7,0xC2,0xA4,0x1B,0x7E,0x22,0x02,0x0C,0xD6,0xF2,0xD8,0xFE,0x0C,0xD0,
+	0x5F,0x3A,0xCC,0x0B,0xD6,0x03,0xB3,0xCA,0xEF,0x23,0x21,0xAA,0x03,0x19,0x78,0x56,
+	0xBA,0xD0,0xC5,0x01,0xF3,0x1A,0xC5,0x7A,0xFE,0x7F,0xCA,0x8A,0x1B,0xFE,0x51,0xDA,
+	0x98,0x1B,0xE6,0xFE,0xFE,0x7A,0xCA,0x98,0x1B,0x21,0x55,0x0C,0xB7,0x3A,0xCC,0x0B,
+	0x3D,0x3D,0x3D,0xCA,0x23,0x21,0xCC,0x08,0x30,0xFA,0x78,0x1B,0xC7,0x00,0xB0,0xC5,
+	0xE2,0x78,0x1B,0x23,0xDA,0x6F,0x1B,0x21,0x51,0x0C,0xD5,0x00,0x10,0xC5,0x13,0x00,
+	0xF0,0x03,0xDA,0x2D,0x21,0xC6,0x03,0x4B,0x47,0xC5,0x01,0xBF,0x1B,0xC5,0x2A,0x02,
+	0x0C,0xC3,0xE7,0x1A,0x68,0x09,0xF0,0x18,0x41,0x31,0x01,0x62,0x3D,0x16,0x7F,0xC3,
+	0x83,0x1B,0xD5,0xCD,0x1C,0x32,0xD1,0xE5,0x01,0x0A,0x1E,0xC3,0x83,0x1B,0x78,0xFE,
+	0x64,0xD0,0xC5,0xD5,0x11,0x04,0x64,0x21,0xE4,0x1D,0xE5,0xF7,0xC2,0x4C,0x1B,0x07,
+	0x05,0xF1,0x02,0x01,0xB7,0x1D,0xC3,0x83,0x1B,0xC1,0x79,0x32,0xCD,0x0B,0x78,0xFE,
+	0x08,0xCA,0xF2,0x1B,0x9A,0x1B,0xD0,0xCA,0x1A,0x1C,0x57,0x78,0xFE,0x04,0xCA,0x2E,
+	0x1C,0x7A,0xFE,0x03,0xF9,0x09,0x50,0x39,0x1C,0x21,0xD4,0x03,0xF3,0x06,0xF0,0x18,
+	0x4E,0x23,0x46,0xD1,0x2A,0x55,0x0C,0xC5,0xC9,0xCD,0x7A,0x32,0xCD,0x9C,0x31,0xE1,
+	0x22,0x53,0x0C,0xE1,0x22,0x51,0x0C,0xC1,0xD1,0xCD,0x51,0x31,0xCD,0x7A,0x32,0x21,
+	0xC0,0x03,0x3A,0xCD,0x0B,0x07,0xC5,0x44,0x0C,0x10,0xC1,0x23,0x0D,0x71,0xE9,0xC5,
+	0xCD,0x9C,0x31,0xF1,0x32,0x77,0x01,0xF1,0x0B,0x00,0x1C,0xE1,0x22,0x55,0x0C,0xC3,
+	0x05,0x1C,0xCD,0x50,0x32,0xC1,0xD1,0x21,0xCA,0x03,0xC3,0x0B,0x1C,0xE1,0xCD,0x41,
+	0x31,0xCD,0x6E,0x35,0x0A,0x31,0x22,0x57,0x0C,0x20,0x00,0x73,0x33,0x1C,0xE5,0xEB,
+	0xCD,0x6E,0x32,0x1A,0x00,0xF0,0x4D,0xC3,0x37,0x30,0xD7,0x1E,0x16,0xCA,0x21,0x0D,
+	0xDA,0x6E,0x36,0xFE,0x20,0xDA,0x0D,0x13,0x3C,0xCA,0x72,0x1D,0x3D,0xCD,0x65,0x15,
+	0xD2,0x00,0x1D,0xFE,0xF2,0xCA,0x5D,0x1C,0xFE,0xF3,0xCA,0xF2,0x1C,0xFE,0x22,0xCA,
+	0x3E,0x22,0xFE,0xD5,0xCA,0xF1,0x1D,0xFE,0x26,0xCA,0x13,0x1D,0xFE,0xD7,0xC2,0xB0,
+	0x1C,0xD7,0xFE,0x28,0x3A,0xED,0x06,0xC2,0xAA,0x1C,0xCD,0xEC,0x1C,0xE5,0xCD,0x10,
+	0x27,0x21,0x02,0x07,0x19,0x7E,0xFE,0xE5,0xCD,0x7C,0x20,0xE1,0xC9,0xFE,0xD6,0xC2,
+	0xBF,0x1C,0xD7,0x28,0x0F,0xF2,0x04,0xCD,0x4A,0x34,0xE1,0xC9,0xFE,0xDC,0xC2,0xD8,
+	0x1C,0xD7,0xCF,0x28,0xCD,0x60,0x1E,0xCF,0x29,0xE5,0x34,0x05,0xF0,0x1D,0xCD,0x38,
+	0x32,0xE1,0xC9,0xFE,0xD2,0xCA,0x82,0x20,0xFE,0xDA,0xCA,0x82,0x25,0xFE,0xD8,0xCA,
+	0xC6,0x24,0xFE,0xD3,0xCA,0xF0,0x20,0xCD,0xE2,0x1A,0xCF,0x29,0xC9,0x16,0x7D,0xCD,
+	0xE7,0x1A,0x2A,0x1C,0x0C,0xE5,0xCD,0x17,0x31,0xE1,0x3A,0x09,0xF0,0x01,0xE5,0xEB,
+	0x22,0x55,0x0C,0xF7,0xC4,0x96,0x31,0xE1,0xC9,0xFE,0x26,0xC2,0x82,0x15,0x7F,0x07,
+	0xF0,0x14,0xFE,0x4F,0xCA,0x4E,0x1D,0xFE,0x48,0xC2,0x4D,0x1D,0x06,0x05,0x23,0xCD,
+	0x65,0x15,0xEB,0xD2,0x38,0x1D,0xFE,0x3A,0xD2,0x6D,0x1D,0xD6,0x30,0xDA,0x6D,0x1D,
+	0xC3,0x3F,0x1D,0xFE,0x47,0x0D,0x00,0x80,0x37,0x29,0x29,0x29,0x29,0xB5,0x6F,0x05,
+	0x99,0x02,0xF0,0x05,0xC3,0x23,0x1D,0x2B,0xD7,0xEB,0xD2,0x6D,0x1D,0xFE,0x38,0xD2,
+	0x10,0x0D,0x01,0x49,0x2F,0xC5,0x29,0xD8,0x02,0x00,0xF0,0x11,0xC1,0x06,0x00,0xD6,
+	0x30,0x4F,0x09,0xEB,0xC3,0x4E,0x1D,0xCD,0x38,0x32,0xEB,0xC9,0x23,0x7E,0xD6,0x81,
+	0x06,0x00,0x07,0x4F,0xC5,0xD7,0x79,0xFE,0x05,0xD2,0x99,0x1D,0x96,0x00,0xF0,0x1B,
+	0x2C,0xCD,0x93,0x32,0xEB,0x2A,0x55,0x0C,0xE3,0xE5,0xEB,0xCD,0x1A,0x27,0xEB,0xE3,
+	0xC3,0xAE,0x1D,0xCD,0xEC,0x1C,0xE3,0x7D,0xFE,0x0C,0xDA,0xAA,0x1D,0xFE,0x1B,0xE5,
+	0xDC,0x50,0x32,0xE1,0x11,0xFE,0x1C,0xD5,0x01,0xD3,0x25,0x0B,0x70,0x66,0x69,0xE9,
+	0xCD,0x38,0x24,0x7E,0x5B,0x02,0x80,0xD1,0xC5,0xF5,0xCD,0x3F,0x24,0xD1,0x5E,0x0C,
+	0x00,0xF0,0x75,0xE1,0x7B,0xB2,0xC8,0x7A,0xD6,0x01,0xD8,0xAF,0xBB,0x3C,0xD0,0x15,
+	0x1D,0x0A,0xBE,0x23,0x03,0xCA,0xCC,0x1D,0x3F,0xC3,0xFC,0x30,0x3C,0x8F,0xC1,0xA0,
+	0xC6,0xFF,0x9F,0xCD,0x29,0x31,0xC3,0xF3,0x1A,0x16,0x5A,0xCD,0xE7,0x1A,0xCD,0x1C,
+	0x32,0x7D,0x2F,0x6F,0x7C,0x2F,0x67,0x22,0x55,0x0C,0xC1,0xC3,0xF3,0x1A,0x3D,0x3D,
+	0x3D,0xC9,0xC5,0xCD,0x1C,0x32,0xF1,0xD1,0xFE,0x7A,0xCA,0x54,0x34,0xFE,0x7B,0xCA,
+	0xEF,0x33,0x01,0x7E,0x20,0xC5,0xFE,0x46,0xC2,0x29,0x1E,0x7B,0xB5,0x6F,0x7C,0xB2,
+	0xC9,0xFE,0x50,0xC2,0x34,0x1E,0x7B,0xA5,0x6F,0x7C,0xA2,0xC9,0xFE,0x3C,0xC2,0x3F,
+	0x1E,0x7B,0xAD,0x6F,0x7C,0xAA,0xC9,0xFE,0x32,0xC2,0x4C,0x1E,0x7B,0xAD,0x2F,0x6F,
+	0x7C,0xAA,0x2F,0xC9,0x7D,0x2F,0xA3,0x55,0x00,0xF0,0x0F,0xA2,0x2F,0xC9,0x2B,0xD7,
+	0xC8,0xCF,0x2C,0x01,0x56,0x1E,0xC5,0xF6,0xAF,0x32,0xCB,0x0B,0x46,0xCD,0x65,0x15,
+	0xDA,0x10,0x0D,0xAF,0x4F,0xD7,0xDA,0x77,0x1E,0x0C,0x00,0x60,0x82,0x1E,0x4F,0xD7,
+	0xDA,0x78,0x0B,0x00,0xF0,0x36,0xD2,0x78,0x1E,0x11,0xA9,0x1E,0xD5,0x16,0x02,0xFE,
+	0x25,0xC8,0x14,0xFE,0x24,0xC8,0x14,0xFE,0x21,0xC8,0x16,0x08,0xFE,0x23,0xC8,0x78,
+	0xD6,0x41,0xE6,0x7F,0x5F,0x16,0x00,0xE5,0x21,0x2D,0x0C,0x19,0x56,0xE1,0x2B,0xC9,
+	0x7A,0x32,0xCC,0x0B,0xD7,0x3A,0x06,0x0C,0x3D,0xCA,0x82,0x1F,0xF2,0xC3,0x1E,0x7E,
+	0xD6,0x28,0xCA,0x53,0x1F,0xD6,0x33,0xCA,0x53,0x1F,0xAF,0x4A,0x0F,0x50,0xD5,0x2A,
+	0x22,0x0C,0xEB,0xE8,0x0A,0xF0,0x2E,0xE1,0xCA,0xF7,0x1E,0x1A,0x6F,0xBC,0x13,0xC2,
+	0xE8,0x1E,0x1A,0xB9,0xC2,0xE8,0x1E,0x13,0x1A,0xB8,0xCA,0x3B,0x1F,0x3E,0x13,0x13,
+	0xE5,0x26,0x00,0x19,0xC3,0xCC,0x1E,0x57,0x5F,0xF1,0xF1,0xE3,0xC9,0x7C,0xE1,0xE3,
+	0xF5,0xD5,0x11,0xCA,0x1C,0xE7,0xCA,0xF1,0x1E,0x11,0x03,0x1D,0xE7,0xD1,0xCA,0x3E,
+	0x1F,0xF1,0xE3,0xE5,0xFF,0x02,0xA2,0xC5,0x03,0x03,0x03,0x2A,0x26,0x0C,0xE5,0x09,
+	0xC1,0xC5,0x10,0x60,0x26,0x0C,0x60,0x69,0x22,0x24,0x48,0x0A,0xB0,0x2B,0x36,0x00,
+	0xE7,0xC2,0x2C,0x1F,0xD1,0x73,0x23,0xD1,0xFA,0x0A,0x90,0x13,0xE1,0xC9,0x32,0x58,
+	0x0C,0xC1,0x67,0x6F,0x3F,0x02,0xF0,0x0F,0xC2,0x27,0x30,0x21,0x8A,0x0C,0x22,0x55,
+	0x0C,0xE1,0xC9,0xE5,0x2A,0xCB,0x0B,0xE3,0x57,0xD5,0xC5,0xCD,0x6D,0x15,0xC1,0xF1,
+	0xEB,0xE3,0xE5,0xEB,0x3C,0x57,0xBE,0x05,0xF0,0x10,0x59,0x1F,0xFE,0x5D,0xC2,0x75,
+	0x1F,0xD7,0xC3,0x77,0x1F,0xCF,0x29,0x22,0x1C,0x0C,0xE1,0x22,0xCB,0x0B,0x1E,0x00,
+	0xD5,0x11,0xE5,0xF5,0x2A,0x24,0x0C,0x3E,0x19,0xBA,0x0A,0xF1,0x07,0xEB,0xE7,0x3A,
+	0xCC,0x0B,0xCA,0xC0,0x1F,0xBE,0x23,0xC2,0xA3,0x1F,0x7E,0xB9,0x23,0xC2,0xA4,0x1F,
+	0x7E,0xB8,0x3E,0x82,0x0C,0xF0,0x2E,0x23,0xC2,0x88,0x1F,0x3A,0xCB,0x0B,0xB7,0xC2,
+	0x19,0x0D,0xF1,0xCA,0xAF,0x14,0x96,0xCA,0x1B,0x20,0x1E,0x09,0xC3,0x21,0x0D,0x77,
+	0x23,0x5F,0x16,0x00,0xF1,0xCA,0x72,0x15,0x71,0x23,0x70,0x23,0x4F,0xCD,0xC6,0x0C,
+	0x23,0x23,0x22,0x02,0x0C,0x71,0x23,0x3A,0xCB,0x0B,0x17,0x79,0x01,0x0B,0x00,0xD2,
+	0xE5,0x1F,0xC1,0x03,0x1C,0x00,0xF0,0x04,0xF5,0xCD,0x4C,0x33,0xF1,0x3D,0xC2,0xDD,
+	0x1F,0xF5,0x42,0x4B,0xEB,0x19,0xDA,0xBB,0x1F,0xCD,0xCF,0x9D,0x10,0x01,0xD4,0x00,
+	0xE0,0x00,0x20,0x03,0x57,0x2A,0x02,0x0C,0x5E,0xEB,0x29,0x09,0xEB,0x2B,0x2B,0xAD,
+	0x11,0xA1,0xF1,0xDA,0x4D,0x20,0x47,0x4F,0x7E,0x23,0x16,0xE1,0x6A,0x05,0xF0,0x1C,
+	0xF5,0xE7,0xD2,0xBB,0x1F,0xCD,0x4C,0x33,0x19,0xF1,0x3D,0x44,0x4D,0xC2,0x20,0x20,
+	0x3A,0xCC,0x0B,0x44,0x4D,0x29,0xD6,0x04,0xDA,0x46,0x20,0x29,0xCA,0x4A,0x20,0x29,
+	0xE2,0x4A,0x20,0x09,0xC1,0x09,0xEB,0x2A,0x1C,0x0C,0xC9,0xC7,0x00,0x00,0x15,0x0E,
+	0xA0,0xF7,0xC2,0x6A,0x20,0xCD,0x3B,0x24,0xCD,0x05,0x23,0xFD,0x0B,0xC0,0x2A,0x00,
+	0x0C,0x7D,0x93,0x6F,0x7C,0x9A,0x67,0xC3,0x4A,0x34,0x8B,0x07,0xF0,0x00,0x7C,0x20,
+	0x3A,0x27,0x00,0x6F,0xAF,0x67,0xC3,0x38,0x32,0xCD,0xA1,0x20,0xD5,0xED,0x02,0xF0,
+	0x23,0x4E,0x23,0x46,0x21,0x27,0x30,0xE5,0xC5,0x3A,0xCC,0x0B,0xF5,0xFE,0x03,0xCC,
+	0x3B,0x24,0xF1,0xEB,0x21,0x55,0x0C,0xC9,0xD7,0x01,0x00,0x00,0xFE,0x1B,0xD2,0xB5,
+	0x20,0xFE,0x11,0xDA,0xB5,0x20,0xD7,0x3A,0xD3,0x0B,0x17,0x4F,0xEB,0x21,0xD9,0x06,
+	0x09,0xEB,0xC9,0x3A,0x00,0x60,0xCF,0xF0,0xCD,0x0D,0x27,0xE3,0x44,0x0C,0x00,0xF3,
+	0x03,0x80,0xBC,0x20,0xCD,0xCC,0x21,0xCD,0xBE,0x21,0x1C,0x12,0xF0,0x06,0xEB,0x7E,
+	0xFE,0x28,0xC2,0x66,0x16,0xD7,0xCD,0x60,0x1E,0x7E,0xFE,0x29,0xCA,0x66,0x16,0xCF,
+	0x2C,0xC3,0xE2,0x20,0x00,0x90,0x3A,0xCC,0x0B,0xB7,0xF5,0x22,0x1C,0x0C,0xEB,0xE7,
+	0x04,0x40,0xB4,0xCA,0x1C,0x0D,0x29,0x00,0xF0,0x01,0x59,0x21,0xD7,0x22,0x02,0x0C,
+	0x01,0xCF,0x2C,0x0E,0x04,0xCD,0xC6,0x0C,0x3E,0x80,0x5B,0x0F,0xF0,0x13,0x60,0x1E,
+	0xEB,0x37,0xC3,0x50,0x1B,0xD2,0x95,0x32,0xD5,0xEB,0xCD,0x63,0x22,0xD1,0xAF,0xE5,
+	0xF5,0xEB,0x7E,0xFE,0x29,0xC2,0x0F,0x21,0x2A,0x1C,0x0C,0xCF,0x28,0xE5,0x2A,0x02,
+	0x24,0x00,0x40,0xE3,0xCD,0x9A,0x16,0x61,0x00,0xF0,0x00,0x54,0x21,0xCF,0x2C,0xE3,
+	0xCF,0x2C,0xC3,0x3F,0x21,0xD7,0xE3,0xCF,0x29,0x3E,0x9A,0x00,0xF0,0x0D,0xE4,0x1A,
+	0x2B,0xD7,0xC2,0x10,0x0D,0xD1,0xF7,0xCA,0xA7,0x21,0xF1,0xCA,0xAB,0x21,0xD2,0x8D,
+	0x21,0xE1,0xC1,0x70,0x2B,0x71,0xFA,0x69,0x21,0x2B,0x08,0x00,0x13,0xE2,0x08,0x00,
+	0x01,0x05,0x00,0xF0,0x05,0xC3,0x69,0x21,0xD5,0xF5,0xF7,0x11,0xFD,0x0B,0xCC,0x63,
+	0x22,0xF1,0xFE,0xE5,0xE6,0x07,0x21,0xB6,0x03,0x8E,0x05,0xF0,0x0D,0xCD,0xB1,0x1D,
+	0xE1,0xC9,0x21,0xFD,0x0B,0xE5,0xCD,0x68,0x24,0x7E,0x22,0xDD,0x0B,0xE1,0x77,0x23,
+	0x71,0x23,0x70,0xCD,0xD8,0x21,0xC3,0x69,0x21,0x95,0x0B,0xC1,0x23,0x7C,0xB5,0xE1,
+	0xC0,0x1E,0x0C,0xC3,0x21,0x0D,0xCF,0xD3,0xB8,0x00,0xF0,0x03,0xB6,0x47,0xC3,0x65,
+	0x1E,0xD5,0xF5,0xC5,0xE5,0x59,0x50,0x4F,0x06,0x00,0x21,0xFD,0x21,0xE5,0x28,0x0B,
+	0xD0,0xD0,0x2A,0xDB,0x0B,0xE7,0xD8,0xE1,0xEB,0x09,0x71,0xD1,0x1B,0x1B,0x75,0x0D,
+	0xF1,0x01,0x13,0x13,0xD5,0xE1,0xC1,0xF1,0xD1,0xC9,0xCD,0x05,0x3D,0xC3,0x11,0x22,
+	0xCD,0x08,0x06,0x00,0x01,0xEE,0x09,0xF0,0x0F,0xCD,0x3B,0x24,0x01,0xC2,0x24,0xC5,
+	0x7E,0x23,0xE5,0xCD,0xD6,0x22,0xE1,0x4E,0x23,0x46,0xCD,0x32,0x22,0xE5,0x6F,0xCD,
+	0x2E,0x24,0xD1,0xC9,0xCD,0xD6,0x22,0x8B,0x00,0x11,0x77,0xB6,0x0D,0xF0,0x21,0xC9,
+	0x2B,0x06,0x22,0x50,0xE5,0x0E,0xFF,0x23,0x7E,0x0C,0xB7,0xCA,0x53,0x22,0xBA,0xCA,
+	0x53,0x22,0xB8,0xC2,0x44,0x22,0xFE,0x22,0xCC,0x92,0x12,0xE3,0x23,0xEB,0x79,0xCD,
+	0x32,0x22,0x11,0xFD,0x0B,0x3E,0xD5,0x2A,0xDD,0x0B,0x22,0x55,0x0C,0x3E,0x03,0x39,
+	0x0F,0x60,0x71,0x31,0x11,0x00,0x0C,0xE7,0xC7,0x00,0xD1,0x7E,0xC2,0x83,0x22,0x1E,
+	0x10,0xC3,0x21,0x0D,0xE5,0x2A,0x55,0x0C,0xA6,0x0B,0x76,0x7E,0xB7,0xC8,0xE5,0x5E,
+	0x16,0x00,0x99,0x0E,0xC1,0xEB,0xE1,0xD2,0xA4,0x22,0xE1,0xC9,0x19,0xEB,0xE3,0xEB,
+	0x1A,0x73,0x00,0x21,0xD1,0x1B,0x18,0x00,0x40,0xD8,0x36,0x00,0x2B,0x05,0x00,0x22,
+	0xC9,0x23,0xAE,0x00,0xF3,0x06,0xCD,0x61,0x31,0x14,0x15,0xC8,0x0A,0xDF,0xFE,0x0D,
+	0xCC,0x74,0x18,0x03,0xC3,0xC9,0x22,0xB7,0x0E,0xF1,0xF5,0x77,0x02,0xF2,0x15,0x2F,
+	0x4F,0x06,0xFF,0x3C,0xCA,0xEC,0x22,0x0B,0x0B,0x0B,0x09,0x23,0xE7,0xDA,0xF9,0x22,
+	0x22,0x00,0x0C,0x23,0xEB,0xF1,0xC9,0xF1,0x1E,0x0E,0xCA,0x21,0x0D,0xBF,0xF5,0x01,
+	0xD8,0x22,0xC5,0xBA,0x13,0xF0,0x01,0x7E,0xB7,0xC2,0x15,0x23,0x2B,0x7E,0x23,0xB7,
+	0xC8,0xE5,0x56,0x2B,0x5E,0x2B,0x7E,0x3A,0x00,0xF1,0x00,0x03,0x09,0xC1,0xE7,0xCA,
+	0x7F,0x23,0xD5,0xC5,0xE5,0xEB,0x7E,0xB7,0xCA,0x7C,0x8B,0x03,0xF0,0x09,0xE1,0xE7,
+	0xC2,0x7D,0x23,0xD1,0xE5,0x2A,0x00,0x0C,0xE7,0xCA,0x83,0x23,0xD5,0xC1,0xD1,0xD5,
+	0xCD,0xBA,0x0C,0xD1,0x1B,0xE1,0x97,0x01,0x81,0x69,0x60,0x2B,0x22,0x00,0x0C,0xEB,
+	0xEB,0xA7,0x00,0x12,0xC8,0x52,0x00,0xF1,0x04,0xE7,0xCA,0x76,0x23,0x7E,0xB7,0x23,
+	0xC2,0x15,0x23,0x2A,0x00,0x0C,0x36,0x00,0x2B,0x36,0x00,0xC9,0x09,0x00,0xA0,0xC9,
+	0xE1,0xC1,0xD1,0x2B,0xC3,0x56,0x23,0xE1,0xD1,0x34,0x00,0xA0,0xC3,0x56,0x23,0xE5,
+	0xD5,0xC5,0xF5,0x21,0xEA,0x23,0xAF,0x0F,0x22,0xC5,0xC1,0x10,0x04,0x30,0xC8,0x7E,
+	0x23,0x16,0x09,0xA2,0x09,0xFE,0x03,0xC2,0x98,0x23,0x22,0x2B,0x0C,0xE1,0xBF,0x0E,
+	0xF1,0x00,0xEB,0x2A,0x2B,0x0C,0xEB,0xE7,0xCA,0x9A,0x23,0x01,0xB6,0x23,0xC5,0x7E,
+	0xB7,0x21,0x04,0x11,0xC8,0x92,0x00,0x20,0xE1,0xD0,0x15,0x0E,0xD1,0xE7,0xE1,0xD8,
+	0xE5,0x2B,0x2B,0x2B,0xE5,0x4E,0x06,0x00,0xEB,0x09,0xAE,0x04,0x80,0xE1,0xC9,0xF1,
+	0xC1,0xD1,0xE1,0xC9,0xC5,0x6D,0x01,0x90,0xE3,0xCD,0x5D,0x1C,0xE3,0xCD,0x93,0x32,
+	0x7E,0x0D,0x00,0xF1,0x18,0xE5,0x86,0x1E,0x0F,0xDA,0x21,0x0D,0xCD,0x2F,0x22,0xD1,
+	0xCD,0x3F,0x24,0xE3,0xCD,0x3E,0x24,0xE5,0x2A,0xFE,0x0B,0xEB,0xCD,0x26,0x24,0xCD,
+	0x26,0x24,0x21,0xF6,0x1A,0xE3,0xE5,0xC3,0x5F,0x22,0xE1,0xE3,0x6E,0x06,0xF0,0x10,
+	0x6F,0x2C,0x2D,0xC8,0x0A,0x12,0x03,0x13,0xC3,0x2F,0x24,0xCD,0x93,0x32,0x2A,0x55,
+	0x0C,0xEB,0xCD,0x68,0x24,0xCD,0x76,0x24,0xEB,0xC0,0xD5,0x50,0x59,0x1B,0x4E,0x80,
+	0x00,0xF3,0x00,0xC2,0x66,0x24,0x79,0xB7,0xCA,0x66,0x24,0xAF,0x47,0x09,0x23,0x23,
+	0x23,0x22,0xF1,0x00,0xF6,0x0D,0xE1,0xC9,0x2A,0xDD,0x0B,0x2B,0x46,0x2B,0x4E,0x2B,
+	0xE7,0xC0,0x22,0xDD,0x0B,0xC9,0xF5,0xD5,0xC5,0xE5,0x7E,0xB7,0xCA,0x95,0x24,0x4E,
+	0x06,0x00,0x65,0x10,0x51,0x95,0x24,0xE5,0x09,0xD1,0x5A,0x02,0xF2,0x00,0xC1,0xD1,
+	0xF1,0xC9,0x01,0x7C,0x20,0xC5,0xCD,0x38,0x24,0xAF,0x57,0x7E,0xB7,0x0C,0x00,0x50,
+	0x9E,0x24,0xCA,0x72,0x15,0x2E,0x00,0xF0,0x03,0x1A,0xC9,0x3E,0x01,0xCD,0x2F,0x22,
+	0xCD,0x1D,0x27,0x2A,0xFE,0x0B,0x73,0xC1,0xC3,0x5F,0x22,0x02,0x08,0xF0,0x0D,0x1A,
+	0x27,0xD5,0xCF,0x2C,0xCD,0xE4,0x1A,0xCF,0x29,0xE3,0xE5,0xF7,0xCA,0xE0,0x24,0xCD,
+	0x1D,0x27,0xC3,0xE3,0x24,0xCD,0xAA,0x24,0xD1,0xCD,0xEC,0x0D,0x00,0xF1,0x31,0x3E,
+	0x20,0xF5,0x7B,0xCD,0x2F,0x22,0x5F,0xF1,0x1C,0x1D,0xCA,0xC2,0x24,0x2A,0xFE,0x0B,
+	0x77,0x23,0x1D,0xC2,0xFB,0x24,0xC3,0xC2,0x24,0xCD,0x75,0x25,0xAF,0xE3,0x4F,0x3E,
+	0xE5,0xE5,0x7E,0xB8,0xDA,0x14,0x25,0x78,0x11,0x0E,0x00,0xC5,0xCD,0xD6,0x22,0xC1,
+	0xE1,0xE5,0x23,0x46,0x23,0x66,0x68,0x06,0x00,0x09,0x44,0x4D,0xCD,0x32,0x22,0x01,
+	0x03,0xF0,0x1D,0xCD,0x3F,0x24,0xC3,0x5F,0x22,0xCD,0x75,0x25,0xD1,0xD5,0x1A,0x90,
+	0xC3,0x08,0x25,0xEB,0x7E,0xCD,0x78,0x25,0xC5,0xCD,0x98,0x26,0xF1,0xE3,0x01,0x0C,
+	0x25,0xC5,0x3D,0xBE,0x06,0x00,0xD0,0x4F,0x7E,0x91,0xBB,0x47,0xD8,0x43,0xC9,0xB1,
+	0x00,0x31,0x7C,0x20,0x5F,0x78,0x16,0xF0,0x1B,0xE5,0x19,0x46,0x72,0xE3,0xC5,0x7E,
+	0xCD,0x67,0x36,0xC1,0xE1,0x70,0xC9,0xEB,0xCF,0x29,0xC1,0xD1,0xC5,0x43,0x04,0x05,
+	0xC0,0xC3,0x72,0x15,0xD7,0xCD,0xE2,0x1A,0xF7,0x3E,0x01,0xF5,0xCA,0x9E,0x25,0xF1,
+	0xCD,0x1D,0x27,0x1F,0x0E,0x00,0xBF,0x11,0x72,0xE4,0x1A,0xCD,0x93,0x32,0xCF,0x2C,
+	0xB0,0x01,0x00,0xD6,0x00,0xD0,0xE5,0xCD,0x38,0x24,0xEB,0xC1,0xE1,0xF1,0xC5,0x01,
+	0x27,0x30,0xC5,0x11,0x01,0xF4,0x07,0xF5,0xD5,0xCD,0x3E,0x24,0xD1,0xF1,0x47,0x3D,
+	0x4F,0xBE,0x3E,0x00,0xD0,0x7E,0xB7,0xC8,0x1A,0xB7,0x78,0xC8,0x7E,0xB4,0x00,0x61,
+	0x91,0x47,0xC5,0xD5,0xE3,0x4E,0xB0,0x02,0xF2,0x1F,0xE5,0xD5,0xC5,0x1A,0xBE,0xC2,
+	0x05,0x26,0x13,0x0D,0xCA,0xFC,0x25,0x23,0x05,0xC2,0xE7,0x25,0xD1,0xD1,0xC1,0xD1,
+	0xAF,0xC9,0xE1,0xD1,0xD1,0xC1,0x78,0x94,0x81,0x3C,0xC9,0xC1,0xD1,0xE1,0x23,0x05,
+	0xCA,0xF9,0x25,0xC3,0xE4,0x25,0xFE,0x7E,0x05,0x26,0x10,0x83,0x07,0x00,0x01,0x58,
+	0x09,0x63,0xCD,0x93,0x32,0xE5,0xD5,0xEB,0xA6,0x01,0x92,0xE7,0xDA,0x42,0x26,0xE1,
+	0xE5,0xCD,0x1B,0x22,0x5D,0x0F,0x10,0xE5,0xB8,0x03,0x52,0xE3,0xCF,0x2C,0xCD,0x1A,
+	0xB8,0x00,0x42,0x7E,0xCD,0x98,0x26,0xF9,0x04,0x01,0xAE,0x00,0xF1,0x0C,0xE1,0xC1,
+	0xF1,0x47,0xE3,0xE5,0x21,0x27,0x30,0xE3,0x79,0xB7,0xC8,0x7E,0x90,0xDA,0x72,0x15,
+	0x3C,0xB9,0xDA,0x75,0x26,0x79,0x48,0x0D,0x06,0xE6,0x03,0x71,0x66,0x6B,0x09,0x47,
+	0xD1,0xEB,0x4E,0x22,0x01,0xF1,0x07,0xEB,0x79,0xB7,0xC8,0x1A,0x77,0x13,0x23,0x0D,
+	0xC8,0x05,0xC2,0x8D,0x26,0xC9,0x1E,0xFF,0xFE,0x29,0xCA,0xA4,0x26,0x5B,0x00,0xF7,
+	0x0D,0xCF,0x29,0xC9,0xCD,0x1D,0x27,0x4F,0xCD,0x39,0x53,0xC3,0x7C,0x20,0xCD,0x1A,
+	0x27,0x4F,0xCF,0x2C,0xC5,0xCD,0x1A,0x27,0xC1,0xCD,0x25,0x53,0xC9,0x0F,0x00,0x83,
+	0x47,0x1E,0x00,0x2B,0xD7,0xCA,0xDB,0x26,0x0F,0x00,0x93,0x5F,0xCD,0x39,0x53,0xAB,
+	0xA0,0xCA,0xDB,0x26,0x24,0x00,0x80,0xCD,0x1A,0x27,0xE5,0xCD,0x40,0x53,0xE1,0x0F,
+	0x00,0xF1,0x08,0xFE,0x0F,0xDA,0x72,0x15,0x32,0xF8,0x06,0xD6,0x0E,0xD2,0xFE,0x26,
+	0xC6,0x1C,0x2F,0x3C,0x83,0x32,0xF9,0x06,0xC9,0xD7,0xB8,0x00,0x61,0x1C,0x32,0xEB,
+	0xE1,0x7A,0xB7,0x0D,0x00,0xF2,0x05,0xCD,0x10,0x27,0xC2,0x72,0x15,0x2B,0xD7,0x7B,
+	0xC9,0x3E,0x02,0x32,0xF1,0x06,0xC1,0xCD,0xC1,0x0E,0xC5,0x77,0x19,0x50,0xCD,0x67,
+	0x18,0xE1,0xD1,0xCD,0x0B,0x53,0x78,0xB1,0xCA,0x9F,0x0D,0xD1,0x0E,0x30,0xCC,0xFC,
+	0x52,0xDC,0x0B,0xC0,0x23,0xC5,0xE3,0xEB,0xE7,0xC1,0xDA,0x9E,0x0D,0xE3,0xE5,0xC5,
+	0x34,0x19,0x00,0xF7,0x14,0xF0,0x35,0x20,0xE1,0xDF,0xCD,0x7E,0x27,0x21,0xC8,0x0A,
+	0x01,0x31,0x27,0xC5,0x7E,0xB7,0xC8,0xCD,0x45,0x2D,0x23,0xC3,0x74,0x27,0x01,0xC8,
+	0x0A,0x16,0xFF,0xC3,0x8A,0x27,0x03,0x23,0x15,0xC8,0x7E,0xB7,0x02,0xC8,0xFE,0x0B,
+	0xDA,0x98,0x27,0xFE,0x20,0xDA,0xEF,0x27,0xB7,0xF2,0x86,0x27,0x3C,0x7E,0xC2,0xA5,
+	0x27,0x23,0x7E,0xE6,0x7F,0x23,0xFE,0xDB,0xC2,0xB3,0x27,0xF6,0x12,0xF0,0x68,0x14,
+	0x14,0x14,0x14,0xFE,0xA2,0xCC,0xC3,0x32,0xE5,0xC5,0xD5,0x21,0x72,0x01,0x47,0x0E,
+	0x40,0x0C,0x23,0x54,0x5D,0x7E,0xB7,0xCA,0xC1,0x27,0x23,0xF2,0xC5,0x27,0x7E,0xB8,
+	0xC2,0xC2,0x27,0xEB,0x79,0xD1,0xC1,0xFE,0x5B,0xC2,0xDE,0x27,0x7E,0x23,0x5F,0xE6,
+	0x7F,0x02,0x03,0x15,0xCA,0x60,0x2C,0xB3,0xF2,0xDC,0x27,0xE1,0xC3,0x8A,0x27,0x2B,
+	0xD7,0xD5,0xC5,0xF5,0xCD,0x0D,0x13,0xF1,0x01,0x0C,0x28,0xC5,0xFE,0x0B,0xCA,0x05,
+	0x3D,0xFE,0x0C,0xCA,0x08,0x3D,0x2A,0xD3,0x0B,0xC3,0xDC,0x37,0xC1,0xD1,0x3A,0xD1,
+	0x0B,0x1E,0x4F,0xFE,0x0B,0xCA,0x1F,0x28,0xFE,0x0C,0x1E,0x48,0xC2,0x2A,0x28,0x3E,
+	0x26,0x02,0x03,0x15,0xC8,0x7B,0x05,0x00,0xF2,0x02,0x3A,0xD2,0x0B,0xFE,0x04,0x1E,
+	0x00,0xDA,0x3B,0x28,0x1E,0x21,0xCA,0x3B,0x28,0x1E,0x23,0x27,0x1A,0x65,0x7E,0x23,
+	0xB7,0xCA,0x6D,0x28,0x21,0x00,0xF0,0x01,0xDA,0x41,0x28,0x0B,0x0A,0x03,0xC2,0x5E,
+	0x28,0xFE,0x2E,0xCA,0x68,0x28,0xFE,0x44,0x05,0x00,0xD1,0x45,0xC2,0x41,0x28,0x1E,
+	0x00,0xC3,0x41,0x28,0x7B,0xB7,0xCA,0x76,0x2B,0x00,0x00,0xC3,0x15,0x23,0x8A,0x27,
+	0x3F,0x1A,0xF0,0x05,0xCD,0xC1,0x0E,0xD1,0xC5,0xC5,0xCD,0xDF,0x0E,0xD2,0x72,0x15,
+	0x54,0x5D,0xE3,0xE5,0xE7,0xD2,0x72,0x15,0xEB,0x1A,0xF1,0x17,0xBF,0x22,0xC1,0x21,
+	0x7B,0x0E,0xE3,0xEB,0x2A,0x22,0x0C,0x1A,0x02,0x03,0x13,0xE7,0xC2,0xA6,0x28,0x60,
+	0x69,0x22,0x22,0x0C,0xC9,0xCD,0x19,0x54,0xC3,0x19,0x54,0x06,0x01,0xFE,0xF4,0xCA,
+	0xA0,0x14,0xB4,0x01,0xF0,0x05,0xAA,0x24,0x3E,0xD3,0x06,0x0A,0xCD,0x19,0x54,0x05,
+	0xC2,0xCC,0x28,0x1A,0xCD,0x19,0x54,0xCD,0x90,0x2E,0x44,0x1A,0x00,0x3B,0x00,0xF0,
+	0x12,0x13,0xCD,0x19,0x54,0xE7,0xC2,0xE1,0x28,0x2E,0x07,0xCD,0x19,0x54,0x2D,0xC2,
+	0xEC,0x28,0xE1,0xC9,0xFE,0xF4,0xCA,0x9E,0x14,0xD6,0x91,0xCA,0x01,0x29,0xAF,0x01,
+	0x2F,0x23,0x67,0x12,0x70,0xCD,0xAA,0x24,0x1A,0x6F,0xF1,0xB7,0x10,0x0B,0x30,0xC2,
+	0x1B,0x29,0x23,0x13,0x20,0x1D,0x0F,0x44,0x00,0xF1,0x0C,0x55,0x0C,0xEB,0x06,0x0A,
+	0xCD,0x0F,0x54,0xD6,0xD3,0xC2,0x22,0x29,0x05,0xC2,0x24,0x29,0xCD,0x0F,0x54,0x93,
+	0xC2,0x22,0x29,0x2A,0x00,0x07,0x18,0x00,0xA0,0x5F,0x96,0xA2,0xC2,0x67,0x29,0x73,
+	0xCD,0xCF,0x0C,0xE2,0x05,0xD2,0x3A,0x29,0x05,0xC2,0x3C,0x29,0x01,0xF9,0xFF,0x09,
+	0x22,0x22,0x0C,0xC3,0x00,0x80,0x2A,0x00,0x07,0xE5,0xC3,0x7B,0x0E,0x23,0x8B,0x00,
+	0xF1,0x04,0xE7,0xDA,0x5A,0x29,0x21,0x79,0x29,0xCD,0xBF,0x22,0xC3,0x9E,0x0D,0x4E,
+	0x4F,0x20,0x47,0x4F,0x4F,0x44,0x0F,0x30,0x9A,0x29,0x7E,0xD9,0x02,0x00,0xC9,0x00,
+	0x22,0x9A,0x29,0x4E,0x03,0xF1,0x0B,0xD1,0x12,0xC9,0x01,0x1C,0x32,0xC5,0xF7,0xF8,
+	0x3A,0x58,0x0C,0xFE,0x90,0xC0,0x01,0x80,0x91,0x11,0x00,0x00,0xC3,0xA7,0x2E,0xCD,
+	0xE5,0x17,0x04,0x10,0x3B,0x2D,0x0C,0x30,0xC3,0xC7,0x29,0xAE,0x0F,0x60,0xCA,0x72,
+	0x15,0xD1,0xEB,0xE5,0x2D,0x10,0x50,0xBA,0xF5,0xD5,0x46,0xB0,0x24,0x05,0x00,0x23,
+	0x0C,0xF1,0x6A,0xC3,0xF9,0x29,0x58,0xE5,0x0E,0x02,0x7E,0x23,0xFE,0x5C,0xCA,0x22,
+	0x2B,0xFE,0x20,0xC2,0xF1,0x29,0x0C,0x05,0xC2,0xE0,0x29,0xE1,0x43,0x3E,0x5C,0xCD,
+	0x54,0x2B,0xDF,0xAF,0x5F,0x57,0xCD,0x54,0x2B,0x57,0x7E,0x23,0xFE,0x21,0xCA,0x1F,
+	0x2B,0xFE,0x23,0xCA,0x4B,0x2A,0x05,0xCA,0x0B,0x2B,0xFE,0x2B,0x3E,0x08,0xCA,0xFC,
+	0x29,0x2B,0x7E,0x23,0xFE,0x2E,0xCA,0x6A,0x2A,0xFE,0x5C,0xCA,0xDC,0x29,0xBE,0xC2,
+	0xF5,0x29,0xFE,0x24,0xCA,0x44,0x2A,0xFE,0x2A,0xC2,0xF5,0x29,0x78,0xFE,0x02,0x23,
+	0xDA,0x3C,0x2A,0x7E,0xFE,0x24,0x3E,0x20,0xC2,0x48,0x2A,0x05,0x1C,0xFE,0xAF,0xC6,
+	0x10,0x23,0x1C,0x82,0x57,0x1C,0x0E,0x00,0x05,0xCA,0xA0,0x2A,0x3A,0x00,0x21,0x75,
+	0x2A,0x52,0x00,0xF3,0x09,0xFE,0x2C,0xC2,0x81,0x2A,0x7A,0xF6,0x40,0x57,0xC3,0x4B,
+	0x2A,0x7E,0xFE,0x23,0x3E,0x2E,0xC2,0xF5,0x29,0x0E,0x01,0x23,0x0C,0x28,0x00,0xF2,
+	0x02,0x23,0xCA,0x75,0x2A,0xD5,0x11,0x9E,0x2A,0xD5,0x54,0x5D,0xFE,0x5E,0xC0,0xBE,
+	0xC0,0x23,0x03,0x00,0xF0,0x39,0x78,0xD6,0x04,0xD8,0xD1,0xD1,0x47,0x14,0x23,0xCA,
+	0xEB,0xD1,0x7A,0x2B,0x1C,0xE6,0x08,0xC2,0xC0,0x2A,0x1D,0x78,0xB7,0xCA,0xC0,0x2A,
+	0x7E,0xD6,0x2D,0xCA,0xBB,0x2A,0xFE,0xFE,0xC2,0xC0,0x2A,0x3E,0x08,0xC6,0x04,0x82,
+	0x57,0x05,0xE1,0xF1,0xCA,0x14,0x2B,0xC5,0xD5,0xCD,0xE4,0x1A,0xD1,0xC1,0xC5,0xE5,
+	0x43,0x78,0x81,0xFE,0x19,0xD2,0x72,0x15,0x7A,0xF6,0x80,0xCD,0xDD,0x37,0x49,0x1D,
+	0xF1,0x0B,0x2B,0xD7,0x37,0xCA,0xF2,0x2A,0x32,0x07,0x0C,0xFE,0x3B,0xCA,0xF1,0x2A,
+	0xCF,0x2C,0x06,0xD7,0xC1,0xEB,0xE1,0xE5,0xF5,0xD5,0x7E,0x90,0x26,0x01,0xC0,0x16,
+	0x00,0x5F,0x19,0x78,0xB7,0xC2,0xF9,0x29,0xC3,0x0F,0x2B,0x16,0x01,0x80,0xE1,0xF1,
+	0xC2,0xBE,0x29,0xDC,0x67,0x18,0x08,0x07,0x00,0xF1,0x10,0x82,0x0E,0x01,0x3E,0xF1,
+	0x05,0xCD,0x54,0x2B,0x67,0x00,0x02,0x95,0x05,0x11,0xC1,0x45,0x07,0x10,0x41,0x26,
+	0x06,0xF0,0x11,0x0B,0x25,0xCD,0xC2,0x22,0x2A,0x55,0x0C,0xF1,0x96,0x47,0x3E,0x20,
+	0x04,0x05,0xCA,0xDF,0x2A,0xDF,0xC3,0x4C,0x2B,0xF5,0x7A,0xB7,0x3E,0x2B,0xC4,0x94,
+	0x52,0xF1,0xC9,0x28,0x1E,0xF4,0x00,0x13,0x0C,0xB4,0xA5,0x3C,0xEB,0xC8,0xC3,0x70,
+	0x2B,0xCD,0x77,0x15,0xC0,0xE1,0x46,0x1D,0x52,0xD2,0x46,0x16,0x60,0x69,0xE6,0x10,
+	0xF0,0x00,0xC5,0xCD,0x7E,0x27,0xE1,0xE5,0x7C,0xA5,0x3C,0x3E,0x21,0xCC,0x94,0x52,
+	0xC4,0x2F,0x04,0x71,0xDF,0x21,0xC8,0x0A,0xE5,0x0E,0xFF,0x56,0x02,0xF0,0x21,0x9E,
+	0x2B,0xE1,0x47,0x16,0x00,0xCD,0x3B,0x52,0xD6,0x30,0xDA,0xC1,0x2B,0xFE,0x0A,0xD2,
+	0xC1,0x2B,0x5F,0x7A,0x07,0x07,0x82,0x07,0x83,0x57,0xC3,0xA9,0x2B,0xE5,0x21,0xA7,
+	0x2B,0xE3,0x15,0x14,0xC2,0xCC,0x2B,0x14,0xFE,0x4F,0xCA,0x22,0x2D,0xFE,0xD8,0x05,
+	0x00,0xF0,0x46,0xDD,0xCA,0x30,0x2D,0xFE,0xF0,0xCA,0x28,0x2C,0xFE,0x31,0xDA,0xE7,
+	0x2B,0xD6,0x20,0xFE,0x21,0xCA,0x50,0x2D,0xFE,0x1C,0xCA,0x62,0x2C,0xFE,0x23,0xCA,
+	0x3B,0x2C,0xFE,0x19,0xCA,0xB1,0x2C,0xFE,0x14,0xCA,0x6C,0x2C,0xFE,0x13,0xCA,0x87,
+	0x2C,0xFE,0x15,0xCA,0x33,0x2D,0xFE,0x28,0xCA,0xAC,0x2C,0xFE,0x1B,0xCA,0x35,0x2C,
+	0xFE,0x18,0xCA,0xA9,0x2C,0xFE,0x11,0x3E,0x07,0xC2,0x94,0x52,0xC1,0xD1,0xCD,0x67,
+	0x18,0xC3,0x71,0x2B,0x7E,0xB7,0xC8,0x04,0xB5,0x04,0xF0,0x2C,0x15,0xC2,0x28,0x2C,
+	0xC9,0xE5,0x21,0x83,0x2C,0xE3,0x37,0xF5,0xCD,0x3B,0x52,0x5F,0xF1,0xF5,0xDC,0x83,
+	0x2C,0x7E,0xB7,0xCA,0x60,0x2C,0xCD,0x45,0x2D,0xF1,0xF5,0xDC,0xDA,0x2C,0xDA,0x57,
+	0x2C,0x23,0x04,0x7E,0xBB,0xC2,0x45,0x2C,0x15,0xC2,0x45,0x2C,0xF1,0xC9,0xCD,0x74,
+	0x27,0xCD,0x67,0x18,0xC1,0xC3,0x88,0x44,0x00,0x90,0x3E,0x5C,0xCD,0x45,0x2D,0x7E,
+	0xB7,0xCA,0x83,0x2F,0x00,0xA0,0xCD,0xDA,0x2C,0x15,0xC2,0x74,0x2C,0x3E,0x5C,0xDF,
+	0xFB,0x09,0xF0,0x06,0xCD,0x3B,0x52,0xFE,0x20,0xD2,0x9E,0x2C,0xFE,0x09,0xCA,0x9E,
+	0x2C,0xFE,0x0A,0xCA,0x9E,0x2C,0x3E,0x20,0x77,0x73,0x00,0xF0,0x03,0x04,0x15,0xC2,
+	0x87,0x2C,0xC9,0x36,0x00,0x48,0x16,0xFF,0xCD,0x28,0x2C,0xCD,0x3B,0x52,0xB7,0xBD,
+	0x00,0x60,0x7F,0xCA,0xCA,0x2C,0xFE,0x0D,0xE7,0x00,0xD0,0x1B,0xC8,0xFE,0x08,0xC2,
+	0xEA,0x2C,0x3E,0x08,0x05,0x04,0xCA,0xF2,0x58,0x00,0xF3,0x35,0x2B,0x05,0x11,0xB1,
+	0x2C,0xD5,0xE5,0x0D,0x7E,0xB7,0x37,0xCA,0x27,0x30,0x23,0x7E,0x2B,0x77,0x23,0xC3,
+	0xDC,0x2C,0xF5,0x79,0xFE,0xFF,0xDA,0xF8,0x2C,0xF1,0x3E,0x07,0xDF,0xC3,0xB1,0x2C,
+	0x90,0x0C,0x04,0xC5,0xEB,0x6F,0x26,0x00,0x19,0x44,0x4D,0x23,0xCD,0xBA,0x0C,0xC1,
+	0xF1,0xFE,0x20,0xD2,0x1A,0x2D,0xFE,0x09,0xCA,0x1A,0x2D,0xFE,0x0A,0xCA,0x1A,0x2D,
+	0x7C,0x00,0xF4,0x01,0xC3,0xB1,0x2C,0x78,0xB7,0xC8,0x05,0x2B,0x7E,0xCD,0x45,0x2D,
+	0x15,0xC2,0x22,0x2D,0xCE,0x00,0xF3,0x09,0xD1,0x7A,0xA3,0x3C,0x21,0xC7,0x0A,0xC8,
+	0x37,0x23,0xF5,0xC3,0x1A,0x0E,0xDF,0xFE,0x0A,0xC0,0x3E,0x0D,0xDF,0xAF,0xC3,0x73,
+	0x1A,0x00,0xF2,0x20,0xC8,0x0A,0xC2,0x9F,0x0D,0x36,0x00,0x2B,0xC3,0x67,0x18,0x01,
+	0x0A,0x00,0xC5,0x50,0x58,0xCA,0x93,0x2D,0xFE,0x2C,0xCA,0x79,0x2D,0xD5,0xCD,0x77,
+	0x15,0x42,0x4B,0xD1,0xCA,0x93,0x2D,0xCF,0x2C,0xCD,0x77,0x15,0xCA,0x93,0x2D,0xF1,
+	0xCF,0x2C,0xD5,0xF2,0x15,0x80,0x7A,0xB3,0xCA,0x72,0x15,0xEB,0xE3,0xEB,0x0B,0x05,
+	0x20,0xD1,0xD5,0x06,0x00,0xF0,0x1A,0x60,0x69,0xD1,0xE7,0xEB,0xDA,0x72,0x15,0xD1,
+	0xC1,0xF1,0xE5,0xD5,0xC3,0xBB,0x2D,0x09,0xDA,0x72,0x15,0xEB,0xE5,0x21,0xF9,0xFF,
+	0xE7,0xE1,0xDA,0x72,0x15,0xD5,0x5E,0x7B,0x23,0x56,0xB2,0xEB,0xD1,0xCA,0xCE,0x2D,
+	0xE2,0x1E,0xB2,0xEB,0xC2,0xAD,0x2D,0xC5,0xCD,0xF1,0x2D,0xC1,0xD1,0xE1,0x1A,0x00,
+	0x61,0xCA,0xEC,0x2D,0xEB,0xE3,0xEB,0xA5,0x19,0xF1,0x00,0x09,0xEB,0xE1,0xC3,0xD5,
+	0x2D,0x01,0x9E,0x0D,0xC5,0xFE,0xF6,0xAF,0x32,0x0A,0xC9,0x1E,0x00,0xB4,0x13,0x10,
+	0xC8,0xD7,0x07,0xF1,0x20,0xD7,0xB7,0xCA,0xFA,0x2D,0x4F,0x3A,0x0A,0x0C,0xB7,0x79,
+	0xCA,0x6C,0x2E,0xFE,0xA8,0xC2,0x2E,0x2E,0xD7,0xFE,0x89,0xC2,0x04,0x2E,0xD7,0xFE,
+	0x0E,0xC2,0x04,0x2E,0xD5,0xCD,0x8B,0x15,0x7A,0xB3,0xC2,0x37,0x2E,0xC3,0x57,0x2E,
+	0xFE,0x0E,0xC2,0x03,0x11,0x00,0xA0,0xE5,0xCD,0xDF,0x0E,0x0B,0x3E,0x0D,0xDA,0x80,
+	0x2E,0x98,0x20,0x30,0x5C,0x2E,0xD5,0x6C,0x03,0xFB,0x01,0xCD,0xCE,0x37,0xC1,0xE1,
+	0xE5,0xC5,0xCD,0xC6,0x37,0xE1,0xD1,0x2B,0xC3,0x03,0x2E,0x11,0x2A,0x33,0x00,0xFE,
+	0x0D,0x3E,0x00,0x12,0xEB,0xDF,0x13,0x70,0xEB,0xE5,0x3E,0x0E,0x21,0x56,0x2E,0x62,
+	0x18,0x20,0xE5,0x2B,0x07,0x0D,0x30,0x77,0xE1,0xC9,0x87,0x00,0xA0,0xC8,0xC3,0xF2,
+	0x2D,0x21,0xC4,0x3B,0xCD,0x5F,0x31,0xF2,0x04,0x80,0x5F,0x31,0xCD,0x1E,0x31,0x78,
+	0xB7,0xC8,0x82,0x2E,0xF0,0x8E,0xCA,0x51,0x31,0x90,0xD2,0xC1,0x2E,0x2F,0x3C,0xEB,
+	0xCD,0x41,0x31,0xEB,0xCD,0x51,0x31,0xC1,0xD1,0xFE,0x19,0xD0,0xF5,0xCD,0x7E,0x31,
+	0x67,0xF1,0xCD,0x6E,0x2F,0xB4,0x21,0x55,0x0C,0xF2,0xE7,0x2E,0xCD,0x4E,0x2F,0xD2,
+	0x2D,0x2F,0x23,0x34,0xCA,0x49,0x2F,0x2E,0x01,0xCD,0x84,0x2F,0xC3,0x2D,0x2F,0xAF,
+	0x90,0x47,0x7E,0x9B,0x5F,0x23,0x7E,0x9A,0x57,0x23,0x7E,0x99,0x4F,0xDC,0x5A,0x2F,
+	0x68,0x63,0xAF,0x47,0x79,0xB7,0xC2,0x1A,0x2F,0x4A,0x54,0x65,0x6F,0x78,0xD6,0x08,
+	0xFE,0xE0,0xC2,0xFB,0x2E,0xAF,0x32,0x58,0x0C,0xC9,0x05,0x29,0x7A,0x17,0x57,0x79,
+	0x8F,0x4F,0xF2,0x12,0x2F,0x78,0x5C,0x45,0xB7,0xCA,0x2D,0x2F,0x21,0x58,0x0C,0x86,
+	0x77,0xD2,0x0D,0x2F,0xC8,0x78,0x21,0x58,0x0C,0xB7,0xFC,0x3F,0x2F,0x46,0x23,0x7E,
+	0xE6,0x80,0xA9,0x4F,0xC3,0x51,0x31,0x1C,0xC0,0x14,0xC0,0x0C,0xC0,0x0E,0x80,0x34,
+	0xC0,0x1E,0x06,0xD7,0x19,0xF0,0xA0,0x83,0x5F,0x23,0x7E,0x8A,0x57,0x23,0x7E,0x89,
+	0x4F,0xC9,0x21,0x59,0x0C,0x7E,0x2F,0x77,0xAF,0x6F,0x90,0x47,0x7D,0x9B,0x5F,0x7D,
+	0x9A,0x57,0x7D,0x99,0x4F,0xC9,0x06,0x00,0xD6,0x08,0xDA,0x7D,0x2F,0x43,0x5A,0x51,
+	0x0E,0x00,0xC3,0x70,0x2F,0xC6,0x09,0x6F,0xAF,0x2D,0xC8,0x79,0x1F,0x4F,0x7A,0x1F,
+	0x57,0x7B,0x1F,0x5F,0x78,0x1F,0x47,0xC3,0x80,0x2F,0x00,0x00,0x00,0x81,0x03,0xAA,
+	0x56,0x19,0x80,0xF1,0x22,0x76,0x80,0x45,0xAA,0x38,0x82,0xEF,0xEA,0x72,0x15,0x21,
+	0x58,0x0C,0x7E,0x01,0x35,0x80,0x11,0xF3,0x04,0x90,0xF5,0x70,0xD5,0xC5,0xCD,0xA7,
+	0x2E,0xC1,0xD1,0x04,0xCD,0x39,0x30,0x21,0x92,0x2F,0xCD,0xA1,0x2E,0x21,0x96,0x2F,
+	0xCD,0x09,0x3E,0x01,0x80,0x80,0x11,0x00,0x00,0xCD,0xA7,0x2E,0xF1,0xCD,0xA7,0x37,
+	0x01,0x31,0x80,0x11,0x18,0x72,0xEF,0xC8,0x2E,0x00,0xCD,0xB6,0x30,0x79,0x32,0x15,
+	0x30,0xEB,0x22,0x10,0x30,0x01,0x00,0x00,0x50,0x58,0x21,0xF8,0x2E,0xE5,0x21,0xFE,
+	0x2F,0xE5,0xE5,0x21,0x55,0x0C,0xBD,0x07,0xF0,0x3C,0x29,0x30,0xE5,0xEB,0x1E,0x08,
+	0x1F,0x57,0x79,0xD2,0x16,0x30,0xD5,0x11,0x00,0x00,0x19,0xD1,0xCE,0x00,0x1F,0x4F,
+	0x7C,0x1F,0x67,0x7D,0x1F,0x6F,0x78,0x1F,0x47,0x1D,0x7A,0xC2,0x08,0x30,0xEB,0xE1,
+	0xC9,0x43,0x5A,0x51,0x4F,0xC9,0xCD,0x41,0x31,0x21,0xDE,0x35,0xCD,0x4E,0x31,0xC1,
+	0xD1,0xEF,0xCA,0x13,0x0D,0x2E,0xFF,0xCD,0xB6,0x30,0x34,0x34,0x2B,0x7E,0x32,0x68,
+	0x30,0x2B,0x7E,0x32,0x64,0x05,0x00,0xF0,0x26,0x60,0x30,0x41,0xEB,0xAF,0x4F,0x57,
+	0x5F,0x32,0x6B,0x30,0xE5,0xC5,0x7D,0xD6,0x00,0x6F,0x7C,0xDE,0x00,0x67,0x78,0xDE,
+	0x00,0x47,0x3E,0x00,0xDE,0x00,0x3F,0xD2,0x79,0x30,0x32,0x6B,0x30,0xF1,0xF1,0x37,
+	0xD2,0xC1,0xE1,0x79,0x3C,0x3D,0x1F,0xFA,0x2E,0x2F,0x17,0x7B,0x17,0x5F,0x72,0x01,
+	0xF0,0x48,0x17,0x4F,0x29,0x78,0x17,0x47,0x3A,0x6B,0x30,0x17,0x32,0x6B,0x30,0x79,
+	0xB2,0xB3,0xC2,0x5C,0x30,0xE5,0x21,0x58,0x0C,0x35,0xE1,0xC2,0x5C,0x30,0xC3,0x49,
+	0x2F,0x3E,0xFF,0x2E,0xAF,0x21,0x61,0x0C,0x4E,0x23,0xAE,0x47,0x2E,0x00,0x78,0xB7,
+	0xCA,0xD8,0x30,0x7D,0x21,0x58,0x0C,0xAE,0x80,0x47,0x1F,0xA8,0x78,0xF2,0xD7,0x30,
+	0xC6,0x80,0x77,0xCA,0x27,0x30,0xCD,0x7E,0x31,0x77,0x2B,0xC9,0xEF,0x2F,0xE1,0xB7,
+	0xE1,0xF2,0x0D,0x2F,0xC3,0x49,0x2F,0xCD,0x5C,0x3B,0x02,0xF0,0x38,0xC6,0x02,0xDA,
+	0x49,0x2F,0x47,0xCD,0xA7,0x2E,0x21,0x58,0x0C,0x34,0xC0,0xC3,0x49,0x2F,0x3A,0x57,
+	0x0C,0xFE,0x2F,0x17,0x9F,0xC0,0x3C,0xC9,0x06,0x88,0x11,0x00,0x00,0x21,0x58,0x0C,
+	0x4F,0x70,0x06,0x00,0x23,0x36,0x80,0x17,0xC3,0xF5,0x2E,0xCD,0x30,0x31,0xF0,0xF7,
+	0xFA,0x3F,0x34,0xCA,0x95,0x32,0x21,0x57,0x0C,0x7E,0xEE,0x80,0x77,0xC9,0xCD,0x30,
+	0x31,0x6F,0x17,0x9F,0xAE,0x10,0x00,0x1D,0x1C,0x30,0xF2,0x28,0x00,0x7D,0x20,0x62,
+	0xB5,0xC8,0x7C,0xC3,0xFB,0x30,0xB7,0x13,0x20,0x2A,0x57,0xBC,0x13,0x40,0xC9,0xCD,
+	0x5F,0x31,0x4D,0x14,0xA0,0x60,0x69,0x22,0x57,0x0C,0xEB,0xC9,0x21,0x55,0x0C,0x99,
+	0x0D,0x00,0xE3,0x05,0xE0,0xC9,0x11,0x55,0x0C,0x06,0x04,0xC3,0x75,0x31,0xEB,0x3A,
+	0xCC,0x0B,0x47,0xE8,0x0A,0x50,0x05,0xC2,0x75,0x31,0xC9,0x60,0x00,0xF0,0x0B,0x07,
+	0x37,0x1F,0x77,0x3F,0x1F,0x23,0x23,0x77,0x79,0x07,0x37,0x1F,0x4F,0x1F,0xAE,0xC9,
+	0x21,0x5B,0x0C,0x11,0x70,0x31,0xC3,0xA2,0x31,0x09,0x00,0xF0,0x37,0x71,0x31,0xD5,
+	0x11,0x55,0x0C,0xF7,0xD8,0x11,0x51,0x0C,0xC9,0x78,0xB7,0xCA,0x28,0x00,0x21,0xFA,
+	0x30,0xE5,0xEF,0x79,0xC8,0x21,0x57,0x0C,0xAE,0x79,0xF8,0xCD,0xC4,0x31,0x1F,0xA9,
+	0xC9,0x23,0x78,0xBE,0xC0,0x2B,0x79,0xBE,0xC0,0x2B,0x7A,0xBE,0xC0,0x2B,0x7B,0x96,
+	0xC0,0xE1,0xE1,0xC9,0x7A,0xAC,0x7C,0xFA,0xFB,0x30,0xBA,0xC2,0xFC,0x30,0x7D,0x93,
+	0xC2,0xFC,0x30,0x54,0x00,0x00,0x7B,0x0F,0x10,0x62,0xBA,0x1A,0x03,0x44,0x00,0x33,
+	0x1B,0x1A,0x4F,0x46,0x00,0xF1,0x18,0x13,0x23,0x06,0x08,0x1A,0x96,0xC2,0xC1,0x31,
+	0x1B,0x2B,0x05,0xC2,0x08,0x32,0xC1,0xC9,0xCD,0xED,0x31,0xC2,0xFA,0x30,0xC9,0xF7,
+	0x2A,0x55,0x0C,0xF8,0xCA,0x95,0x32,0xD4,0x58,0x32,0x21,0x49,0x2F,0xE5,0x8B,0x08,
+	0x80,0xD2,0x41,0x32,0xCD,0x9A,0x32,0xEB,0xD1,0xD1,0x0F,0x80,0x02,0x32,0xCC,0x0B,
+	0xC9,0x01,0x80,0x90,0x76,0x02,0xF0,0x00,0xAC,0x31,0xC0,0x61,0x6A,0xC3,0x37,0x32,
+	0xF7,0xE0,0xFA,0x6B,0x32,0xCA,0x95,0x18,0x16,0xF0,0x01,0xCD,0x8E,0x32,0x78,0xB7,
+	0xC8,0xCD,0x7E,0x31,0x21,0x54,0x0C,0x46,0xC3,0x2D,0x2F,0xE7,0x0F,0xF0,0x23,0x8E,
+	0x32,0x7C,0x55,0x1E,0x00,0x06,0x90,0xC3,0x05,0x31,0xF7,0xD0,0xCA,0x95,0x32,0xFC,
+	0x6B,0x32,0x21,0x00,0x00,0x22,0x51,0x0C,0x22,0x53,0x0C,0x3E,0x08,0x01,0x3E,0x04,
+	0xC3,0x3D,0x32,0xF7,0xC8,0x1E,0x0D,0xC3,0x21,0x0D,0x47,0x4F,0x57,0x5F,0xB7,0xC8,
+	0xE5,0x49,0x00,0xF1,0x24,0x7E,0x31,0xAE,0x67,0xFC,0xBE,0x32,0x3E,0x98,0x90,0xCD,
+	0x6E,0x2F,0x7C,0x17,0xDC,0x3F,0x2F,0x06,0x00,0xDC,0x5A,0x2F,0xE1,0xC9,0x1B,0x7A,
+	0xA3,0x3C,0xC0,0x0B,0xC9,0xF7,0xF8,0xEF,0xF2,0xD4,0x32,0xCD,0x1E,0x31,0xCD,0xD4,
+	0x32,0xC3,0x17,0x31,0xF7,0xF8,0xD2,0xF8,0x84,0x00,0x20,0x2B,0x32,0x38,0x03,0xF1,
+	0x06,0xFE,0x98,0x3A,0x55,0x0C,0xD0,0x7E,0xCD,0x9A,0x32,0x36,0x98,0x7B,0xF5,0x79,
+	0x17,0xCD,0xF5,0x2E,0xF1,0xC9,0x19,0x00,0xF3,0x11,0x90,0xDA,0x1C,0x32,0xC2,0x19,
+	0x33,0x4F,0x2B,0x7E,0xEE,0x80,0x06,0x06,0x2B,0xB6,0x05,0xC2,0x0B,0x33,0xB7,0x21,
+	0x00,0x80,0xCA,0x38,0x32,0x79,0xFE,0xB8,0xD0,0xF5,0x7C,0x00,0xF0,0x45,0x2B,0x36,
+	0xB8,0xF5,0xFC,0x41,0x33,0x21,0x57,0x0C,0x3E,0xB8,0x90,0xCD,0x66,0x35,0xF1,0xFC,
+	0x1E,0x35,0xAF,0x32,0x50,0x0C,0xF1,0xD0,0xC3,0xD2,0x34,0x21,0x51,0x0C,0x7E,0x35,
+	0xB7,0x23,0xCA,0x44,0x33,0xC9,0xE5,0x21,0x00,0x00,0x78,0xB1,0xCA,0x69,0x33,0x3E,
+	0x10,0x29,0xDA,0xBB,0x1F,0xEB,0x29,0xEB,0xD2,0x65,0x33,0x09,0xDA,0xBB,0x1F,0x3D,
+	0xC2,0x57,0x33,0xEB,0xE1,0xC9,0x7C,0x17,0x9F,0x47,0xCD,0x35,0x34,0x79,0x98,0xC3,
+	0x7B,0x33,0x0C,0x00,0xC0,0xE5,0x7A,0x17,0x9F,0x19,0x88,0x0F,0xAC,0xF2,0x37,0x32,
+	0xC5,0x39,0x17,0x10,0xF1,0x3A,0x17,0xF0,0x08,0xEB,0xCD,0x4F,0x34,0xC3,0xAD,0x37,
+	0x7C,0xB5,0xCA,0x38,0x32,0xE5,0xD5,0xCD,0x29,0x34,0xC5,0x44,0x4D,0x21,0x00,0x00,
+	0x53,0x00,0x20,0xD0,0x33,0x53,0x00,0xF6,0x11,0xB8,0x33,0x09,0xDA,0xD0,0x33,0x3D,
+	0xC2,0xAA,0x33,0xC1,0xD1,0x7C,0xB7,0xFA,0xC8,0x33,0xD1,0x78,0xC3,0x31,0x34,0xEE,
+	0x80,0xB5,0xCA,0xE1,0x33,0xEB,0x01,0xC1,0xE1,0x82,0x17,0xF0,0x09,0xC1,0xD1,0xC3,
+	0xDE,0x2F,0x78,0xB7,0xC1,0xFA,0x38,0x32,0xD5,0xCD,0x6E,0x32,0xD1,0xC3,0x1E,0x31,
+	0x7C,0xB5,0xCA,0x13,0x0D,0x55,0x00,0x42,0xEB,0xCD,0x35,0x34,0x59,0x00,0xF2,0x01,
+	0x11,0xF5,0xB7,0xC3,0x12,0x34,0xF5,0xE5,0x09,0xD2,0x11,0x34,0xF1,0x37,0x3E,0xE1,
+	0x8F,0x03,0xF0,0x14,0x7D,0x17,0x6F,0x7C,0x17,0x67,0xF1,0x3D,0xC2,0x08,0x34,0xEB,
+	0xC1,0xD5,0xC3,0xBE,0x33,0x7C,0xAA,0x47,0xCD,0x30,0x34,0xEB,0x7C,0xB7,0xF2,0x38,
+	0x32,0xAF,0x4F,0x95,0x6F,0x79,0x9C,0x0F,0x03,0x00,0xD4,0x01,0xF1,0x16,0x35,0x34,
+	0x7C,0xEE,0x80,0xB5,0xC0,0xEB,0xCD,0x8E,0x32,0xAF,0x06,0x98,0xC3,0x05,0x31,0xD5,
+	0xCD,0xEF,0x33,0xAF,0x82,0x1F,0x67,0x7B,0x1F,0x6F,0xCD,0x3B,0x32,0xF1,0xC3,0x31,
+	0x34,0x21,0x61,0x48,0x03,0xB0,0x21,0x62,0x0C,0x7E,0xB7,0xC8,0x47,0x2B,0x4E,0x11,
+	0x58,0x89,0x02,0xF1,0x10,0x93,0x31,0x90,0xD2,0x99,0x34,0x2F,0x3C,0xF5,0x0E,0x08,
+	0x23,0xE5,0x1A,0x46,0x77,0x78,0x12,0x1B,0x2B,0x0D,0xC2,0x89,0x34,0xE1,0x46,0x2B,
+	0x4E,0xF1,0xFE,0x39,0xD8,0x05,0xF0,0x0E,0x23,0x36,0x00,0x47,0xF1,0x21,0x61,0x0C,
+	0xCD,0x66,0x35,0x3A,0x5A,0x0C,0x32,0x50,0x0C,0x78,0xB7,0xF2,0xC7,0x34,0xCD,0x3B,
+	0x35,0xD2,0x0C,0x35,0xEB,0xE2,0x05,0xF0,0x18,0xCD,0x92,0x35,0xC3,0x0C,0x35,0x3E,
+	0x9E,0xCD,0x3D,0x35,0x21,0x59,0x0C,0xDC,0x53,0x35,0xAF,0x47,0x3A,0x57,0x0C,0xB7,
+	0xC2,0xFB,0x34,0x21,0x50,0x0C,0x0E,0x08,0x56,0x77,0x7A,0x23,0x0D,0xC2,0xE0,0x34,
+	0xE3,0x05,0xF5,0x08,0xC0,0xC2,0xD3,0x34,0xC3,0x0D,0x2F,0x05,0x21,0x50,0x0C,0xCD,
+	0x9A,0x35,0xB7,0xF2,0xF3,0x34,0x78,0xB7,0xCA,0x0C,0x35,0xDF,0x05,0x60,0x3A,0x50,
+	0x0C,0xB7,0xFC,0x1E,0x47,0x00,0xF0,0x05,0x7E,0xE6,0x80,0x2B,0x2B,0xAE,0x77,0xC9,
+	0x21,0x51,0x0C,0x06,0x07,0x34,0xC0,0x23,0x05,0xC2,0x23,0x35,0x6D,0x00,0xF0,0x00,
+	0x2B,0x36,0x80,0xC9,0x11,0x7E,0x0C,0x21,0x5B,0x0C,0xC3,0x43,0x35,0x3E,0x8E,0xA1,
+	0x03,0xF0,0x18,0x51,0x0C,0x0E,0x07,0x32,0x4A,0x35,0xAF,0x1A,0x8E,0x12,0x13,0x23,
+	0x0D,0xC2,0x49,0x35,0xC9,0x7E,0x2F,0x77,0x21,0x50,0x0C,0x06,0x08,0xAF,0x4F,0x79,
+	0x9E,0x77,0x23,0x05,0xC2,0x5D,0x35,0xC9,0x71,0xE5,0xF8,0x05,0xF0,0x53,0x35,0xE1,
+	0xE5,0x11,0x00,0x08,0x4E,0x73,0x59,0x2B,0x15,0xC2,0x72,0x35,0xC3,0x68,0x35,0xC6,
+	0x09,0x57,0xAF,0xE1,0x15,0xC8,0xE5,0x1E,0x08,0x7E,0x1F,0x77,0x2B,0x1D,0xC2,0x87,
+	0x35,0xC3,0x80,0x35,0x21,0x57,0x0C,0x16,0x01,0xC3,0x84,0x35,0x0E,0x08,0x7E,0x17,
+	0x77,0x23,0x0D,0xC2,0x9C,0x35,0xC9,0xEF,0xC8,0xCD,0xAC,0x30,0xCD,0x3A,0x36,0x71,
+	0x13,0x06,0x07,0x1A,0x13,0xB7,0xD5,0xCA,0xD1,0x35,0x0E,0x08,0xC5,0x1F,0x47,0xDC,
+	0x3B,0x35,0xCD,0x92,0x35,0x78,0xC1,0x0D,0xC2,0xBA,0x35,0xD1,0x05,0xC2,0xB1,0x35,
+	0x90,0x02,0x83,0x57,0x0C,0xCD,0x6E,0x35,0xC3,0xC9,0x35,0x5A,0x29,0x42,0x84,0x11,
+	0xDA,0x35,0xFE,0x03,0x40,0x3A,0x62,0x0C,0xB7,0xFE,0x01,0xF0,0x14,0xA9,0x30,0x34,
+	0x34,0xCD,0x3A,0x36,0x21,0x85,0x0C,0x71,0x41,0x3E,0x9E,0xCD,0x32,0x35,0x1A,0x99,
+	0x3F,0xDA,0x11,0x36,0x3E,0x8E,0xCD,0x32,0x35,0xAF,0xDA,0x12,0x04,0x3A,0x57,0x0C,
+	0x9A,0x05,0x40,0x0F,0x35,0x17,0x21,0xDD,0x00,0x50,0xCD,0x9C,0x35,0x21,0x7E,0x31,
+	0x01,0x40,0x78,0xB7,0xC2,0xFF,0x2D,0x01,0xF0,0x06,0x35,0xC2,0xFF,0x35,0xC3,0x49,
+	0x2F,0x79,0x32,0x61,0x0C,0x2B,0x11,0x84,0x0C,0x01,0x00,0x07,0x7E,0x12,0x71,0x3B,
+	0x04,0x70,0x45,0x36,0xC9,0xCD,0x9C,0x31,0xEB,0xE8,0x09,0x01,0x72,0x05,0x61,0x77,
+	0xE5,0xCD,0x6D,0x34,0xE1,0x71,0x05,0xF2,0x04,0xCD,0x0D,0x2F,0xCD,0x8B,0x32,0xF6,
+	0xAF,0xEB,0x01,0xFF,0x00,0x60,0x68,0xCC,0x38,0x32,0xEB,0x7E,0xF0,0x19,0xF0,0x63,
+	0x2D,0xF5,0xCA,0x8B,0x36,0xFE,0x2B,0xCA,0x8B,0x36,0x2B,0xD7,0xDA,0x43,0x37,0xFE,
+	0x2E,0xCA,0xFB,0x36,0xFE,0x45,0xC2,0xA4,0x36,0xE5,0xD7,0xFE,0x4C,0xE1,0x3E,0x00,
+	0xC2,0xB8,0x36,0x7E,0xFE,0x25,0xCA,0x06,0x37,0xFE,0x23,0xCA,0x0E,0x37,0xFE,0x21,
+	0xCA,0x0F,0x37,0xFE,0x44,0xC2,0xDD,0x36,0xB7,0xCD,0x15,0x37,0xE5,0x21,0xD2,0x36,
+	0xE3,0xD7,0x15,0xFE,0xF3,0xC8,0xFE,0x2D,0xC8,0x14,0xFE,0xF2,0xC8,0xFE,0x2B,0xC8,
+	0x2B,0xF1,0xD7,0xDA,0xB2,0x37,0x14,0xC2,0xDD,0x36,0xAF,0x93,0x5F,0xE5,0x7B,0x90,
+	0xF4,0x24,0x37,0xFC,0x32,0x37,0xC2,0xE0,0x36,0xE1,0xF1,0xE5,0xCC,0x17,0x31,0xE1,
+	0xF7,0xE8,0x90,0x10,0xF2,0x07,0xE5,0xCD,0x41,0x32,0xC9,0xF7,0x0C,0xC2,0xDD,0x36,
+	0xDC,0x15,0x37,0xC3,0x8B,0x36,0xF7,0xF2,0x10,0x0D,0x23,0xC3,0x56,0x00,0x30,0xC3,
+	0x0A,0x37,0x89,0x13,0x70,0xCC,0x50,0x32,0xF1,0xC4,0x7A,0x32,0x35,0x13,0xF0,0x01,
+	0xC8,0xF5,0xF7,0xF5,0xE4,0xDF,0x30,0xF1,0xEC,0x4F,0x36,0xF1,0x3D,0xC9,0xD5,0xE5,
+	0x0F,0x00,0xF0,0x17,0x2E,0x30,0xF1,0xEC,0xE2,0x35,0xF1,0xE1,0xD1,0x3C,0xC9,0xD5,
+	0x78,0x89,0x47,0xC5,0xE5,0x7E,0xD6,0x30,0xF5,0xF7,0xF2,0x78,0x37,0x2A,0x55,0x0C,
+	0x11,0xCD,0x0C,0xE7,0xD2,0x74,0x37,0x54,0x5D,0x29,0xB9,0x21,0x70,0x4F,0x09,0x7C,
+	0xB7,0xFA,0x72,0x37,0x1B,0x18,0xF0,0x0E,0xC1,0xD1,0xC3,0x8B,0x36,0x79,0xF5,0xCD,
+	0x6B,0x32,0x37,0xD2,0x94,0x37,0x01,0x74,0x94,0x11,0x00,0x24,0xCD,0xAC,0x31,0xF2,
+	0x91,0x37,0xCD,0xDF,0x30,0xB6,0x07,0x90,0xC3,0x6C,0x37,0xCD,0x82,0x32,0xCD,0x4F,
+	0x36,0x7C,0x1B,0x30,0xCD,0x00,0x31,0x0D,0x00,0x20,0x6D,0x34,0x16,0x00,0xB0,0x41,
+	0x31,0xCD,0x00,0x31,0xC1,0xD1,0xC3,0xA7,0x2E,0x7B,0x02,0x0C,0xF0,0x03,0x37,0x07,
+	0x07,0x83,0x07,0x86,0xD6,0x30,0x5F,0xFA,0x1E,0x32,0xC3,0xD2,0x36,0xE5,0x21,0x86,
+	0x6D,0x0E,0xF0,0x00,0xE1,0xCD,0x38,0x32,0xAF,0xCD,0x5D,0x38,0xB6,0xCD,0xF9,0x37,
+	0xC3,0xBE,0x22,0x0B,0x00,0xF1,0x03,0xE6,0x08,0xCA,0xE7,0x37,0x36,0x2B,0xEB,0xCD,
+	0x30,0x31,0xEB,0xF2,0xF9,0x37,0x36,0x2D,0xC5,0xF8,0x1A,0xF0,0x2D,0xC1,0xB4,0x23,
+	0x36,0x30,0x3A,0x02,0x0C,0x57,0x17,0x3A,0xCC,0x0B,0xDA,0xC5,0x38,0xCA,0xBD,0x38,
+	0xFE,0x05,0xEA,0x66,0x38,0x01,0x00,0x00,0xCD,0x71,0x3B,0x21,0x64,0x0C,0x46,0x0E,
+	0x20,0x3A,0x02,0x0C,0x5F,0xE6,0x20,0xCA,0x2C,0x38,0x78,0xB9,0x0E,0x2A,0xC2,0x2C,
+	0x38,0x41,0x71,0xD7,0xCA,0x4A,0x38,0xFE,0x45,0x05,0x00,0x10,0x44,0x05,0x00,0x60,
+	0x30,0xCA,0x2C,0x38,0xFE,0x2C,0x05,0x00,0xF0,0xAB,0x2E,0xC2,0x4D,0x38,0x2B,0x36,
+	0x30,0x7B,0xE6,0x10,0xCA,0x56,0x38,0x2B,0x36,0x24,0x7B,0xE6,0x04,0xC0,0x2B,0x70,
+	0xC9,0x32,0x02,0x0C,0x21,0x64,0x0C,0x36,0x20,0xC9,0xE5,0xDE,0x00,0x17,0x57,0x14,
+	0xCD,0x30,0x3A,0x01,0x00,0x03,0x82,0xFA,0x7F,0x38,0x14,0xBA,0xD2,0x7F,0x38,0x3C,
+	0x47,0x3E,0x02,0xD6,0x02,0xE1,0xF5,0xCD,0xC8,0x3A,0x36,0x30,0xCC,0x66,0x31,0xCD,
+	0xDC,0x3A,0x2B,0x7E,0xFE,0x30,0xCA,0x8E,0x38,0xFE,0x2E,0xC4,0x66,0x31,0xF1,0xCA,
+	0xBE,0x38,0xF5,0xF7,0x3E,0x22,0x8F,0x77,0x23,0xF1,0x36,0x2B,0xF2,0xAF,0x38,0x36,
+	0x2D,0x2F,0x3C,0x06,0x2F,0x04,0xD6,0x0A,0xD2,0xB1,0x38,0xC6,0x3A,0x23,0x70,0x23,
+	0x77,0x23,0x36,0x00,0xEB,0x21,0x64,0x0C,0xC9,0x23,0xC5,0xFE,0x04,0x7A,0xD2,0x3B,
+	0x39,0x1F,0xDA,0xD3,0x39,0x01,0x03,0x06,0xCD,0xC0,0x3A,0xD1,0x7A,0xD6,0x05,0xF4,
+	0x9C,0x3A,0xCD,0x71,0x3B,0x7B,0xB7,0xCC,0xD2,0x30,0x3D,0xF4,0x9C,0x3A,0xE5,0xCD,
+	0x15,0x38,0xE1,0xCA,0xF4,0x38,0x70,0x23,0x36,0x00,0x21,0x63,0x0C,0x23,0x3A,0x1C,
+	0x0C,0x95,0x92,0xC8,0x57,0x27,0xF0,0x02,0xF9,0x38,0xFE,0x2A,0xCA,0xF9,0x38,0x2B,
+	0xE5,0xF5,0x01,0x0D,0x39,0xC5,0xD7,0xFE,0x2D,0x49,0x02,0xF0,0x35,0xFE,0x24,0xC8,
+	0xC1,0xFE,0x30,0xC2,0x33,0x39,0x23,0xD7,0xD2,0x33,0x39,0x2B,0x01,0x2B,0x77,0xF1,
+	0xCA,0x29,0x39,0xC1,0xC3,0xFA,0x38,0xF1,0xCA,0x33,0x39,0xE1,0x36,0x25,0xC9,0xE5,
+	0x1F,0xDA,0xDA,0x39,0xCA,0x57,0x39,0x11,0xC8,0x3B,0xCD,0xE7,0x31,0x16,0x10,0xFA,
+	0x65,0x39,0xE1,0xC1,0xCD,0xDC,0x37,0x2B,0x36,0x25,0xC9,0x01,0x0E,0xB6,0x11,0xCA,
+	0x1B,0xDC,0x01,0xF0,0x03,0x4E,0x39,0x16,0x06,0xEF,0xC4,0x30,0x3A,0xE1,0xC1,0xFA,
+	0x88,0x39,0xC5,0x5F,0x78,0x92,0x93,0x98,0x00,0xF1,0x1C,0xB3,0x3A,0xCD,0xDC,0x3A,
+	0xB3,0xC4,0xAC,0x3A,0xB3,0xC4,0xC8,0x3A,0xD1,0xC3,0xE1,0x38,0x5F,0x79,0xB7,0xC4,
+	0x30,0x37,0x83,0xFA,0x93,0x39,0xAF,0xC5,0xF5,0xFC,0xA6,0x3C,0xC1,0x7B,0x90,0xC1,
+	0x5F,0x82,0x78,0xFA,0xAE,0x39,0x31,0x00,0xF0,0x15,0xC5,0xCD,0xB3,0x3A,0xC3,0xBF,
+	0x39,0xCD,0x9C,0x3A,0x79,0xCD,0xCC,0x3A,0x4F,0xAF,0x92,0x93,0xCD,0x9C,0x3A,0xC5,
+	0x47,0x4F,0xCD,0xDC,0x3A,0xC1,0xB1,0xC2,0xCA,0x39,0x2A,0x1C,0x0C,0x83,0xE5,0x00,
+	0xF1,0x06,0x50,0xC3,0xEA,0x38,0xE5,0xD5,0xCD,0x6B,0x32,0xD1,0xAF,0xCA,0xE0,0x39,
+	0x1E,0x10,0x01,0x1E,0x06,0xEF,0x37,0x7E,0x00,0xF0,0x3F,0xF5,0x79,0xB7,0xF5,0xC4,
+	0x30,0x37,0x80,0x4F,0x7A,0xE6,0x04,0xFE,0x01,0x9F,0x57,0x81,0x4F,0x93,0xF5,0xC5,
+	0xFC,0x32,0x37,0xFA,0xFE,0x39,0xC1,0xF1,0xC5,0xF5,0xFA,0x0C,0x3A,0xAF,0x2F,0x3C,
+	0x80,0x3C,0x82,0x47,0x0E,0x00,0xCD,0xDC,0x3A,0xF1,0xF4,0xA5,0x3A,0xC1,0xF1,0xCC,
+	0xD2,0x30,0xF1,0xDA,0x27,0x3A,0x83,0x90,0x92,0xC5,0xCD,0x9E,0x38,0xEB,0xD1,0xC3,
+	0xEA,0x38,0xD5,0xAF,0xF5,0xF7,0xE2,0x52,0x3A,0x0C,0x08,0x72,0x91,0xD2,0x52,0x3A,
+	0x11,0xA8,0x3B,0x5D,0x04,0xF0,0x08,0xCD,0xA5,0x35,0xF1,0xD6,0x0A,0xF5,0xC3,0x37,
+	0x3A,0xCD,0x81,0x3A,0xF7,0xEA,0x65,0x3A,0x01,0x43,0x91,0x11,0xF9,0x4F,0xCF,0x1F,
+	0x40,0x6B,0x3A,0x11,0xB0,0x22,0x01,0xF0,0x0B,0xF2,0x7E,0x3A,0xF1,0xCD,0x25,0x37,
+	0xF5,0xC3,0x55,0x3A,0xF1,0xCD,0x32,0x37,0xF5,0xCD,0x81,0x3A,0xF1,0xD1,0xC9,0xF7,
+	0xEA,0x91,0x3A,0x0A,0x03,0x20,0xF8,0x23,0x2C,0x00,0x40,0x97,0x3A,0x11,0xB8,0x2C,
+	0x00,0xF1,0x03,0xE1,0xF2,0x76,0x3A,0xE9,0xB7,0xC8,0x3D,0x36,0x30,0x23,0xC3,0x9D,
+	0x3A,0xC2,0xAC,0x3A,0xC8,0x26,0x02,0xF0,0x6B,0x23,0x3D,0xC3,0xA8,0x3A,0x7B,0x82,
+	0x3C,0x47,0x3C,0xD6,0x03,0xD2,0xB8,0x3A,0xC6,0x05,0x4F,0x3A,0x02,0x0C,0xE6,0x40,
+	0xC0,0x4F,0xC9,0x05,0xC2,0xD4,0x3A,0x36,0x2E,0x22,0x1C,0x0C,0x23,0x48,0xC9,0x0D,
+	0xC0,0x36,0x2C,0x23,0x0E,0x03,0xC9,0xD5,0xF7,0xE2,0x29,0x3B,0xC5,0xE5,0xCD,0x9C,
+	0x31,0x21,0xC0,0x3B,0xCD,0x96,0x31,0xCD,0x6D,0x34,0xAF,0xCD,0x1C,0x33,0xE1,0xC1,
+	0x11,0xD0,0x3B,0x3E,0x0A,0xCD,0xC8,0x3A,0xC5,0xF5,0xE5,0xD5,0x06,0x2F,0x04,0xE1,
+	0xE5,0x3E,0x9E,0xCD,0x40,0x35,0xD2,0x03,0x3B,0xE1,0x3E,0x8E,0xCD,0x40,0x35,0xEB,
+	0xE1,0x70,0x23,0xF1,0xC1,0x3D,0xC2,0xFA,0x3A,0xC5,0xE5,0x21,0x51,0x0C,0xCD,0x4E,
+	0x31,0xC3,0x35,0x48,0x00,0xF3,0x01,0x98,0x2E,0x3C,0xCD,0x9A,0x32,0xCD,0x51,0x31,
+	0xE1,0xC1,0xAF,0x11,0x16,0x3C,0x3F,0x42,0x00,0x00,0x03,0x1F,0xF2,0x0B,0x06,0x2F,
+	0x04,0x7B,0x96,0x5F,0x23,0x7A,0x9E,0x57,0x23,0x79,0x9E,0x4F,0x2B,0x2B,0xD2,0x49,
+	0x3B,0xCD,0x4E,0x2F,0x23,0xCD,0x51,0x31,0x4D,0x00,0xF2,0x01,0xDA,0x3B,0x3B,0x13,
+	0x13,0x3E,0x04,0xC3,0x77,0x3B,0xD5,0x11,0x1C,0x3C,0x3E,0x05,0x3B,0x00,0x10,0xEB,
+	0x0A,0x20,0x20,0x23,0xE3,0x43,0x0A,0x32,0x06,0x2F,0x04,0x21,0x1B,0x83,0xD2,0x8A,
+	0x3B,0x19,0x22,0x55,0x0C,0xD1,0x84,0x00,0x80,0x77,0x3B,0xCD,0xC8,0x3A,0x77,0xD1,
+	0xC9,0x00,0x00,0xF3,0x05,0xF9,0x02,0x15,0xA2,0xFD,0xFF,0x9F,0x31,0xA9,0x5F,0x63,
+	0xB2,0xFE,0xFF,0x03,0xBF,0xC9,0x1B,0x0E,0xB6,0x00,0x00,0x42,0x80,0x00,0x00,0x04,
+	0x10,0x00,0xF0,0x1E,0x80,0xC6,0xA4,0x7E,0x8D,0x03,0x00,0x40,0x7A,0x10,0xF3,0x5A,
+	0x00,0x00,0xA0,0x72,0x4E,0x18,0x09,0x00,0x00,0x10,0xA5,0xD4,0xE8,0x00,0x00,0x00,
+	0xE8,0x76,0x48,0x17,0x00,0x00,0x00,0xE4,0x0B,0x54,0x02,0x00,0x00,0x00,0xCA,0x9A,
+	0x3B,0x00,0x00,0x30,0xE1,0xF5,0x05,0x41,0x00,0x20,0x96,0x98,0x00,0x00,0x30,0x40,
+	0x42,0x0F,0x00,0x00,0xF4,0x00,0xA0,0x86,0x01,0x10,0x27,0x00,0x10,0x27,0xE8,0x03,
+	0x64,0x00,0x0A,0x00,0x01,0xA6,0x2F,0x13,0x84,0x3C,0x35,0x12,0x87,0x00,0x00,0x21,
+	0x7A,0x8A,0x00,0x00,0x31,0x40,0x1C,0x8E,0x00,0x00,0x31,0x50,0x43,0x91,0x00,0x00,
+	0x31,0x24,0x74,0x94,0x93,0x00,0x21,0x96,0x18,0x53,0x00,0x40,0x20,0xBC,0x3E,0x9B,
+	0x00,0x00,0x44,0x28,0x6B,0x6E,0x9E,0xC6,0x00,0x00,0x36,0x00,0x51,0xB7,0x43,0x3A,
+	0xA5,0x00,0x9B,0x00,0xF0,0x07,0x68,0xA8,0x00,0x00,0x7C,0xBC,0xE7,0x84,0x11,0xAC,
+	0x00,0x00,0x80,0xF4,0x20,0xE6,0x35,0xAF,0x00,0xF0,0xE9,0x33,0xE6,0x00,0x04,0xD6,
+	0x00,0x00,0x91,0x05,0xF0,0x06,0x2F,0x07,0x07,0x07,0xF5,0xF7,0xDA,0xD1,0x3C,0xD1,
+	0xF1,0xF5,0xFE,0xF0,0xDA,0xFE,0x3C,0x21,0x26,0x3C,0x5A,0x13,0x27,0x03,0x81,0x02,
+	0x21,0xEB,0x35,0xE2,0x18,0x00,0x1E,0x00,0x76,0xF9,0xDA,0xFE,0x3C,0x7A,0xC6,0x04,
+	0x80,0x0B,0x90,0xD5,0xC5,0x16,0x00,0x5F,0x21,0x26,0x3C,0x19,0x53,0x1C,0xB0,0xCD,
+	0x71,0x31,0xC1,0xD1,0xCD,0x39,0x30,0xC3,0xCC,0x3C,0xF1,0x0D,0x00,0x07,0x00,0xF2,
+	0x0B,0x47,0xC2,0x06,0x01,0xC5,0xCD,0x9A,0x29,0xC1,0x11,0x63,0x0C,0xD5,0xAF,0x12,
+	0x05,0x04,0x0E,0x06,0xCA,0x24,0x3D,0x0E,0x04,0x29,0x8F,0x02,0x00,0xF0,0x21,0xB7,
+	0xC2,0x35,0x3D,0x79,0x3D,0xCA,0x35,0x3D,0x1A,0xB7,0xCA,0x41,0x3D,0xAF,0xC6,0x30,
+	0xFE,0x3A,0xDA,0x3E,0x3D,0xC6,0x07,0x12,0x13,0x12,0xAF,0x0D,0xCA,0x4E,0x3D,0x05,
+	0x04,0xCA,0x20,0x3D,0xC3,0x1E,0x3D,0x12,0xE1,0xC9,0x21,0x1E,0x31,0xE3,0xE9,0x28,
+	0x0D,0x20,0xC4,0x3B,0x39,0x02,0x21,0x65,0x3D,0x34,0x21,0x80,0xEF,0x78,0xCA,0xA8,
+	0x3D,0xF2,0x73,0x3D,0x81,0x07,0xF0,0x00,0xB7,0xCA,0x0E,0x2F,0xD5,0xC5,0x79,0xF6,
+	0x7F,0xCD,0x5C,0x31,0xF2,0x90,0x3D,0xEA,0x0F,0xA4,0x32,0xC1,0xD1,0xF5,0xCD,0xAC,
+	0x31,0xE1,0x7C,0x1F,0x4D,0x21,0xF0,0x01,0xDC,0x51,0x3D,0xCC,0x1E,0x31,0xD5,0xC5,
+	0xCD,0xA3,0x2F,0xC1,0xD1,0xCD,0xDE,0x2F,0x1B,0x22,0x80,0x38,0x81,0x11,0x3B,0xAA,
+	0xCD,0xDE,0x2F,0x7D,0x03,0xF0,0x00,0x88,0xD2,0xD4,0x30,0xCD,0xDF,0x32,0xC6,0x80,
+	0xC6,0x02,0xDA,0xD4,0x30,0xF5,0x08,0x0E,0x60,0x9B,0x2E,0xCD,0xD8,0x2F,0xF1,0x4A,
+	0x00,0xF0,0x21,0xA4,0x2E,0xCD,0x1E,0x31,0x21,0xE8,0x3D,0xCD,0x18,0x3E,0x11,0x00,
+	0x00,0xC1,0x4A,0xC3,0xDE,0x2F,0x08,0x40,0x2E,0x94,0x74,0x70,0x4F,0x2E,0x77,0x6E,
+	0x02,0x88,0x7A,0xE6,0xA0,0x2A,0x7C,0x50,0xAA,0xAA,0x7E,0xFF,0xFF,0x7F,0x7F,0x00,
+	0x00,0x80,0x81,0x73,0x0E,0x71,0xCD,0x41,0x31,0x11,0xDC,0x33,0xD5,0x70,0x0B,0x20,
+	0xDE,0x2F,0x42,0x0A,0xC0,0x7E,0x23,0xCD,0x4E,0x31,0x06,0xF1,0xC1,0xD1,0x3D,0xC8,
+	0xD5,0xEB,0x2F,0x00,0x16,0x00,0x00,0xA2,0x23,0xF0,0x13,0xA7,0x2E,0xE1,0xC3,0x21,
+	0x3E,0xEF,0x21,0xA2,0x3E,0xFA,0x98,0x3E,0x21,0xC3,0x3E,0xCD,0x4E,0x31,0x21,0xA2,
+	0x3E,0xC8,0x86,0xE6,0x07,0x06,0x00,0x77,0x23,0x87,0x87,0x4F,0x09,0xB4,0x0F,0xF0,
+	0x00,0xDE,0x2F,0x3A,0xA1,0x3E,0x3C,0xE6,0x03,0x06,0x00,0xFE,0x01,0x88,0x32,0xA1,
+	0x29,0x00,0x01,0x1B,0x00,0xF1,0x18,0x9B,0x2E,0xCD,0x5C,0x31,0x7B,0x59,0xEE,0x4F,
+	0x4F,0x36,0x80,0x2B,0x46,0x36,0x80,0x21,0xA0,0x3E,0x34,0x7E,0xD6,0xAB,0xC2,0x8F,
+	0x3E,0x77,0x0C,0x15,0x1C,0xCD,0xF8,0x2E,0x21,0xC3,0x3E,0xC3,0x68,0x31,0x46,0x2F,
+	0xF0,0x2A,0xC3,0x73,0x3E,0x00,0x00,0x00,0x35,0x4A,0xCA,0x99,0x39,0x1C,0x76,0x98,
+	0x22,0x95,0xB3,0x98,0x0A,0xDD,0x47,0x98,0x53,0xD1,0x99,0x99,0x0A,0x1A,0x9F,0x98,
+	0x65,0xBC,0xCD,0x98,0xD6,0x77,0x3E,0x98,0x52,0xC7,0x4F,0x80,0x68,0xB1,0x46,0x68,
+	0x99,0xE9,0x92,0x69,0x10,0xD1,0x75,0x68,0x21,0x19,0x3F,0x66,0x00,0x81,0x41,0x31,
+	0x01,0x49,0x83,0x11,0xDB,0x0F,0x26,0x10,0x30,0xCD,0x39,0x30,0x43,0x07,0x00,0x69,
+	0x01,0xF0,0x08,0xCD,0xA4,0x2E,0x21,0x1D,0x3F,0xCD,0xA1,0x2E,0xEF,0x37,0xF2,0x05,
+	0x3F,0xCD,0x98,0x2E,0xEF,0xB7,0xF5,0xF4,0x1E,0x31,0x14,0x00,0xF0,0x00,0x9B,0x2E,
+	0xF1,0xD4,0x1E,0x31,0x21,0x21,0x3F,0xC3,0x09,0x3E,0xDB,0x0F,0x49,0x18,0x01,0xF0,
+	0x07,0x7F,0x05,0xBA,0xD7,0x1E,0x86,0x64,0x26,0x99,0x87,0x58,0x34,0x23,0x87,0xE0,
+	0x5D,0xA5,0x86,0xDA,0x0F,0x49,0x83,0x4C,0x00,0x32,0xD9,0x3E,0xC1,0xB0,0x0B,0xF0,
+	0x00,0x51,0x31,0xCD,0xD3,0x3E,0xC3,0x37,0x30,0xEF,0xFC,0x51,0x3D,0xFC,0x1E,0x31,
+	0x9E,0x01,0x40,0x81,0xDA,0x66,0x3F,0x49,0x2D,0x10,0x59,0xA3,0x0F,0xF0,0x1F,0xA1,
+	0x2E,0xE5,0x21,0x70,0x3F,0xCD,0x09,0x3E,0x21,0x19,0x3F,0xC9,0x09,0x4A,0xD7,0x3B,
+	0x78,0x02,0x6E,0x84,0x7B,0xFE,0xC1,0x2F,0x7C,0x74,0x31,0x9A,0x7D,0x84,0x3D,0x5A,
+	0x7D,0xC8,0x7F,0x91,0x7E,0xE4,0xBB,0x4C,0x7E,0x6C,0xAA,0xAA,0x7F,0x8C,0x01,0x63,
+	0xF6,0x37,0x9F,0x32,0x08,0x0C,0x81,0x26,0x01,0x4F,0x19,0x10,0xE3,0x50,0x19,0x02,
+	0xCE,0x19,0x11,0x46,0x2F,0x19,0x10,0xD5,0x7D,0x2C,0xF0,0x13,0xE7,0xEB,0x1E,0x3B,
+	0xDA,0x21,0x0D,0xD1,0x3A,0x08,0x0C,0xB1,0x90,0xD2,0xD5,0x3F,0x36,0x20,0x23,0x3C,
+	0xC2,0xCD,0x3F,0x41,0x04,0x0C,0x0D,0xCA,0xE9,0x3F,0x05,0xCA,0xED,0x3F,0x6A,0x0E,
+	0x20,0xC3,0xD7,0x19,0x00,0xF1,0x3D,0x05,0xC2,0xE6,0x3F,0xE1,0xC9,0xCD,0xBE,0x46,
+	0xFE,0x01,0xC2,0x7F,0x47,0x21,0x06,0x00,0x09,0x7E,0x23,0xB6,0x23,0xC2,0x04,0x40,
+	0x23,0x7E,0xD6,0x01,0x9F,0xC3,0x29,0x31,0x3E,0x02,0x01,0x3E,0x04,0x01,0x3E,0x08,
+	0xF5,0xCD,0x98,0x21,0xF1,0xCD,0x2F,0x22,0x2A,0xFE,0x0B,0xCD,0x9F,0x31,0xC3,0xC2,
+	0x24,0x3E,0x01,0x01,0x3E,0x03,0x01,0x3E,0x07,0xF5,0xCD,0x38,0x24,0xF1,0xBE,0xD2,
+	0x72,0x15,0x3C,0x3B,0x15,0xF0,0x09,0x32,0xCC,0x0B,0xC3,0x96,0x31,0xCD,0xB4,0x46,
+	0xCA,0x85,0x47,0xD6,0x04,0xC2,0x7F,0x47,0x11,0x0A,0x00,0xEB,0x09,0x47,0xEB,0x6D,
+	0x2B,0xA2,0xD5,0xC5,0xCD,0x19,0x27,0xF5,0xCF,0x41,0xCF,0x53,0xC5,0x00,0xF0,0x00,
+	0xF1,0xC1,0xE3,0x4F,0x80,0xDA,0x97,0x47,0xFE,0x81,0xD2,0x97,0x47,0xEB,0x71,0x94,
+	0x12,0xC1,0x06,0x00,0xE1,0xC3,0x4E,0x40,0x01,0xAE,0x47,0xC3,0x93,0x40,0x27,0x24,
+	0xF2,0x12,0x01,0x38,0x44,0xC3,0x93,0x40,0x01,0xAD,0x48,0xC2,0xB1,0x40,0x3A,0x9E,
+	0x07,0xE5,0xC5,0xF5,0x11,0xA2,0x40,0xD5,0xC5,0xC9,0xF1,0xC1,0x3D,0xF2,0x9A,0x40,
+	0xE1,0xC9,0xC1,0xC7,0x2B,0x00,0xDC,0x19,0xD0,0xE3,0xE5,0x11,0xAA,0x40,0xD5,0xE9,
+	0xD5,0xC5,0xAF,0xCD,0xC6,0x40,0xCA,0x1A,0x21,0x01,0x6E,0x36,0x00,0xF0,0x0C,0x88,
+	0x09,0xC3,0x99,0x40,0xD5,0xC5,0xE5,0x3A,0x88,0x09,0xB7,0xCA,0xE5,0x40,0xF5,0xCD,
+	0x6E,0x48,0xF1,0x3D,0xC2,0xDC,0x40,0xE1,0xC1,0xD1,0x42,0x1A,0xA0,0xCD,0xDD,0x46,
+	0x23,0x23,0xC3,0xFE,0x40,0xCD,0xBE,0xB4,0x00,0xA2,0x21,0x05,0x00,0x09,0x7E,0x2B,
+	0x6E,0xC3,0x7E,0x20,0x10,0x00,0xF0,0x08,0xCD,0xFA,0x46,0x6E,0x26,0x00,0x29,0x29,
+	0x2B,0x29,0x2B,0xC3,0x38,0x32,0xF6,0xAF,0x32,0x62,0x09,0xCD,0xB4,0x46,0xFE,0xDA,
+	0x00,0x41,0xC5,0xE5,0x21,0x04,0x5B,0x31,0x10,0xE3,0x7F,0x29,0x21,0x6D,0x15,0xD6,
+	0x1F,0xB0,0xE3,0x72,0x2B,0x73,0x23,0x23,0x23,0x36,0x80,0xE1,0xC1,0x8D,0x19,0x50,
+	0xF5,0x07,0xE7,0xDA,0x94,0x45,0x00,0xD2,0xD1,0x7B,0xB2,0xCA,0x94,0x47,0x13,0x7B,
+	0xE6,0x07,0x47,0x0E,0x03,0xD9,0x11,0xF0,0x21,0xB7,0x0D,0xC2,0x5F,0x41,0x78,0xC6,
+	0xF9,0x7B,0x89,0x96,0xD2,0xB2,0x41,0x23,0x19,0xCD,0x41,0x42,0x80,0x47,0xC5,0x3C,
+	0xE6,0x07,0x78,0xC2,0x88,0x41,0x23,0x7E,0xCD,0x41,0x42,0x3D,0x3C,0x67,0x69,0x22,
+	0x28,0x08,0xC1,0xE1,0xE5,0x11,0x06,0x00,0x19,0xB0,0x21,0xF0,0x06,0x36,0x80,0xE1,
+	0x3A,0x62,0x09,0xB7,0xC2,0xAB,0x41,0xCD,0x2D,0x4C,0xDA,0x7C,0x47,0xE1,0xC9,0xCD,
+	0x1F,0x4B,0x93,0x16,0x11,0x57,0x17,0x00,0x33,0xD5,0x41,0xC1,0x94,0x00,0xF0,0x1D,
+	0x13,0x72,0x2B,0x73,0x21,0x0A,0x00,0x09,0x0E,0x80,0xAF,0x77,0x0D,0x23,0xC2,0xCD,
+	0x41,0xE1,0xC9,0x22,0x08,0x0C,0xE3,0x22,0x64,0x09,0xE3,0x14,0xC5,0x7A,0x86,0x4A,
+	0x16,0x00,0xD5,0x5E,0x77,0x19,0xC5,0xCD,0x41,0x42,0x23,0x51,0xA9,0x1A,0xA0,0x44,
+	0x4D,0xCD,0xA6,0x4D,0xC2,0x08,0x42,0xE1,0xC1,0x27,0x27,0xF0,0x0F,0x91,0x77,0xCD,
+	0x7A,0x4D,0xC3,0x76,0x47,0x63,0x6A,0x22,0x28,0x08,0x87,0x87,0x87,0x82,0xD6,0x06,
+	0xE1,0x77,0x2B,0x16,0x07,0xCD,0x4E,0x42,0x23,0x16,0x08,0xD2,0x0E,0xF0,0x09,0x22,
+	0x28,0x08,0xE1,0x15,0xD5,0xCD,0x4E,0x42,0xD1,0x14,0x15,0xC2,0x26,0x42,0xC1,0x0D,
+	0xC2,0xE8,0x41,0xCD,0x7A,0x4D,0xD1,0x3F,0x00,0xF0,0x08,0xC3,0x73,0x41,0x7E,0xE6,
+	0x3F,0xC6,0x06,0x4F,0x7E,0xE6,0xC0,0x1F,0x1F,0x1F,0xC9,0x1E,0x80,0xE5,0x21,0x1E,
+	0x07,0xAF,0x5A,0x1D,0xF0,0x04,0x55,0x42,0x1E,0x80,0xE1,0xE5,0xCD,0x41,0x42,0x82,
+	0x47,0x3C,0xE6,0x07,0xCA,0x70,0x42,0x60,0x24,0xE2,0x00,0xF1,0x0E,0x2A,0x64,0x09,
+	0x23,0x7E,0x23,0x56,0x21,0x1E,0x07,0xCD,0x1E,0x4F,0xE1,0xC9,0xCD,0x27,0x47,0xE5,
+	0x21,0x14,0x07,0x11,0x35,0x08,0xCD,0xC8,0x42,0xE1,0x31,0x02,0xF0,0x08,0x5C,0x47,
+	0xE5,0x11,0x35,0x08,0x21,0x1C,0x07,0xCD,0xC8,0x42,0xCD,0xD4,0x48,0xC2,0x9A,0x47,
+	0x11,0x14,0x07,0xCD,0xC5,0x0C,0x00,0x61,0xCA,0x82,0x47,0x2B,0x2B,0x11,0x1A,0x00,
+	0x30,0x3A,0x02,0x07,0x44,0x00,0xF1,0x0E,0xF3,0x49,0xE1,0xC3,0x61,0x48,0x21,0x35,
+	0x08,0x0E,0x08,0x2B,0x1B,0x1A,0x77,0x0D,0xC2,0xCA,0x42,0xC9,0x1E,0x00,0xC1,0xCA,
+	0xE1,0x42,0xCD,0x1A,0x27,0xA7,0x01,0xF0,0x3A,0x7B,0xCD,0x6A,0x47,0x22,0x08,0x0C,
+	0x06,0x00,0xCD,0x4C,0x49,0x0E,0x08,0x21,0x1E,0x07,0x11,0x08,0x00,0x7E,0x3C,0xCA,
+	0x2A,0x43,0x3D,0xCA,0x20,0x43,0xCD,0xFC,0x52,0x53,0x7E,0x23,0xDF,0x15,0xC2,0x02,
+	0x43,0x3A,0x27,0x00,0xC6,0x0A,0x57,0x3A,0xF8,0x06,0x92,0xDA,0x1A,0x43,0x3E,0x20,
+	0xDF,0xDF,0xDC,0x67,0x18,0x16,0x00,0x3E,0x19,0x19,0x0D,0xC2,0xF5,0x42,0x04,0xC3,
+	0xEA,0x42,0xEF,0x00,0xF0,0x03,0x39,0x12,0x16,0x03,0xAF,0xC3,0x2D,0x45,0xF6,0xAF,
+	0xF5,0x16,0x01,0xCD,0x32,0x43,0xC2,0x7F,0x4C,0x2B,0xF0,0x09,0xD2,0x40,0xCA,0x52,
+	0x43,0xCF,0x2C,0xCF,0x52,0xC2,0x10,0x0D,0xF1,0xF6,0xF1,0x32,0x60,0x09,0xCD,0x1D,
+	0x0F,0x2A,0x68,0x09,0xD0,0x34,0x42,0xFE,0x4B,0x3C,0xC2,0xD0,0x34,0xF3,0x11,0x2A,
+	0xFC,0x06,0x01,0xAA,0xFF,0x09,0xE7,0xEB,0xDA,0x83,0x43,0xE5,0xCD,0xFE,0x4B,0xE1,
+	0xDA,0x89,0x43,0x77,0x23,0xC3,0x69,0x43,0xCD,0x1D,0x0F,0xC3,0xDE,0x0C,0xAF,0x64,
+	0x34,0xF2,0x01,0xCD,0x96,0x0E,0xCD,0x2D,0x0F,0xCD,0x96,0x45,0x3A,0x60,0x09,0xB7,
+	0xCA,0x9F,0x0D,0x77,0x00,0x11,0xC1,0x6F,0x00,0xC0,0x2B,0xD7,0xCA,0xB8,0x43,0xCD,
+	0x96,0x45,0xC3,0x10,0x0D,0xAF,0x66,0x00,0x02,0x5D,0x00,0xB2,0xC3,0x7F,0x47,0xCD,
+	0x74,0x48,0xC3,0x76,0x47,0x16,0x02,0x24,0x00,0x10,0xDD,0x8D,0x00,0xC1,0x41,0xC3,
+	0x2C,0x27,0xCD,0xF2,0x2D,0x3E,0xFF,0xCD,0xC3,0x4B,0x1C,0x25,0xF0,0x01,0x00,0x07,
+	0xE7,0xCA,0x96,0x45,0x7E,0x23,0xD5,0xCD,0xC3,0x4B,0xD1,0xC3,0xEC,0x43,0x55,0x1E,
+	0x10,0x2C,0x57,0x04,0x10,0xE3,0x52,0x03,0x00,0xA5,0x12,0x50,0x66,0x68,0x3E,0x89,
+	0x91,0xA5,0x1D,0xF5,0x05,0xFE,0x8A,0xCA,0x72,0x15,0x47,0xCD,0x1F,0x51,0x3E,0x80,
+	0xD3,0x09,0xCD,0xC7,0x50,0xE1,0xC9,0x3E,0x89,0x71,0x1F,0xF2,0x05,0xCD,0xF5,0x50,
+	0xC3,0xC2,0x24,0x5F,0x47,0xCD,0xE8,0x46,0x78,0x36,0x01,0xCD,0x1A,0x4E,0xCD,0x3C,
+	0x51,0x27,0x02,0xF0,0x1E,0x21,0x1E,0x07,0x0E,0x80,0x36,0x00,0x23,0x0D,0xC2,0x51,
+	0x44,0x0E,0x06,0xCD,0x32,0x51,0xDB,0x08,0xE6,0x02,0xC2,0x5D,0x44,0x3E,0x01,0xD3,
+	0x09,0x0D,0xC2,0x5D,0x44,0x0E,0x06,0x06,0x00,0xC5,0x78,0x32,0x04,0x07,0x79,0x32,
+	0x03,0x07,0x77,0x13,0xF0,0x10,0x1E,0x07,0xCD,0x32,0x51,0xCD,0x21,0x4F,0xD2,0xA3,
+	0x44,0x21,0xE1,0x44,0x06,0x0E,0x7E,0xDF,0x23,0x05,0xC2,0x8D,0x44,0x3A,0x03,0x07,
+	0xCD,0x77,0x4E,0x3A,0x04,0x06,0x00,0x00,0x6D,0x17,0xE4,0x04,0x78,0xFE,0x20,0xC2,
+	0x70,0x44,0x0C,0x79,0xFE,0x4D,0xCA,0xC3,0x44,0x58,0x00,0x11,0xB5,0x58,0x00,0xF1,
+	0x07,0xC3,0x6E,0x44,0xCD,0x3C,0x51,0xE5,0x01,0x46,0x00,0x71,0xCD,0xF4,0x4E,0x21,
+	0x1E,0x07,0x36,0xFF,0x50,0x3A,0x02,0x5D,0x02,0x61,0x36,0xFF,0xDA,0x79,0x47,0xC9,
+	0x20,0x3E,0x50,0x20,0x57,0x52,0x49,0x54,0x96,0x3F,0x43,0x01,0x04,0x19,0xC5,0x9E,
+	0x1E,0x50,0x7E,0xB7,0xCA,0x7F,0x47,0x1D,0x08,0xC0,0x0A,0x16,0x02,0xFE,0x4F,0xCA,
+	0x19,0x45,0x16,0x01,0xFE,0x49,0x07,0x00,0xF0,0x00,0x04,0xFE,0x52,0xC2,0x7F,0x47,
+	0xE1,0xCF,0x2C,0xD5,0xFE,0x23,0xCC,0x92,0x12,0x81,0x1E,0xF0,0x04,0x2C,0x7B,0xB7,
+	0xCA,0x85,0x47,0xD1,0xD5,0xCD,0xC1,0x46,0xC2,0x8E,0x47,0xF1,0x02,0xC5,0xCD,0x5C,
+	0x55,0x02,0xF0,0x03,0xCD,0xD4,0x48,0xE1,0xE5,0x22,0x64,0x09,0x32,0x63,0x09,0x23,
+	0x3A,0x02,0x07,0x77,0xCA,0xA6,0xB6,0x01,0xD1,0x4F,0x3A,0x61,0x09,0x3C,0x87,0x87,
+	0x87,0x91,0x23,0x3C,0x77,0x23,0xD7,0x01,0x50,0x77,0x23,0x72,0x23,0x73,0x08,0x00,
+	0xF0,0x1F,0xE1,0x7E,0xFE,0x01,0xCA,0xB6,0x45,0xE6,0x02,0x3A,0x63,0x09,0xCA,0xD1,
+	0x45,0xB7,0xCA,0x9C,0x45,0xBE,0xCA,0x8B,0x45,0x7E,0xFE,0x03,0xC2,0xCC,0x45,0xCD,
+	0xFE,0x49,0xF5,0x7E,0xE6,0x01,0xCA,0xA0,0x45,0xF1,0xCD,0x04,0x19,0xCD,0x6E,0x48,
+	0x1D,0x36,0xF0,0x11,0xF1,0xDA,0x7C,0x47,0xE5,0x23,0x2B,0x7E,0xE6,0x01,0x1E,0x35,
+	0xC2,0x66,0x46,0xCD,0x5F,0x49,0x23,0xC3,0x50,0x45,0xCD,0x23,0x4C,0x3A,0x63,0x09,
+	0xFE,0x02,0xCA,0x9C,0x0B,0x00,0xF2,0x66,0xCD,0x23,0x4C,0xF6,0x7F,0xC3,0x9C,0x45,
+	0x1E,0x41,0xC3,0x66,0x46,0xB7,0xCA,0xDC,0x45,0xFE,0x04,0x1E,0x36,0xC2,0x66,0x46,
+	0x3A,0x2A,0x08,0x11,0x0C,0x07,0x47,0x04,0xAF,0x12,0x13,0x05,0xC2,0xE5,0x45,0xCD,
+	0x42,0x4D,0x0A,0x77,0xC2,0x90,0x46,0xE5,0x16,0x00,0x21,0x0D,0x07,0x14,0x3A,0x2A,
+	0x08,0xBA,0xDA,0x52,0x46,0x7E,0x23,0xB7,0xC2,0xF9,0x45,0xE1,0x72,0x7A,0xCD,0xFF,
+	0x46,0x3A,0x63,0x09,0xB7,0xC2,0x75,0x46,0x36,0x01,0x23,0xE5,0x01,0x00,0x00,0x70,
+	0x23,0x0D,0xC2,0x1B,0x46,0xD1,0x2A,0x64,0x09,0x01,0x07,0x00,0x09,0x7E,0x87,0x87,
+	0x87,0x2B,0xD6,0x06,0x86,0x12,0xD5,0xCD,0x7A,0x4D,0xE1,0x16,0x02,0x12,0x04,0x90,
+	0x7A,0xD6,0x07,0xC2,0x39,0x46,0xE5,0x6F,0x67,0x26,0x04,0x52,0xCD,0x4E,0x42,0xC3,
+	0x90,0x45,0x00,0xF1,0x01,0x64,0x46,0x2A,0x37,0x08,0x36,0x00,0x2A,0x64,0x09,0xCD,
+	0xE9,0x49,0x1E,0x44,0xD5,0x78,0x04,0x60,0x78,0xB1,0xC4,0x74,0x48,0xD1,0xF2,0x23,
+	0x41,0xCD,0x23,0x4C,0xD1,0xD9,0x37,0x82,0x64,0x46,0x12,0x13,0xCD,0xA7,0x46,0xD5,
+	0x11,0x00,0x50,0xCD,0xA7,0x46,0x01,0x04,0x35,0x00,0x40,0x09,0x36,0x01,0x01,0xE9,
+	0x22,0x00,0x83,0x00,0xB0,0x9E,0x46,0xC3,0x9C,0x45,0x23,0x23,0x06,0x80,0x7E,0x12,
+	0x36,0x15,0x52,0xAB,0x46,0xC9,0x2B,0xD7,0x99,0x01,0xF0,0x0B,0xE4,0x1A,0xCD,0x1D,
+	0x27,0x5F,0x3A,0x88,0x09,0xBB,0xDA,0x85,0x47,0x16,0x00,0xE5,0xEB,0x22,0x3A,0x08,
+	0xEB,0x21,0x68,0x09,0x19,0x19,0x0E,0x29,0xF0,0x1C,0x0A,0xB7,0xC9,0x5F,0xCD,0xE8,
+	0x46,0xB6,0xF0,0x1E,0x38,0xC3,0x66,0x46,0x3A,0x9E,0x07,0xBB,0xDA,0xE3,0x46,0x7B,
+	0x21,0x58,0x56,0x11,0x27,0x00,0x3C,0xC3,0x09,0x47,0x21,0x03,0x00,0x09,0x7E,0x2A,
+	0x2B,0x08,0x11,0x01,0x01,0x0A,0x02,0xF0,0x0C,0x3D,0xC8,0x19,0xC3,0x09,0x47,0x0E,
+	0x01,0xFE,0x23,0xC0,0xC5,0xCD,0xB4,0x46,0xD1,0xBB,0xC2,0x7F,0x47,0xCF,0x2C,0xEB,
+	0x60,0x69,0x22,0x64,0x6B,0x26,0x05,0x34,0x02,0x61,0x91,0x47,0xFE,0x09,0xD2,0x91,
+	0x39,0x02,0xF0,0x0E,0x21,0x35,0x08,0x5F,0x3E,0x08,0x2B,0x36,0x20,0x3D,0xC2,0x42,
+	0x47,0x0A,0x3C,0xCA,0x91,0x47,0x3D,0xCA,0x91,0x47,0x0A,0x77,0x1D,0x23,0x03,0xC2,
+	0x52,0xB1,0x05,0x81,0x27,0x47,0x2B,0xD7,0x7B,0xCA,0x6A,0x47,0xD3,0x1D,0xF1,0x23,
+	0x32,0x02,0x07,0xD5,0xE5,0xCD,0xDE,0x46,0xE1,0xD1,0x7B,0xC9,0x1E,0x3D,0x01,0x1E,
+	0x39,0x01,0x1E,0x45,0x01,0x1E,0x36,0x01,0x1E,0x35,0x01,0x1E,0x34,0x01,0x1E,0x33,
+	0x01,0x1E,0x3E,0x01,0x1E,0x37,0x01,0x1E,0x40,0x01,0x1E,0x3F,0x01,0x1E,0x32,0x01,
+	0x1E,0x3A,0x1C,0x25,0x00,0x5A,0x20,0x20,0x1E,0x42,0x4E,0x31,0x31,0xC3,0x74,0x12,
+	0x76,0x03,0xF0,0x08,0x7E,0x3C,0x1E,0x3C,0xC2,0x21,0x0D,0x77,0x78,0xCD,0x1A,0x4E,
+	0x06,0x24,0xE5,0x23,0x23,0x23,0x77,0x05,0xC2,0xC4,0x47,0x89,0x28,0xF0,0x1D,0x08,
+	0x0C,0xC5,0xCD,0xE1,0x4E,0x01,0x06,0x00,0xCD,0xF4,0x4E,0xC1,0x3E,0x06,0x02,0x03,
+	0xC5,0x03,0x16,0x05,0x03,0xC5,0x4A,0x2E,0x00,0x7D,0x87,0x87,0x87,0x87,0x6F,0x0C,
+	0x79,0xFE,0x46,0xCA,0xE6,0x47,0xFE,0x4D,0xCA,0x56,0x48,0x26,0x03,0xF3,0x6E,0x80,
+	0x4E,0xCD,0x32,0x51,0x1E,0x00,0xFB,0x00,0xF3,0xDB,0x09,0x1F,0xDA,0x05,0x48,0x3C,
+	0xE6,0x1F,0x47,0x0F,0x0F,0x0F,0x57,0xE6,0xE0,0xC2,0x05,0x48,0x14,0x3E,0x10,0x32,
+	0x1E,0x51,0x1F,0x15,0xC2,0x21,0x48,0x57,0xC5,0xE5,0xD5,0x21,0x1E,0x07,0x16,0x00,
+	0xCD,0xF7,0x4F,0xD1,0xE1,0xC1,0xDA,0x42,0x48,0x7D,0x2A,0x08,0x0C,0x23,0x22,0x08,
+	0x0C,0xB2,0x6F,0x7B,0xB2,0x5F,0xFE,0x0F,0xC2,0x05,0x48,0x79,0x1F,0xD2,0xE8,0x47,
+	0x51,0xC1,0x7D,0x02,0xC3,0xE3,0x47,0xC1,0x7D,0x02,0x2A,0x08,0x0C,0xEB,0xE1,0x73,
+	0x23,0x72,0x3A,0x02,0x07,0xD3,0x08,0x32,0x0A,0x07,0x3E,0x08,0xD3,0x09,0xC9,0xCD,
+	0xC1,0x46,0xCA,0x92,0x48,0x0A,0xD6,0x02,0xC2,0x8C,0x48,0xC5,0x84,0x08,0x02,0x3C,
+	0x04,0xF0,0x3D,0xC4,0xF8,0x4A,0xC1,0x03,0x0A,0xCD,0x64,0x48,0x0B,0xE5,0xD5,0x11,
+	0x3E,0x08,0x2A,0x3A,0x08,0x29,0x19,0x36,0x00,0x23,0x36,0x00,0xD1,0xE1,0x16,0x0A,
+	0xAF,0x02,0x03,0x15,0xC2,0xA6,0x48,0xC9,0x6F,0x3A,0x88,0x09,0x5F,0xCD,0xC2,0x46,
+	0xCA,0xC3,0x48,0x03,0x0A,0xBD,0x63,0xE5,0x7B,0xCC,0x6E,0x48,0xE1,0x5C,0x1D,0xF2,
+	0xB2,0x48,0x5D,0xCD,0xE8,0x46,0x3E,0xFF,0x77,0x32,0x0A,0x07,0xD3,0x08,0xC9,0x1C,
+	0x05,0x11,0x47,0xEF,0x05,0xF4,0x1E,0x7E,0x3C,0xCA,0x2C,0x49,0x3D,0xC2,0xF2,0x48,
+	0x79,0x32,0x60,0x09,0x78,0x32,0x61,0x09,0x22,0x37,0x08,0xC5,0x0E,0x08,0x11,0x2D,
+	0x08,0x22,0x35,0x08,0x1A,0xBE,0x23,0x13,0xC2,0x16,0x49,0x0D,0xC2,0xFB,0x48,0xC1,
+	0x56,0x23,0x5E,0x23,0x24,0x00,0xF1,0x00,0x7E,0xB7,0xC9,0x2A,0x35,0x08,0x01,0x10,
+	0x00,0x09,0xC1,0x0D,0xC2,0xDE,0x48,0x7E,0x04,0x51,0xD9,0x48,0xC3,0x79,0x47,0x92,
+	0x05,0xF0,0x00,0x3D,0x49,0x3A,0x61,0x09,0xB8,0xC8,0xC6,0x80,0xC3,0x47,0x49,0x79,
+	0xC6,0x80,0x34,0x00,0xF0,0x33,0x22,0x37,0x08,0x32,0x61,0x09,0xAF,0xC9,0xC5,0x21,
+	0x1E,0x07,0x3A,0x02,0x07,0x0E,0x46,0x16,0x00,0xCD,0xF4,0x4F,0xDA,0x7C,0x47,0xC1,
+	0xC9,0xAF,0x32,0x63,0x09,0x3A,0x60,0x09,0xC6,0x80,0xD2,0x95,0x49,0x32,0x60,0x09,
+	0xE5,0x3D,0xCA,0x7F,0x49,0x2A,0x37,0x08,0x11,0x10,0x00,0x19,0x36,0xFF,0xC3,0x94,
+	0x49,0x23,0x56,0x21,0x0C,0x07,0x36,0xFF,0x32,0x04,0xF0,0x1A,0xFE,0x20,0x1E,0x43,
+	0xCA,0x21,0x0D,0xCD,0xF1,0x49,0xE1,0xE5,0x44,0x4D,0x7E,0xFE,0x02,0xC2,0xA8,0x49,
+	0x16,0x47,0x3E,0x4D,0xCD,0xAB,0x4D,0xC3,0xAD,0x49,0x16,0x45,0xCD,0xA6,0x4D,0xCA,
+	0xC6,0x43,0xD5,0x3A,0x61,0x4E,0x00,0x41,0xC0,0x49,0x32,0x61,0xE4,0x00,0x00,0x4D,
+	0x00,0x40,0x2D,0x08,0x0E,0x08,0x57,0x3B,0x50,0x0D,0xC2,0xC8,0x49,0xD1,0x6A,0x04,
+	0xF1,0x05,0xEB,0xE3,0x7E,0x12,0xAF,0x0E,0x05,0x13,0x12,0x0D,0xC2,0xDC,0x49,0xE5,
+	0xCD,0xE9,0x49,0xE1,0xD1,0xC9,0x74,0x07,0x51,0x3A,0x61,0x09,0x47,0x7A,0xA0,0x00,
+	0xF0,0x04,0x1E,0x4F,0xD0,0xC3,0x79,0x47,0xE5,0xCD,0x42,0x4D,0x1E,0x37,0xC2,0x66,
+	0x46,0x2A,0x35,0x08,0x22,0xB1,0x03,0x10,0xE1,0x2E,0x00,0xF0,0x00,0x2A,0x35,0x08,
+	0x11,0x0A,0x00,0x19,0x7E,0xFE,0x04,0xCA,0x57,0x4A,0xE1,0xE5,0x8A,0x03,0xF0,0x26,
+	0x4E,0x23,0x46,0x78,0xB1,0xCA,0xC1,0x4A,0xC5,0xCD,0x2A,0x4C,0xC1,0xDA,0xC1,0x4A,
+	0xE1,0xE5,0x23,0x78,0xE6,0x07,0xC2,0x43,0x4A,0xCD,0xC3,0x4A,0x7E,0x11,0x09,0x00,
+	0x19,0x5A,0xEB,0x22,0x28,0x08,0xEB,0xCD,0x1E,0x4F,0xDA,0x79,0x47,0xC3,0x21,0x4A,
+	0xD1,0xD5,0x21,0x06,0x00,0x87,0x03,0xB2,0x21,0x01,0x00,0x19,0x7E,0xF5,0x23,0x56,
+	0x21,0x60,0x08,0x14,0x01,0x43,0xF1,0xD5,0x21,0xE0,0x0B,0x00,0x70,0xC1,0xD1,0xD5,
+	0x21,0x60,0x08,0xE5,0x9B,0x08,0x11,0x47,0x28,0x00,0x31,0xCD,0xC3,0x4A,0x08,0x00,
+	0x00,0x08,0x27,0x31,0x02,0x00,0x19,0x26,0x08,0x40,0xF4,0x4F,0xE5,0x60,0x39,0x08,
+	0x00,0x67,0x3C,0x01,0xB8,0x00,0xF3,0x0C,0xC1,0xD1,0x04,0xE6,0x07,0xC2,0x90,0x4A,
+	0xC1,0xE1,0x23,0x0D,0xC2,0x82,0x4A,0xE1,0xC9,0xE5,0xD5,0xC5,0x5E,0xCD,0xDE,0x46,
+	0xC1,0xC5,0x23,0x0E,0x09,0xF0,0x11,0x79,0x1F,0x5F,0x3E,0x80,0xD2,0xDE,0x4A,0x3E,
+	0x08,0x16,0x00,0x19,0x2B,0x50,0x17,0x1F,0x5F,0x7A,0xD6,0x08,0x57,0x7B,0xD2,0xE4,
+	0x4A,0xAE,0xBE,0x77,0xDA,0x88,0x47,0x27,0x0E,0xC0,0xAF,0x32,0x5E,0x08,0x2A,0x28,
+	0x08,0x7C,0xB5,0xCA,0x19,0x4B,0x89,0x02,0xB0,0x56,0x23,0x5E,0x1C,0x7B,0xE6,0x07,
+	0x3E,0x4D,0xCC,0xAB,0x67,0x01,0x01,0x0F,0x09,0x50,0xEB,0x60,0x69,0xE5,0x23,0x51,
+	0x25,0x00,0xAF,0x1C,0xF0,0x3D,0x73,0x23,0x58,0x46,0x72,0x53,0x23,0x5E,0xD5,0x36,
+	0x00,0x23,0x23,0xE5,0x21,0x3C,0x08,0x71,0x23,0x70,0xE1,0xCD,0x1E,0x4F,0xD1,0xC1,
+	0xF5,0x0A,0xFE,0x02,0xC2,0x5B,0x4B,0xF1,0xD2,0x65,0x4B,0x21,0x08,0x00,0x09,0x73,
+	0x3E,0xFF,0x32,0x5E,0x08,0xC3,0xFC,0x4A,0xF1,0x1E,0x46,0xDA,0x21,0x0D,0xC5,0xC3,
+	0xB4,0x4B,0x3A,0x5E,0x08,0xB7,0xCA,0xA4,0x4B,0xC5,0x03,0x0A,0xF5,0x21,0x01,0x00,
+	0x09,0x56,0xDE,0x02,0x32,0x01,0x3E,0x08,0x56,0x01,0xB3,0xC2,0x8A,0x4B,0xC1,0xC1,
+	0xC3,0xA4,0x4B,0xF1,0xF5,0xC5,0xF0,0x00,0x30,0x2A,0x3C,0x08,0xF1,0x00,0x22,0xC1,
+	0xF1,0x4F,0x01,0x50,0xC1,0x2A,0x3C,0x08,0xEB,0x33,0x00,0x10,0xC5,0x34,0x00,0x38,
+	0x73,0x23,0x72,0xFA,0x09,0x80,0xC9,0xE1,0xF1,0xE5,0xF5,0x2A,0x64,0x09,0x59,0x06,
+	0xA0,0x29,0x15,0xF1,0xD5,0xC5,0x44,0x4D,0xF5,0x11,0x08,0xBD,0x01,0xF0,0x16,0x80,
+	0xE5,0x22,0x28,0x08,0xCC,0xF8,0x4A,0xE1,0x34,0x7E,0x06,0x00,0x4F,0x23,0xF1,0xF5,
+	0x56,0xFE,0x0D,0x70,0xCA,0xF7,0x4B,0xC6,0xE0,0x7A,0x88,0x77,0x09,0xF1,0xC1,0xD1,
+	0x77,0xE1,0xC9,0xC5,0xDD,0x05,0x00,0x29,0x33,0xF0,0x0C,0xB7,0xCA,0x16,0x4C,0x2B,
+	0x7E,0x23,0x35,0x96,0x4F,0x09,0x7E,0xB7,0xC1,0xC9,0x2B,0x2B,0x7E,0x2B,0xB6,0x37,
+	0xCA,0x14,0x4C,0x01,0xFF,0x4B,0xF3,0x01,0x80,0xDA,0x7C,0x47,0xC9,0x2A,0x64,0x09,
+	0xD5,0xBB,0x09,0x01,0xBB,0x1D,0x20,0x03,0x2B,0xA4,0x0A,0x00,0x35,0x08,0x90,0x23,
+	0x23,0xCD,0xF4,0x4F,0x2B,0x73,0x2B,0x73,0xC2,0x1D,0x10,0xD1,0xF5,0x32,0x02,0xF3,
+	0x0B,0x00,0x6A,0x07,0xF0,0x08,0xD5,0x01,0xA0,0x16,0xAF,0x57,0x5F,0xC3,0x72,0x4C,
+	0xF7,0x01,0xE8,0x19,0x11,0x20,0x2C,0xC2,0x72,0x4C,0x5A,0xF5,0xC5,0xFE,0x08,0xF0,
+	0x0D,0xDA,0x8B,0x47,0xFE,0x20,0xC2,0x85,0x4C,0x14,0x15,0xC2,0x75,0x4C,0xFE,0x22,
+	0xC2,0x9A,0x4C,0x47,0x7B,0xFE,0x2C,0x78,0xC2,0x9A,0x4C,0x50,0x58,0x1F,0x00,0xF2,
+	0x14,0xEC,0x4C,0x21,0xC8,0x0A,0x06,0xFF,0x4F,0x7A,0xFE,0x22,0x79,0xCA,0xD5,0x4C,
+	0xFE,0x0D,0xE5,0xCA,0x0C,0x4D,0xE1,0xFE,0x0A,0xC2,0xD5,0x4C,0x4F,0x7B,0xFE,0x2C,
+	0x79,0xC4,0x38,0x4D,0x45,0x09,0xF3,0x12,0xEC,0x4C,0xFE,0x0D,0xC2,0xD5,0x4C,0x7B,
+	0xFE,0x20,0xCA,0xE4,0x4C,0xFE,0x2C,0x3E,0x0D,0xCA,0xE4,0x4C,0xB7,0xCA,0xE4,0x4C,
+	0xBA,0xCA,0xEC,0x4C,0xBB,0xCA,0xEC,0x4C,0xCD,0x29,0x00,0xE0,0xD2,0x9F,0x4C,0xE5,
+	0xFE,0x22,0xCA,0xF7,0x4C,0xFE,0x20,0xC2,0x1F,0x4D,0x63,0x00,0x40,0x1F,0x4D,0xFE,
+	0x20,0x10,0x00,0x84,0x2C,0xCA,0x1F,0x4D,0xFE,0x0D,0xC2,0x17,0x15,0x00,0x43,0x0A,
+	0xCA,0x1F,0x4D,0x18,0x01,0xD2,0x34,0xE1,0x36,0x00,0x21,0xC7,0x0A,0x7B,0xD6,0x20,
+	0xCA,0x32,0x4D,0xFF,0x33,0xF1,0x02,0xC9,0xD7,0xCD,0x6E,0x36,0xE1,0xC9,0xB7,0xC8,
+	0x77,0x23,0x05,0xC0,0xC1,0xC3,0x20,0x4D,0x7D,0x29,0x00,0x72,0x0C,0x20,0xC8,0xF5,
+	0x20,0x08,0xF2,0x1A,0xD1,0x03,0x0A,0xBB,0x03,0x0A,0x03,0xC2,0x69,0x4D,0xBA,0xC2,
+	0x69,0x4D,0x7C,0x90,0xC2,0xF7,0x22,0x7D,0x91,0xC2,0xF7,0x22,0x0A,0x4F,0x06,0x00,
+	0xE5,0x21,0x0C,0x07,0x09,0x71,0xE1,0xF1,0x3D,0xC2,0x4C,0x4D,0xC9,0x8B,0x0B,0xF0,
+	0x3D,0xFA,0x46,0x5E,0x23,0xE5,0xCD,0x98,0x4D,0xE3,0xCD,0x5E,0x42,0xE3,0xCD,0x98,
+	0x4D,0xE1,0x2B,0x5E,0x23,0x14,0xC3,0x5E,0x42,0x16,0x80,0x01,0x1E,0x07,0x7E,0x02,
+	0x23,0x03,0x15,0xC2,0x9D,0x4D,0xC9,0x3E,0x46,0x1E,0xFF,0x21,0x1E,0x01,0x32,0x62,
+	0x09,0xC5,0x03,0x0A,0xD5,0xCD,0xDD,0x46,0xD1,0x4B,0x42,0xC3,0xD4,0x4D,0xAF,0x93,
+	0x5F,0x91,0xCA,0xE5,0x4D,0x50,0x7A,0x83,0xFE,0x05,0xCA,0xBD,0x4D,0x1A,0x0C,0xF0,
+	0x0B,0xBA,0xCA,0xBD,0x4D,0x7A,0xD5,0xC5,0xCD,0xE7,0x4D,0xC1,0xD1,0xD2,0xC5,0x4D,
+	0x87,0x87,0x87,0x5F,0x14,0x15,0xC1,0xC9,0xE5,0x1F,0xF5,0x4C,0x2C,0xF0,0x13,0xF1,
+	0x7E,0x1E,0x0F,0xDA,0xF7,0x4D,0x1E,0xF0,0xA3,0xCA,0xED,0x3F,0x58,0x05,0x37,0x4F,
+	0x7B,0x1F,0x5F,0x79,0x87,0x04,0xD2,0xFE,0x4D,0x7B,0xAE,0x77,0x78,0xE6,0x03,0x37,
+	0xE1,0xCE,0x00,0xF1,0x11,0x1B,0x72,0x2B,0x73,0x2B,0xC9,0x32,0x02,0x07,0x5F,0x3A,
+	0x0A,0x07,0xBB,0x7B,0x32,0x0A,0x07,0xC2,0x30,0x4E,0xDB,0x08,0xE6,0x08,0xCA,0xDE,
+	0x46,0x3E,0xFF,0xD3,0x08,0xD3,0x05,0x00,0x10,0x00,0xF0,0x00,0x3A,0x0A,0x07,0xCA,
+	0xDD,0x46,0x2A,0x64,0x09,0xE5,0x11,0x5A,0x4E,0xCD,0x67,0xAD,0x09,0xC1,0xCD,0xFC,
+	0x52,0xE1,0x22,0x64,0x09,0xC3,0x30,0x4E,0x45,0x4E,0x16,0x49,0x01,0x2E,0x48,0x10,
+	0x00,0xF5,0x3A,0x01,0x62,0x35,0x40,0xEB,0xCD,0xBF,0x22,0x7A,0x06,0xF0,0x01,0x29,
+	0x31,0xCD,0xDC,0x37,0xC3,0xBF,0x22,0xE5,0xC5,0xD5,0xCD,0x1A,0x4E,0xD1,0xC1,0x13,
+	0x0A,0xF0,0x00,0xFE,0x06,0xDA,0x88,0x47,0x3E,0x14,0x32,0x0B,0x07,0x7E,0x71,0xE1,
+	0xC5,0x47,0x1C,0x0A,0xF0,0x00,0xCC,0x4E,0xB8,0xCA,0xB5,0x4E,0xCD,0x13,0x4F,0xCD,
+	0xE1,0x4E,0xC5,0x48,0x47,0xD7,0x06,0xC3,0xC3,0x9E,0x4E,0xCD,0xF4,0x4E,0xCD,0xCC,
+	0x4E,0xB9,0xCA,0xC9,0x1A,0x00,0x71,0x47,0xC3,0xB5,0x4E,0xC1,0xAF,0xC9,0xC7,0x06,
+	0xF1,0x06,0x0F,0xDA,0xCC,0x4E,0xDB,0x08,0x07,0xDA,0xD5,0x4E,0xDB,0x0A,0xE6,0x7F,
+	0xFB,0xC9,0xDB,0x08,0xE6,0x40,0xC8,0x31,0x0A,0xF1,0x09,0xE6,0x4E,0x3E,0x02,0xD3,
+	0x09,0xC3,0xE1,0x4E,0x78,0xB9,0xC8,0xC5,0x06,0x02,0x91,0xF2,0x02,0x4F,0x2F,0x3C,
+	0x06,0x01,0x4F,0x1D,0x00,0x30,0x03,0x4F,0x78,0xA5,0x0A,0xF0,0x03,0x03,0x4F,0xC1,
+	0xC9,0x3A,0x0B,0x07,0x3D,0x32,0x0B,0x07,0xC0,0xC3,0x79,0x47,0xCD,0x80,0x4E,0xB0,
+	0x0A,0xF0,0x0C,0xC5,0xD5,0x01,0xA6,0x07,0x1E,0x80,0x7E,0x02,0x82,0x57,0x03,0x23,
+	0x1D,0xC2,0x2C,0x4F,0x3E,0xFF,0x02,0x7A,0xD1,0xC1,0x83,0x21,0x9F,0x07,0x07,0x03,
+	0x01,0x73,0x05,0x61,0x2A,0x28,0x08,0xEB,0x82,0x83,0xA6,0x2C,0xA0,0x79,0xC6,0xD5,
+	0x3E,0x00,0x1F,0x37,0x1F,0x57,0x78,0x75,0x07,0x90,0x80,0xE6,0x1F,0x47,0x3E,0x05,
+	0x32,0x0B,0x07,0x63,0x07,0x93,0x6B,0x4F,0x3C,0xE6,0x1F,0xB8,0xC2,0x6B,0x4F,0x73,
+	0x07,0x20,0x78,0x4F,0x0F,0x00,0xF3,0x13,0x71,0x4F,0x7A,0xD3,0x09,0x21,0x9F,0x07,
+	0xD5,0xE5,0xC5,0x01,0x88,0x01,0xCD,0xC7,0x50,0xC1,0xE1,0xD1,0x3A,0x39,0x08,0xB7,
+	0xC8,0xD5,0x7E,0xF6,0x80,0x77,0x3E,0x04,0xD3,0x09,0xDB,0x00,0x11,0xA7,0x2F,0x00,
+	0xF4,0x06,0xA7,0x4F,0xE5,0x11,0x89,0x00,0xDB,0x08,0xB7,0xFA,0xBA,0x4F,0xDB,0x0A,
+	0xAE,0xB2,0x57,0x23,0x1D,0xCA,0xD4,0x0A,0x00,0x30,0xC2,0xBA,0x4F,0x6B,0x07,0xA3,
+	0xFB,0xE1,0x7E,0xE6,0x7F,0x77,0x7A,0xD1,0xB7,0xC8,0xCF,0x00,0xF0,0x03,0xCA,0xF2,
+	0x4F,0xCD,0x32,0x51,0xC3,0x6B,0x4F,0x37,0xC9,0xCD,0x80,0x4E,0xAF,0x32,0x5F,0x08,
+	0xDA,0x00,0x70,0xE5,0xD5,0xC5,0x3A,0x04,0x07,0x5F,0xA8,0x00,0xF1,0x26,0x83,0xE6,
+	0x1F,0x5F,0x2A,0x05,0x07,0x23,0x22,0x05,0x07,0x21,0x9F,0x07,0xCD,0xF5,0x50,0x2B,
+	0x7E,0xB7,0xC2,0x76,0x50,0x2B,0x34,0xC2,0x76,0x50,0x21,0x9F,0x07,0x7E,0xE6,0x7F,
+	0xC1,0xB9,0xC2,0x73,0x50,0x23,0x7E,0xB8,0xC2,0x72,0x50,0xD1,0x23,0x7E,0xE1,0xE5,
+	0xD5,0x57,0xC5,0x18,0x01,0xD0,0x0A,0x77,0x23,0x03,0x82,0x57,0x1D,0xC2,0x44,0x50,
+	0x21,0xA5,0x07,0xE5,0x2B,0xF0,0x11,0x56,0x2B,0x5E,0x83,0x80,0x81,0xBA,0xC2,0x76,
+	0x50,0x2A,0x05,0x07,0x2B,0x22,0x05,0x07,0xF1,0xF1,0x57,0x21,0xA1,0x07,0xBE,0xE1,
+	0x37,0xC0,0xB7,0xC9,0xC1,0xCD,0x99,0xB7,0x01,0x00,0xA5,0x00,0xF0,0x03,0x3A,0x5F,
+	0x08,0xB7,0xCA,0x9D,0x50,0x3A,0x03,0x07,0xFE,0x4C,0xCA,0xA4,0x50,0xCD,0xBF,0x50,
+	0xD3,0x0B,0x00,0x07,0x00,0x00,0xA9,0x01,0x10,0xB2,0x19,0x00,0x43,0xB7,0xCA,0x8C,
+	0x50,0x11,0x00,0x04,0x1F,0x00,0xC0,0x32,0x51,0x3A,0x5F,0x08,0x2F,0x32,0x5F,0x08,
+	0xC3,0x01,0x50,0xBC,0x01,0xF0,0x13,0xC8,0xC3,0xBF,0x50,0x16,0x01,0x3E,0x80,0xB6,
+	0x5F,0x23,0xDB,0x08,0xA2,0xC2,0xCE,0x50,0x83,0xD3,0x0A,0x7E,0x23,0x5E,0x23,0x0D,
+	0xCA,0xE5,0x50,0x0D,0xD3,0x0A,0xC2,0xCE,0x50,0x17,0x00,0xF0,0x02,0xE5,0x50,0xD3,
+	0x0A,0x05,0xC2,0xE5,0x50,0xFB,0xC3,0x69,0x48,0xCD,0x1F,0x51,0x0E,0x89,0x40,0x01,
+	0xC0,0xFA,0x50,0xDB,0x0A,0x77,0x23,0x0D,0xCA,0x11,0x51,0x0D,0x00,0x0A,0x00,0xF3,
+	0x05,0xC2,0xFA,0x50,0xFB,0x3A,0x1E,0x51,0xB7,0xCA,0x69,0x48,0xAF,0x32,0x1E,0x51,
+	0xC9,0x00,0xCD,0x32,0x51,0xAA,0x01,0x80,0x22,0x51,0xE6,0x1F,0xBB,0xC2,0x22,0x51,
+	0x51,0x02,0x20,0x04,0xC8,0x94,0x01,0x14,0xC9,0x8A,0x0C,0x20,0x3F,0x51,0x9F,0x00,
+	0x00,0x69,0x02,0x61,0xC2,0x3C,0x51,0x3A,0x02,0x07,0xA1,0x03,0x30,0xAF,0x77,0xC9,
+	0xD2,0x24,0xA2,0x01,0xC2,0xBC,0x51,0x36,0x00,0xC3,0x72,0x51,0x70,0x0E,0x00,0xF0,
+	0x1F,0xB1,0x51,0xCD,0x67,0x18,0x21,0xFF,0xFF,0xC3,0x89,0x2B,0x3A,0xFA,0x06,0xB7,
+	0x3E,0x5C,0x32,0xFA,0x06,0xC2,0x8D,0x51,0x05,0xCA,0x69,0x51,0xDF,0x3E,0x05,0x2B,
+	0xCA,0xAD,0x51,0x7E,0xDF,0xC3,0x5C,0x51,0x05,0x2B,0xCA,0x6A,0x51,0x3E,0x08,0x19,
+	0x42,0xC0,0x3E,0x08,0xC3,0x93,0x51,0x05,0x2B,0xDF,0xC2,0x5C,0x51,0xDF,0x3C,0x00,
+	0xF0,0x01,0xC8,0x0A,0x06,0x01,0xF5,0xAF,0x32,0xFA,0x06,0xF1,0x4F,0xFE,0x7F,0xCA,
+	0x7B,0x51,0x47,0x00,0xC0,0xCA,0xD6,0x51,0x79,0xFE,0x08,0xCA,0x7B,0x51,0x3E,0x5C,
+	0xDF,0x1B,0x00,0x00,0x0D,0x00,0xF0,0x06,0x97,0x51,0xFE,0x07,0xCA,0x0C,0x52,0xFE,
+	0x03,0xCC,0x88,0x13,0x37,0xC8,0xFE,0x0D,0xCA,0x32,0x52,0xFE,0x09,0x11,0x00,0xF1,
+	0x21,0x0A,0xC2,0xFF,0x51,0x05,0xCA,0x6A,0x51,0x04,0xC3,0x0C,0x52,0xFE,0x15,0xCC,
+	0x88,0x13,0xCA,0x6A,0x51,0xFE,0x20,0xDA,0x5C,0x51,0x78,0x3C,0x3E,0x07,0xCA,0x17,
+	0x52,0x79,0x71,0x23,0x04,0xDF,0xD6,0x0A,0xC2,0x5C,0x51,0x32,0x27,0x00,0x3E,0x0D,
+	0xDF,0x72,0x25,0x80,0x23,0x52,0xFE,0x0D,0xCA,0x5C,0x51,0xC3,0xCE,0x00,0x30,0x21,
+	0xC8,0x0A,0xDA,0x24,0x02,0x9C,0x0A,0xF1,0x01,0xCA,0x70,0x52,0xCD,0xFE,0x4B,0xD2,
+	0x6E,0x52,0xC5,0xE5,0xCD,0x96,0x45,0xE1,0xC1,0x25,0x09,0x60,0x63,0x52,0xAF,0xCD,
+	0x6E,0x48,0xFC,0x3B,0x52,0xC3,0x2D,0x0F,0xC5,0xD5,0x0B,0x29,0xF2,0x1B,0xD1,0xC1,
+	0xAF,0xE1,0xC9,0xE1,0xDB,0x10,0xE6,0x01,0xCA,0x71,0x52,0xDB,0x11,0xE6,0x7F,0xFE,
+	0x0F,0xC0,0x3A,0xFB,0x06,0xB7,0xCC,0x86,0x13,0x2F,0x32,0xFB,0x06,0xB7,0xCA,0x86,
+	0x13,0xAF,0xC9,0xF5,0xC3,0xAD,0x52,0xF5,0x5A,0x00,0x41,0xC2,0xC1,0x4B,0xE1,0x38,
+	0x3A,0x20,0x2B,0x54,0x27,0x00,0xF3,0x0F,0xC2,0xF7,0x22,0xF1,0xC5,0xF5,0xFE,0x09,
+	0xC2,0xC3,0x52,0x3E,0x20,0xDF,0x3A,0x27,0x00,0xE6,0x07,0xC2,0xB5,0x52,0xF1,0xC1,
+	0xC9,0xFE,0x20,0xDA,0xDA,0x52,0x83,0x3A,0xB0,0xB8,0xCC,0x67,0x18,0x3C,0x32,0x27,
+	0x00,0xC3,0xEA,0x52,0x15,0x26,0x10,0x52,0x80,0x3A,0x30,0xCA,0xC0,0x52,0x63,0x3A,
+	0xF0,0x03,0xF1,0xC1,0xF5,0xDB,0x10,0xE6,0x02,0xCA,0xED,0x52,0xF1,0xD3,0x11,0xF5,
+	0x00,0x00,0xF1,0xC9,0x8B,0x00,0x01,0x77,0x26,0x00,0x23,0x01,0xF0,0x27,0xCA,0x46,
+	0x13,0xFE,0x11,0xCA,0xFC,0x52,0xFE,0x13,0xCA,0x01,0x53,0xC9,0x00,0x00,0x21,0x17,
+	0x53,0xCD,0x61,0x53,0xCD,0x63,0x0F,0xC3,0x9F,0x0D,0xF5,0x79,0xFE,0x08,0xC2,0x32,
+	0x53,0x3E,0xFF,0x32,0x0A,0x07,0x79,0x32,0x37,0x53,0xF1,0xD3,0x00,0xC9,0x79,0x32,
+	0x3E,0x53,0xDB,0x00,0x7D,0x08,0x80,0xE6,0x0F,0x07,0x07,0xB7,0xCD,0x68,0x53,0x57,
+	0x08,0xF0,0x06,0xDB,0xFF,0xE6,0xF0,0x0F,0x0F,0xFE,0x3C,0xC8,0xFE,0x38,0x37,0xC2,
+	0x68,0x53,0x21,0x00,0x00,0x4E,0x2B,0x7E,0x13,0x00,0x80,0xF5,0x6F,0x26,0x00,0x11,
+	0xCD,0x53,0x19,0x41,0x07,0xF0,0x08,0x46,0x23,0x5E,0x67,0xF1,0xF5,0x7C,0xDA,0x7F,
+	0x53,0x79,0x32,0xCB,0x53,0xF1,0x21,0xE9,0x53,0xE5,0x0E,0xFF,0xFE,0x10,0x09,0x0B,
+	0xF0,0x0B,0xF8,0x52,0xCA,0xA3,0x53,0xFE,0x08,0xD0,0xC6,0x11,0xF5,0x3E,0x03,0xCD,
+	0xCA,0x53,0xF1,0xC3,0xCA,0x53,0xAF,0xCD,0xCA,0x53,0xCD,0xC6,0x03,0x00,0x10,0x2F,
+	0xC6,0x38,0xF0,0x10,0x53,0xE5,0x2A,0xCA,0x53,0x2E,0xDB,0x22,0xF8,0x52,0xE1,0x3E,
+	0x2C,0x35,0xCD,0xCA,0x53,0x35,0x35,0x35,0x21,0xCB,0x53,0x34,0xD3,0x10,0xC9,0x10,
+	0xCA,0x01,0x02,0x04,0x00,0xF0,0x6D,0x00,0xC2,0x01,0x80,0x06,0xC2,0x01,0x80,0x20,
+	0xCA,0x80,0x80,0x04,0xCA,0x02,0x01,0x24,0xCA,0x40,0x40,0x62,0x68,0x22,0x74,0x52,
+	0x7C,0xE6,0xC8,0x67,0x22,0xFF,0x52,0xEB,0x22,0xF0,0x52,0x3A,0xCB,0x53,0x32,0x72,
+	0x52,0x32,0xFD,0x52,0x3C,0x32,0x79,0x52,0x81,0x32,0xEE,0x52,0x3C,0x32,0xF6,0x52,
+	0xC9,0xDB,0x06,0xE6,0x01,0xC2,0x0F,0x54,0xDB,0x07,0xC9,0xF5,0xDB,0x06,0xE6,0x80,
+	0xC2,0x1A,0x54,0xF1,0xD3,0x07,0xC9,0xC3,0xBD,0x54,0xC3,0xC9,0x54,0xF1,0xE5,0xD5,
+	0xF5,0xFE,0x20,0x3A,0xF0,0x06,0xFA,0x5E,0x54,0xCA,0x78,0x54,0xCD,0x90,0x54,0xF1,
+	0xF5,0x87,0x2F,0xD3,0x31,0xCD,0x19,0x55,0x3E,0xDF,0xD3,0x33,0xF6,0x20,0xD3,0x33,
+	0x3A,0xF0,0x06,0x14,0x3C,0x20,0xC2,0x74,0xEA,0x3B,0xF0,0x0F,0xC3,0xE6,0x54,0xF1,
+	0xF5,0xFE,0x09,0xCC,0x0D,0x55,0xFE,0x0D,0xCA,0xD1,0x54,0xFE,0x0A,0xCA,0xE6,0x54,
+	0xFE,0x0C,0xCA,0xFF,0x54,0xF1,0xD1,0xE1,0xC9,0x3C,0x28,0x00,0xF6,0x05,0xCA,0x58,
+	0x54,0x32,0xF0,0x06,0x11,0x0C,0x00,0x2A,0xF4,0x06,0x19,0x22,0xF4,0x06,0xC3,0x74,
+	0x54,0x3C,0x11,0x00,0xF0,0x0C,0xEB,0x2A,0xF2,0x06,0x19,0x22,0xF2,0x06,0xCD,0x19,
+	0x55,0x7B,0x2F,0xD3,0x31,0x7A,0x2F,0xD3,0x33,0xEE,0x40,0xD3,0x33,0xF6,0x40,0xD3,
+	0x33,0x2B,0x01,0xA0,0xF4,0x06,0xC9,0x3A,0xF0,0x06,0xB7,0xC4,0xC9,0x54,0xC0,0x3B,
+	0x12,0xC9,0x5B,0x3C,0xF0,0x04,0xAF,0xC9,0x2A,0xF2,0x06,0x7C,0xF6,0x08,0x67,0xEB,
+	0xCD,0xA3,0x54,0x22,0xF2,0x06,0x7C,0x32,0xF0,0x56,0x00,0xB0,0x21,0x10,0x00,0xCD,
+	0x19,0x55,0x7D,0x2F,0xD3,0x31,0x7C,0x46,0x00,0xA0,0x80,0xD3,0x33,0xF6,0x80,0xD3,
+	0x33,0xC3,0x74,0x54,0xBC,0x00,0xA0,0xDA,0xD3,0x37,0x3E,0xFA,0xD3,0x37,0xC3,0x74,
+	0x54,0x58,0x02,0xF0,0x08,0xF0,0x06,0xE6,0x07,0xC2,0x0D,0x55,0xC9,0xDB,0x35,0xEE,
+	0x80,0xE6,0x90,0xCA,0x19,0x55,0xC9,0xC3,0x86,0x54,0xC3,0x8F,0xCB,0x00,0x30,0x0D,
+	0xCC,0x8F,0xC6,0x00,0xE2,0x68,0x54,0xFE,0x09,0xCA,0x5B,0x54,0xDA,0x66,0x54,0x3A,
+	0xF0,0x06,0x3C,0x05,0x3D,0xF5,0x03,0xC2,0x4D,0x54,0xAF,0x32,0xF0,0x06,0xDB,0x02,
+	0xE6,0x11,0xCA,0x50,0x54,0xF1,0xD3,0x03,0xC9,0x4C,0x00,0xA1,0x5B,0x54,0xF1,0xC9,
+	0x3A,0xF1,0x06,0xE6,0x02,0xC2,0x31,0x00,0x90,0xE5,0x67,0xCD,0x8F,0x54,0x24,0x25,
+	0xCA,0x83,0x6E,0x00,0x60,0xC3,0x79,0x54,0xE1,0xF1,0xC9,0xC0,0x00,0x00,0xCB,0x00,
+	0x10,0xC8,0x05,0x00,0xB1,0xC2,0x9B,0x54,0x3E,0x0A,0xC3,0x9D,0x54,0x3E,0x0D,0xF5,
+	0x4E,0x00,0x10,0x9E,0x4E,0x00,0x00,0x5C,0x00,0x61,0xC9,0xC3,0x75,0x54,0xC3,0x7E,
+	0x53,0x01,0x26,0xC2,0x3F,0xAB,0x00,0x80,0x32,0x54,0xF1,0xC9,0xFE,0x0D,0xCC,0x7E,
+	0x9A,0x00,0x48,0xB4,0x54,0xDA,0x3D,0x95,0x00,0x72,0x5F,0x54,0x3E,0x01,0x32,0xEF,
+	0x06,0x9A,0x00,0xF6,0x01,0xF6,0xF5,0x3C,0xC2,0x62,0x54,0xF1,0xFE,0x60,0xFA,0x72,
+	0x54,0xE6,0xDF,0xD3,0x03,0x77,0x00,0x02,0x1C,0x00,0x10,0x7E,0x3A,0x00,0xF0,0x18,
+	0xB7,0xC2,0xA8,0x54,0x3A,0xEF,0x06,0xB7,0xCA,0xA2,0x54,0xE5,0x21,0x38,0x4A,0x2B,
+	0x7C,0xB5,0xC2,0x98,0x54,0xE1,0x32,0xEF,0x06,0x3E,0x02,0xD3,0x02,0xAF,0xC9,0x3E,
+	0x01,0xD3,0x02,0x32,0xEF,0x06,0x3D,0x8F,0x00,0x02,0xD4,0x00,0x13,0x3D,0xD4,0x00,
+	0x10,0x7E,0xD4,0x00,0x11,0xCF,0xD4,0x00,0x10,0xC5,0xD4,0x00,0x61,0xF3,0x21,0xFA,
+	0x58,0xF9,0x22,0xF9,0x46,0xA2,0xAF,0x32,0xCA,0x0B,0x32,0xED,0x06,0x32,0xFB,0x06,
+	0x3C,0x2F,0x03,0x08,0x47,0x10,0x4F,0x1E,0x03,0x80,0x22,0xF0,0x06,0x22,0xF2,0x06,
+	0x22,0xF4,0x51,0x2F,0xF0,0x1E,0x21,0x48,0x58,0xCD,0xBF,0x22,0xCD,0x83,0x0F,0xDA,
+	0x88,0x56,0xD7,0xB7,0xC2,0xB1,0x56,0x21,0xB4,0x58,0x23,0x7C,0xB5,0xCA,0xC2,0x56,
+	0x7E,0x47,0x2F,0x77,0xBE,0x70,0xCA,0x9F,0x56,0xC3,0xC2,0x56,0x21,0xC8,0x0A,0xCD,
+	0x0E,0x1D,0x7E,0x6A,0x44,0x10,0x7A,0xFC,0x2C,0xF3,0x1F,0xEB,0x2B,0xE5,0x11,0x9D,
+	0xFF,0xE1,0x2B,0x22,0xDB,0x0B,0x19,0xD2,0xDE,0x0C,0x2B,0xE5,0xCD,0x69,0x57,0x3E,
+	0xFF,0x32,0x39,0x08,0x21,0x3E,0x08,0x06,0x20,0x36,0x00,0x23,0x05,0xC2,0xDF,0x56,
+	0x21,0xF1,0x57,0xCD,0x2B,0x58,0x32,0x9E,0x07,0xFF,0x0F,0xF0,0x0B,0x19,0x3D,0xC2,
+	0xF6,0x56,0xE5,0x21,0x05,0x58,0xCD,0x2B,0x58,0xE1,0x22,0x66,0x09,0x11,0x68,0x09,
+	0x32,0x88,0x09,0x3C,0x01,0x8A,0x00,0x3A,0x36,0xC0,0x23,0xEB,0x09,0x3D,0xC2,0x10,
+	0x57,0x22,0x2B,0x08,0x21,0x14,0x22,0x00,0xF3,0x06,0x32,0x2A,0x08,0xB7,0x3C,0xCD,
+	0xFF,0x46,0x23,0x22,0x00,0x07,0xE3,0x11,0xFA,0x58,0xE7,0xDA,0xDE,0x0C,0xD1,0xDD,
+	0x00,0xE0,0xEB,0xCD,0xCF,0x0C,0x7B,0x95,0x6F,0x7A,0x9C,0x67,0x01,0xF0,0xFF,0x09,
+	0x01,0x09,0x40,0xCE,0x37,0x21,0x54,0xC9,0x00,0xF3,0x0D,0x21,0xBF,0x22,0x22,0xB0,
+	0x0D,0x21,0xEF,0x0C,0x22,0x02,0x00,0xC3,0xE3,0x0C,0x3E,0x84,0x32,0xF6,0x06,0x3E,
+	0x70,0x32,0xF7,0x06,0x21,0xBF,0x57,0xE8,0x00,0xF0,0x08,0x73,0x57,0xD7,0xFE,0x51,
+	0xCA,0xCB,0x57,0xFE,0x43,0xCA,0xA5,0x57,0xFE,0x4F,0xC2,0x73,0x57,0x11,0xAB,0x55,
+	0x0E,0xAD,0x66,0x01,0x20,0x3E,0x50,0x2F,0x00,0xF2,0x07,0x38,0x32,0xF7,0x06,0xC3,
+	0xB1,0x57,0x11,0x23,0x55,0x0E,0x88,0x3E,0x11,0xD3,0x03,0xAF,0xD3,0x02,0x21,0x25,
+	0x54,0xEC,0x0D,0x50,0xB4,0x57,0xC3,0xF0,0x57,0x59,0x29,0x01,0x82,0x52,0xF4,0x09,
+	0x45,0x52,0x00,0xAF,0xD3,0x30,0xD3,0x32,0xD3,0x34,0xD3,0x36,0xD3,0x35,0x3E,0xFF,
+	0xD3,0x31,0xD3,0x33,0xD3,0x37,0x3E,0x04,0x14,0x00,0x22,0x3E,0xFC,0xE6,0x02,0x82,
+	0xC9,0x48,0x49,0x47,0x48,0x45,0x53,0x54,0x98,0x09,0x03,0xA7,0x51,0x38,0x48,0x4F,
+	0x57,0x72,0x51,0x05,0x0F,0x00,0x03,0x52,0x51,0x02,0x16,0x00,0x23,0xE1,0xE5,0xB6,
+	0x00,0xF2,0x06,0x2A,0x58,0xD7,0xCD,0x0E,0x1D,0x2B,0xD7,0xC2,0x2A,0x58,0x21,0x0F,
+	0x00,0xE7,0xDA,0x2A,0x58,0xF1,0x7B,0xC9,0x04,0x54,0xF1,0x21,0x20,0x53,0x49,0x5A,
+	0x45,0x00,0x20,0x42,0x59,0x54,0x45,0x53,0x20,0x46,0x52,0x45,0x45,0x0D,0x0A,0x41,
+	0x4C,0x54,0x41,0x49,0x52,0x20,0x42,0x41,0x53,0x49,0x43,0x20,0x35,0x2E,0x30,0x20,
+	0x5B,0x31,0x34,0x4A,0x55,0x4C,0x37,0x38,0x5D,0x0D,0x0A,0x5B,0x85,0x00,0xC0,0x45,
+	0x58,0x54,0x45,0x4E,0x44,0x45,0x44,0x20,0x56,0x45,0x52,0xFF,0x53,0x80,0x5D,0x0D,
+	0x0A,0x43,0x4F,0x50,0x59,0x52,0x84,0x55,0x50,0x20,0x31,0x39,0x37,0x38,0x10,0x54,
+	0xBF,0x4D,0x49,0x54,0x53,0x20,0x49,0x4E,0x43,0x2E,0x0D,0x0A,0x00,0x00,0x24,0xF0,
+	0x5D,0x8B,0x24,0xDF,0x0B,0x48,0x58,0xDF,0x0B,0x56,0x20,0xE2,0x0B,0x6D,0x51,0x94,
+	0x56,0x00,0x5D,0x49,0x28,0x58,0x5C,0xE7,0x75,0x61,0x77,0x04,0x00,0x00,0x00,0x67,
+	0x25,0x77,0x50,0x11,0x04,0x44,0x04,0x73,0x67,0x67,0x72,0x50,0x00,0x42,0x50,0x66,
+	0xE1,0x63,0xF3,0x46,0x64,0x01,0x50,0x33,0x61,0x75,0x70,0x10,0x40,0x40,0x00,0xE0,
+	0xD0,0x71,0x72,0x04,0x40,0x44,0x54,0x72,0x70,0x61,0xF4,0x40,0x42,0x61,0x40,0x33,
+	0x71,0x57,0xE0,0x40,0x00,0x00,0x10,0x6D,0x63,0x67,0x04,0x60,0x00,0x00,0x00,0xF1,
+	0xE5,0x70,0x63,0x20,0x66,0x00,0x50,0x75,0x43,0x57,0x64,0x22,0x50,0x00,0x00,0xB0,
+	0x0A,0x00,0x91,0x3A,0x91,0x22,0x50,0x49,0x50,0x20,0x2D,0xDA,0x00,0xF0,0x28,0x20,
+	0x34,0x2E,0x30,0x22,0x00,0xAB,0x59,0x14,0x00,0x92,0x20,0x11,0x3A,0x58,0xF0,0xFF,
+	0x8F,0x28,0x11,0x29,0xF3,0x1C,0xDC,0x05,0x3A,0x8B,0x20,0x58,0xF1,0x11,0x20,0xCF,
+	0x20,0x92,0x20,0x1C,0x58,0x02,0x20,0x3A,0xA2,0x20,0x8B,0x20,0x58,0xEF,0x1C,0x00,
+	0x7D,0x20,0xCF,0x0A,0x92,0x20,0x08,0x00,0xF2,0x52,0x3A,0xA2,0x20,0x92,0x20,0x58,
+	0x00,0xD6,0x59,0x1E,0x00,0x86,0x54,0x32,0x28,0x0F,0x0F,0x29,0x3A,0x82,0x59,0xF0,
+	0x11,0xCE,0x0F,0x0F,0x3A,0x54,0x32,0x28,0x59,0x29,0xF0,0xF3,0x12,0x3A,0x83,0x59,
+	0x3A,0x91,0x22,0x2A,0x22,0x3B,0x3A,0xB1,0x85,0x42,0x24,0x00,0xE7,0x59,0x28,0x00,
+	0x8B,0x42,0x24,0xF0,0x22,0x22,0xCF,0x92,0x0F,0xC8,0x3A,0x81,0x00,0x14,0x5A,0x32,
+	0x00,0x8B,0x20,0xFF,0x92,0x28,0x42,0x24,0x29,0xEF,0x14,0x20,0xCF,0x20,0x43,0x24,
+	0xF0,0xFF,0x82,0x28,0x42,0x24,0xF3,0x31,0x4F,0x5B,0xAF,0xCE,0x0B,0x30,0xC2,0x04,
+	0x5A,0xD7,0x08,0x31,0xC3,0x20,0x5A,0xD6,0x08,0x25,0x15,0x5A,0xD6,0x08,0xA0,0x15,
+	0x5A,0x11,0x00,0x00,0x06,0x08,0xC2,0x06,0x00,0xFD,0x08,0xE0,0xC2,0x2F,0x5A,0xC5,
+	0x21,0xC8,0x5A,0x01,0x80,0x00,0x1A,0x77,0x80,0x47,0xF5,0x24,0xF0,0x02,0x3D,0x5A,
+	0x36,0xFF,0x23,0x70,0x23,0x71,0xC1,0xC5,0xD5,0x11,0x86,0x01,0x21,0xC5,0x5A,0x31,
+	0x09,0x20,0x56,0x5A,0xAC,0x0A,0x20,0x56,0x5A,0x44,0x16,0x11,0x4E,0x9A,0x09,0x30,
+	0x68,0x5A,0x81,0x9A,0x09,0xF0,0x09,0x1D,0x4E,0x23,0xCA,0x7F,0x5A,0x1D,0xD3,0x0A,
+	0xC2,0x68,0x5A,0xD1,0xC1,0x21,0x00,0x5E,0xCD,0xBF,0x5A,0xD2,0xB2,0x5A,0x04,0x69,
+	0x11,0x71,0xDA,0x36,0x5A,0x06,0x01,0xCA,0x36,0x41,0x00,0x12,0x97,0x88,0x00,0x20,
+	0x9D,0x5A,0xF6,0x09,0x91,0x3A,0xC5,0x5A,0x3C,0x32,0xC5,0x5A,0xC3,0x2D,0x1B,0x00,
+	0x10,0xB2,0x56,0x00,0xDF,0x08,0xC3,0xBC,0x5A,0x7A,0xBC,0xC0,0x7B,0xBD,0xC9,0x85,
+	0x00,0x5E,0x48,0x00,0x6D,0xF0,0x02,0xFF,0x32,0x00,0x00,0x5B,0x0A,0x15,0x00,0x54,
+	0xF0,0x0F,0x46,0x3A,0x8D,0x20,0x0E,0x58,0x62,0x1F,0x12,0xDB,0xE4,0x54,0x00,0x19,
+	0x03,0xF7,0x09,0x54,0x52,0x41,0x43,0x4B,0x00,0x9C,0x5B,0xDC,0x00,0x41,0x24,0xF0,
+	0xFF,0x96,0x28,0x0F,0x46,0x29,0xF2,0xFF,0x96,0x28,0x11,0x06,0x00,0x22,0x0F,0x80,
+	0x07,0x00,0x13,0x7F,0x14,0x00,0x40,0x00,0xC2,0x5B,0xE6,0x2E,0x00,0x27,0x41,0x24,
+	0x24,0x00,0x85,0xFF,0x29,0xF2,0xD8,0x28,0x0F,0x7F,0x2C,0x0F,0x00,0xE1,0x00,0xCC,
+	0x5B,0xF0,0x00,0xBC,0x41,0x24,0x2C,0x11,0x00,0xDA,0x5B,0xFA,0x74,0x02,0xF1,0x12,
+	0x44,0x4F,0x4E,0x45,0x22,0x00,0xE3,0x5B,0x04,0x01,0x89,0x0E,0x14,0x00,0x00,0x00,
+	0x5C,0x0E,0x01,0x8D,0x0E,0xF8,0x02,0x3A,0xBF,0x22,0x4F,0x22,0x2C,0x12,0x2C,0x22,
+	0x2E,0x01,0x00,0xF9,0x05,0x52,0x52,0x22,0x2C,0x41,0x00,0x1B,0x5C,0x18,0x01,0x91,
+	0x23,0x12,0x2C,0x12,0x3A,0xC3,0x12,0x3A,0xC8,0x1B,0x00,0xC6,0x21,0x5C,0x22,0x01,
+	0x91,0x00,0x39,0x5C,0x2C,0x01,0x91,0x22,0xC9,0x00,0x00,0xB3,0x03,0xF0,0x05,0x22,
+	0x3B,0x41,0x00,0x43,0x5C,0x36,0x01,0x91,0x3A,0x49,0xF0,0x11,0x00,0x4F,0x5C,0x40,
+	0x01,0x82,0x53,0x90,0x02,0x60,0x1F,0x00,0x62,0x5C,0x4A,0x01,0xE1,0x00,0xE1,0xAA,
+	0x28,0x0F,0x11,0xF4,0x53,0xF7,0x0F,0x1F,0x29,0x00,0x73,0x5C,0x54,0x13,0x00,0xC1,
+	0x81,0x28,0x41,0x24,0x2C,0x0F,0x87,0x29,0x00,0x84,0x5C,0x5E,0x11,0x00,0x11,0x82,
+	0x11,0x00,0xF4,0x07,0x80,0x29,0x00,0x92,0x5C,0x68,0x01,0x82,0x20,0x54,0xF0,0x11,
+	0x20,0xCE,0x20,0x18,0x00,0xA9,0x5C,0x72,0x01,0x42,0x30,0x00,0xD1,0x28,0x54,0xF2,
+	0x12,0x29,0xF4,0x0F,0x10,0x29,0x00,0xBA,0x5C,0x7C,0x17,0x00,0x00,0xB5,0x02,0x10,
+	0x2C,0x11,0x00,0x51,0xCA,0x5C,0x86,0x01,0x4E,0x28,0x00,0x96,0x42,0x24,0x2C,0x19,
+	0x29,0x00,0xDA,0x5C,0x90,0x21,0x00,0xB0,0x19,0x29,0x00,0xFC,0x5C,0x9A,0x01,0x58,
+	0xF0,0xFF,0x95,0xF3,0x02,0x15,0x3A,0x19,0x00,0x43,0x18,0x29,0x3A,0x59,0x15,0x00,
+	0x46,0x00,0x15,0x5D,0xA4,0x32,0x00,0x44,0x17,0x29,0x3A,0x5A,0x19,0x00,0xF5,0x06,
+	0x27,0x5D,0xAE,0x01,0x8B,0xFF,0x95,0x28,0x4E,0x24,0x29,0xF0,0x11,0xCF,0x0E,0xD6,
+	0x01,0x00,0x3A,0x5D,0xB8,0x12,0x00,0xF0,0x09,0x0F,0xFF,0xCF,0x0E,0xEA,0x01,0x00,
+	0x52,0x5D,0xC2,0x01,0x52,0x24,0xF0,0x22,0x53,0x22,0x3A,0x8B,0x5A,0xF1,0xEF,0x13,
+	0xCF,0x0D,0x00,0xE0,0x52,0x22,0x00,0xA6,0x5D,0xCC,0x01,0x8B,0x20,0x46,0x20,0xCF,
+	0x91,0x4E};
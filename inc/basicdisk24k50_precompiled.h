@@ -0,0 +1,13288 @@
+// Generated by host/precompile.c from basicdisk24k50.h, do not edit
+//
+// Included by src/i8080.c when built with I8080_PRECOMPILED
+//
+// Limited to the 1000 blocks BASIC ran most
+
+#define PRECOMPILED_SIZE 23901
+
+static int block_0000(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x000, 0x000, 14)) return 0;
+  op_di(cpu, 0);
+  cpu->PC = 0x0004; op_jmp(cpu, i8080_read_word(cpu, 0x0002));
+  return 1;
+}
+
+static int block_0008(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x000, 0x000, 65)) return 0;
+  op_mov_A_M(cpu, 0);
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x000, 0x000)) {
+    cpu->PC = 0x000A;
+    return 1;
+  }
+  op_cmp_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x000, 0x000)) {
+    cpu->PC = 0x000D;
+    return 1;
+  }
+  cpu->PC = 0x0010; op_jnz(cpu, i8080_read_word(cpu, 0x000E));
+  return 1;
+}
+
+static int block_0010(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x001, 0x001, 40)) return 0;
+  op_inx_H(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x0013));
+  cpu->PC = 0x0015; op_rnc(cpu, 0);
+  if (cpu->PC != 0x0015) return 1;
+  cpu->PC = 0x0018; op_jmp(cpu, i8080_read_word(cpu, 0x0016));
+  return 1;
+}
+
+static int block_0018(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x001, 0x001, 10)) return 0;
+  cpu->PC = 0x001B; op_jmp(cpu, i8080_read_word(cpu, 0x0019));
+  return 1;
+}
+
+static int block_0020(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x002, 0x002, 40)) return 0;
+  op_mov_A_H(cpu, 0);
+  op_sub_D(cpu, 0);
+  cpu->PC = 0x0023; op_rnz(cpu, 0);
+  if (cpu->PC != 0x0023) return 1;
+  op_mov_A_L(cpu, 0);
+  op_sub_E(cpu, 0);
+  cpu->PC = 0x0026; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_0028(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x002, 0x002, 38)) return 0;
+  lda(cpu, i8080_read_word(cpu, 0x0029));
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x002F; op_jnz(cpu, i8080_read_word(cpu, 0x002D));
+  if (cpu->PC != 0x002F) return 1;
+  cpu->PC = 0x0030; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_0030(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x003, 0x003, 30)) return 0;
+  lda(cpu, i8080_read_word(cpu, 0x0031));
+  cpi(cpu, i8080_read_byte(cpu, 0x0034));
+  cpu->PC = 0x0038; op_jmp(cpu, i8080_read_word(cpu, 0x0036));
+  return 1;
+}
+
+static int block_0C96(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0C9, 0x0C9, 20)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x0C97));
+  op_dad_SP(cpu, 0);
+  cpu->PC = 0x0C9A;
+  return 1;
+}
+
+static int block_0C9A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0C9, 0x0CA, 75)) return 0;
+  op_mov_A_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x0C9D));
+  cpu->PC = 0x0C9F; op_rnz(cpu, 0);
+  if (cpu->PC != 0x0C9F) return 1;
+  op_mov_C_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_B_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x0C9, 0x0CA)) {
+    cpu->PC = 0x0CA4;
+    return 1;
+  }
+  op_mov_L_C(cpu, 0);
+  op_mov_H_B(cpu, 0);
+  cpu->PC = 0x0CA6;
+  return 1;
+}
+
+static int block_0CA6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0CA, 0x0CA, 40)) return 0;
+  op_mov_A_D(cpu, 0);
+  op_ora_E(cpu, 0);
+  op_xchg(cpu, 0);
+  cpu->PC = 0x0CAC; op_jz(cpu, i8080_read_word(cpu, 0x0CAA));
+  if (cpu->PC != 0x0CAC) return 1;
+  op_xchg(cpu, 0);
+  cpu->PC = 0x0CAE; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_0CAE(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0CA, 0x0CB, 51)) return 0;
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x0CAF));
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x0CB3; op_rz(cpu, 0);
+  if (cpu->PC != 0x0CB3) return 1;
+  op_dad_B(cpu, 0);
+  cpu->PC = 0x0CB7; op_jmp(cpu, i8080_read_word(cpu, 0x0CB5));
+  return 1;
+}
+
+static int block_0CB7(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0CB, 0x0CB, 17)) return 0;
+  cpu->PC = 0x0CBA; op_call(cpu, i8080_read_word(cpu, 0x0CB8));
+  return 1;
+}
+
+static int block_0CBA(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0CB, 0x0CB, 39)) return 0;
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x0CB, 0x0CB)) {
+    cpu->PC = 0x0CBB;
+    return 1;
+  }
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x0CB, 0x0CB)) {
+    cpu->PC = 0x0CBC;
+    return 1;
+  }
+  op_pop_B(cpu, 0);
+  cpu->PC = 0x0CBD;
+  return 1;
+}
+
+static int block_0CBD(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0CB, 0x0CB, 11)) return 0;
+  cpu->PC = 0x0CBE; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_0CBE(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0CB, 0x0CC, 45)) return 0;
+  op_mov_A_M(cpu, 0);
+  op_stax_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x0CB, 0x0CC)) {
+    cpu->PC = 0x0CC0;
+    return 1;
+  }
+  cpu->PC = 0x0CC1; op_rz(cpu, 0);
+  if (cpu->PC != 0x0CC1) return 1;
+  op_dcx_B(cpu, 0);
+  op_dcx_H(cpu, 0);
+  cpu->PC = 0x0CC6; op_jmp(cpu, i8080_read_word(cpu, 0x0CC4));
+  return 1;
+}
+
+static int block_0CC6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0CC, 0x0CD, 134)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x0CC, 0x0CD)) {
+    cpu->PC = 0x0CC7;
+    return 1;
+  }
+  ldhd(cpu, i8080_read_word(cpu, 0x0CC8));
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x0CCB));
+  op_dad_B(cpu, 0);
+  op_dad_B(cpu, 0);
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x0CCF));
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x0CD1));
+  op_sub_L(cpu, 0);
+  op_mov_L_A(cpu, 0);
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x0CD5));
+  op_sbb_H(cpu, 0);
+  cpu->PC = 0x0CDA; op_jc(cpu, i8080_read_word(cpu, 0x0CD8));
+  if (cpu->PC != 0x0CDA) return 1;
+  op_mov_H_A(cpu, 0);
+  op_dad_SP(cpu, 0);
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x0CDE; op_rc(cpu, 0);
+  return 1;
+}
+
+static int block_0CCF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0CC, 0x0CD, 84)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x0CC, 0x0CD)) {
+    cpu->PC = 0x0CD0;
+    return 1;
+  }
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x0CD1));
+  op_sub_L(cpu, 0);
+  op_mov_L_A(cpu, 0);
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x0CD5));
+  op_sbb_H(cpu, 0);
+  cpu->PC = 0x0CDA; op_jc(cpu, i8080_read_word(cpu, 0x0CD8));
+  if (cpu->PC != 0x0CDA) return 1;
+  op_mov_H_A(cpu, 0);
+  op_dad_SP(cpu, 0);
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x0CDE; op_rc(cpu, 0);
+  return 1;
+}
+
+static int block_0CE3(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0CE, 0x0CE, 17)) return 0;
+  cpu->PC = 0x0CE6; op_call(cpu, i8080_read_word(cpu, 0x0CE4));
+  return 1;
+}
+
+static int block_0CE6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0CE, 0x0CE, 41)) return 0;
+  ldhd(cpu, i8080_read_word(cpu, 0x0CE7));
+  op_dcx_H(cpu, 0);
+  op_mvi_M(cpu, i8080_read_byte(cpu, 0x0CEB));
+  if (precompiled_changed(cpu, 0x0CE, 0x0CE)) {
+    cpu->PC = 0x0CEC;
+    return 1;
+  }
+  cpu->PC = 0x0CEF; op_jmp(cpu, i8080_read_word(cpu, 0x0CED));
+  return 1;
+}
+
+static int block_0D9E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0D9, 0x0D9, 10)) return 0;
+  op_pop_B(cpu, 0);
+  cpu->PC = 0x0D9F;
+  return 1;
+}
+
+static int block_0D9F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0D9, 0x0DA, 17)) return 0;
+  cpu->PC = 0x0DA2; op_call(cpu, i8080_read_word(cpu, 0x0DA0));
+  return 1;
+}
+
+static int block_0DA2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0DA, 0x0DA, 34)) return 0;
+  op_xra_A(cpu, 0);
+  sta(cpu, i8080_read_word(cpu, 0x0DA4));
+  if (precompiled_changed(cpu, 0x0DA, 0x0DA)) {
+    cpu->PC = 0x0DA6;
+    return 1;
+  }
+  cpu->PC = 0x0DA9; op_call(cpu, i8080_read_word(cpu, 0x0DA7));
+  return 1;
+}
+
+static int block_0DA9(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0DA, 0x0DA, 17)) return 0;
+  cpu->PC = 0x0DAC; op_call(cpu, i8080_read_word(cpu, 0x0DAA));
+  return 1;
+}
+
+static int block_0DAC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0DA, 0x0DB, 27)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x0DAD));
+  cpu->PC = 0x0DB2; op_call(cpu, i8080_read_word(cpu, 0x0DB0));
+  return 1;
+}
+
+static int block_0DB2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0DB, 0x0DB, 37)) return 0;
+  lda(cpu, i8080_read_word(cpu, 0x0DB3));
+  sui(cpu, i8080_read_byte(cpu, 0x0DB6));
+  cpu->PC = 0x0DBA; op_cz(cpu, i8080_read_word(cpu, 0x0DB8));
+  return 1;
+}
+
+static int block_0DBA(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0DB, 0x0DC, 97)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x0DBB));
+  shld(cpu, i8080_read_word(cpu, 0x0DBE));
+  if (precompiled_changed(cpu, 0x0DB, 0x0DC)) {
+    cpu->PC = 0x0DC0;
+    return 1;
+  }
+  lda(cpu, i8080_read_word(cpu, 0x0DC1));
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x0DC7; op_jz(cpu, i8080_read_word(cpu, 0x0DC5));
+  if (cpu->PC != 0x0DC7) return 1;
+  ldhd(cpu, i8080_read_word(cpu, 0x0DC8));
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x0DB, 0x0DC)) {
+    cpu->PC = 0x0DCB;
+    return 1;
+  }
+  cpu->PC = 0x0DCE; op_call(cpu, i8080_read_word(cpu, 0x0DCC));
+  return 1;
+}
+
+static int block_0E01(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0E0, 0x0E0, 17)) return 0;
+  cpu->PC = 0x0E04; op_call(cpu, i8080_read_word(cpu, 0x0E02));
+  return 1;
+}
+
+static int block_0E04(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0E0, 0x0E0, 21)) return 0;
+  cpu->PC = 0x0E07; op_jc(cpu, i8080_read_word(cpu, 0x0E05));
+  if (cpu->PC != 0x0E07) return 1;
+  cpu->PC = 0x0E08; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_0E08(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0E0, 0x0E1, 48)) return 0;
+  op_inr_A(cpu, 0);
+  op_dcr_A(cpu, 0);
+  cpu->PC = 0x0E0D; op_jz(cpu, i8080_read_word(cpu, 0x0E0B));
+  if (cpu->PC != 0x0E0D) return 1;
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x0E0, 0x0E1)) {
+    cpu->PC = 0x0E0E;
+    return 1;
+  }
+  cpu->PC = 0x0E11; op_call(cpu, i8080_read_word(cpu, 0x0E0F));
+  return 1;
+}
+
+static int block_0E11(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0E1, 0x0E1, 17)) return 0;
+  cpu->PC = 0x0E14; op_call(cpu, i8080_read_word(cpu, 0x0E12));
+  return 1;
+}
+
+static int block_0E14(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0E1, 0x0E1, 31)) return 0;
+  op_mov_A_M(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x0E16));
+  cpu->PC = 0x0E1A; op_cz(cpu, i8080_read_word(cpu, 0x0E18));
+  return 1;
+}
+
+static int block_0E1A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0E1, 0x0E1, 28)) return 0;
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x0E1, 0x0E1)) {
+    cpu->PC = 0x0E1B;
+    return 1;
+  }
+  cpu->PC = 0x0E1E; op_call(cpu, i8080_read_word(cpu, 0x0E1C));
+  return 1;
+}
+
+static int block_0E1E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0E1, 0x0E2, 79)) return 0;
+  op_pop_D(cpu, 0);
+  op_pop_PSW(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x0E21));
+  if (precompiled_changed(cpu, 0x0E1, 0x0E2)) {
+    cpu->PC = 0x0E23;
+    return 1;
+  }
+  cpu->PC = 0x0E26; op_jnc(cpu, i8080_read_word(cpu, 0x0E24));
+  if (cpu->PC != 0x0E26) return 1;
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x0E1, 0x0E2)) {
+    cpu->PC = 0x0E27;
+    return 1;
+  }
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x0E1, 0x0E2)) {
+    cpu->PC = 0x0E28;
+    return 1;
+  }
+  cpu->PC = 0x0E29; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_0E29(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0E2, 0x0E3, 58)) return 0;
+  op_ora_A(cpu, 0);
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x0E2, 0x0E3)) {
+    cpu->PC = 0x0E2B;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x0E2D));
+  if (precompiled_changed(cpu, 0x0E2, 0x0E3)) {
+    cpu->PC = 0x0E2F;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  cpu->PC = 0x0E33; op_call(cpu, i8080_read_word(cpu, 0x0E31));
+  return 1;
+}
+
+static int block_0E33(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0E3, 0x0E3, 45)) return 0;
+  cpu->PC = 0x0E36; op_jc(cpu, i8080_read_word(cpu, 0x0E34));
+  if (cpu->PC != 0x0E36) return 1;
+  op_pop_PSW(cpu, 0);
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x0E3, 0x0E3)) {
+    cpu->PC = 0x0E38;
+    return 1;
+  }
+  cpu->PC = 0x0E3B; op_jz(cpu, i8080_read_word(cpu, 0x0E39));
+  if (cpu->PC != 0x0E3B) return 1;
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x0E3C;
+  return 1;
+}
+
+static int block_0E3C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0E3, 0x0E4, 50)) return 0;
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x0E3, 0x0E4)) {
+    cpu->PC = 0x0E3D;
+    return 1;
+  }
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x0E3, 0x0E4)) {
+    cpu->PC = 0x0E3E;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x0E3, 0x0E4)) {
+    cpu->PC = 0x0E3F;
+    return 1;
+  }
+  cpu->PC = 0x0E42; op_call(cpu, i8080_read_word(cpu, 0x0E40));
+  return 1;
+}
+
+static int block_0E42(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0E4, 0x0E4, 58)) return 0;
+  op_pop_H(cpu, 0);
+  op_pop_PSW(cpu, 0);
+  op_pop_B(cpu, 0);
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x0E4, 0x0E4)) {
+    cpu->PC = 0x0E46;
+    return 1;
+  }
+  cpu->PC = 0x0E49; op_cc(cpu, i8080_read_word(cpu, 0x0E47));
+  return 1;
+}
+
+static int block_0E49(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0E4, 0x0E5, 144)) return 0;
+  op_pop_D(cpu, 0);
+  op_pop_PSW(cpu, 0);
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x0E4, 0x0E5)) {
+    cpu->PC = 0x0E4C;
+    return 1;
+  }
+  cpu->PC = 0x0E4F; op_jz(cpu, i8080_read_word(cpu, 0x0E4D));
+  if (cpu->PC != 0x0E4F) return 1;
+  op_pop_D(cpu, 0);
+  ldhd(cpu, i8080_read_word(cpu, 0x0E51));
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x0E4, 0x0E5)) {
+    cpu->PC = 0x0E54;
+    return 1;
+  }
+  op_pop_B(cpu, 0);
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x0E4, 0x0E5)) {
+    cpu->PC = 0x0E56;
+    return 1;
+  }
+  op_dad_B(cpu, 0);
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x0E4, 0x0E5)) {
+    cpu->PC = 0x0E58;
+    return 1;
+  }
+  cpu->PC = 0x0E5B; op_call(cpu, i8080_read_word(cpu, 0x0E59));
+  return 1;
+}
+
+static int block_0E5B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0E5, 0x0E7, 133)) return 0;
+  op_pop_H(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x0E5D));
+  if (precompiled_changed(cpu, 0x0E5, 0x0E7)) {
+    cpu->PC = 0x0E5F;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  op_mov_M_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x0E5, 0x0E7)) {
+    cpu->PC = 0x0E61;
+    return 1;
+  }
+  op_pop_B(cpu, 0);
+  op_pop_D(cpu, 0);
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x0E5, 0x0E7)) {
+    cpu->PC = 0x0E64;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_M_E(cpu, 0);
+  if (precompiled_changed(cpu, 0x0E5, 0x0E7)) {
+    cpu->PC = 0x0E67;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_mov_M_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x0E5, 0x0E7)) {
+    cpu->PC = 0x0E69;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x0E6B));
+  op_dcx_B(cpu, 0);
+  op_dcx_B(cpu, 0);
+  op_dcx_B(cpu, 0);
+  op_dcx_B(cpu, 0);
+  cpu->PC = 0x0E71;
+  return 1;
+}
+
+static int block_0E71(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0E7, 0x0E7, 48)) return 0;
+  op_ldax_D(cpu, 0);
+  op_mov_M_A(cpu, 0);
+  if (precompiled_changed(cpu, 0x0E7, 0x0E7)) {
+    cpu->PC = 0x0E73;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_inx_D(cpu, 0);
+  op_dcx_B(cpu, 0);
+  op_mov_A_C(cpu, 0);
+  op_ora_B(cpu, 0);
+  cpu->PC = 0x0E7B; op_jnz(cpu, i8080_read_word(cpu, 0x0E79));
+  return 1;
+}
+
+static int block_0E7B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0E7, 0x0E7, 27)) return 0;
+  op_pop_D(cpu, 0);
+  cpu->PC = 0x0E7F; op_call(cpu, i8080_read_word(cpu, 0x0E7D));
+  return 1;
+}
+
+static int block_0E7F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0E7, 0x0E8, 49)) return 0;
+  ldhd(cpu, i8080_read_word(cpu, 0x0E80));
+  shld(cpu, i8080_read_word(cpu, 0x0E83));
+  if (precompiled_changed(cpu, 0x0E7, 0x0E8)) {
+    cpu->PC = 0x0E85;
+    return 1;
+  }
+  cpu->PC = 0x0E88; op_call(cpu, i8080_read_word(cpu, 0x0E86));
+  return 1;
+}
+
+static int block_0E88(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0E8, 0x0E9, 60)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x0E8, 0x0E9)) {
+    cpu->PC = 0x0E89;
+    return 1;
+  }
+  ldhd(cpu, i8080_read_word(cpu, 0x0E8A));
+  shld(cpu, i8080_read_word(cpu, 0x0E8D));
+  if (precompiled_changed(cpu, 0x0E8, 0x0E9)) {
+    cpu->PC = 0x0E8F;
+    return 1;
+  }
+  cpu->PC = 0x0E92; op_call(cpu, i8080_read_word(cpu, 0x0E90));
+  return 1;
+}
+
+static int block_0E92(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0E9, 0x0E9, 20)) return 0;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x0E96; op_jmp(cpu, i8080_read_word(cpu, 0x0E94));
+  return 1;
+}
+
+static int block_0E9A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0E9, 0x0EA, 50)) return 0;
+  op_mov_H_D(cpu, 0);
+  op_mov_L_E(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_ora_M(cpu, 0);
+  cpu->PC = 0x0EA0; op_rz(cpu, 0);
+  if (cpu->PC != 0x0EA0) return 1;
+  op_inx_H(cpu, 0);
+  op_inx_H(cpu, 0);
+  cpu->PC = 0x0EA2;
+  return 1;
+}
+
+static int block_0EA2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0EA, 0x0EA, 12)) return 0;
+  op_inx_H(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  cpu->PC = 0x0EA4;
+  return 1;
+}
+
+static int block_0EA4(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0EA, 0x0EB, 65)) return 0;
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x0EA8; op_jz(cpu, i8080_read_word(cpu, 0x0EA6));
+  if (cpu->PC != 0x0EA8) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x0EA9));
+  cpu->PC = 0x0EAD; op_jnc(cpu, i8080_read_word(cpu, 0x0EAB));
+  if (cpu->PC != 0x0EAD) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x0EAE));
+  cpu->PC = 0x0EB2; op_jc(cpu, i8080_read_word(cpu, 0x0EB0));
+  if (cpu->PC != 0x0EB2) return 1;
+  cpu->PC = 0x0EB5; op_call(cpu, i8080_read_word(cpu, 0x0EB3));
+  return 1;
+}
+
+static int block_0EB5(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0EB, 0x0EB, 11)) return 0;
+  cpu->PC = 0x0EB6; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_0EB6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0EB, 0x0EB, 10)) return 0;
+  cpu->PC = 0x0EB9; op_jmp(cpu, i8080_read_word(cpu, 0x0EB7));
+  return 1;
+}
+
+static int block_0EB9(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0EB, 0x0EC, 39)) return 0;
+  op_inx_H(cpu, 0);
+  op_xchg(cpu, 0);
+  op_mov_M_E(cpu, 0);
+  if (precompiled_changed(cpu, 0x0EB, 0x0EC)) {
+    cpu->PC = 0x0EBC;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_mov_M_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x0EB, 0x0EC)) {
+    cpu->PC = 0x0EBE;
+    return 1;
+  }
+  cpu->PC = 0x0EC1; op_jmp(cpu, i8080_read_word(cpu, 0x0EBF));
+  return 1;
+}
+
+static int block_0EDF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0ED, 0x0EE, 16)) return 0;
+  ldhd(cpu, i8080_read_word(cpu, 0x0EE0));
+  cpu->PC = 0x0EE2;
+  return 1;
+}
+
+static int block_0EE2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0EE, 0x0EE, 90)) return 0;
+  op_mov_B_H(cpu, 0);
+  op_mov_C_L(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_ora_M(cpu, 0);
+  op_dcx_H(cpu, 0);
+  cpu->PC = 0x0EE9; op_rz(cpu, 0);
+  if (cpu->PC != 0x0EE9) return 1;
+  op_inx_H(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_H_M(cpu, 0);
+  op_mov_L_A(cpu, 0);
+  cpu->PC = 0x0EF0; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_0EF0(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0EF, 0x0EF, 74)) return 0;
+  op_mov_H_B(cpu, 0);
+  op_mov_L_C(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_H_M(cpu, 0);
+  op_mov_L_A(cpu, 0);
+  op_cmc(cpu, 0);
+  cpu->PC = 0x0EF8; op_rz(cpu, 0);
+  if (cpu->PC != 0x0EF8) return 1;
+  op_cmc(cpu, 0);
+  cpu->PC = 0x0EFA; op_rnc(cpu, 0);
+  if (cpu->PC != 0x0EFA) return 1;
+  cpu->PC = 0x0EFD; op_jmp(cpu, i8080_read_word(cpu, 0x0EFB));
+  return 1;
+}
+
+static int block_0EFD(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0EF, 0x0F0, 37)) return 0;
+  lda(cpu, i8080_read_word(cpu, 0x0EFE));
+  op_mov_B_A(cpu, 0);
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x0F02));
+  op_xra_A(cpu, 0);
+  op_inr_B(cpu, 0);
+  cpu->PC = 0x0F06;
+  return 1;
+}
+
+static int block_0F06(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0F0, 0x0F1, 63)) return 0;
+  op_mov_E_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_D_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_stax_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x0F0, 0x0F1)) {
+    cpu->PC = 0x0F0B;
+    return 1;
+  }
+  op_dcr_B(cpu, 0);
+  cpu->PC = 0x0F0F; op_jnz(cpu, i8080_read_word(cpu, 0x0F0D));
+  if (cpu->PC != 0x0F0F) return 1;
+  cpu->PC = 0x0F12; op_call(cpu, i8080_read_word(cpu, 0x0F10));
+  return 1;
+}
+
+static int block_0F12(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0F1, 0x0F1, 17)) return 0;
+  cpu->PC = 0x0F15; op_call(cpu, i8080_read_word(cpu, 0x0F13));
+  return 1;
+}
+
+static int block_0F15(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0F1, 0x0F1, 14)) return 0;
+  op_xra_A(cpu, 0);
+  cpu->PC = 0x0F19; op_jmp(cpu, i8080_read_word(cpu, 0x0F17));
+  return 1;
+}
+
+static int block_0F1D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0F1, 0x0F2, 33)) return 0;
+  ldhd(cpu, i8080_read_word(cpu, 0x0F1E));
+  cpu->PC = 0x0F23; op_call(cpu, i8080_read_word(cpu, 0x0F21));
+  return 1;
+}
+
+static int block_0F23(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0F2, 0x0F2, 53)) return 0;
+  sta(cpu, i8080_read_word(cpu, 0x0F24));
+  if (precompiled_changed(cpu, 0x0F2, 0x0F2)) {
+    cpu->PC = 0x0F26;
+    return 1;
+  }
+  op_mov_M_A(cpu, 0);
+  if (precompiled_changed(cpu, 0x0F2, 0x0F2)) {
+    cpu->PC = 0x0F27;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_mov_M_A(cpu, 0);
+  if (precompiled_changed(cpu, 0x0F2, 0x0F2)) {
+    cpu->PC = 0x0F29;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x0F2B));
+  cpu->PC = 0x0F2D;
+  return 1;
+}
+
+static int block_0F2D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0F2, 0x0F3, 21)) return 0;
+  ldhd(cpu, i8080_read_word(cpu, 0x0F2E));
+  op_dcx_H(cpu, 0);
+  cpu->PC = 0x0F31;
+  return 1;
+}
+
+static int block_0F31(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0F3, 0x0F3, 33)) return 0;
+  shld(cpu, i8080_read_word(cpu, 0x0F32));
+  if (precompiled_changed(cpu, 0x0F3, 0x0F3)) {
+    cpu->PC = 0x0F34;
+    return 1;
+  }
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x0F35));
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x0F37));
+  cpu->PC = 0x0F39;
+  return 1;
+}
+
+static int block_0F39(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0F3, 0x0F5, 169)) return 0;
+  op_mvi_M(cpu, i8080_read_byte(cpu, 0x0F3A));
+  if (precompiled_changed(cpu, 0x0F3, 0x0F5)) {
+    cpu->PC = 0x0F3B;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_dcr_A(cpu, 0);
+  cpu->PC = 0x0F40; op_jnz(cpu, i8080_read_word(cpu, 0x0F3E));
+  if (cpu->PC != 0x0F40) return 1;
+  sta(cpu, i8080_read_word(cpu, 0x0F41));
+  if (precompiled_changed(cpu, 0x0F3, 0x0F5)) {
+    cpu->PC = 0x0F43;
+    return 1;
+  }
+  op_mov_L_A(cpu, 0);
+  op_mov_H_A(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x0F46));
+  if (precompiled_changed(cpu, 0x0F3, 0x0F5)) {
+    cpu->PC = 0x0F48;
+    return 1;
+  }
+  shld(cpu, i8080_read_word(cpu, 0x0F49));
+  if (precompiled_changed(cpu, 0x0F3, 0x0F5)) {
+    cpu->PC = 0x0F4B;
+    return 1;
+  }
+  ldhd(cpu, i8080_read_word(cpu, 0x0F4C));
+  shld(cpu, i8080_read_word(cpu, 0x0F4F));
+  if (precompiled_changed(cpu, 0x0F3, 0x0F5)) {
+    cpu->PC = 0x0F51;
+    return 1;
+  }
+  op_xra_A(cpu, 0);
+  op_mov_M_A(cpu, 0);
+  if (precompiled_changed(cpu, 0x0F3, 0x0F5)) {
+    cpu->PC = 0x0F53;
+    return 1;
+  }
+  op_dcx_H(cpu, 0);
+  op_mov_M_A(cpu, 0);
+  if (precompiled_changed(cpu, 0x0F3, 0x0F5)) {
+    cpu->PC = 0x0F55;
+    return 1;
+  }
+  op_dcx_H(cpu, 0);
+  op_mov_M_A(cpu, 0);
+  if (precompiled_changed(cpu, 0x0F3, 0x0F5)) {
+    cpu->PC = 0x0F57;
+    return 1;
+  }
+  cpu->PC = 0x0F5A; op_call(cpu, i8080_read_word(cpu, 0x0F58));
+  return 1;
+}
+
+static int block_0F5A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0F5, 0x0F6, 90)) return 0;
+  ldhd(cpu, i8080_read_word(cpu, 0x0F5B));
+  shld(cpu, i8080_read_word(cpu, 0x0F5E));
+  if (precompiled_changed(cpu, 0x0F5, 0x0F6)) {
+    cpu->PC = 0x0F60;
+    return 1;
+  }
+  shld(cpu, i8080_read_word(cpu, 0x0F61));
+  if (precompiled_changed(cpu, 0x0F5, 0x0F6)) {
+    cpu->PC = 0x0F63;
+    return 1;
+  }
+  op_pop_B(cpu, 0);
+  ldhd(cpu, i8080_read_word(cpu, 0x0F65));
+  shld(cpu, i8080_read_word(cpu, 0x0F68));
+  cpu->PC = 0x0F6A;
+  return 1;
+}
+
+static int block_0F6A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0F6, 0x0F6, 5)) return 0;
+  cpu->PC = 0x0F6B; op_sphl(cpu, 0);
+  return 1;
+}
+
+static int block_0F6B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0F6, 0x0F7, 43)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x0F6C));
+  shld(cpu, i8080_read_word(cpu, 0x0F6F));
+  if (precompiled_changed(cpu, 0x0F6, 0x0F7)) {
+    cpu->PC = 0x0F71;
+    return 1;
+  }
+  cpu->PC = 0x0F74; op_call(cpu, i8080_read_word(cpu, 0x0F72));
+  return 1;
+}
+
+static int block_0F74(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0F7, 0x0F7, 17)) return 0;
+  cpu->PC = 0x0F77; op_call(cpu, i8080_read_word(cpu, 0x0F75));
+  return 1;
+}
+
+static int block_0F77(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0F7, 0x0F8, 76)) return 0;
+  op_xra_A(cpu, 0);
+  op_mov_H_A(cpu, 0);
+  op_mov_L_A(cpu, 0);
+  sta(cpu, i8080_read_word(cpu, 0x0F7B));
+  if (precompiled_changed(cpu, 0x0F7, 0x0F8)) {
+    cpu->PC = 0x0F7D;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x0F7, 0x0F8)) {
+    cpu->PC = 0x0F7E;
+    return 1;
+  }
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x0F7, 0x0F8)) {
+    cpu->PC = 0x0F7F;
+    return 1;
+  }
+  ldhd(cpu, i8080_read_word(cpu, 0x0F80));
+  cpu->PC = 0x0F83; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_0F83(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0F8, 0x0F8, 18)) return 0;
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x0F84));
+  cpu->PC = 0x0F86; op_rst_3(cpu, 0);
+  return 1;
+}
+
+static int block_0F86(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0F8, 0x0F8, 18)) return 0;
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x0F87));
+  cpu->PC = 0x0F89; op_rst_3(cpu, 0);
+  return 1;
+}
+
+static int block_0F89(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0F8, 0x0F8, 10)) return 0;
+  cpu->PC = 0x0F8C; op_jmp(cpu, i8080_read_word(cpu, 0x0F8A));
+  return 1;
+}
+
+static int block_0F8C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0F8, 0x0F9, 50)) return 0;
+  op_xra_A(cpu, 0);
+  sta(cpu, i8080_read_word(cpu, 0x0F8E));
+  if (precompiled_changed(cpu, 0x0F8, 0x0F9)) {
+    cpu->PC = 0x0F90;
+    return 1;
+  }
+  sta(cpu, i8080_read_word(cpu, 0x0F91));
+  if (precompiled_changed(cpu, 0x0F8, 0x0F9)) {
+    cpu->PC = 0x0F93;
+    return 1;
+  }
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x0F94));
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x0F97));
+  cpu->PC = 0x0F99;
+  return 1;
+}
+
+static int block_0F99(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0F9, 0x0FB, 162)) return 0;
+  op_mov_A_M(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x0F9B));
+  cpu->PC = 0x0F9F; op_jz(cpu, i8080_read_word(cpu, 0x0F9D));
+  if (cpu->PC != 0x0F9F) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x0FA0));
+  cpu->PC = 0x0FA4; op_jz(cpu, i8080_read_word(cpu, 0x0FA2));
+  if (cpu->PC != 0x0FA4) return 1;
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x0FA8; op_jz(cpu, i8080_read_word(cpu, 0x0FA6));
+  if (cpu->PC != 0x0FA8) return 1;
+  lda(cpu, i8080_read_word(cpu, 0x0FA9));
+  op_ora_A(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  cpu->PC = 0x0FB0; op_jnz(cpu, i8080_read_word(cpu, 0x0FAE));
+  if (cpu->PC != 0x0FB0) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x0FB1));
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x0FB3));
+  cpu->PC = 0x0FB7; op_jz(cpu, i8080_read_word(cpu, 0x0FB5));
+  if (cpu->PC != 0x0FB7) return 1;
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x0F9, 0x0FB)) {
+    cpu->PC = 0x0FB8;
+    return 1;
+  }
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x0F9, 0x0FB)) {
+    cpu->PC = 0x0FB9;
+    return 1;
+  }
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x0FBA));
+  cpu->PC = 0x0FBF; op_call(cpu, i8080_read_word(cpu, 0x0FBD));
+  return 1;
+}
+
+static int block_0FBF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0FB, 0x0FC, 17)) return 0;
+  cpu->PC = 0x0FC2; op_call(cpu, i8080_read_word(cpu, 0x0FC0));
+  return 1;
+}
+
+static int block_0FC2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0FC, 0x0FD, 98)) return 0;
+  cpu->PC = 0x0FC5; op_jc(cpu, i8080_read_word(cpu, 0x0FC3));
+  if (cpu->PC != 0x0FC5) return 1;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x0FC, 0x0FD)) {
+    cpu->PC = 0x0FC6;
+    return 1;
+  }
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x0FC7));
+  sui(cpu, i8080_read_byte(cpu, 0x0FCA));
+  op_add_A(cpu, 0);
+  op_mov_C_A(cpu, 0);
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x0FCE));
+  op_dad_B(cpu, 0);
+  op_mov_E_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_D_M(cpu, 0);
+  op_pop_H(cpu, 0);
+  op_inx_H(cpu, 0);
+  cpu->PC = 0x0FD5;
+  return 1;
+}
+
+static int block_0FD5(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0FD, 0x0FD, 11)) return 0;
+  op_push_H(cpu, 0);
+  cpu->PC = 0x0FD6;
+  return 1;
+}
+
+static int block_0FD6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0FD, 0x0FD, 17)) return 0;
+  cpu->PC = 0x0FD9; op_call(cpu, i8080_read_word(cpu, 0x0FD7));
+  return 1;
+}
+
+static int block_0FD9(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0FD, 0x0FF, 167)) return 0;
+  op_mov_C_A(cpu, 0);
+  op_ldax_D(cpu, 0);
+  ani(cpu, i8080_read_byte(cpu, 0x0FDC));
+  cpu->PC = 0x0FE0; op_jz(cpu, i8080_read_word(cpu, 0x0FDE));
+  if (cpu->PC != 0x0FE0) return 1;
+  op_cmp_C(cpu, 0);
+  op_inx_H(cpu, 0);
+  cpu->PC = 0x0FE5; op_jnz(cpu, i8080_read_word(cpu, 0x0FE3));
+  if (cpu->PC != 0x0FE5) return 1;
+  op_ldax_D(cpu, 0);
+  op_inx_D(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x0FEB; op_jp(cpu, i8080_read_word(cpu, 0x0FE9));
+  if (cpu->PC != 0x0FEB) return 1;
+  op_pop_PSW(cpu, 0);
+  op_ldax_D(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x0FF1; op_jm(cpu, i8080_read_word(cpu, 0x0FEF));
+  if (cpu->PC != 0x0FF1) return 1;
+  op_pop_B(cpu, 0);
+  op_pop_D(cpu, 0);
+  ori(cpu, i8080_read_byte(cpu, 0x0FF4));
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x0FD, 0x0FF)) {
+    cpu->PC = 0x0FF6;
+    return 1;
+  }
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x0FF7));
+  cpu->PC = 0x0FFB; op_call(cpu, i8080_read_word(cpu, 0x0FF9));
+  return 1;
+}
+
+static int block_0FFB(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x0FF, 0x100, 44)) return 0;
+  op_xra_A(cpu, 0);
+  sta(cpu, i8080_read_word(cpu, 0x0FFD));
+  if (precompiled_changed(cpu, 0x0FF, 0x100)) {
+    cpu->PC = 0x0FFF;
+    return 1;
+  }
+  op_pop_PSW(cpu, 0);
+  cpu->PC = 0x1003; op_call(cpu, i8080_read_word(cpu, 0x1001));
+  return 1;
+}
+
+static int block_1003(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x100, 0x100, 10)) return 0;
+  cpu->PC = 0x1006; op_jmp(cpu, i8080_read_word(cpu, 0x1004));
+  return 1;
+}
+
+static int block_1006(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x100, 0x100, 10)) return 0;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x1007;
+  return 1;
+}
+
+static int block_1007(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x100, 0x101, 41)) return 0;
+  op_ldax_D(cpu, 0);
+  op_inx_D(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x100D; op_jp(cpu, i8080_read_word(cpu, 0x100B));
+  if (cpu->PC != 0x100D) return 1;
+  op_inx_D(cpu, 0);
+  cpu->PC = 0x1011; op_jmp(cpu, i8080_read_word(cpu, 0x100F));
+  return 1;
+}
+
+static int block_1011(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x101, 0x104, 284)) return 0;
+  op_dcx_H(cpu, 0);
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x101, 0x104)) {
+    cpu->PC = 0x1013;
+    return 1;
+  }
+  cpi(cpu, i8080_read_byte(cpu, 0x1014));
+  cpu->PC = 0x1018; op_jz(cpu, i8080_read_word(cpu, 0x1016));
+  if (cpu->PC != 0x1018) return 1;
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x1019));
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x101, 0x104)) {
+    cpu->PC = 0x101C;
+    return 1;
+  }
+  cpi(cpu, i8080_read_byte(cpu, 0x101D));
+  cpu->PC = 0x101F; op_rz(cpu, 0);
+  if (cpu->PC != 0x101F) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1020));
+  cpu->PC = 0x1022; op_rz(cpu, 0);
+  if (cpu->PC != 0x1022) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1023));
+  cpu->PC = 0x1025; op_rz(cpu, 0);
+  if (cpu->PC != 0x1025) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1026));
+  cpu->PC = 0x1028; op_rz(cpu, 0);
+  if (cpu->PC != 0x1028) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1029));
+  cpu->PC = 0x102B; op_rz(cpu, 0);
+  if (cpu->PC != 0x102B) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x102C));
+  cpu->PC = 0x102E; op_rz(cpu, 0);
+  if (cpu->PC != 0x102E) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x102F));
+  cpu->PC = 0x1031; op_rz(cpu, 0);
+  if (cpu->PC != 0x1031) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1032));
+  cpu->PC = 0x1034; op_rz(cpu, 0);
+  if (cpu->PC != 0x1034) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1035));
+  cpu->PC = 0x1037; op_rz(cpu, 0);
+  if (cpu->PC != 0x1037) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1038));
+  cpu->PC = 0x103A; op_rz(cpu, 0);
+  if (cpu->PC != 0x103A) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x103B));
+  cpu->PC = 0x103D; op_rz(cpu, 0);
+  if (cpu->PC != 0x103D) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x103E));
+  cpu->PC = 0x1040; op_rz(cpu, 0);
+  if (cpu->PC != 0x1040) return 1;
+  op_pop_PSW(cpu, 0);
+  op_xra_A(cpu, 0);
+  cpu->PC = 0x1042;
+  return 1;
+}
+
+static int block_1042(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x104, 0x104, 10)) return 0;
+  cpu->PC = 0x1045; op_jnz(cpu, i8080_read_word(cpu, 0x1043));
+  return 1;
+}
+
+static int block_1043(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x104, 0x104, 7)) return 0;
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x1044));
+  cpu->PC = 0x1045;
+  return 1;
+}
+
+static int block_1045(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x104, 0x105, 95)) return 0;
+  sta(cpu, i8080_read_word(cpu, 0x1046));
+  if (precompiled_changed(cpu, 0x104, 0x105)) {
+    cpu->PC = 0x1048;
+    return 1;
+  }
+  op_pop_PSW(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x104A));
+  op_pop_B(cpu, 0);
+  op_pop_D(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x104E));
+  cpu->PC = 0x1052; op_jnz(cpu, i8080_read_word(cpu, 0x1050));
+  if (cpu->PC != 0x1052) return 1;
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x104, 0x105)) {
+    cpu->PC = 0x1053;
+    return 1;
+  }
+  cpu->PC = 0x1056; op_call(cpu, i8080_read_word(cpu, 0x1054));
+  return 1;
+}
+
+static int block_104A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x104, 0x105, 72)) return 0;
+  op_mov_A_M(cpu, 0);
+  op_pop_B(cpu, 0);
+  op_pop_D(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x104E));
+  cpu->PC = 0x1052; op_jnz(cpu, i8080_read_word(cpu, 0x1050));
+  if (cpu->PC != 0x1052) return 1;
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x104, 0x105)) {
+    cpu->PC = 0x1053;
+    return 1;
+  }
+  cpu->PC = 0x1056; op_call(cpu, i8080_read_word(cpu, 0x1054));
+  return 1;
+}
+
+static int block_1056(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x105, 0x105, 10)) return 0;
+  op_pop_PSW(cpu, 0);
+  cpu->PC = 0x1057;
+  return 1;
+}
+
+static int block_1057(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x105, 0x105, 45)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x1058));
+  cpu->PC = 0x105C; op_jnz(cpu, i8080_read_word(cpu, 0x105A));
+  if (cpu->PC != 0x105C) return 1;
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x105, 0x105)) {
+    cpu->PC = 0x105D;
+    return 1;
+  }
+  cpu->PC = 0x1060; op_call(cpu, i8080_read_word(cpu, 0x105E));
+  return 1;
+}
+
+static int block_106A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x106, 0x107, 58)) return 0;
+  op_mov_A_M(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x106C));
+  cpu->PC = 0x1070; op_jz(cpu, i8080_read_word(cpu, 0x106E));
+  if (cpu->PC != 0x1070) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1071));
+  cpu->PC = 0x1075; op_jnc(cpu, i8080_read_word(cpu, 0x1073));
+  if (cpu->PC != 0x1075) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1076));
+  cpu->PC = 0x107A; op_jc(cpu, i8080_read_word(cpu, 0x1078));
+  return 1;
+}
+
+static int block_107A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x107, 0x109, 105)) return 0;
+  lda(cpu, i8080_read_word(cpu, 0x107B));
+  op_ora_A(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  op_pop_B(cpu, 0);
+  op_pop_D(cpu, 0);
+  cpu->PC = 0x1084; op_jm(cpu, i8080_read_word(cpu, 0x1082));
+  if (cpu->PC != 0x1084) return 1;
+  cpu->PC = 0x1087; op_jz(cpu, i8080_read_word(cpu, 0x1085));
+  if (cpu->PC != 0x1087) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1088));
+  cpu->PC = 0x108C; op_jz(cpu, i8080_read_word(cpu, 0x108A));
+  if (cpu->PC != 0x108C) return 1;
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x108D));
+  cpu->PC = 0x1091; op_call(cpu, i8080_read_word(cpu, 0x108F));
+  return 1;
+}
+
+static int block_1091(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x109, 0x109, 28)) return 0;
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x109, 0x109)) {
+    cpu->PC = 0x1092;
+    return 1;
+  }
+  cpu->PC = 0x1095; op_call(cpu, i8080_read_word(cpu, 0x1093));
+  return 1;
+}
+
+static int block_1095(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x109, 0x109, 17)) return 0;
+  cpu->PC = 0x1098; op_call(cpu, i8080_read_word(cpu, 0x1096));
+  return 1;
+}
+
+static int block_1098(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x109, 0x109, 23)) return 0;
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x109, 0x109)) {
+    cpu->PC = 0x1099;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  cpu->PC = 0x109A;
+  return 1;
+}
+
+static int block_109A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x109, 0x109, 22)) return 0;
+  op_mov_A_L(cpu, 0);
+  cpu->PC = 0x109E; op_call(cpu, i8080_read_word(cpu, 0x109C));
+  return 1;
+}
+
+static int block_109E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x109, 0x109, 5)) return 0;
+  op_mov_A_H(cpu, 0);
+  cpu->PC = 0x109F;
+  return 1;
+}
+
+static int block_109F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x109, 0x10A, 27)) return 0;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x10A3; op_call(cpu, i8080_read_word(cpu, 0x10A1));
+  return 1;
+}
+
+static int block_10A3(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x10A, 0x10A, 10)) return 0;
+  cpu->PC = 0x10A6; op_jmp(cpu, i8080_read_word(cpu, 0x10A4));
+  return 1;
+}
+
+static int block_10A6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x10A, 0x10A, 46)) return 0;
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x10A, 0x10A)) {
+    cpu->PC = 0x10A7;
+    return 1;
+  }
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x10A, 0x10A)) {
+    cpu->PC = 0x10A8;
+    return 1;
+  }
+  op_mov_A_M(cpu, 0);
+  cpu->PC = 0x10AC; op_call(cpu, i8080_read_word(cpu, 0x10AA));
+  return 1;
+}
+
+static int block_10AC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x10A, 0x10A, 17)) return 0;
+  cpu->PC = 0x10AF; op_call(cpu, i8080_read_word(cpu, 0x10AD));
+  return 1;
+}
+
+static int block_10AF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x10A, 0x10D, 154)) return 0;
+  op_pop_B(cpu, 0);
+  op_pop_D(cpu, 0);
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x10A, 0x10D)) {
+    cpu->PC = 0x10B2;
+    return 1;
+  }
+  lda(cpu, i8080_read_word(cpu, 0x10B3));
+  cpi(cpu, i8080_read_byte(cpu, 0x10B6));
+  cpu->PC = 0x10BA; op_jnz(cpu, i8080_read_word(cpu, 0x10B8));
+  if (cpu->PC != 0x10BA) return 1;
+  ldhd(cpu, i8080_read_word(cpu, 0x10BB));
+  op_mov_A_H(cpu, 0);
+  op_ora_A(cpu, 0);
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x10C0));
+  cpu->PC = 0x10C4; op_jnz(cpu, i8080_read_word(cpu, 0x10C2));
+  if (cpu->PC != 0x10C4) return 1;
+  op_mov_A_L(cpu, 0);
+  op_mov_H_L(cpu, 0);
+  op_mvi_L(cpu, i8080_read_byte(cpu, 0x10C7));
+  cpi(cpu, i8080_read_byte(cpu, 0x10C9));
+  cpu->PC = 0x10CD; op_jnc(cpu, i8080_read_word(cpu, 0x10CB));
+  if (cpu->PC != 0x10CD) return 1;
+  adi(cpu, i8080_read_byte(cpu, 0x10CE));
+  cpu->PC = 0x10D2; op_jmp(cpu, i8080_read_word(cpu, 0x10D0));
+  return 1;
+}
+
+static int block_10F3(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x10F, 0x10F, 39)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x10F4));
+  cpu->PC = 0x10F8; op_jnz(cpu, i8080_read_word(cpu, 0x10F6));
+  if (cpu->PC != 0x10F8) return 1;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x10F, 0x10F)) {
+    cpu->PC = 0x10F9;
+    return 1;
+  }
+  cpu->PC = 0x10FA; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_1110(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x111, 0x111, 10)) return 0;
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x1111));
+  cpu->PC = 0x1113;
+  return 1;
+}
+
+static int block_1113(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x111, 0x112, 68)) return 0;
+  op_inx_D(cpu, 0);
+  op_ldax_D(cpu, 0);
+  ani(cpu, i8080_read_byte(cpu, 0x1116));
+  cpu->PC = 0x111A; op_jz(cpu, i8080_read_word(cpu, 0x1118));
+  if (cpu->PC != 0x111A) return 1;
+  op_cmp_M(cpu, 0);
+  op_inx_D(cpu, 0);
+  op_ldax_D(cpu, 0);
+  cpu->PC = 0x1120; op_jnz(cpu, i8080_read_word(cpu, 0x111E));
+  if (cpu->PC != 0x1120) return 1;
+  cpu->PC = 0x1123; op_jmp(cpu, i8080_read_word(cpu, 0x1121));
+  return 1;
+}
+
+static int block_1123(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x112, 0x112, 33)) return 0;
+  op_inx_H(cpu, 0);
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x112, 0x112)) {
+    cpu->PC = 0x1125;
+    return 1;
+  }
+  cpu->PC = 0x1128; op_call(cpu, i8080_read_word(cpu, 0x1126));
+  return 1;
+}
+
+static int block_1128(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x112, 0x113, 51)) return 0;
+  op_pop_PSW(cpu, 0);
+  sui(cpu, i8080_read_byte(cpu, 0x112A));
+  cpu->PC = 0x112E; op_jz(cpu, i8080_read_word(cpu, 0x112C));
+  if (cpu->PC != 0x112E) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x112F));
+  cpu->PC = 0x1133; op_jnz(cpu, i8080_read_word(cpu, 0x1131));
+  if (cpu->PC != 0x1133) return 1;
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x1134));
+  cpu->PC = 0x1135;
+  return 1;
+}
+
+static int block_1135(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x113, 0x113, 26)) return 0;
+  sta(cpu, i8080_read_word(cpu, 0x1136));
+  if (precompiled_changed(cpu, 0x113, 0x113)) {
+    cpu->PC = 0x1138;
+    return 1;
+  }
+  sta(cpu, i8080_read_word(cpu, 0x1139));
+  cpu->PC = 0x113B;
+  return 1;
+}
+
+static int block_113B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x113, 0x114, 28)) return 0;
+  sui(cpu, i8080_read_byte(cpu, 0x113C));
+  cpu->PC = 0x1140; op_jnz(cpu, i8080_read_word(cpu, 0x113E));
+  if (cpu->PC != 0x1140) return 1;
+  op_push_PSW(cpu, 0);
+  cpu->PC = 0x1141;
+  return 1;
+}
+
+static int block_1141(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x114, 0x114, 71)) return 0;
+  op_mov_A_M(cpu, 0);
+  op_ora_A(cpu, 0);
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x114, 0x114)) {
+    cpu->PC = 0x1144;
+    return 1;
+  }
+  op_mov_A_H(cpu, 0);
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x1149; op_jz(cpu, i8080_read_word(cpu, 0x1147));
+  if (cpu->PC != 0x1149) return 1;
+  op_cmp_M(cpu, 0);
+  cpu->PC = 0x114D; op_jz(cpu, i8080_read_word(cpu, 0x114B));
+  return 1;
+}
+
+static int block_114D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x114, 0x114, 18)) return 0;
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x114, 0x114)) {
+    cpu->PC = 0x114E;
+    return 1;
+  }
+  op_mov_A_M(cpu, 0);
+  cpu->PC = 0x114F;
+  return 1;
+}
+
+static int block_114F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x114, 0x115, 22)) return 0;
+  op_inx_H(cpu, 0);
+  cpu->PC = 0x1153; op_call(cpu, i8080_read_word(cpu, 0x1151));
+  return 1;
+}
+
+static int block_1153(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x115, 0x115, 10)) return 0;
+  cpu->PC = 0x1156; op_jmp(cpu, i8080_read_word(cpu, 0x1154));
+  return 1;
+}
+
+static int block_1156(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x115, 0x116, 94)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x1157));
+  op_mov_A_L(cpu, 0);
+  op_sub_C(cpu, 0);
+  op_mov_C_A(cpu, 0);
+  op_mov_A_H(cpu, 0);
+  op_sbb_B(cpu, 0);
+  op_mov_B_A(cpu, 0);
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x1160));
+  op_xra_A(cpu, 0);
+  op_stax_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x115, 0x116)) {
+    cpu->PC = 0x1164;
+    return 1;
+  }
+  op_inx_D(cpu, 0);
+  op_stax_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x115, 0x116)) {
+    cpu->PC = 0x1166;
+    return 1;
+  }
+  op_inx_D(cpu, 0);
+  op_stax_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x115, 0x116)) {
+    cpu->PC = 0x1168;
+    return 1;
+  }
+  cpu->PC = 0x1169; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_1169(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x116, 0x116, 7)) return 0;
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x116A));
+  cpu->PC = 0x116B;
+  return 1;
+}
+
+static int block_116B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x116, 0x117, 54)) return 0;
+  op_stax_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x116, 0x117)) {
+    cpu->PC = 0x116C;
+    return 1;
+  }
+  op_inx_D(cpu, 0);
+  op_dcx_B(cpu, 0);
+  op_mov_A_C(cpu, 0);
+  op_ora_B(cpu, 0);
+  cpu->PC = 0x1171; op_rnz(cpu, 0);
+  if (cpu->PC != 0x1171) return 1;
+  op_mvi_E(cpu, i8080_read_byte(cpu, 0x1172));
+  cpu->PC = 0x1176; op_jmp(cpu, i8080_read_word(cpu, 0x1174));
+  return 1;
+}
+
+static int block_1176(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x117, 0x118, 68)) return 0;
+  op_mov_A_M(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x1178));
+  cpu->PC = 0x117A; op_rc(cpu, 0);
+  if (cpu->PC != 0x117A) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x117B));
+  cpu->PC = 0x117D; op_rnc(cpu, 0);
+  if (cpu->PC != 0x117D) return 1;
+  ani(cpu, i8080_read_byte(cpu, 0x117E));
+  op_mov_M_A(cpu, 0);
+  if (precompiled_changed(cpu, 0x117, 0x118)) {
+    cpu->PC = 0x1180;
+    return 1;
+  }
+  cpu->PC = 0x1181; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_1181(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x118, 0x118, 43)) return 0;
+  op_pop_H(cpu, 0);
+  op_dcx_H(cpu, 0);
+  op_dcr_A(cpu, 0);
+  sta(cpu, i8080_read_word(cpu, 0x1185));
+  if (precompiled_changed(cpu, 0x118, 0x118)) {
+    cpu->PC = 0x1187;
+    return 1;
+  }
+  cpu->PC = 0x118A; op_jmp(cpu, i8080_read_word(cpu, 0x1188));
+  return 1;
+}
+
+static int block_118A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x118, 0x119, 65)) return 0;
+  op_mov_A_M(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x118C));
+  cpu->PC = 0x1190; op_jnc(cpu, i8080_read_word(cpu, 0x118E));
+  if (cpu->PC != 0x1190) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1191));
+  cpu->PC = 0x1195; op_jz(cpu, i8080_read_word(cpu, 0x1193));
+  if (cpu->PC != 0x1195) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1196));
+  cpu->PC = 0x119A; op_jz(cpu, i8080_read_word(cpu, 0x1198));
+  if (cpu->PC != 0x119A) return 1;
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x119B));
+  cpu->PC = 0x119C;
+  return 1;
+}
+
+static int block_119C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x119, 0x11A, 54)) return 0;
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x119, 0x11A)) {
+    cpu->PC = 0x119D;
+    return 1;
+  }
+  lda(cpu, i8080_read_word(cpu, 0x119E));
+  op_inr_A(cpu, 0);
+  cpu->PC = 0x11A4; op_jz(cpu, i8080_read_word(cpu, 0x11A2));
+  if (cpu->PC != 0x11A4) return 1;
+  op_dcr_A(cpu, 0);
+  cpu->PC = 0x11A8; op_jmp(cpu, i8080_read_word(cpu, 0x11A6));
+  return 1;
+}
+
+static int block_11A8(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x11A, 0x11B, 79)) return 0;
+  op_dcx_H(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x11AB));
+  cpu->PC = 0x11AF; op_jz(cpu, i8080_read_word(cpu, 0x11AD));
+  if (cpu->PC != 0x11AF) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x11B0));
+  cpu->PC = 0x11B4; op_jz(cpu, i8080_read_word(cpu, 0x11B2));
+  if (cpu->PC != 0x11B4) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x11B5));
+  cpu->PC = 0x11B9; op_jz(cpu, i8080_read_word(cpu, 0x11B7));
+  if (cpu->PC != 0x11B9) return 1;
+  op_inx_H(cpu, 0);
+  cpu->PC = 0x11BB; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_11BB(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x11B, 0x11C, 37)) return 0;
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x11BC));
+  sta(cpu, i8080_read_word(cpu, 0x11BE));
+  if (precompiled_changed(cpu, 0x11B, 0x11C)) {
+    cpu->PC = 0x11C0;
+    return 1;
+  }
+  cpu->PC = 0x11C3; op_call(cpu, i8080_read_word(cpu, 0x11C1));
+  return 1;
+}
+
+static int block_11C3(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x11C, 0x11C, 35)) return 0;
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x11C, 0x11C)) {
+    cpu->PC = 0x11C4;
+    return 1;
+  }
+  cpu->PC = 0x11C7; op_call(cpu, i8080_read_word(cpu, 0x11C5));
+  return 1;
+}
+
+static int block_11C7(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x11C, 0x11C, 35)) return 0;
+  op_pop_D(cpu, 0);
+  cpu->PC = 0x11CB; op_jnz(cpu, i8080_read_word(cpu, 0x11C9));
+  if (cpu->PC != 0x11CB) return 1;
+  op_dad_B(cpu, 0);
+  cpu->PC = 0x11CD; op_sphl(cpu, 0);
+  return 1;
+}
+
+static int block_11D0(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x11D, 0x11D, 29)) return 0;
+  op_xchg(cpu, 0);
+  op_mvi_C(cpu, i8080_read_byte(cpu, 0x11D2));
+  cpu->PC = 0x11D6; op_call(cpu, i8080_read_word(cpu, 0x11D4));
+  return 1;
+}
+
+static int block_11D6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x11D, 0x11D, 28)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x11D, 0x11D)) {
+    cpu->PC = 0x11D7;
+    return 1;
+  }
+  cpu->PC = 0x11DA; op_call(cpu, i8080_read_word(cpu, 0x11D8));
+  return 1;
+}
+
+static int block_11DA(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x11D, 0x11E, 74)) return 0;
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x11D, 0x11E)) {
+    cpu->PC = 0x11DB;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x11D, 0x11E)) {
+    cpu->PC = 0x11DC;
+    return 1;
+  }
+  ldhd(cpu, i8080_read_word(cpu, 0x11DD));
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x11D, 0x11E)) {
+    cpu->PC = 0x11E0;
+    return 1;
+  }
+  cpu->PC = 0x11E1; op_rst_1(cpu, 0);
+  return 1;
+}
+
+static int block_11E2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x11E, 0x11E, 11)) return 0;
+  cpu->PC = 0x11E3; op_rst_6(cpu, 0);
+  return 1;
+}
+
+static int block_11E3(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x11E, 0x11E, 48)) return 0;
+  cpu->PC = 0x11E6; op_jz(cpu, i8080_read_word(cpu, 0x11E4));
+  if (cpu->PC != 0x11E6) return 1;
+  cpu->PC = 0x11E9; op_jnc(cpu, i8080_read_word(cpu, 0x11E7));
+  if (cpu->PC != 0x11E9) return 1;
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x11E, 0x11E)) {
+    cpu->PC = 0x11EA;
+    return 1;
+  }
+  cpu->PC = 0x11ED; op_call(cpu, i8080_read_word(cpu, 0x11EB));
+  return 1;
+}
+
+static int block_11ED(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x11E, 0x11F, 48)) return 0;
+  op_pop_PSW(cpu, 0);
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x11E, 0x11F)) {
+    cpu->PC = 0x11EF;
+    return 1;
+  }
+  cpu->PC = 0x11F2; op_jp(cpu, i8080_read_word(cpu, 0x11F0));
+  if (cpu->PC != 0x11F2) return 1;
+  cpu->PC = 0x11F5; op_call(cpu, i8080_read_word(cpu, 0x11F3));
+  return 1;
+}
+
+static int block_1208(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x120, 0x120, 17)) return 0;
+  cpu->PC = 0x120B; op_call(cpu, i8080_read_word(cpu, 0x1209));
+  return 1;
+}
+
+static int block_120B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x120, 0x120, 17)) return 0;
+  cpu->PC = 0x120E; op_call(cpu, i8080_read_word(cpu, 0x120C));
+  return 1;
+}
+
+static int block_120E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x120, 0x122, 100)) return 0;
+  op_pop_H(cpu, 0);
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x120, 0x122)) {
+    cpu->PC = 0x1210;
+    return 1;
+  }
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x120, 0x122)) {
+    cpu->PC = 0x1211;
+    return 1;
+  }
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x1212));
+  op_mov_D_C(cpu, 0);
+  op_mov_E_D(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x1218));
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x121A));
+  cpu->PC = 0x121E; op_jnz(cpu, i8080_read_word(cpu, 0x121C));
+  if (cpu->PC != 0x121E) return 1;
+  cpu->PC = 0x1221; op_call(cpu, i8080_read_word(cpu, 0x121F));
+  return 1;
+}
+
+static int block_122A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x122, 0x122, 38)) return 0;
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x122, 0x122)) {
+    cpu->PC = 0x122B;
+    return 1;
+  }
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x122, 0x122)) {
+    cpu->PC = 0x122C;
+    return 1;
+  }
+  op_mov_C_A(cpu, 0);
+  cpu->PC = 0x122E; op_rst_6(cpu, 0);
+  return 1;
+}
+
+static int block_122E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x122, 0x123, 61)) return 0;
+  op_mov_B_A(cpu, 0);
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x122, 0x123)) {
+    cpu->PC = 0x1230;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x122, 0x123)) {
+    cpu->PC = 0x1231;
+    return 1;
+  }
+  ldhd(cpu, i8080_read_word(cpu, 0x1232));
+  op_xthl(cpu, 0);
+  cpu->PC = 0x1235;
+  return 1;
+}
+
+static int block_1235(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x123, 0x123, 23)) return 0;
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x1236));
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x123, 0x123)) {
+    cpu->PC = 0x1238;
+    return 1;
+  }
+  op_inx_SP(cpu, 0);
+  cpu->PC = 0x1239;
+  return 1;
+}
+
+static int block_1239(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x123, 0x123, 17)) return 0;
+  cpu->PC = 0x123C; op_call(cpu, i8080_read_word(cpu, 0x123A));
+  return 1;
+}
+
+static int block_123C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x123, 0x126, 235)) return 0;
+  shld(cpu, i8080_read_word(cpu, 0x123D));
+  if (precompiled_changed(cpu, 0x123, 0x126)) {
+    cpu->PC = 0x123F;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x1241));
+  op_dad_SP(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x1245));
+  if (precompiled_changed(cpu, 0x123, 0x126)) {
+    cpu->PC = 0x1247;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x124A));
+  cpu->PC = 0x124E; op_jz(cpu, i8080_read_word(cpu, 0x124C));
+  if (cpu->PC != 0x124E) return 1;
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x1252; op_jnz(cpu, i8080_read_word(cpu, 0x1250));
+  if (cpu->PC != 0x1252) return 1;
+  op_inx_H(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_ora_M(cpu, 0);
+  cpu->PC = 0x1259; op_jz(cpu, i8080_read_word(cpu, 0x1257));
+  if (cpu->PC != 0x1259) return 1;
+  op_inx_H(cpu, 0);
+  op_mov_E_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_D_M(cpu, 0);
+  op_xchg(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x125F));
+  if (precompiled_changed(cpu, 0x123, 0x126)) {
+    cpu->PC = 0x1261;
+    return 1;
+  }
+  lda(cpu, i8080_read_word(cpu, 0x1262));
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x1268; op_jz(cpu, i8080_read_word(cpu, 0x1266));
+  if (cpu->PC != 0x1268) return 1;
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x123, 0x126)) {
+    cpu->PC = 0x1269;
+    return 1;
+  }
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x126A));
+  cpu->PC = 0x126C; op_rst_3(cpu, 0);
+  return 1;
+}
+
+static int block_1273(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x127, 0x127, 5)) return 0;
+  op_xchg(cpu, 0);
+  cpu->PC = 0x1274;
+  return 1;
+}
+
+static int block_1274(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x127, 0x127, 11)) return 0;
+  cpu->PC = 0x1275; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_1275(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x127, 0x127, 21)) return 0;
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x1276));
+  op_push_D(cpu, 0);
+  cpu->PC = 0x1279;
+  return 1;
+}
+
+static int block_1279(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x127, 0x127, 11)) return 0;
+  cpu->PC = 0x127A; op_rz(cpu, 0);
+  return 1;
+}
+
+static int block_127A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x127, 0x129, 110)) return 0;
+  sui(cpu, i8080_read_byte(cpu, 0x127B));
+  cpu->PC = 0x127F; op_jc(cpu, i8080_read_word(cpu, 0x127D));
+  if (cpu->PC != 0x127F) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1280));
+  cpu->PC = 0x1284; op_jnc(cpu, i8080_read_word(cpu, 0x1282));
+  if (cpu->PC != 0x1284) return 1;
+  op_rlc(cpu, 0);
+  op_mov_C_A(cpu, 0);
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x1287));
+  op_xchg(cpu, 0);
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x128A));
+  op_dad_B(cpu, 0);
+  op_mov_C_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_B_M(cpu, 0);
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x127, 0x129)) {
+    cpu->PC = 0x1291;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  cpu->PC = 0x1292;
+  return 1;
+}
+
+static int block_1292(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x129, 0x129, 5)) return 0;
+  op_inx_H(cpu, 0);
+  cpu->PC = 0x1293;
+  return 1;
+}
+
+static int block_1293(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x129, 0x129, 25)) return 0;
+  op_mov_A_M(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x1295));
+  cpu->PC = 0x1297; op_rnc(cpu, 0);
+  return 1;
+}
+
+static int block_1297(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x129, 0x12A, 89)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x1298));
+  cpu->PC = 0x129C; op_jz(cpu, i8080_read_word(cpu, 0x129A));
+  if (cpu->PC != 0x129C) return 1;
+  cpu->PC = 0x129F; op_jnc(cpu, i8080_read_word(cpu, 0x129D));
+  if (cpu->PC != 0x129F) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x12A0));
+  cpu->PC = 0x12A4; op_jc(cpu, i8080_read_word(cpu, 0x12A2));
+  if (cpu->PC != 0x12A4) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x12A5));
+  cpu->PC = 0x12A9; op_jnz(cpu, i8080_read_word(cpu, 0x12A7));
+  if (cpu->PC != 0x12A9) return 1;
+  lda(cpu, i8080_read_word(cpu, 0x12AA));
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x12AE; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_12AE(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x12A, 0x12B, 17)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x12AF));
+  cpu->PC = 0x12B3; op_jnz(cpu, i8080_read_word(cpu, 0x12B1));
+  return 1;
+}
+
+static int block_12B3(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x12B, 0x12B, 26)) return 0;
+  ldhd(cpu, i8080_read_word(cpu, 0x12B4));
+  cpu->PC = 0x12B9; op_jmp(cpu, i8080_read_word(cpu, 0x12B7));
+  return 1;
+}
+
+static int block_12B9(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x12B, 0x12C, 92)) return 0;
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x12B, 0x12C)) {
+    cpu->PC = 0x12BA;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  sta(cpu, i8080_read_word(cpu, 0x12BC));
+  if (precompiled_changed(cpu, 0x12B, 0x12C)) {
+    cpu->PC = 0x12BE;
+    return 1;
+  }
+  sui(cpu, i8080_read_byte(cpu, 0x12BF));
+  cpu->PC = 0x12C3; op_jnc(cpu, i8080_read_word(cpu, 0x12C1));
+  if (cpu->PC != 0x12C3) return 1;
+  sui(cpu, i8080_read_byte(cpu, 0x12C4));
+  cpu->PC = 0x12C8; op_jnc(cpu, i8080_read_word(cpu, 0x12C6));
+  if (cpu->PC != 0x12C8) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x12C9));
+  cpu->PC = 0x12CD; op_jnz(cpu, i8080_read_word(cpu, 0x12CB));
+  if (cpu->PC != 0x12CD) return 1;
+  op_mov_A_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  cpu->PC = 0x12CF;
+  return 1;
+}
+
+static int block_12CF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x12C, 0x12D, 79)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x12C, 0x12D)) {
+    cpu->PC = 0x12D0;
+    return 1;
+  }
+  op_mov_L_A(cpu, 0);
+  op_mvi_H(cpu, i8080_read_byte(cpu, 0x12D2));
+  shld(cpu, i8080_read_word(cpu, 0x12D4));
+  if (precompiled_changed(cpu, 0x12C, 0x12D)) {
+    cpu->PC = 0x12D6;
+    return 1;
+  }
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x12D7));
+  sta(cpu, i8080_read_word(cpu, 0x12D9));
+  if (precompiled_changed(cpu, 0x12C, 0x12D)) {
+    cpu->PC = 0x12DB;
+    return 1;
+  }
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x12DF; op_jmp(cpu, i8080_read_word(cpu, 0x12DD));
+  return 1;
+}
+
+static int block_12DF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x12D, 0x12D, 4)) return 0;
+  op_xra_A(cpu, 0);
+  cpu->PC = 0x12E0;
+  return 1;
+}
+
+static int block_12E0(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x12E, 0x12E, 81)) return 0;
+  op_inr_A(cpu, 0);
+  op_rlc(cpu, 0);
+  sta(cpu, i8080_read_word(cpu, 0x12E3));
+  if (precompiled_changed(cpu, 0x12E, 0x12E)) {
+    cpu->PC = 0x12E5;
+    return 1;
+  }
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x12E, 0x12E)) {
+    cpu->PC = 0x12E6;
+    return 1;
+  }
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x12E, 0x12E)) {
+    cpu->PC = 0x12E7;
+    return 1;
+  }
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x12E8));
+  op_xchg(cpu, 0);
+  op_mov_B_A(cpu, 0);
+  cpu->PC = 0x12EF; op_call(cpu, i8080_read_word(cpu, 0x12ED));
+  return 1;
+}
+
+static int block_12EF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x12E, 0x12F, 25)) return 0;
+  op_xchg(cpu, 0);
+  op_pop_B(cpu, 0);
+  op_pop_D(cpu, 0);
+  cpu->PC = 0x12F2;
+  return 1;
+}
+
+static int block_12F2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x12F, 0x12F, 51)) return 0;
+  shld(cpu, i8080_read_word(cpu, 0x12F3));
+  if (precompiled_changed(cpu, 0x12F, 0x12F)) {
+    cpu->PC = 0x12F5;
+    return 1;
+  }
+  op_pop_PSW(cpu, 0);
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x12F7));
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x12FB; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_12FB(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x12F, 0x130, 34)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x12FC));
+  cpu->PC = 0x1300; op_jnc(cpu, i8080_read_word(cpu, 0x12FE));
+  if (cpu->PC != 0x1300) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1301));
+  cpu->PC = 0x1305; op_jnc(cpu, i8080_read_word(cpu, 0x1303));
+  return 1;
+}
+
+static int block_1305(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x130, 0x130, 32)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x1306));
+  op_cmc(cpu, 0);
+  op_inr_A(cpu, 0);
+  op_dcr_A(cpu, 0);
+  cpu->PC = 0x130B; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_130D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x130, 0x132, 112)) return 0;
+  lda(cpu, i8080_read_word(cpu, 0x130E));
+  cpi(cpu, i8080_read_byte(cpu, 0x1311));
+  cpu->PC = 0x1315; op_jnc(cpu, i8080_read_word(cpu, 0x1313));
+  if (cpu->PC != 0x1315) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1316));
+  cpu->PC = 0x131A; op_jc(cpu, i8080_read_word(cpu, 0x1318));
+  if (cpu->PC != 0x131A) return 1;
+  ldhd(cpu, i8080_read_word(cpu, 0x131B));
+  cpu->PC = 0x1320; op_jnz(cpu, i8080_read_word(cpu, 0x131E));
+  if (cpu->PC != 0x1320) return 1;
+  op_inx_H(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_E_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_D_M(cpu, 0);
+  op_xchg(cpu, 0);
+  cpu->PC = 0x1327;
+  return 1;
+}
+
+static int block_132D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x132, 0x133, 53)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x132E));
+  lda(cpu, i8080_read_word(cpu, 0x1331));
+  sta(cpu, i8080_read_word(cpu, 0x1334));
+  if (precompiled_changed(cpu, 0x132, 0x133)) {
+    cpu->PC = 0x1336;
+    return 1;
+  }
+  cpu->PC = 0x1339; op_call(cpu, i8080_read_word(cpu, 0x1337));
+  return 1;
+}
+
+static int block_1339(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x133, 0x133, 10)) return 0;
+  cpu->PC = 0x133C; op_jmp(cpu, i8080_read_word(cpu, 0x133A));
+  return 1;
+}
+
+static int block_133C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x133, 0x134, 58)) return 0;
+  op_xchg(cpu, 0);
+  ldhd(cpu, i8080_read_word(cpu, 0x133E));
+  op_dcx_H(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x1342));
+  if (precompiled_changed(cpu, 0x133, 0x134)) {
+    cpu->PC = 0x1344;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  cpu->PC = 0x1346; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_134B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x134, 0x134, 39)) return 0;
+  cpu->PC = 0x134C; op_rnz(cpu, 0);
+  if (cpu->PC != 0x134C) return 1;
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x134, 0x134)) {
+    cpu->PC = 0x134D;
+    return 1;
+  }
+  cpu->PC = 0x1350; op_cz(cpu, i8080_read_word(cpu, 0x134E));
+  return 1;
+}
+
+static int block_1350(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x135, 0x135, 10)) return 0;
+  op_pop_PSW(cpu, 0);
+  cpu->PC = 0x1351;
+  return 1;
+}
+
+static int block_1351(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x135, 0x135, 62)) return 0;
+  shld(cpu, i8080_read_word(cpu, 0x1352));
+  if (precompiled_changed(cpu, 0x135, 0x135)) {
+    cpu->PC = 0x1354;
+    return 1;
+  }
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x1355));
+  shld(cpu, i8080_read_word(cpu, 0x1358));
+  if (precompiled_changed(cpu, 0x135, 0x135)) {
+    cpu->PC = 0x135A;
+    return 1;
+  }
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x135B));
+  op_pop_B(cpu, 0);
+  cpu->PC = 0x135E;
+  return 1;
+}
+
+static int block_135E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x135, 0x137, 110)) return 0;
+  ldhd(cpu, i8080_read_word(cpu, 0x135F));
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x135, 0x137)) {
+    cpu->PC = 0x1362;
+    return 1;
+  }
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x135, 0x137)) {
+    cpu->PC = 0x1363;
+    return 1;
+  }
+  op_mov_A_L(cpu, 0);
+  op_ana_H(cpu, 0);
+  op_inr_A(cpu, 0);
+  cpu->PC = 0x1369; op_jz(cpu, i8080_read_word(cpu, 0x1367));
+  if (cpu->PC != 0x1369) return 1;
+  shld(cpu, i8080_read_word(cpu, 0x136A));
+  if (precompiled_changed(cpu, 0x135, 0x137)) {
+    cpu->PC = 0x136C;
+    return 1;
+  }
+  ldhd(cpu, i8080_read_word(cpu, 0x136D));
+  shld(cpu, i8080_read_word(cpu, 0x1370));
+  cpu->PC = 0x1372;
+  return 1;
+}
+
+static int block_1372(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x137, 0x137, 34)) return 0;
+  op_xra_A(cpu, 0);
+  sta(cpu, i8080_read_word(cpu, 0x1374));
+  if (precompiled_changed(cpu, 0x137, 0x137)) {
+    cpu->PC = 0x1376;
+    return 1;
+  }
+  cpu->PC = 0x1379; op_call(cpu, i8080_read_word(cpu, 0x1377));
+  return 1;
+}
+
+static int block_1379(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x137, 0x137, 17)) return 0;
+  cpu->PC = 0x137C; op_call(cpu, i8080_read_word(cpu, 0x137A));
+  return 1;
+}
+
+static int block_137C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x137, 0x138, 40)) return 0;
+  op_pop_PSW(cpu, 0);
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x137E));
+  cpu->PC = 0x1383; op_jnz(cpu, i8080_read_word(cpu, 0x1381));
+  if (cpu->PC != 0x1383) return 1;
+  cpu->PC = 0x1386; op_jmp(cpu, i8080_read_word(cpu, 0x1384));
+  return 1;
+}
+
+static int block_13C1(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x13C, 0x13C, 28)) return 0;
+  op_xra_A(cpu, 0);
+  sta(cpu, i8080_read_word(cpu, 0x13C3));
+  if (precompiled_changed(cpu, 0x13C, 0x13C)) {
+    cpu->PC = 0x13C5;
+    return 1;
+  }
+  cpu->PC = 0x13C6; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_13C6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x13C, 0x13C, 17)) return 0;
+  cpu->PC = 0x13C9; op_call(cpu, i8080_read_word(cpu, 0x13C7));
+  return 1;
+}
+
+static int block_13C9(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x13C, 0x13D, 49)) return 0;
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x13C, 0x13D)) {
+    cpu->PC = 0x13CA;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x13C, 0x13D)) {
+    cpu->PC = 0x13CB;
+    return 1;
+  }
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x13CC));
+  cpu->PC = 0x13D1; op_call(cpu, i8080_read_word(cpu, 0x13CF));
+  return 1;
+}
+
+static int block_13D1(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x13D, 0x13D, 45)) return 0;
+  ldhd(cpu, i8080_read_word(cpu, 0x13D2));
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x13D, 0x13D)) {
+    cpu->PC = 0x13D5;
+    return 1;
+  }
+  cpu->PC = 0x13D6; op_rst_6(cpu, 0);
+  return 1;
+}
+
+static int block_13D6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x13D, 0x13D, 22)) return 0;
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x13D, 0x13D)) {
+    cpu->PC = 0x13D7;
+    return 1;
+  }
+  cpu->PC = 0x13D8; op_rst_1(cpu, 0);
+  return 1;
+}
+
+static int block_13D9(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x13D, 0x13D, 17)) return 0;
+  cpu->PC = 0x13DC; op_call(cpu, i8080_read_word(cpu, 0x13DA));
+  return 1;
+}
+
+static int block_13DC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x13D, 0x13D, 21)) return 0;
+  op_pop_B(cpu, 0);
+  cpu->PC = 0x13DE; op_rst_6(cpu, 0);
+  return 1;
+}
+
+static int block_13DE(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x13D, 0x13E, 75)) return 0;
+  op_cmp_B(cpu, 0);
+  cpu->PC = 0x13E2; op_jnz(cpu, i8080_read_word(cpu, 0x13E0));
+  if (cpu->PC != 0x13E2) return 1;
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x13D, 0x13E)) {
+    cpu->PC = 0x13E3;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x13D, 0x13E)) {
+    cpu->PC = 0x13E5;
+    return 1;
+  }
+  ldhd(cpu, i8080_read_word(cpu, 0x13E6));
+  cpu->PC = 0x13E9; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_13E9(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x13E, 0x140, 166)) return 0;
+  cpu->PC = 0x13EC; op_jnz(cpu, i8080_read_word(cpu, 0x13EA));
+  if (cpu->PC != 0x13EC) return 1;
+  op_pop_D(cpu, 0);
+  op_pop_H(cpu, 0);
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x13E, 0x140)) {
+    cpu->PC = 0x13EF;
+    return 1;
+  }
+  op_mov_A_B(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x13F4; op_jnz(cpu, i8080_read_word(cpu, 0x13F2));
+  if (cpu->PC != 0x13F4) return 1;
+  op_mov_A_M(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x13F9; op_jz(cpu, i8080_read_word(cpu, 0x13F7));
+  if (cpu->PC != 0x13F9) return 1;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x13E, 0x140)) {
+    cpu->PC = 0x13FA;
+    return 1;
+  }
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x13E, 0x140)) {
+    cpu->PC = 0x13FB;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_mov_E_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_D_M(cpu, 0);
+  ldhd(cpu, i8080_read_word(cpu, 0x1400));
+  op_xchg(cpu, 0);
+  cpu->PC = 0x1404; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_1491(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x149, 0x149, 28)) return 0;
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x149, 0x149)) {
+    cpu->PC = 0x1492;
+    return 1;
+  }
+  cpu->PC = 0x1495; op_call(cpu, i8080_read_word(cpu, 0x1493));
+  return 1;
+}
+
+static int block_1495(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x149, 0x149, 37)) return 0;
+  op_pop_H(cpu, 0);
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x1497));
+  cpu->PC = 0x149C; op_call(cpu, i8080_read_word(cpu, 0x149A));
+  return 1;
+}
+
+static int block_149C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x149, 0x149, 21)) return 0;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x149E; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_14A3(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x14A, 0x14A, 47)) return 0;
+  op_xra_A(cpu, 0);
+  sta(cpu, i8080_read_word(cpu, 0x14A5));
+  if (precompiled_changed(cpu, 0x14A, 0x14A)) {
+    cpu->PC = 0x14A7;
+    return 1;
+  }
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x14A8));
+  sta(cpu, i8080_read_word(cpu, 0x14AA));
+  if (precompiled_changed(cpu, 0x14A, 0x14A)) {
+    cpu->PC = 0x14AC;
+    return 1;
+  }
+  cpu->PC = 0x14AF; op_jmp(cpu, i8080_read_word(cpu, 0x14AD));
+  return 1;
+}
+
+static int block_14AF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x14A, 0x14C, 96)) return 0;
+  sta(cpu, i8080_read_word(cpu, 0x14B0));
+  if (precompiled_changed(cpu, 0x14A, 0x14C)) {
+    cpu->PC = 0x14B2;
+    return 1;
+  }
+  op_mov_B_H(cpu, 0);
+  op_mov_C_L(cpu, 0);
+  op_dcx_B(cpu, 0);
+  op_dcx_B(cpu, 0);
+  op_dcx_B(cpu, 0);
+  op_dcx_B(cpu, 0);
+  op_dcx_B(cpu, 0);
+  lda(cpu, i8080_read_word(cpu, 0x14BA));
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x14C0; op_jnz(cpu, i8080_read_word(cpu, 0x14BE));
+  if (cpu->PC != 0x14C0) return 1;
+  op_dad_D(cpu, 0);
+  op_push_H(cpu, 0);
+  cpu->PC = 0x14C2;
+  return 1;
+}
+
+static int block_14C2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x14C, 0x14C, 49)) return 0;
+  op_dcx_H(cpu, 0);
+  op_mov_A_E(cpu, 0);
+  op_ora_D(cpu, 0);
+  cpu->PC = 0x14C8; op_jz(cpu, i8080_read_word(cpu, 0x14C6));
+  if (cpu->PC != 0x14C8) return 1;
+  op_mvi_M(cpu, i8080_read_byte(cpu, 0x14C9));
+  if (precompiled_changed(cpu, 0x14C, 0x14C)) {
+    cpu->PC = 0x14CA;
+    return 1;
+  }
+  op_dcx_D(cpu, 0);
+  cpu->PC = 0x14CE; op_jmp(cpu, i8080_read_word(cpu, 0x14CC));
+  return 1;
+}
+
+static int block_14CE(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x14C, 0x14D, 31)) return 0;
+  op_pop_H(cpu, 0);
+  op_xchg(cpu, 0);
+  ldhd(cpu, i8080_read_word(cpu, 0x14D1));
+  cpu->PC = 0x14D3;
+  return 1;
+}
+
+static int block_14D3(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x14D, 0x14D, 11)) return 0;
+  cpu->PC = 0x14D4; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_14D4(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x14D, 0x14E, 82)) return 0;
+  op_ldax_D(cpu, 0);
+  op_stax_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x14D, 0x14E)) {
+    cpu->PC = 0x14D6;
+    return 1;
+  }
+  op_inx_D(cpu, 0);
+  op_inx_B(cpu, 0);
+  cpu->PC = 0x14DB; op_jnz(cpu, i8080_read_word(cpu, 0x14D9));
+  if (cpu->PC != 0x14DB) return 1;
+  op_dcx_B(cpu, 0);
+  op_mov_H_B(cpu, 0);
+  op_mov_L_C(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x14DF));
+  if (precompiled_changed(cpu, 0x14D, 0x14E)) {
+    cpu->PC = 0x14E1;
+    return 1;
+  }
+  cpu->PC = 0x14E4; op_call(cpu, i8080_read_word(cpu, 0x14E2));
+  return 1;
+}
+
+static int block_14E4(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x14E, 0x14E, 46)) return 0;
+  op_pop_H(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x14E7));
+  cpu->PC = 0x14E9; op_rnz(cpu, 0);
+  if (cpu->PC != 0x14E9) return 1;
+  cpu->PC = 0x14EA; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_1565(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x156, 0x156, 7)) return 0;
+  op_mov_A_M(cpu, 0);
+  cpu->PC = 0x1566;
+  return 1;
+}
+
+static int block_1566(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x156, 0x156, 40)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x1567));
+  cpu->PC = 0x1569; op_rc(cpu, 0);
+  if (cpu->PC != 0x1569) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x156A));
+  op_cmc(cpu, 0);
+  cpu->PC = 0x156D; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_156D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x156, 0x156, 11)) return 0;
+  cpu->PC = 0x156E; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_156E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x156, 0x157, 17)) return 0;
+  cpu->PC = 0x1571; op_call(cpu, i8080_read_word(cpu, 0x156F));
+  return 1;
+}
+
+static int block_1571(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x157, 0x157, 11)) return 0;
+  cpu->PC = 0x1572; op_rp(cpu, 0);
+  return 1;
+}
+
+static int block_1582(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x158, 0x158, 5)) return 0;
+  op_dcx_H(cpu, 0);
+  cpu->PC = 0x1583;
+  return 1;
+}
+
+static int block_1583(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x158, 0x158, 11)) return 0;
+  cpu->PC = 0x1584; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_1584(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x158, 0x158, 24)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x1585));
+  cpu->PC = 0x1589; op_jz(cpu, i8080_read_word(cpu, 0x1587));
+  if (cpu->PC != 0x1589) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x158A));
+  cpu->PC = 0x158B;
+  return 1;
+}
+
+static int block_158B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x158, 0x159, 51)) return 0;
+  op_xchg(cpu, 0);
+  ldhd(cpu, i8080_read_word(cpu, 0x158D));
+  op_xchg(cpu, 0);
+  cpu->PC = 0x1593; op_jz(cpu, i8080_read_word(cpu, 0x1591));
+  if (cpu->PC != 0x1593) return 1;
+  op_dcx_H(cpu, 0);
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x1595));
+  cpu->PC = 0x1597;
+  return 1;
+}
+
+static int block_1597(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x159, 0x159, 11)) return 0;
+  cpu->PC = 0x1598; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_1598(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x159, 0x159, 54)) return 0;
+  cpu->PC = 0x1599; op_rnc(cpu, 0);
+  if (cpu->PC != 0x1599) return 1;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x159, 0x159)) {
+    cpu->PC = 0x159A;
+    return 1;
+  }
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x159, 0x159)) {
+    cpu->PC = 0x159B;
+    return 1;
+  }
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x159C));
+  cpu->PC = 0x159F; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_159F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x159, 0x15B, 124)) return 0;
+  cpu->PC = 0x15A2; op_jc(cpu, i8080_read_word(cpu, 0x15A0));
+  if (cpu->PC != 0x15A2) return 1;
+  op_mov_H_D(cpu, 0);
+  op_mov_L_E(cpu, 0);
+  op_dad_D(cpu, 0);
+  op_dad_H(cpu, 0);
+  op_dad_D(cpu, 0);
+  op_dad_H(cpu, 0);
+  op_pop_PSW(cpu, 0);
+  sui(cpu, i8080_read_byte(cpu, 0x15AA));
+  op_mov_E_A(cpu, 0);
+  op_mvi_D(cpu, i8080_read_byte(cpu, 0x15AD));
+  op_dad_D(cpu, 0);
+  op_xchg(cpu, 0);
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x15B4; op_jmp(cpu, i8080_read_word(cpu, 0x15B2));
+  return 1;
+}
+
+static int block_15DD(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x15D, 0x15E, 38)) return 0;
+  cpu->PC = 0x15E0; op_jnz(cpu, i8080_read_word(cpu, 0x15DE));
+  if (cpu->PC != 0x15E0) return 1;
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x15D, 0x15E)) {
+    cpu->PC = 0x15E1;
+    return 1;
+  }
+  cpu->PC = 0x15E4; op_call(cpu, i8080_read_word(cpu, 0x15E2));
+  return 1;
+}
+
+static int block_15E4(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x15E, 0x15E, 20)) return 0;
+  op_pop_PSW(cpu, 0);
+  cpu->PC = 0x15E8; op_jmp(cpu, i8080_read_word(cpu, 0x15E6));
+  return 1;
+}
+
+static int block_15FE(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x15F, 0x160, 24)) return 0;
+  op_mvi_C(cpu, i8080_read_byte(cpu, 0x15FF));
+  cpu->PC = 0x1603; op_call(cpu, i8080_read_word(cpu, 0x1601));
+  return 1;
+}
+
+static int block_1603(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x160, 0x160, 17)) return 0;
+  cpu->PC = 0x1606; op_call(cpu, i8080_read_word(cpu, 0x1604));
+  return 1;
+}
+
+static int block_1606(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x160, 0x161, 110)) return 0;
+  op_pop_B(cpu, 0);
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x160, 0x161)) {
+    cpu->PC = 0x1608;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x160, 0x161)) {
+    cpu->PC = 0x1609;
+    return 1;
+  }
+  ldhd(cpu, i8080_read_word(cpu, 0x160A));
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x160, 0x161)) {
+    cpu->PC = 0x160D;
+    return 1;
+  }
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x160E));
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x160, 0x161)) {
+    cpu->PC = 0x1610;
+    return 1;
+  }
+  op_inx_SP(cpu, 0);
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x160, 0x161)) {
+    cpu->PC = 0x1612;
+    return 1;
+  }
+  cpu->PC = 0x1615; op_jmp(cpu, i8080_read_word(cpu, 0x1613));
+  return 1;
+}
+
+static int block_1616(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x161, 0x161, 17)) return 0;
+  cpu->PC = 0x1619; op_call(cpu, i8080_read_word(cpu, 0x1617));
+  return 1;
+}
+
+static int block_1619(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x161, 0x162, 103)) return 0;
+  lda(cpu, i8080_read_word(cpu, 0x161A));
+  cpi(cpu, i8080_read_byte(cpu, 0x161D));
+  op_xchg(cpu, 0);
+  cpu->PC = 0x1620; op_rz(cpu, 0);
+  if (cpu->PC != 0x1620) return 1;
+  op_xchg(cpu, 0);
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x161, 0x162)) {
+    cpu->PC = 0x1622;
+    return 1;
+  }
+  ldhd(cpu, i8080_read_word(cpu, 0x1623));
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x161, 0x162)) {
+    cpu->PC = 0x1626;
+    return 1;
+  }
+  cpu->PC = 0x1629; op_call(cpu, i8080_read_word(cpu, 0x1627));
+  return 1;
+}
+
+static int block_1629(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x162, 0x162, 38)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x162, 0x162)) {
+    cpu->PC = 0x162A;
+    return 1;
+  }
+  ldhd(cpu, i8080_read_word(cpu, 0x162B));
+  cpu->PC = 0x162E; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_162E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x162, 0x163, 32)) return 0;
+  op_pop_H(cpu, 0);
+  op_inx_H(cpu, 0);
+  cpu->PC = 0x1633; op_cc(cpu, i8080_read_word(cpu, 0x1631));
+  return 1;
+}
+
+static int block_1633(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x163, 0x163, 17)) return 0;
+  cpu->PC = 0x1636; op_cnc(cpu, i8080_read_word(cpu, 0x1634));
+  return 1;
+}
+
+static int block_1636(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x163, 0x164, 62)) return 0;
+  cpu->PC = 0x1639; op_jnc(cpu, i8080_read_word(cpu, 0x1637));
+  if (cpu->PC != 0x1639) return 1;
+  op_dcx_B(cpu, 0);
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x163B));
+  sta(cpu, i8080_read_word(cpu, 0x163D));
+  if (precompiled_changed(cpu, 0x163, 0x164)) {
+    cpu->PC = 0x163F;
+    return 1;
+  }
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x1643; op_call(cpu, i8080_read_word(cpu, 0x1641));
+  return 1;
+}
+
+static int block_1643(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x164, 0x164, 21)) return 0;
+  op_mov_H_B(cpu, 0);
+  op_mov_L_C(cpu, 0);
+  cpu->PC = 0x1646; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_164B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x164, 0x165, 35)) return 0;
+  cpu->PC = 0x164C; op_rnz(cpu, 0);
+  if (cpu->PC != 0x164C) return 1;
+  op_mvi_D(cpu, i8080_read_byte(cpu, 0x164D));
+  cpu->PC = 0x1651; op_call(cpu, i8080_read_word(cpu, 0x164F));
+  return 1;
+}
+
+static int block_1651(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x165, 0x165, 5)) return 0;
+  cpu->PC = 0x1652; op_sphl(cpu, 0);
+  return 1;
+}
+
+static int block_1652(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x165, 0x166, 101)) return 0;
+  shld(cpu, i8080_read_word(cpu, 0x1653));
+  if (precompiled_changed(cpu, 0x165, 0x166)) {
+    cpu->PC = 0x1655;
+    return 1;
+  }
+  cpi(cpu, i8080_read_byte(cpu, 0x1656));
+  op_mvi_E(cpu, i8080_read_byte(cpu, 0x1658));
+  cpu->PC = 0x165C; op_jnz(cpu, i8080_read_word(cpu, 0x165A));
+  if (cpu->PC != 0x165C) return 1;
+  op_pop_H(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x165E));
+  if (precompiled_changed(cpu, 0x165, 0x166)) {
+    cpu->PC = 0x1660;
+    return 1;
+  }
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x1661));
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x165, 0x166)) {
+    cpu->PC = 0x1664;
+    return 1;
+  }
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x1665));
+  cpu->PC = 0x1666;
+  return 1;
+}
+
+static int block_1666(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x166, 0x166, 21)) return 0;
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x1667));
+  op_nop(cpu, 0);
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x166B));
+  cpu->PC = 0x166C;
+  return 1;
+}
+
+static int block_1668(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x166, 0x166, 14)) return 0;
+  op_mvi_C(cpu, i8080_read_byte(cpu, 0x1669));
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x166B));
+  cpu->PC = 0x166C;
+  return 1;
+}
+
+static int block_166C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x166, 0x166, 15)) return 0;
+  op_mov_A_C(cpu, 0);
+  op_mov_C_B(cpu, 0);
+  op_mov_B_A(cpu, 0);
+  cpu->PC = 0x166F;
+  return 1;
+}
+
+static int block_166F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x166, 0x166, 5)) return 0;
+  op_dcx_H(cpu, 0);
+  cpu->PC = 0x1670;
+  return 1;
+}
+
+static int block_1670(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x167, 0x167, 11)) return 0;
+  cpu->PC = 0x1671; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_1671(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x167, 0x168, 107)) return 0;
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x1673; op_rz(cpu, 0);
+  if (cpu->PC != 0x1673) return 1;
+  op_cmp_B(cpu, 0);
+  cpu->PC = 0x1675; op_rz(cpu, 0);
+  if (cpu->PC != 0x1675) return 1;
+  op_inx_H(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x1677));
+  cpu->PC = 0x167B; op_jz(cpu, i8080_read_word(cpu, 0x1679));
+  if (cpu->PC != 0x167B) return 1;
+  op_inr_A(cpu, 0);
+  cpu->PC = 0x167F; op_jz(cpu, i8080_read_word(cpu, 0x167D));
+  if (cpu->PC != 0x167F) return 1;
+  sui(cpu, i8080_read_byte(cpu, 0x1680));
+  cpu->PC = 0x1684; op_jnz(cpu, i8080_read_word(cpu, 0x1682));
+  if (cpu->PC != 0x1684) return 1;
+  op_cmp_B(cpu, 0);
+  op_adc_D(cpu, 0);
+  op_mov_D_A(cpu, 0);
+  cpu->PC = 0x168A; op_jmp(cpu, i8080_read_word(cpu, 0x1688));
+  return 1;
+}
+
+static int block_168A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x168, 0x168, 17)) return 0;
+  cpu->PC = 0x168D; op_call(cpu, i8080_read_word(cpu, 0x168B));
+  return 1;
+}
+
+static int block_168D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x168, 0x168, 22)) return 0;
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x168, 0x168)) {
+    cpu->PC = 0x168E;
+    return 1;
+  }
+  cpu->PC = 0x168F; op_rst_6(cpu, 0);
+  return 1;
+}
+
+static int block_168F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x168, 0x169, 22)) return 0;
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x168, 0x169)) {
+    cpu->PC = 0x1690;
+    return 1;
+  }
+  cpu->PC = 0x1691; op_rst_1(cpu, 0);
+  return 1;
+}
+
+static int block_1692(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x169, 0x169, 36)) return 0;
+  op_xchg(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x1694));
+  if (precompiled_changed(cpu, 0x169, 0x169)) {
+    cpu->PC = 0x1696;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  cpu->PC = 0x169A; op_jmp(cpu, i8080_read_word(cpu, 0x1698));
+  return 1;
+}
+
+static int block_169A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x169, 0x169, 22)) return 0;
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x169, 0x169)) {
+    cpu->PC = 0x169B;
+    return 1;
+  }
+  cpu->PC = 0x169C; op_rst_6(cpu, 0);
+  return 1;
+}
+
+static int block_169C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x169, 0x169, 11)) return 0;
+  op_push_PSW(cpu, 0);
+  cpu->PC = 0x169D;
+  return 1;
+}
+
+static int block_169D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x169, 0x169, 17)) return 0;
+  cpu->PC = 0x16A0; op_call(cpu, i8080_read_word(cpu, 0x169E));
+  return 1;
+}
+
+static int block_16A0(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x16A, 0x16A, 52)) return 0;
+  op_pop_PSW(cpu, 0);
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x16A, 0x16A)) {
+    cpu->PC = 0x16A2;
+    return 1;
+  }
+  adi(cpu, i8080_read_byte(cpu, 0x16A3));
+  cpu->PC = 0x16A7; op_call(cpu, i8080_read_word(cpu, 0x16A5));
+  return 1;
+}
+
+static int block_16A7(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x16A, 0x16A, 17)) return 0;
+  cpu->PC = 0x16AA; op_call(cpu, i8080_read_word(cpu, 0x16A8));
+  return 1;
+}
+
+static int block_16AA(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x16A, 0x16B, 99)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x16A, 0x16B)) {
+    cpu->PC = 0x16AB;
+    return 1;
+  }
+  cpu->PC = 0x16AE; op_jnz(cpu, i8080_read_word(cpu, 0x16AC));
+  if (cpu->PC != 0x16AE) return 1;
+  ldhd(cpu, i8080_read_word(cpu, 0x16AF));
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x16A, 0x16B)) {
+    cpu->PC = 0x16B2;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_mov_E_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_D_M(cpu, 0);
+  ldhd(cpu, i8080_read_word(cpu, 0x16B7));
+  cpu->PC = 0x16BA; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_16BA(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x16B, 0x16C, 37)) return 0;
+  cpu->PC = 0x16BD; op_jnc(cpu, i8080_read_word(cpu, 0x16BB));
+  if (cpu->PC != 0x16BD) return 1;
+  ldhd(cpu, i8080_read_word(cpu, 0x16BE));
+  cpu->PC = 0x16C1; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_16C1(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x16C, 0x16C, 47)) return 0;
+  op_pop_D(cpu, 0);
+  cpu->PC = 0x16C5; op_jnc(cpu, i8080_read_word(cpu, 0x16C3));
+  if (cpu->PC != 0x16C5) return 1;
+  ldhd(cpu, i8080_read_word(cpu, 0x16C6));
+  cpu->PC = 0x16C9; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_16C9(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x16C, 0x16C, 20)) return 0;
+  cpu->PC = 0x16CC; op_jz(cpu, i8080_read_word(cpu, 0x16CA));
+  if (cpu->PC != 0x16CC) return 1;
+  cpu->PC = 0x16CF; op_jnc(cpu, i8080_read_word(cpu, 0x16CD));
+  return 1;
+}
+
+static int block_16D8(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x16D, 0x16D, 17)) return 0;
+  cpu->PC = 0x16DB; op_call(cpu, i8080_read_word(cpu, 0x16D9));
+  return 1;
+}
+
+static int block_16DB(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x16D, 0x16D, 38)) return 0;
+  op_pop_H(cpu, 0);
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x16D, 0x16D)) {
+    cpu->PC = 0x16DD;
+    return 1;
+  }
+  cpu->PC = 0x16E0; op_call(cpu, i8080_read_word(cpu, 0x16DE));
+  return 1;
+}
+
+static int block_16E0(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x16E, 0x16E, 27)) return 0;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x16E4; op_call(cpu, i8080_read_word(cpu, 0x16E2));
+  return 1;
+}
+
+static int block_16E4(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x16E, 0x16E, 21)) return 0;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x16E6; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_16E6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x16E, 0x16E, 17)) return 0;
+  cpu->PC = 0x16E9; op_call(cpu, i8080_read_word(cpu, 0x16E7));
+  return 1;
+}
+
+static int block_16E9(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x16E, 0x16E, 31)) return 0;
+  op_pop_D(cpu, 0);
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x16EC; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_16EC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x16E, 0x16F, 28)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x16ED));
+  cpu->PC = 0x16F1; op_jnz(cpu, i8080_read_word(cpu, 0x16EF));
+  if (cpu->PC != 0x16F1) return 1;
+  cpu->PC = 0x16F2; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_1717(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x171, 0x171, 17)) return 0;
+  cpu->PC = 0x171A; op_call(cpu, i8080_read_word(cpu, 0x1718));
+  return 1;
+}
+
+static int block_171A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x171, 0x172, 40)) return 0;
+  op_mov_A_M(cpu, 0);
+  op_mov_B_A(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x171D));
+  cpu->PC = 0x1721; op_jz(cpu, i8080_read_word(cpu, 0x171F));
+  if (cpu->PC != 0x1721) return 1;
+  cpu->PC = 0x1722; op_rst_1(cpu, 0);
+  return 1;
+}
+
+static int block_1723(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x172, 0x172, 5)) return 0;
+  op_dcx_H(cpu, 0);
+  cpu->PC = 0x1724;
+  return 1;
+}
+
+static int block_1724(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x172, 0x172, 5)) return 0;
+  op_mov_C_E(cpu, 0);
+  cpu->PC = 0x1725;
+  return 1;
+}
+
+static int block_1725(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x172, 0x172, 37)) return 0;
+  op_dcr_C(cpu, 0);
+  op_mov_A_B(cpu, 0);
+  cpu->PC = 0x172A; op_jz(cpu, i8080_read_word(cpu, 0x1728));
+  if (cpu->PC != 0x172A) return 1;
+  cpu->PC = 0x172D; op_call(cpu, i8080_read_word(cpu, 0x172B));
+  return 1;
+}
+
+static int block_172D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x172, 0x173, 28)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x172E));
+  cpu->PC = 0x1730; op_rnz(cpu, 0);
+  if (cpu->PC != 0x1730) return 1;
+  cpu->PC = 0x1733; op_jmp(cpu, i8080_read_word(cpu, 0x1731));
+  return 1;
+}
+
+static int block_17AD(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x17A, 0x17A, 17)) return 0;
+  cpu->PC = 0x17B0; op_call(cpu, i8080_read_word(cpu, 0x17AE));
+  return 1;
+}
+
+static int block_17B0(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x17B, 0x17B, 31)) return 0;
+  op_mov_A_M(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x17B2));
+  cpu->PC = 0x17B6; op_cz(cpu, i8080_read_word(cpu, 0x17B4));
+  return 1;
+}
+
+static int block_17B6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x17B, 0x17B, 28)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x17B7));
+  cpu->PC = 0x17BB; op_jz(cpu, i8080_read_word(cpu, 0x17B9));
+  if (cpu->PC != 0x17BB) return 1;
+  cpu->PC = 0x17BC; op_rst_1(cpu, 0);
+  return 1;
+}
+
+static int block_17BD(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x17B, 0x17B, 5)) return 0;
+  op_dcx_H(cpu, 0);
+  cpu->PC = 0x17BE;
+  return 1;
+}
+
+static int block_17BE(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x17B, 0x17C, 28)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x17B, 0x17C)) {
+    cpu->PC = 0x17BF;
+    return 1;
+  }
+  cpu->PC = 0x17C2; op_call(cpu, i8080_read_word(cpu, 0x17C0));
+  return 1;
+}
+
+static int block_17C2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x17C, 0x17C, 20)) return 0;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x17C6; op_jz(cpu, i8080_read_word(cpu, 0x17C4));
+  return 1;
+}
+
+static int block_17C6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x17C, 0x17C, 11)) return 0;
+  cpu->PC = 0x17C7; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_17C7(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x17C, 0x17D, 44)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x17C8));
+  cpu->PC = 0x17CC; op_jz(cpu, i8080_read_word(cpu, 0x17CA));
+  if (cpu->PC != 0x17CC) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x17CD));
+  cpu->PC = 0x17D1; op_jz(cpu, i8080_read_word(cpu, 0x17CF));
+  if (cpu->PC != 0x17D1) return 1;
+  cpu->PC = 0x17D4; op_jmp(cpu, i8080_read_word(cpu, 0x17D2));
+  return 1;
+}
+
+static int block_17D4(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x17D, 0x17D, 7)) return 0;
+  op_mvi_D(cpu, i8080_read_byte(cpu, 0x17D5));
+  cpu->PC = 0x17D6;
+  return 1;
+}
+
+static int block_17D6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x17D, 0x17D, 17)) return 0;
+  cpu->PC = 0x17D9; op_call(cpu, i8080_read_word(cpu, 0x17D7));
+  return 1;
+}
+
+static int block_17D9(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x17D, 0x17D, 26)) return 0;
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x17DB; op_rz(cpu, 0);
+  if (cpu->PC != 0x17DB) return 1;
+  cpu->PC = 0x17DC; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_17DC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x17D, 0x17E, 42)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x17DD));
+  cpu->PC = 0x17E1; op_jnz(cpu, i8080_read_word(cpu, 0x17DF));
+  if (cpu->PC != 0x17E1) return 1;
+  op_dcr_D(cpu, 0);
+  cpu->PC = 0x17E5; op_jnz(cpu, i8080_read_word(cpu, 0x17E3));
+  if (cpu->PC != 0x17E5) return 1;
+  cpu->PC = 0x17E8; op_jmp(cpu, i8080_read_word(cpu, 0x17E6));
+  return 1;
+}
+
+static int block_17F0(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x17F, 0x17F, 24)) return 0;
+  op_mvi_C(cpu, i8080_read_byte(cpu, 0x17F1));
+  cpu->PC = 0x17F5; op_call(cpu, i8080_read_word(cpu, 0x17F3));
+  return 1;
+}
+
+static int block_17F5(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x17F, 0x17F, 16)) return 0;
+  op_dcx_H(cpu, 0);
+  cpu->PC = 0x17F7; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_17F7(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x17F, 0x17F, 17)) return 0;
+  cpu->PC = 0x17FA; op_cz(cpu, i8080_read_word(cpu, 0x17F8));
+  return 1;
+}
+
+static int block_17FA(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x17F, 0x181, 133)) return 0;
+  cpu->PC = 0x17FD; op_jz(cpu, i8080_read_word(cpu, 0x17FB));
+  if (cpu->PC != 0x17FD) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x17FE));
+  cpu->PC = 0x1802; op_jz(cpu, i8080_read_word(cpu, 0x1800));
+  if (cpu->PC != 0x1802) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1803));
+  cpu->PC = 0x1807; op_jz(cpu, i8080_read_word(cpu, 0x1805));
+  if (cpu->PC != 0x1807) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1808));
+  cpu->PC = 0x180C; op_jz(cpu, i8080_read_word(cpu, 0x180A));
+  if (cpu->PC != 0x180C) return 1;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x17F, 0x181)) {
+    cpu->PC = 0x180D;
+    return 1;
+  }
+  cpi(cpu, i8080_read_byte(cpu, 0x180E));
+  cpu->PC = 0x1812; op_jz(cpu, i8080_read_word(cpu, 0x1810));
+  if (cpu->PC != 0x1812) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1813));
+  cpu->PC = 0x1817; op_jz(cpu, i8080_read_word(cpu, 0x1815));
+  if (cpu->PC != 0x1817) return 1;
+  op_pop_B(cpu, 0);
+  cpu->PC = 0x181B; op_call(cpu, i8080_read_word(cpu, 0x1819));
+  return 1;
+}
+
+static int block_181B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x181, 0x181, 22)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x181, 0x181)) {
+    cpu->PC = 0x181C;
+    return 1;
+  }
+  cpu->PC = 0x181D; op_rst_6(cpu, 0);
+  return 1;
+}
+
+static int block_181D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x181, 0x182, 27)) return 0;
+  cpu->PC = 0x1820; op_jz(cpu, i8080_read_word(cpu, 0x181E));
+  if (cpu->PC != 0x1820) return 1;
+  cpu->PC = 0x1823; op_call(cpu, i8080_read_word(cpu, 0x1821));
+  return 1;
+}
+
+static int block_1823(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x182, 0x182, 17)) return 0;
+  cpu->PC = 0x1826; op_call(cpu, i8080_read_word(cpu, 0x1824));
+  return 1;
+}
+
+static int block_1826(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x182, 0x184, 146)) return 0;
+  ldhd(cpu, i8080_read_word(cpu, 0x1827));
+  op_mov_A_H(cpu, 0);
+  op_ora_L(cpu, 0);
+  cpu->PC = 0x182E; op_jnz(cpu, i8080_read_word(cpu, 0x182C));
+  if (cpu->PC != 0x182E) return 1;
+  ldhd(cpu, i8080_read_word(cpu, 0x182F));
+  lda(cpu, i8080_read_word(cpu, 0x1832));
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x1838; op_jz(cpu, i8080_read_word(cpu, 0x1836));
+  if (cpu->PC != 0x1838) return 1;
+  lda(cpu, i8080_read_word(cpu, 0x1839));
+  op_add_M(cpu, 0);
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x182, 0x184)) {
+    cpu->PC = 0x183D;
+    return 1;
+  }
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x183E));
+  op_cmp_M(cpu, 0);
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x1845; op_jmp(cpu, i8080_read_word(cpu, 0x1843));
+  return 1;
+}
+
+static int block_1845(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x184, 0x184, 42)) return 0;
+  lda(cpu, i8080_read_word(cpu, 0x1846));
+  op_mov_B_A(cpu, 0);
+  lda(cpu, i8080_read_word(cpu, 0x184A));
+  op_add_M(cpu, 0);
+  op_cmp_B(cpu, 0);
+  cpu->PC = 0x184E;
+  return 1;
+}
+
+static int block_184E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x184, 0x185, 17)) return 0;
+  cpu->PC = 0x1851; op_cnc(cpu, i8080_read_word(cpu, 0x184F));
+  return 1;
+}
+
+static int block_1851(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x185, 0x185, 17)) return 0;
+  cpu->PC = 0x1854; op_call(cpu, i8080_read_word(cpu, 0x1852));
+  return 1;
+}
+
+static int block_1854(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x185, 0x185, 18)) return 0;
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x1855));
+  cpu->PC = 0x1857; op_rst_3(cpu, 0);
+  return 1;
+}
+
+static int block_1857(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x185, 0x185, 4)) return 0;
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x1858;
+  return 1;
+}
+
+static int block_1858(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x185, 0x185, 17)) return 0;
+  cpu->PC = 0x185B; op_cz(cpu, i8080_read_word(cpu, 0x1859));
+  return 1;
+}
+
+static int block_185B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x185, 0x185, 20)) return 0;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x185F; op_jmp(cpu, i8080_read_word(cpu, 0x185D));
+  return 1;
+}
+
+static int block_185F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x185, 0x186, 38)) return 0;
+  lda(cpu, i8080_read_word(cpu, 0x1860));
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x1864; op_rz(cpu, 0);
+  if (cpu->PC != 0x1864) return 1;
+  cpu->PC = 0x1867; op_jmp(cpu, i8080_read_word(cpu, 0x1865));
+  return 1;
+}
+
+static int block_1867(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x186, 0x187, 45)) return 0;
+  lda(cpu, i8080_read_word(cpu, 0x1868));
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x186E; op_jnz(cpu, i8080_read_word(cpu, 0x186C));
+  if (cpu->PC != 0x186E) return 1;
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x186F));
+  cpu->PC = 0x1871; op_rst_3(cpu, 0);
+  return 1;
+}
+
+static int block_1871(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x187, 0x187, 7)) return 0;
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x1872));
+  cpu->PC = 0x1873;
+  return 1;
+}
+
+static int block_1873(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x187, 0x187, 11)) return 0;
+  cpu->PC = 0x1874; op_rst_3(cpu, 0);
+  return 1;
+}
+
+static int block_1874(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x187, 0x187, 71)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x187, 0x187)) {
+    cpu->PC = 0x1875;
+    return 1;
+  }
+  ldhd(cpu, i8080_read_word(cpu, 0x1876));
+  op_mov_A_H(cpu, 0);
+  op_ora_L(cpu, 0);
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x187E; op_jz(cpu, i8080_read_word(cpu, 0x187C));
+  if (cpu->PC != 0x187E) return 1;
+  op_xra_A(cpu, 0);
+  cpu->PC = 0x1880; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_1880(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x188, 0x188, 13)) return 0;
+  lda(cpu, i8080_read_word(cpu, 0x1881));
+  cpu->PC = 0x1883;
+  return 1;
+}
+
+static int block_1883(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x188, 0x188, 55)) return 0;
+  op_dcr_A(cpu, 0);
+  sta(cpu, i8080_read_word(cpu, 0x1885));
+  if (precompiled_changed(cpu, 0x188, 0x188)) {
+    cpu->PC = 0x1887;
+    return 1;
+  }
+  cpu->PC = 0x1888; op_rz(cpu, 0);
+  if (cpu->PC != 0x1888) return 1;
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x188, 0x188)) {
+    cpu->PC = 0x1889;
+    return 1;
+  }
+  op_xra_A(cpu, 0);
+  cpu->PC = 0x188B; op_rst_3(cpu, 0);
+  return 1;
+}
+
+static int block_18FF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x18F, 0x190, 21)) return 0;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x1901; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_1901(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x190, 0x190, 10)) return 0;
+  cpu->PC = 0x1904; op_jmp(cpu, i8080_read_word(cpu, 0x1902));
+  return 1;
+}
+
+static int block_1904(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x190, 0x190, 75)) return 0;
+  op_xra_A(cpu, 0);
+  sta(cpu, i8080_read_word(cpu, 0x1906));
+  if (precompiled_changed(cpu, 0x190, 0x190)) {
+    cpu->PC = 0x1908;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x190, 0x190)) {
+    cpu->PC = 0x1909;
+    return 1;
+  }
+  op_mov_H_A(cpu, 0);
+  op_mov_L_A(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x190C));
+  if (precompiled_changed(cpu, 0x190, 0x190)) {
+    cpu->PC = 0x190E;
+    return 1;
+  }
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x1910; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_1A61(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1A6, 0x1A6, 10)) return 0;
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x1A62));
+  cpu->PC = 0x1A64;
+  return 1;
+}
+
+static int block_1A64(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1A6, 0x1A6, 17)) return 0;
+  cpu->PC = 0x1A67; op_cnz(cpu, i8080_read_word(cpu, 0x1A65));
+  return 1;
+}
+
+static int block_1A67(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1A6, 0x1A6, 33)) return 0;
+  shld(cpu, i8080_read_word(cpu, 0x1A68));
+  if (precompiled_changed(cpu, 0x1A6, 0x1A6)) {
+    cpu->PC = 0x1A6A;
+    return 1;
+  }
+  cpu->PC = 0x1A6D; op_call(cpu, i8080_read_word(cpu, 0x1A6B));
+  return 1;
+}
+
+static int block_1A6D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1A6, 0x1A7, 15)) return 0;
+  cpu->PC = 0x1A70; op_jnz(cpu, i8080_read_word(cpu, 0x1A6E));
+  if (cpu->PC != 0x1A70) return 1;
+  cpu->PC = 0x1A71; op_sphl(cpu, 0);
+  return 1;
+}
+
+static int block_1A71(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1A7, 0x1A8, 104)) return 0;
+  shld(cpu, i8080_read_word(cpu, 0x1A72));
+  if (precompiled_changed(cpu, 0x1A7, 0x1A8)) {
+    cpu->PC = 0x1A74;
+    return 1;
+  }
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x1A7, 0x1A8)) {
+    cpu->PC = 0x1A75;
+    return 1;
+  }
+  op_mov_A_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x1A7, 0x1A8)) {
+    cpu->PC = 0x1A78;
+    return 1;
+  }
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x1A7, 0x1A8)) {
+    cpu->PC = 0x1A79;
+    return 1;
+  }
+  op_mov_A_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x1A7F; op_jm(cpu, i8080_read_word(cpu, 0x1A7D));
+  if (cpu->PC != 0x1A7F) return 1;
+  cpu->PC = 0x1A82; op_call(cpu, i8080_read_word(cpu, 0x1A80));
+  return 1;
+}
+
+static int block_1A82(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1A8, 0x1A8, 46)) return 0;
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x1A8, 0x1A8)) {
+    cpu->PC = 0x1A83;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x1A8, 0x1A8)) {
+    cpu->PC = 0x1A84;
+    return 1;
+  }
+  cpu->PC = 0x1A87; op_call(cpu, i8080_read_word(cpu, 0x1A85));
+  return 1;
+}
+
+static int block_1A87(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1A8, 0x1A8, 27)) return 0;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x1A8B; op_call(cpu, i8080_read_word(cpu, 0x1A89));
+  return 1;
+}
+
+static int block_1A8B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1A8, 0x1A8, 27)) return 0;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x1A8F; op_call(cpu, i8080_read_word(cpu, 0x1A8D));
+  return 1;
+}
+
+static int block_1A8F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1A8, 0x1A9, 28)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x1A8, 0x1A9)) {
+    cpu->PC = 0x1A90;
+    return 1;
+  }
+  cpu->PC = 0x1A93; op_call(cpu, i8080_read_word(cpu, 0x1A91));
+  return 1;
+}
+
+static int block_1A93(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1A9, 0x1A9, 10)) return 0;
+  cpu->PC = 0x1A96; op_jmp(cpu, i8080_read_word(cpu, 0x1A94));
+  return 1;
+}
+
+static int block_1ABF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1AB, 0x1AC, 41)) return 0;
+  op_pop_H(cpu, 0);
+  op_pop_B(cpu, 0);
+  op_sub_B(cpu, 0);
+  cpu->PC = 0x1AC5; op_call(cpu, i8080_read_word(cpu, 0x1AC3));
+  return 1;
+}
+
+static int block_1AC5(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1AC, 0x1AD, 51)) return 0;
+  cpu->PC = 0x1AC8; op_jz(cpu, i8080_read_word(cpu, 0x1AC6));
+  if (cpu->PC != 0x1AC8) return 1;
+  op_xchg(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x1ACA));
+  if (precompiled_changed(cpu, 0x1AC, 0x1AD)) {
+    cpu->PC = 0x1ACC;
+    return 1;
+  }
+  op_mov_L_C(cpu, 0);
+  op_mov_H_B(cpu, 0);
+  cpu->PC = 0x1AD1; op_jmp(cpu, i8080_read_word(cpu, 0x1ACF));
+  return 1;
+}
+
+static int block_1AD1(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1AD, 0x1AD, 5)) return 0;
+  cpu->PC = 0x1AD2; op_sphl(cpu, 0);
+  return 1;
+}
+
+static int block_1AD2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1AD, 0x1AD, 67)) return 0;
+  shld(cpu, i8080_read_word(cpu, 0x1AD3));
+  if (precompiled_changed(cpu, 0x1AD, 0x1AD)) {
+    cpu->PC = 0x1AD5;
+    return 1;
+  }
+  ldhd(cpu, i8080_read_word(cpu, 0x1AD6));
+  op_mov_A_M(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x1ADA));
+  cpu->PC = 0x1ADE; op_jnz(cpu, i8080_read_word(cpu, 0x1ADC));
+  if (cpu->PC != 0x1ADE) return 1;
+  cpu->PC = 0x1ADF; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_1AE2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1AE, 0x1AE, 11)) return 0;
+  cpu->PC = 0x1AE3; op_rst_1(cpu, 0);
+  return 1;
+}
+
+static int block_1AE4(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1AE, 0x1AE, 5)) return 0;
+  op_dcx_H(cpu, 0);
+  cpu->PC = 0x1AE5;
+  return 1;
+}
+
+static int block_1AE5(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1AE, 0x1AE, 7)) return 0;
+  op_mvi_D(cpu, i8080_read_byte(cpu, 0x1AE6));
+  cpu->PC = 0x1AE7;
+  return 1;
+}
+
+static int block_1AE7(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1AE, 0x1AE, 35)) return 0;
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x1AE, 0x1AE)) {
+    cpu->PC = 0x1AE8;
+    return 1;
+  }
+  op_mvi_C(cpu, i8080_read_byte(cpu, 0x1AE9));
+  cpu->PC = 0x1AED; op_call(cpu, i8080_read_word(cpu, 0x1AEB));
+  return 1;
+}
+
+static int block_1AED(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1AE, 0x1AE, 17)) return 0;
+  cpu->PC = 0x1AF0; op_call(cpu, i8080_read_word(cpu, 0x1AEE));
+  return 1;
+}
+
+static int block_1AF0(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1AF, 0x1AF, 16)) return 0;
+  shld(cpu, i8080_read_word(cpu, 0x1AF1));
+  cpu->PC = 0x1AF3;
+  return 1;
+}
+
+static int block_1AF3(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1AF, 0x1AF, 16)) return 0;
+  ldhd(cpu, i8080_read_word(cpu, 0x1AF4));
+  cpu->PC = 0x1AF6;
+  return 1;
+}
+
+static int block_1AF6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1AF, 0x1AF, 24)) return 0;
+  op_pop_B(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  op_mvi_D(cpu, i8080_read_byte(cpu, 0x1AF9));
+  cpu->PC = 0x1AFA;
+  return 1;
+}
+
+static int block_1AFA(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1AF, 0x1B1, 95)) return 0;
+  sui(cpu, i8080_read_byte(cpu, 0x1AFB));
+  cpu->PC = 0x1AFF; op_jc(cpu, i8080_read_word(cpu, 0x1AFD));
+  if (cpu->PC != 0x1AFF) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1B00));
+  cpu->PC = 0x1B04; op_jnc(cpu, i8080_read_word(cpu, 0x1B02));
+  if (cpu->PC != 0x1B04) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1B05));
+  op_ral(cpu, 0);
+  op_xra_D(cpu, 0);
+  op_cmp_D(cpu, 0);
+  op_mov_D_A(cpu, 0);
+  cpu->PC = 0x1B0D; op_jc(cpu, i8080_read_word(cpu, 0x1B0B));
+  if (cpu->PC != 0x1B0D) return 1;
+  shld(cpu, i8080_read_word(cpu, 0x1B0E));
+  if (precompiled_changed(cpu, 0x1AF, 0x1B1)) {
+    cpu->PC = 0x1B10;
+    return 1;
+  }
+  cpu->PC = 0x1B11; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_1B11(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1B1, 0x1B1, 10)) return 0;
+  cpu->PC = 0x1B14; op_jmp(cpu, i8080_read_word(cpu, 0x1B12));
+  return 1;
+}
+
+static int block_1B14(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1B1, 0x1B4, 259)) return 0;
+  op_mov_A_D(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x1B19; op_jnz(cpu, i8080_read_word(cpu, 0x1B17));
+  if (cpu->PC != 0x1B19) return 1;
+  op_mov_A_M(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x1B1B));
+  if (precompiled_changed(cpu, 0x1B1, 0x1B4)) {
+    cpu->PC = 0x1B1D;
+    return 1;
+  }
+  sui(cpu, i8080_read_byte(cpu, 0x1B1E));
+  cpu->PC = 0x1B20; op_rc(cpu, 0);
+  if (cpu->PC != 0x1B20) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1B21));
+  cpu->PC = 0x1B23; op_rnc(cpu, 0);
+  if (cpu->PC != 0x1B23) return 1;
+  op_mov_E_A(cpu, 0);
+  lda(cpu, i8080_read_word(cpu, 0x1B25));
+  sui(cpu, i8080_read_byte(cpu, 0x1B28));
+  op_ora_E(cpu, 0);
+  cpu->PC = 0x1B2D; op_jz(cpu, i8080_read_word(cpu, 0x1B2B));
+  if (cpu->PC != 0x1B2D) return 1;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x1B2E));
+  op_dad_D(cpu, 0);
+  op_mov_A_B(cpu, 0);
+  op_mov_D_M(cpu, 0);
+  op_cmp_D(cpu, 0);
+  cpu->PC = 0x1B35; op_rnc(cpu, 0);
+  if (cpu->PC != 0x1B35) return 1;
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x1B1, 0x1B4)) {
+    cpu->PC = 0x1B36;
+    return 1;
+  }
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x1B37));
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x1B1, 0x1B4)) {
+    cpu->PC = 0x1B3A;
+    return 1;
+  }
+  op_mov_A_D(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x1B3C));
+  cpu->PC = 0x1B40; op_jz(cpu, i8080_read_word(cpu, 0x1B3E));
+  if (cpu->PC != 0x1B40) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1B41));
+  cpu->PC = 0x1B45; op_jc(cpu, i8080_read_word(cpu, 0x1B43));
+  if (cpu->PC != 0x1B45) return 1;
+  ani(cpu, i8080_read_byte(cpu, 0x1B46));
+  cpi(cpu, i8080_read_byte(cpu, 0x1B48));
+  cpu->PC = 0x1B4C; op_jz(cpu, i8080_read_word(cpu, 0x1B4A));
+  return 1;
+}
+
+static int block_1B4C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1B4, 0x1B4, 10)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x1B4D));
+  cpu->PC = 0x1B4F;
+  return 1;
+}
+
+static int block_1B4F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1B4, 0x1B4, 4)) return 0;
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x1B50;
+  return 1;
+}
+
+static int block_1B50(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1B5, 0x1B6, 148)) return 0;
+  lda(cpu, i8080_read_word(cpu, 0x1B51));
+  op_dcr_A(cpu, 0);
+  op_dcr_A(cpu, 0);
+  op_dcr_A(cpu, 0);
+  cpu->PC = 0x1B59; op_jz(cpu, i8080_read_word(cpu, 0x1B57));
+  if (cpu->PC != 0x1B59) return 1;
+  op_mov_C_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_B_M(cpu, 0);
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x1B5, 0x1B6)) {
+    cpu->PC = 0x1B5D;
+    return 1;
+  }
+  cpu->PC = 0x1B60; op_jm(cpu, i8080_read_word(cpu, 0x1B5E));
+  if (cpu->PC != 0x1B60) return 1;
+  op_inx_H(cpu, 0);
+  op_mov_C_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_B_M(cpu, 0);
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x1B5, 0x1B6)) {
+    cpu->PC = 0x1B65;
+    return 1;
+  }
+  cpu->PC = 0x1B68; op_jpo(cpu, i8080_read_word(cpu, 0x1B66));
+  if (cpu->PC != 0x1B68) return 1;
+  op_inx_H(cpu, 0);
+  cpu->PC = 0x1B6C; op_jc(cpu, i8080_read_word(cpu, 0x1B6A));
+  if (cpu->PC != 0x1B6C) return 1;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x1B6D));
+  cpu->PC = 0x1B6F;
+  return 1;
+}
+
+static int block_1B78(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1B7, 0x1B7, 17)) return 0;
+  cpu->PC = 0x1B7B; op_jc(cpu, i8080_read_word(cpu, 0x1B79));
+  if (cpu->PC != 0x1B7B) return 1;
+  adi(cpu, i8080_read_byte(cpu, 0x1B7C));
+  cpu->PC = 0x1B7D;
+  return 1;
+}
+
+static int block_1B7D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1B7, 0x1B7, 5)) return 0;
+  op_mov_C_E(cpu, 0);
+  cpu->PC = 0x1B7E;
+  return 1;
+}
+
+static int block_1B7E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1B7, 0x1B7, 5)) return 0;
+  op_mov_B_A(cpu, 0);
+  cpu->PC = 0x1B7F;
+  return 1;
+}
+
+static int block_1B7F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1B7, 0x1B8, 21)) return 0;
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x1B7, 0x1B8)) {
+    cpu->PC = 0x1B80;
+    return 1;
+  }
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x1B81));
+  cpu->PC = 0x1B83;
+  return 1;
+}
+
+static int block_1B83(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1B8, 0x1B8, 37)) return 0;
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x1B8, 0x1B8)) {
+    cpu->PC = 0x1B84;
+    return 1;
+  }
+  ldhd(cpu, i8080_read_word(cpu, 0x1B85));
+  cpu->PC = 0x1B8A; op_jmp(cpu, i8080_read_word(cpu, 0x1B88));
+  return 1;
+}
+
+static int block_1B8A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1B8, 0x1B8, 17)) return 0;
+  cpu->PC = 0x1B8D; op_call(cpu, i8080_read_word(cpu, 0x1B8B));
+  return 1;
+}
+
+static int block_1B8D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1B8, 0x1B8, 17)) return 0;
+  cpu->PC = 0x1B90; op_call(cpu, i8080_read_word(cpu, 0x1B8E));
+  return 1;
+}
+
+static int block_1B90(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1B9, 0x1B9, 27)) return 0;
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x1B91));
+  op_mvi_D(cpu, i8080_read_byte(cpu, 0x1B94));
+  cpu->PC = 0x1B98; op_jmp(cpu, i8080_read_word(cpu, 0x1B96));
+  return 1;
+}
+
+static int block_1B98(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1B9, 0x1B9, 28)) return 0;
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x1B9, 0x1B9)) {
+    cpu->PC = 0x1B99;
+    return 1;
+  }
+  cpu->PC = 0x1B9C; op_call(cpu, i8080_read_word(cpu, 0x1B9A));
+  return 1;
+}
+
+static int block_1B9C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1B9, 0x1BA, 41)) return 0;
+  op_pop_D(cpu, 0);
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x1B9, 0x1BA)) {
+    cpu->PC = 0x1B9E;
+    return 1;
+  }
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x1B9F));
+  cpu->PC = 0x1BA4; op_jmp(cpu, i8080_read_word(cpu, 0x1BA2));
+  return 1;
+}
+
+static int block_1BA4(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1BA, 0x1BB, 87)) return 0;
+  op_mov_A_B(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x1BA6));
+  cpu->PC = 0x1BA8; op_rnc(cpu, 0);
+  if (cpu->PC != 0x1BA8) return 1;
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x1BA, 0x1BB)) {
+    cpu->PC = 0x1BA9;
+    return 1;
+  }
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x1BA, 0x1BB)) {
+    cpu->PC = 0x1BAA;
+    return 1;
+  }
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x1BAB));
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x1BAE));
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x1BA, 0x1BB)) {
+    cpu->PC = 0x1BB1;
+    return 1;
+  }
+  cpu->PC = 0x1BB2; op_rst_6(cpu, 0);
+  return 1;
+}
+
+static int block_1BB2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1BB, 0x1BB, 57)) return 0;
+  cpu->PC = 0x1BB5; op_jnz(cpu, i8080_read_word(cpu, 0x1BB3));
+  if (cpu->PC != 0x1BB5) return 1;
+  ldhd(cpu, i8080_read_word(cpu, 0x1BB6));
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x1BB, 0x1BB)) {
+    cpu->PC = 0x1BB9;
+    return 1;
+  }
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x1BBA));
+  cpu->PC = 0x1BBF; op_jmp(cpu, i8080_read_word(cpu, 0x1BBD));
+  return 1;
+}
+
+static int block_1BBF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1BB, 0x1BF, 243)) return 0;
+  op_pop_B(cpu, 0);
+  op_mov_A_C(cpu, 0);
+  sta(cpu, i8080_read_word(cpu, 0x1BC2));
+  if (precompiled_changed(cpu, 0x1BB, 0x1BF)) {
+    cpu->PC = 0x1BC4;
+    return 1;
+  }
+  op_mov_A_B(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x1BC6));
+  cpu->PC = 0x1BCA; op_jz(cpu, i8080_read_word(cpu, 0x1BC8));
+  if (cpu->PC != 0x1BCA) return 1;
+  lda(cpu, i8080_read_word(cpu, 0x1BCB));
+  cpi(cpu, i8080_read_byte(cpu, 0x1BCE));
+  cpu->PC = 0x1BD2; op_jz(cpu, i8080_read_word(cpu, 0x1BD0));
+  if (cpu->PC != 0x1BD2) return 1;
+  op_mov_D_A(cpu, 0);
+  op_mov_A_B(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x1BD5));
+  cpu->PC = 0x1BD9; op_jz(cpu, i8080_read_word(cpu, 0x1BD7));
+  if (cpu->PC != 0x1BD9) return 1;
+  op_mov_A_D(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x1BDB));
+  cpu->PC = 0x1BDF; op_jz(cpu, i8080_read_word(cpu, 0x1BDD));
+  if (cpu->PC != 0x1BDF) return 1;
+  cpu->PC = 0x1BE2; op_jnc(cpu, i8080_read_word(cpu, 0x1BE0));
+  if (cpu->PC != 0x1BE2) return 1;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x1BE3));
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x1BE6));
+  op_dad_B(cpu, 0);
+  op_dad_B(cpu, 0);
+  op_mov_C_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_B_M(cpu, 0);
+  op_pop_D(cpu, 0);
+  ldhd(cpu, i8080_read_word(cpu, 0x1BEE));
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x1BB, 0x1BF)) {
+    cpu->PC = 0x1BF1;
+    return 1;
+  }
+  cpu->PC = 0x1BF2; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_1C05(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1C0, 0x1C0, 17)) return 0;
+  cpu->PC = 0x1C08; op_call(cpu, i8080_read_word(cpu, 0x1C06));
+  return 1;
+}
+
+static int block_1C08(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1C0, 0x1C0, 10)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x1C09));
+  cpu->PC = 0x1C0B;
+  return 1;
+}
+
+static int block_1C0B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1C0, 0x1C1, 89)) return 0;
+  lda(cpu, i8080_read_word(cpu, 0x1C0C));
+  op_rlc(cpu, 0);
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x1C0, 0x1C1)) {
+    cpu->PC = 0x1C10;
+    return 1;
+  }
+  op_mov_C_A(cpu, 0);
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x1C12));
+  op_dad_B(cpu, 0);
+  op_pop_B(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_H_M(cpu, 0);
+  op_mov_L_A(cpu, 0);
+  cpu->PC = 0x1C1A; op_pchl(cpu, 0);
+  return 1;
+}
+
+static int block_1C1A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1C1, 0x1C1, 28)) return 0;
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x1C1, 0x1C1)) {
+    cpu->PC = 0x1C1B;
+    return 1;
+  }
+  cpu->PC = 0x1C1E; op_call(cpu, i8080_read_word(cpu, 0x1C1C));
+  return 1;
+}
+
+static int block_1C1E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1C1, 0x1C2, 76)) return 0;
+  op_pop_PSW(cpu, 0);
+  sta(cpu, i8080_read_word(cpu, 0x1C20));
+  if (precompiled_changed(cpu, 0x1C1, 0x1C2)) {
+    cpu->PC = 0x1C22;
+    return 1;
+  }
+  cpi(cpu, i8080_read_byte(cpu, 0x1C23));
+  cpu->PC = 0x1C27; op_jz(cpu, i8080_read_word(cpu, 0x1C25));
+  if (cpu->PC != 0x1C27) return 1;
+  op_pop_H(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x1C29));
+  if (precompiled_changed(cpu, 0x1C1, 0x1C2)) {
+    cpu->PC = 0x1C2B;
+    return 1;
+  }
+  cpu->PC = 0x1C2E; op_jmp(cpu, i8080_read_word(cpu, 0x1C2C));
+  return 1;
+}
+
+static int block_1C2E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1C2, 0x1C3, 17)) return 0;
+  cpu->PC = 0x1C31; op_call(cpu, i8080_read_word(cpu, 0x1C2F));
+  return 1;
+}
+
+static int block_1C31(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1C3, 0x1C3, 20)) return 0;
+  op_pop_B(cpu, 0);
+  op_pop_D(cpu, 0);
+  cpu->PC = 0x1C33;
+  return 1;
+}
+
+static int block_1C33(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1C3, 0x1C3, 20)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x1C34));
+  cpu->PC = 0x1C39; op_jmp(cpu, i8080_read_word(cpu, 0x1C37));
+  return 1;
+}
+
+static int block_1C39(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1C3, 0x1C3, 27)) return 0;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x1C3D; op_call(cpu, i8080_read_word(cpu, 0x1C3B));
+  return 1;
+}
+
+static int block_1C3D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1C3, 0x1C3, 17)) return 0;
+  cpu->PC = 0x1C40; op_call(cpu, i8080_read_word(cpu, 0x1C3E));
+  return 1;
+}
+
+static int block_1C40(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1C4, 0x1C4, 17)) return 0;
+  cpu->PC = 0x1C43; op_call(cpu, i8080_read_word(cpu, 0x1C41));
+  return 1;
+}
+
+static int block_1C43(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1C4, 0x1C4, 62)) return 0;
+  op_pop_H(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x1C45));
+  if (precompiled_changed(cpu, 0x1C4, 0x1C4)) {
+    cpu->PC = 0x1C47;
+    return 1;
+  }
+  op_pop_H(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x1C49));
+  if (precompiled_changed(cpu, 0x1C4, 0x1C4)) {
+    cpu->PC = 0x1C4B;
+    return 1;
+  }
+  cpu->PC = 0x1C4E; op_jmp(cpu, i8080_read_word(cpu, 0x1C4C));
+  return 1;
+}
+
+static int block_1C5D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1C5, 0x1C5, 11)) return 0;
+  cpu->PC = 0x1C5E; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_1C5E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1C5, 0x1C7, 81)) return 0;
+  op_mvi_E(cpu, i8080_read_byte(cpu, 0x1C5F));
+  cpu->PC = 0x1C63; op_jz(cpu, i8080_read_word(cpu, 0x1C61));
+  if (cpu->PC != 0x1C63) return 1;
+  cpu->PC = 0x1C66; op_jc(cpu, i8080_read_word(cpu, 0x1C64));
+  if (cpu->PC != 0x1C66) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1C67));
+  cpu->PC = 0x1C6B; op_jc(cpu, i8080_read_word(cpu, 0x1C69));
+  if (cpu->PC != 0x1C6B) return 1;
+  op_inr_A(cpu, 0);
+  cpu->PC = 0x1C6F; op_jz(cpu, i8080_read_word(cpu, 0x1C6D));
+  if (cpu->PC != 0x1C6F) return 1;
+  op_dcr_A(cpu, 0);
+  cpu->PC = 0x1C73; op_call(cpu, i8080_read_word(cpu, 0x1C71));
+  return 1;
+}
+
+static int block_1C73(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1C7, 0x1C9, 123)) return 0;
+  cpu->PC = 0x1C76; op_jnc(cpu, i8080_read_word(cpu, 0x1C74));
+  if (cpu->PC != 0x1C76) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1C77));
+  cpu->PC = 0x1C7B; op_jz(cpu, i8080_read_word(cpu, 0x1C79));
+  if (cpu->PC != 0x1C7B) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1C7C));
+  cpu->PC = 0x1C80; op_jz(cpu, i8080_read_word(cpu, 0x1C7E));
+  if (cpu->PC != 0x1C80) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1C81));
+  cpu->PC = 0x1C85; op_jz(cpu, i8080_read_word(cpu, 0x1C83));
+  if (cpu->PC != 0x1C85) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1C86));
+  cpu->PC = 0x1C8A; op_jz(cpu, i8080_read_word(cpu, 0x1C88));
+  if (cpu->PC != 0x1C8A) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1C8B));
+  cpu->PC = 0x1C8F; op_jz(cpu, i8080_read_word(cpu, 0x1C8D));
+  if (cpu->PC != 0x1C8F) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1C90));
+  cpu->PC = 0x1C94; op_jnz(cpu, i8080_read_word(cpu, 0x1C92));
+  if (cpu->PC != 0x1C94) return 1;
+  cpu->PC = 0x1C95; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_1CB0(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1CB, 0x1CB, 28)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x1CB1));
+  cpu->PC = 0x1CB5; op_jnz(cpu, i8080_read_word(cpu, 0x1CB3));
+  if (cpu->PC != 0x1CB5) return 1;
+  cpu->PC = 0x1CB6; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_1CBF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1CB, 0x1CC, 28)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x1CC0));
+  cpu->PC = 0x1CC4; op_jnz(cpu, i8080_read_word(cpu, 0x1CC2));
+  if (cpu->PC != 0x1CC4) return 1;
+  cpu->PC = 0x1CC5; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_1CD8(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1CD, 0x1CE, 68)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x1CD9));
+  cpu->PC = 0x1CDD; op_jz(cpu, i8080_read_word(cpu, 0x1CDB));
+  if (cpu->PC != 0x1CDD) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1CDE));
+  cpu->PC = 0x1CE2; op_jz(cpu, i8080_read_word(cpu, 0x1CE0));
+  if (cpu->PC != 0x1CE2) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1CE3));
+  cpu->PC = 0x1CE7; op_jz(cpu, i8080_read_word(cpu, 0x1CE5));
+  if (cpu->PC != 0x1CE7) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1CE8));
+  cpu->PC = 0x1CEC; op_jz(cpu, i8080_read_word(cpu, 0x1CEA));
+  return 1;
+}
+
+static int block_1CEC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1CE, 0x1CE, 17)) return 0;
+  cpu->PC = 0x1CEF; op_call(cpu, i8080_read_word(cpu, 0x1CED));
+  return 1;
+}
+
+static int block_1CEF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1CE, 0x1CE, 11)) return 0;
+  cpu->PC = 0x1CF0; op_rst_1(cpu, 0);
+  return 1;
+}
+
+static int block_1CF1(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1CF, 0x1CF, 11)) return 0;
+  cpu->PC = 0x1CF2; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_1CF2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1CF, 0x1CF, 24)) return 0;
+  op_mvi_D(cpu, i8080_read_byte(cpu, 0x1CF3));
+  cpu->PC = 0x1CF7; op_call(cpu, i8080_read_word(cpu, 0x1CF5));
+  return 1;
+}
+
+static int block_1CF7(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1CF, 0x1CF, 44)) return 0;
+  ldhd(cpu, i8080_read_word(cpu, 0x1CF8));
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x1CF, 0x1CF)) {
+    cpu->PC = 0x1CFB;
+    return 1;
+  }
+  cpu->PC = 0x1CFE; op_call(cpu, i8080_read_word(cpu, 0x1CFC));
+  return 1;
+}
+
+static int block_1CFE(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1CF, 0x1CF, 21)) return 0;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x1D00; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_1D00(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1D0, 0x1D0, 17)) return 0;
+  cpu->PC = 0x1D03; op_call(cpu, i8080_read_word(cpu, 0x1D01));
+  return 1;
+}
+
+static int block_1D03(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1D0, 0x1D0, 43)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x1D0, 0x1D0)) {
+    cpu->PC = 0x1D04;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x1D06));
+  if (precompiled_changed(cpu, 0x1D0, 0x1D0)) {
+    cpu->PC = 0x1D08;
+    return 1;
+  }
+  cpu->PC = 0x1D09; op_rst_6(cpu, 0);
+  return 1;
+}
+
+static int block_1D09(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1D0, 0x1D0, 17)) return 0;
+  cpu->PC = 0x1D0C; op_cnz(cpu, i8080_read_word(cpu, 0x1D0A));
+  return 1;
+}
+
+static int block_1D0C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1D0, 0x1D0, 21)) return 0;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x1D0E; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_1D0E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1D0, 0x1D1, 17)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x1D0F));
+  cpu->PC = 0x1D13; op_jnz(cpu, i8080_read_word(cpu, 0x1D11));
+  return 1;
+}
+
+static int block_1D72(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1D7, 0x1D7, 57)) return 0;
+  op_inx_H(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  sui(cpu, i8080_read_byte(cpu, 0x1D75));
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x1D77));
+  op_rlc(cpu, 0);
+  op_mov_C_A(cpu, 0);
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x1D7, 0x1D7)) {
+    cpu->PC = 0x1D7B;
+    return 1;
+  }
+  cpu->PC = 0x1D7C; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_1D7C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1D7, 0x1D8, 39)) return 0;
+  op_mov_A_C(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x1D7E));
+  cpu->PC = 0x1D82; op_jnc(cpu, i8080_read_word(cpu, 0x1D80));
+  if (cpu->PC != 0x1D82) return 1;
+  cpu->PC = 0x1D85; op_call(cpu, i8080_read_word(cpu, 0x1D83));
+  return 1;
+}
+
+static int block_1D85(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1D8, 0x1D8, 11)) return 0;
+  cpu->PC = 0x1D86; op_rst_1(cpu, 0);
+  return 1;
+}
+
+static int block_1D87(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1D8, 0x1D8, 17)) return 0;
+  cpu->PC = 0x1D8A; op_call(cpu, i8080_read_word(cpu, 0x1D88));
+  return 1;
+}
+
+static int block_1D8A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1D8, 0x1D9, 72)) return 0;
+  op_xchg(cpu, 0);
+  ldhd(cpu, i8080_read_word(cpu, 0x1D8C));
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x1D8, 0x1D9)) {
+    cpu->PC = 0x1D8F;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x1D8, 0x1D9)) {
+    cpu->PC = 0x1D90;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  cpu->PC = 0x1D94; op_call(cpu, i8080_read_word(cpu, 0x1D92));
+  return 1;
+}
+
+static int block_1D94(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1D9, 0x1D9, 33)) return 0;
+  op_xchg(cpu, 0);
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x1D9, 0x1D9)) {
+    cpu->PC = 0x1D96;
+    return 1;
+  }
+  cpu->PC = 0x1D99; op_jmp(cpu, i8080_read_word(cpu, 0x1D97));
+  return 1;
+}
+
+static int block_1D99(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1D9, 0x1D9, 17)) return 0;
+  cpu->PC = 0x1D9C; op_call(cpu, i8080_read_word(cpu, 0x1D9A));
+  return 1;
+}
+
+static int block_1D9C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1D9, 0x1DA, 75)) return 0;
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x1D9, 0x1DA)) {
+    cpu->PC = 0x1D9D;
+    return 1;
+  }
+  op_mov_A_L(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x1D9F));
+  cpu->PC = 0x1DA3; op_jc(cpu, i8080_read_word(cpu, 0x1DA1));
+  if (cpu->PC != 0x1DA3) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1DA4));
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x1D9, 0x1DA)) {
+    cpu->PC = 0x1DA6;
+    return 1;
+  }
+  cpu->PC = 0x1DA9; op_cc(cpu, i8080_read_word(cpu, 0x1DA7));
+  return 1;
+}
+
+static int block_1DA9(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1DA, 0x1DA, 10)) return 0;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x1DAA;
+  return 1;
+}
+
+static int block_1DAA(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1DA, 0x1DA, 21)) return 0;
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x1DAB));
+  op_push_D(cpu, 0);
+  cpu->PC = 0x1DAE;
+  return 1;
+}
+
+static int block_1DAE(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1DA, 0x1DB, 10)) return 0;
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x1DAF));
+  cpu->PC = 0x1DB1;
+  return 1;
+}
+
+static int block_1DB1(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1DB, 0x1DB, 39)) return 0;
+  op_dad_B(cpu, 0);
+  op_mov_C_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_H_M(cpu, 0);
+  op_mov_L_C(cpu, 0);
+  cpu->PC = 0x1DB7; op_pchl(cpu, 0);
+  return 1;
+}
+
+static int block_1DE4(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1DE, 0x1DE, 51)) return 0;
+  op_inr_A(cpu, 0);
+  op_adc_A(cpu, 0);
+  op_pop_B(cpu, 0);
+  op_ana_B(cpu, 0);
+  adi(cpu, i8080_read_byte(cpu, 0x1DE9));
+  op_sbb_A(cpu, 0);
+  cpu->PC = 0x1DEE; op_call(cpu, i8080_read_word(cpu, 0x1DEC));
+  return 1;
+}
+
+static int block_1DEE(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1DE, 0x1DF, 10)) return 0;
+  cpu->PC = 0x1DF1; op_jmp(cpu, i8080_read_word(cpu, 0x1DEF));
+  return 1;
+}
+
+static int block_1DF1(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1DF, 0x1DF, 24)) return 0;
+  op_mvi_D(cpu, i8080_read_byte(cpu, 0x1DF2));
+  cpu->PC = 0x1DF6; op_call(cpu, i8080_read_word(cpu, 0x1DF4));
+  return 1;
+}
+
+static int block_1DF6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1DF, 0x1DF, 17)) return 0;
+  cpu->PC = 0x1DF9; op_call(cpu, i8080_read_word(cpu, 0x1DF7));
+  return 1;
+}
+
+static int block_1DF9(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1DF, 0x1E0, 64)) return 0;
+  op_mov_A_L(cpu, 0);
+  op_cma(cpu, 0);
+  op_mov_L_A(cpu, 0);
+  op_mov_A_H(cpu, 0);
+  op_cma(cpu, 0);
+  op_mov_H_A(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x1E00));
+  if (precompiled_changed(cpu, 0x1DF, 0x1E0)) {
+    cpu->PC = 0x1E02;
+    return 1;
+  }
+  op_pop_B(cpu, 0);
+  cpu->PC = 0x1E06; op_jmp(cpu, i8080_read_word(cpu, 0x1E04));
+  return 1;
+}
+
+static int block_1E06(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1E0, 0x1E0, 26)) return 0;
+  op_dcr_A(cpu, 0);
+  op_dcr_A(cpu, 0);
+  op_dcr_A(cpu, 0);
+  cpu->PC = 0x1E0A; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_1E0A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1E0, 0x1E0, 28)) return 0;
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x1E0, 0x1E0)) {
+    cpu->PC = 0x1E0B;
+    return 1;
+  }
+  cpu->PC = 0x1E0E; op_call(cpu, i8080_read_word(cpu, 0x1E0C));
+  return 1;
+}
+
+static int block_1E0E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1E0, 0x1E2, 126)) return 0;
+  op_pop_PSW(cpu, 0);
+  op_pop_D(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x1E11));
+  cpu->PC = 0x1E15; op_jz(cpu, i8080_read_word(cpu, 0x1E13));
+  if (cpu->PC != 0x1E15) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1E16));
+  cpu->PC = 0x1E1A; op_jz(cpu, i8080_read_word(cpu, 0x1E18));
+  if (cpu->PC != 0x1E1A) return 1;
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x1E1B));
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x1E0, 0x1E2)) {
+    cpu->PC = 0x1E1E;
+    return 1;
+  }
+  cpi(cpu, i8080_read_byte(cpu, 0x1E1F));
+  cpu->PC = 0x1E23; op_jnz(cpu, i8080_read_word(cpu, 0x1E21));
+  if (cpu->PC != 0x1E23) return 1;
+  op_mov_A_E(cpu, 0);
+  op_ora_L(cpu, 0);
+  op_mov_L_A(cpu, 0);
+  op_mov_A_H(cpu, 0);
+  op_ora_D(cpu, 0);
+  cpu->PC = 0x1E29; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_1E29(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1E2, 0x1E3, 51)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x1E2A));
+  cpu->PC = 0x1E2E; op_jnz(cpu, i8080_read_word(cpu, 0x1E2C));
+  if (cpu->PC != 0x1E2E) return 1;
+  op_mov_A_E(cpu, 0);
+  op_ana_L(cpu, 0);
+  op_mov_L_A(cpu, 0);
+  op_mov_A_H(cpu, 0);
+  op_ana_D(cpu, 0);
+  cpu->PC = 0x1E34; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_1E56(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1E5, 0x1E5, 16)) return 0;
+  op_dcx_H(cpu, 0);
+  cpu->PC = 0x1E58; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_1E58(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1E5, 0x1E5, 22)) return 0;
+  cpu->PC = 0x1E59; op_rz(cpu, 0);
+  if (cpu->PC != 0x1E59) return 1;
+  cpu->PC = 0x1E5A; op_rst_1(cpu, 0);
+  return 1;
+}
+
+static int block_1E5B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1E5, 0x1E6, 48)) return 0;
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x1E5C));
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x1E5, 0x1E6)) {
+    cpu->PC = 0x1E5F;
+    return 1;
+  }
+  ori(cpu, i8080_read_byte(cpu, 0x1E60));
+  sta(cpu, i8080_read_word(cpu, 0x1E62));
+  if (precompiled_changed(cpu, 0x1E5, 0x1E6)) {
+    cpu->PC = 0x1E64;
+    return 1;
+  }
+  op_mov_B_M(cpu, 0);
+  cpu->PC = 0x1E65;
+  return 1;
+}
+
+static int block_1E60(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1E6, 0x1E6, 24)) return 0;
+  op_xra_A(cpu, 0);
+  sta(cpu, i8080_read_word(cpu, 0x1E62));
+  if (precompiled_changed(cpu, 0x1E6, 0x1E6)) {
+    cpu->PC = 0x1E64;
+    return 1;
+  }
+  op_mov_B_M(cpu, 0);
+  cpu->PC = 0x1E65;
+  return 1;
+}
+
+static int block_1E65(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1E6, 0x1E6, 17)) return 0;
+  cpu->PC = 0x1E68; op_call(cpu, i8080_read_word(cpu, 0x1E66));
+  return 1;
+}
+
+static int block_1E68(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1E6, 0x1E6, 30)) return 0;
+  cpu->PC = 0x1E6B; op_jc(cpu, i8080_read_word(cpu, 0x1E69));
+  if (cpu->PC != 0x1E6B) return 1;
+  op_xra_A(cpu, 0);
+  op_mov_C_A(cpu, 0);
+  cpu->PC = 0x1E6E; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_1E6E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1E6, 0x1E7, 27)) return 0;
+  cpu->PC = 0x1E71; op_jc(cpu, i8080_read_word(cpu, 0x1E6F));
+  if (cpu->PC != 0x1E71) return 1;
+  cpu->PC = 0x1E74; op_call(cpu, i8080_read_word(cpu, 0x1E72));
+  return 1;
+}
+
+static int block_1E74(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1E7, 0x1E7, 10)) return 0;
+  cpu->PC = 0x1E77; op_jc(cpu, i8080_read_word(cpu, 0x1E75));
+  return 1;
+}
+
+static int block_1E82(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1E8, 0x1EA, 212)) return 0;
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x1E83));
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x1E8, 0x1EA)) {
+    cpu->PC = 0x1E86;
+    return 1;
+  }
+  op_mvi_D(cpu, i8080_read_byte(cpu, 0x1E87));
+  cpi(cpu, i8080_read_byte(cpu, 0x1E89));
+  cpu->PC = 0x1E8B; op_rz(cpu, 0);
+  if (cpu->PC != 0x1E8B) return 1;
+  op_inr_D(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x1E8D));
+  cpu->PC = 0x1E8F; op_rz(cpu, 0);
+  if (cpu->PC != 0x1E8F) return 1;
+  op_inr_D(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x1E91));
+  cpu->PC = 0x1E93; op_rz(cpu, 0);
+  if (cpu->PC != 0x1E93) return 1;
+  op_mvi_D(cpu, i8080_read_byte(cpu, 0x1E94));
+  cpi(cpu, i8080_read_byte(cpu, 0x1E96));
+  cpu->PC = 0x1E98; op_rz(cpu, 0);
+  if (cpu->PC != 0x1E98) return 1;
+  op_mov_A_B(cpu, 0);
+  sui(cpu, i8080_read_byte(cpu, 0x1E9A));
+  ani(cpu, i8080_read_byte(cpu, 0x1E9C));
+  op_mov_E_A(cpu, 0);
+  op_mvi_D(cpu, i8080_read_byte(cpu, 0x1E9F));
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x1E8, 0x1EA)) {
+    cpu->PC = 0x1EA1;
+    return 1;
+  }
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x1EA2));
+  op_dad_D(cpu, 0);
+  op_mov_D_M(cpu, 0);
+  op_pop_H(cpu, 0);
+  op_dcx_H(cpu, 0);
+  cpu->PC = 0x1EA9; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_1EA9(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1EA, 0x1EA, 29)) return 0;
+  op_mov_A_D(cpu, 0);
+  sta(cpu, i8080_read_word(cpu, 0x1EAB));
+  if (precompiled_changed(cpu, 0x1EA, 0x1EA)) {
+    cpu->PC = 0x1EAD;
+    return 1;
+  }
+  cpu->PC = 0x1EAE; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_1EAE(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1EA, 0x1EC, 79)) return 0;
+  lda(cpu, i8080_read_word(cpu, 0x1EAF));
+  op_dcr_A(cpu, 0);
+  cpu->PC = 0x1EB5; op_jz(cpu, i8080_read_word(cpu, 0x1EB3));
+  if (cpu->PC != 0x1EB5) return 1;
+  cpu->PC = 0x1EB8; op_jp(cpu, i8080_read_word(cpu, 0x1EB6));
+  if (cpu->PC != 0x1EB8) return 1;
+  op_mov_A_M(cpu, 0);
+  sui(cpu, i8080_read_byte(cpu, 0x1EBA));
+  cpu->PC = 0x1EBE; op_jz(cpu, i8080_read_word(cpu, 0x1EBC));
+  if (cpu->PC != 0x1EBE) return 1;
+  sui(cpu, i8080_read_byte(cpu, 0x1EBF));
+  cpu->PC = 0x1EC3; op_jz(cpu, i8080_read_word(cpu, 0x1EC1));
+  return 1;
+}
+
+static int block_1EC3(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1EC, 0x1EC, 55)) return 0;
+  op_xra_A(cpu, 0);
+  sta(cpu, i8080_read_word(cpu, 0x1EC5));
+  if (precompiled_changed(cpu, 0x1EC, 0x1EC)) {
+    cpu->PC = 0x1EC7;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x1EC, 0x1EC)) {
+    cpu->PC = 0x1EC8;
+    return 1;
+  }
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x1EC, 0x1EC)) {
+    cpu->PC = 0x1EC9;
+    return 1;
+  }
+  ldhd(cpu, i8080_read_word(cpu, 0x1ECA));
+  cpu->PC = 0x1ECC;
+  return 1;
+}
+
+static int block_1ECC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1EC, 0x1ED, 32)) return 0;
+  op_xchg(cpu, 0);
+  ldhd(cpu, i8080_read_word(cpu, 0x1ECE));
+  cpu->PC = 0x1ED1; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_1ED1(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1ED, 0x1EF, 148)) return 0;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x1ED5; op_jz(cpu, i8080_read_word(cpu, 0x1ED3));
+  if (cpu->PC != 0x1ED5) return 1;
+  op_ldax_D(cpu, 0);
+  op_mov_L_A(cpu, 0);
+  op_cmp_H(cpu, 0);
+  op_inx_D(cpu, 0);
+  cpu->PC = 0x1EDC; op_jnz(cpu, i8080_read_word(cpu, 0x1EDA));
+  if (cpu->PC != 0x1EDC) return 1;
+  op_ldax_D(cpu, 0);
+  op_cmp_C(cpu, 0);
+  cpu->PC = 0x1EE1; op_jnz(cpu, i8080_read_word(cpu, 0x1EDF));
+  if (cpu->PC != 0x1EE1) return 1;
+  op_inx_D(cpu, 0);
+  op_ldax_D(cpu, 0);
+  op_cmp_B(cpu, 0);
+  cpu->PC = 0x1EE7; op_jz(cpu, i8080_read_word(cpu, 0x1EE5));
+  if (cpu->PC != 0x1EE7) return 1;
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x1EE8));
+  op_inx_D(cpu, 0);
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x1ED, 0x1EF)) {
+    cpu->PC = 0x1EEB;
+    return 1;
+  }
+  op_mvi_H(cpu, i8080_read_byte(cpu, 0x1EEC));
+  op_dad_D(cpu, 0);
+  cpu->PC = 0x1EF1; op_jmp(cpu, i8080_read_word(cpu, 0x1EEF));
+  return 1;
+}
+
+static int block_1EE8(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1EE, 0x1EF, 48)) return 0;
+  op_inx_D(cpu, 0);
+  op_inx_D(cpu, 0);
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x1EE, 0x1EF)) {
+    cpu->PC = 0x1EEB;
+    return 1;
+  }
+  op_mvi_H(cpu, i8080_read_byte(cpu, 0x1EEC));
+  op_dad_D(cpu, 0);
+  cpu->PC = 0x1EF1; op_jmp(cpu, i8080_read_word(cpu, 0x1EEF));
+  return 1;
+}
+
+static int block_1EF7(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1EF, 0x1EF, 76)) return 0;
+  op_mov_A_H(cpu, 0);
+  op_pop_H(cpu, 0);
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x1EF, 0x1EF)) {
+    cpu->PC = 0x1EFA;
+    return 1;
+  }
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x1EF, 0x1EF)) {
+    cpu->PC = 0x1EFB;
+    return 1;
+  }
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x1EF, 0x1EF)) {
+    cpu->PC = 0x1EFC;
+    return 1;
+  }
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x1EFD));
+  cpu->PC = 0x1F00; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_1F00(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1F0, 0x1F0, 31)) return 0;
+  cpu->PC = 0x1F03; op_jz(cpu, i8080_read_word(cpu, 0x1F01));
+  if (cpu->PC != 0x1F03) return 1;
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x1F04));
+  cpu->PC = 0x1F07; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_1F07(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1F0, 0x1F1, 183)) return 0;
+  op_pop_D(cpu, 0);
+  cpu->PC = 0x1F0B; op_jz(cpu, i8080_read_word(cpu, 0x1F09));
+  if (cpu->PC != 0x1F0B) return 1;
+  op_pop_PSW(cpu, 0);
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x1F0, 0x1F1)) {
+    cpu->PC = 0x1F0D;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x1F0, 0x1F1)) {
+    cpu->PC = 0x1F0E;
+    return 1;
+  }
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x1F0, 0x1F1)) {
+    cpu->PC = 0x1F0F;
+    return 1;
+  }
+  op_mov_C_A(cpu, 0);
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x1F11));
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x1F0, 0x1F1)) {
+    cpu->PC = 0x1F13;
+    return 1;
+  }
+  op_inx_B(cpu, 0);
+  op_inx_B(cpu, 0);
+  op_inx_B(cpu, 0);
+  ldhd(cpu, i8080_read_word(cpu, 0x1F17));
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x1F0, 0x1F1)) {
+    cpu->PC = 0x1F1A;
+    return 1;
+  }
+  op_dad_B(cpu, 0);
+  op_pop_B(cpu, 0);
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x1F0, 0x1F1)) {
+    cpu->PC = 0x1F1D;
+    return 1;
+  }
+  cpu->PC = 0x1F20; op_call(cpu, i8080_read_word(cpu, 0x1F1E));
+  return 1;
+}
+
+static int block_1F20(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1F2, 0x1F2, 69)) return 0;
+  op_pop_H(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x1F22));
+  if (precompiled_changed(cpu, 0x1F2, 0x1F2)) {
+    cpu->PC = 0x1F24;
+    return 1;
+  }
+  op_mov_H_B(cpu, 0);
+  op_mov_L_C(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x1F27));
+  if (precompiled_changed(cpu, 0x1F2, 0x1F2)) {
+    cpu->PC = 0x1F29;
+    return 1;
+  }
+  cpu->PC = 0x1F2C; op_call(cpu, i8080_read_word(cpu, 0x1F2A));
+  return 1;
+}
+
+static int block_1F2C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1F2, 0x1F2, 26)) return 0;
+  op_dcx_H(cpu, 0);
+  op_mvi_M(cpu, i8080_read_byte(cpu, 0x1F2E));
+  if (precompiled_changed(cpu, 0x1F2, 0x1F2)) {
+    cpu->PC = 0x1F2F;
+    return 1;
+  }
+  cpu->PC = 0x1F30; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_1F30(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1F3, 0x1F3, 66)) return 0;
+  cpu->PC = 0x1F33; op_jnz(cpu, i8080_read_word(cpu, 0x1F31));
+  if (cpu->PC != 0x1F33) return 1;
+  op_pop_D(cpu, 0);
+  op_mov_M_E(cpu, 0);
+  if (precompiled_changed(cpu, 0x1F3, 0x1F3)) {
+    cpu->PC = 0x1F35;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_pop_D(cpu, 0);
+  op_mov_M_E(cpu, 0);
+  if (precompiled_changed(cpu, 0x1F3, 0x1F3)) {
+    cpu->PC = 0x1F38;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_mov_M_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x1F3, 0x1F3)) {
+    cpu->PC = 0x1F3A;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  cpu->PC = 0x1F3B;
+  return 1;
+}
+
+static int block_1F3B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1F3, 0x1F3, 26)) return 0;
+  op_inx_D(cpu, 0);
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x1F3E; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_1F53(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1F5, 0x1F5, 50)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x1F5, 0x1F5)) {
+    cpu->PC = 0x1F54;
+    return 1;
+  }
+  ldhd(cpu, i8080_read_word(cpu, 0x1F55));
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x1F5, 0x1F5)) {
+    cpu->PC = 0x1F58;
+    return 1;
+  }
+  op_mov_D_A(cpu, 0);
+  cpu->PC = 0x1F59;
+  return 1;
+}
+
+static int block_1F59(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1F5, 0x1F5, 39)) return 0;
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x1F5, 0x1F5)) {
+    cpu->PC = 0x1F5A;
+    return 1;
+  }
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x1F5, 0x1F5)) {
+    cpu->PC = 0x1F5B;
+    return 1;
+  }
+  cpu->PC = 0x1F5E; op_call(cpu, i8080_read_word(cpu, 0x1F5C));
+  return 1;
+}
+
+static int block_1F5E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1F5, 0x1F7, 121)) return 0;
+  op_pop_B(cpu, 0);
+  op_pop_PSW(cpu, 0);
+  op_xchg(cpu, 0);
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x1F5, 0x1F7)) {
+    cpu->PC = 0x1F62;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x1F5, 0x1F7)) {
+    cpu->PC = 0x1F63;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  op_inr_A(cpu, 0);
+  op_mov_D_A(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x1F68));
+  cpu->PC = 0x1F6C; op_jz(cpu, i8080_read_word(cpu, 0x1F6A));
+  if (cpu->PC != 0x1F6C) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x1F6D));
+  cpu->PC = 0x1F71; op_jnz(cpu, i8080_read_word(cpu, 0x1F6F));
+  if (cpu->PC != 0x1F71) return 1;
+  cpu->PC = 0x1F72; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_1F75(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1F7, 0x1F7, 11)) return 0;
+  cpu->PC = 0x1F76; op_rst_1(cpu, 0);
+  return 1;
+}
+
+static int block_1F77(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1F7, 0x1F8, 130)) return 0;
+  shld(cpu, i8080_read_word(cpu, 0x1F78));
+  if (precompiled_changed(cpu, 0x1F7, 0x1F8)) {
+    cpu->PC = 0x1F7A;
+    return 1;
+  }
+  op_pop_H(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x1F7C));
+  if (precompiled_changed(cpu, 0x1F7, 0x1F8)) {
+    cpu->PC = 0x1F7E;
+    return 1;
+  }
+  op_mvi_E(cpu, i8080_read_byte(cpu, 0x1F7F));
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x1F7, 0x1F8)) {
+    cpu->PC = 0x1F81;
+    return 1;
+  }
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x1F82));
+  ldhd(cpu, i8080_read_word(cpu, 0x1F85));
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x1F88));
+  op_xchg(cpu, 0);
+  ldhd(cpu, i8080_read_word(cpu, 0x1F8B));
+  op_xchg(cpu, 0);
+  cpu->PC = 0x1F8F; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_1F82(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1F8, 0x1F8, 82)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x1F8, 0x1F8)) {
+    cpu->PC = 0x1F83;
+    return 1;
+  }
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x1F8, 0x1F8)) {
+    cpu->PC = 0x1F84;
+    return 1;
+  }
+  ldhd(cpu, i8080_read_word(cpu, 0x1F85));
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x1F88));
+  op_xchg(cpu, 0);
+  ldhd(cpu, i8080_read_word(cpu, 0x1F8B));
+  op_xchg(cpu, 0);
+  cpu->PC = 0x1F8F; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_1F8F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1F8, 0x1FA, 89)) return 0;
+  lda(cpu, i8080_read_word(cpu, 0x1F90));
+  cpu->PC = 0x1F95; op_jz(cpu, i8080_read_word(cpu, 0x1F93));
+  if (cpu->PC != 0x1F95) return 1;
+  op_cmp_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  cpu->PC = 0x1F9A; op_jnz(cpu, i8080_read_word(cpu, 0x1F98));
+  if (cpu->PC != 0x1F9A) return 1;
+  op_mov_A_M(cpu, 0);
+  op_cmp_C(cpu, 0);
+  op_inx_H(cpu, 0);
+  cpu->PC = 0x1FA0; op_jnz(cpu, i8080_read_word(cpu, 0x1F9E));
+  if (cpu->PC != 0x1FA0) return 1;
+  op_mov_A_M(cpu, 0);
+  op_cmp_B(cpu, 0);
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x1FA3));
+  cpu->PC = 0x1FA4;
+  return 1;
+}
+
+static int block_1FA4(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1FA, 0x1FB, 103)) return 0;
+  op_inx_H(cpu, 0);
+  op_mov_E_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_D_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  cpu->PC = 0x1FAC; op_jnz(cpu, i8080_read_word(cpu, 0x1FAA));
+  if (cpu->PC != 0x1FAC) return 1;
+  lda(cpu, i8080_read_word(cpu, 0x1FAD));
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x1FB3; op_jnz(cpu, i8080_read_word(cpu, 0x1FB1));
+  if (cpu->PC != 0x1FB3) return 1;
+  op_pop_PSW(cpu, 0);
+  cpu->PC = 0x1FB7; op_jz(cpu, i8080_read_word(cpu, 0x1FB5));
+  if (cpu->PC != 0x1FB7) return 1;
+  op_sub_M(cpu, 0);
+  cpu->PC = 0x1FBB; op_jz(cpu, i8080_read_word(cpu, 0x1FB9));
+  return 1;
+}
+
+static int block_1FC0(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1FC, 0x1FD, 90)) return 0;
+  op_mov_M_A(cpu, 0);
+  if (precompiled_changed(cpu, 0x1FC, 0x1FD)) {
+    cpu->PC = 0x1FC1;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_mov_E_A(cpu, 0);
+  op_mvi_D(cpu, i8080_read_byte(cpu, 0x1FC4));
+  op_pop_PSW(cpu, 0);
+  cpu->PC = 0x1FC9; op_jz(cpu, i8080_read_word(cpu, 0x1FC7));
+  if (cpu->PC != 0x1FC9) return 1;
+  op_mov_M_C(cpu, 0);
+  if (precompiled_changed(cpu, 0x1FC, 0x1FD)) {
+    cpu->PC = 0x1FCA;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_mov_M_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x1FC, 0x1FD)) {
+    cpu->PC = 0x1FCC;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_mov_C_A(cpu, 0);
+  cpu->PC = 0x1FD1; op_call(cpu, i8080_read_word(cpu, 0x1FCF));
+  return 1;
+}
+
+static int block_1FD1(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1FD, 0x1FD, 60)) return 0;
+  op_inx_H(cpu, 0);
+  op_inx_H(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x1FD4));
+  if (precompiled_changed(cpu, 0x1FD, 0x1FD)) {
+    cpu->PC = 0x1FD6;
+    return 1;
+  }
+  op_mov_M_C(cpu, 0);
+  if (precompiled_changed(cpu, 0x1FD, 0x1FD)) {
+    cpu->PC = 0x1FD7;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  lda(cpu, i8080_read_word(cpu, 0x1FD9));
+  op_ral(cpu, 0);
+  op_mov_A_C(cpu, 0);
+  cpu->PC = 0x1FDD;
+  return 1;
+}
+
+static int block_1FDD(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1FD, 0x1FE, 35)) return 0;
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x1FDE));
+  cpu->PC = 0x1FE3; op_jnc(cpu, i8080_read_word(cpu, 0x1FE1));
+  if (cpu->PC != 0x1FE3) return 1;
+  op_pop_B(cpu, 0);
+  op_inx_B(cpu, 0);
+  cpu->PC = 0x1FE5;
+  return 1;
+}
+
+static int block_1FE5(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1FE, 0x1FE, 52)) return 0;
+  op_mov_M_C(cpu, 0);
+  if (precompiled_changed(cpu, 0x1FE, 0x1FE)) {
+    cpu->PC = 0x1FE6;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_mov_M_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x1FE, 0x1FE)) {
+    cpu->PC = 0x1FE8;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x1FE, 0x1FE)) {
+    cpu->PC = 0x1FEA;
+    return 1;
+  }
+  cpu->PC = 0x1FED; op_call(cpu, i8080_read_word(cpu, 0x1FEB));
+  return 1;
+}
+
+static int block_1FED(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1FE, 0x1FF, 88)) return 0;
+  op_pop_PSW(cpu, 0);
+  op_dcr_A(cpu, 0);
+  cpu->PC = 0x1FF2; op_jnz(cpu, i8080_read_word(cpu, 0x1FF0));
+  if (cpu->PC != 0x1FF2) return 1;
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x1FE, 0x1FF)) {
+    cpu->PC = 0x1FF3;
+    return 1;
+  }
+  op_mov_B_D(cpu, 0);
+  op_mov_C_E(cpu, 0);
+  op_xchg(cpu, 0);
+  op_dad_D(cpu, 0);
+  cpu->PC = 0x1FFA; op_jc(cpu, i8080_read_word(cpu, 0x1FF8));
+  if (cpu->PC != 0x1FFA) return 1;
+  cpu->PC = 0x1FFD; op_call(cpu, i8080_read_word(cpu, 0x1FFB));
+  return 1;
+}
+
+static int block_1FFD(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x1FF, 0x1FF, 16)) return 0;
+  shld(cpu, i8080_read_word(cpu, 0x1FFE));
+  cpu->PC = 0x2000;
+  return 1;
+}
+
+static int block_2000(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x200, 0x200, 26)) return 0;
+  op_dcx_H(cpu, 0);
+  op_mvi_M(cpu, i8080_read_byte(cpu, 0x2002));
+  if (precompiled_changed(cpu, 0x200, 0x200)) {
+    cpu->PC = 0x2003;
+    return 1;
+  }
+  cpu->PC = 0x2004; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_2004(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x200, 0x201, 127)) return 0;
+  cpu->PC = 0x2007; op_jnz(cpu, i8080_read_word(cpu, 0x2005));
+  if (cpu->PC != 0x2007) return 1;
+  op_inx_B(cpu, 0);
+  op_mov_D_A(cpu, 0);
+  ldhd(cpu, i8080_read_word(cpu, 0x200A));
+  op_mov_E_M(cpu, 0);
+  op_xchg(cpu, 0);
+  op_dad_H(cpu, 0);
+  op_dad_B(cpu, 0);
+  op_xchg(cpu, 0);
+  op_dcx_H(cpu, 0);
+  op_dcx_H(cpu, 0);
+  op_mov_M_E(cpu, 0);
+  if (precompiled_changed(cpu, 0x200, 0x201)) {
+    cpu->PC = 0x2014;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_mov_M_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x200, 0x201)) {
+    cpu->PC = 0x2016;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_pop_PSW(cpu, 0);
+  cpu->PC = 0x201B; op_jc(cpu, i8080_read_word(cpu, 0x2019));
+  return 1;
+}
+
+static int block_201B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x201, 0x202, 93)) return 0;
+  op_mov_B_A(cpu, 0);
+  op_mov_C_A(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mvi_D(cpu, i8080_read_byte(cpu, 0x2020));
+  op_mov_E_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_D_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x201, 0x202)) {
+    cpu->PC = 0x2026;
+    return 1;
+  }
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x201, 0x202)) {
+    cpu->PC = 0x2027;
+    return 1;
+  }
+  cpu->PC = 0x2028; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_2028(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x202, 0x202, 27)) return 0;
+  cpu->PC = 0x202B; op_jnc(cpu, i8080_read_word(cpu, 0x2029));
+  if (cpu->PC != 0x202B) return 1;
+  cpu->PC = 0x202E; op_call(cpu, i8080_read_word(cpu, 0x202C));
+  return 1;
+}
+
+static int block_202E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x202, 0x204, 125)) return 0;
+  op_dad_D(cpu, 0);
+  op_pop_PSW(cpu, 0);
+  op_dcr_A(cpu, 0);
+  op_mov_B_H(cpu, 0);
+  op_mov_C_L(cpu, 0);
+  cpu->PC = 0x2036; op_jnz(cpu, i8080_read_word(cpu, 0x2034));
+  if (cpu->PC != 0x2036) return 1;
+  lda(cpu, i8080_read_word(cpu, 0x2037));
+  op_mov_B_H(cpu, 0);
+  op_mov_C_L(cpu, 0);
+  op_dad_H(cpu, 0);
+  sui(cpu, i8080_read_byte(cpu, 0x203D));
+  cpu->PC = 0x2041; op_jc(cpu, i8080_read_word(cpu, 0x203F));
+  if (cpu->PC != 0x2041) return 1;
+  op_dad_H(cpu, 0);
+  cpu->PC = 0x2045; op_jz(cpu, i8080_read_word(cpu, 0x2043));
+  if (cpu->PC != 0x2045) return 1;
+  op_dad_H(cpu, 0);
+  cpu->PC = 0x2046;
+  return 1;
+}
+
+static int block_204A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x204, 0x204, 25)) return 0;
+  op_pop_B(cpu, 0);
+  op_dad_B(cpu, 0);
+  op_xchg(cpu, 0);
+  cpu->PC = 0x204D;
+  return 1;
+}
+
+static int block_204D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x204, 0x205, 27)) return 0;
+  ldhd(cpu, i8080_read_word(cpu, 0x204E));
+  cpu->PC = 0x2051; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_207C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x207, 0x207, 9)) return 0;
+  op_mov_L_A(cpu, 0);
+  op_xra_A(cpu, 0);
+  cpu->PC = 0x207E;
+  return 1;
+}
+
+static int block_207E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x207, 0x208, 15)) return 0;
+  op_mov_H_A(cpu, 0);
+  cpu->PC = 0x2082; op_jmp(cpu, i8080_read_word(cpu, 0x2080));
+  return 1;
+}
+
+static int block_20CB(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x20C, 0x20D, 34)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x20CC));
+  cpu->PC = 0x20D0; op_jz(cpu, i8080_read_word(cpu, 0x20CE));
+  if (cpu->PC != 0x20D0) return 1;
+  cpu->PC = 0x20D3; op_call(cpu, i8080_read_word(cpu, 0x20D1));
+  return 1;
+}
+
+static int block_20D3(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x20D, 0x20D, 17)) return 0;
+  cpu->PC = 0x20D6; op_call(cpu, i8080_read_word(cpu, 0x20D4));
+  return 1;
+}
+
+static int block_20D6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x20D, 0x20E, 64)) return 0;
+  op_xchg(cpu, 0);
+  op_mov_M_E(cpu, 0);
+  if (precompiled_changed(cpu, 0x20D, 0x20E)) {
+    cpu->PC = 0x20D8;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_mov_M_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x20D, 0x20E)) {
+    cpu->PC = 0x20DA;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x20DD));
+  cpu->PC = 0x20E1; op_jnz(cpu, i8080_read_word(cpu, 0x20DF));
+  if (cpu->PC != 0x20E1) return 1;
+  cpu->PC = 0x20E2; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_20E2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x20E, 0x20E, 17)) return 0;
+  cpu->PC = 0x20E5; op_call(cpu, i8080_read_word(cpu, 0x20E3));
+  return 1;
+}
+
+static int block_20E5(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x20E, 0x20E, 35)) return 0;
+  op_mov_A_M(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x20E7));
+  cpu->PC = 0x20EB; op_jz(cpu, i8080_read_word(cpu, 0x20E9));
+  if (cpu->PC != 0x20EB) return 1;
+  cpu->PC = 0x20EC; op_rst_1(cpu, 0);
+  return 1;
+}
+
+static int block_20F0(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x20F, 0x20F, 17)) return 0;
+  cpu->PC = 0x20F3; op_call(cpu, i8080_read_word(cpu, 0x20F1));
+  return 1;
+}
+
+static int block_20F3(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x20F, 0x210, 122)) return 0;
+  lda(cpu, i8080_read_word(cpu, 0x20F4));
+  op_ora_A(cpu, 0);
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x20F, 0x210)) {
+    cpu->PC = 0x20F8;
+    return 1;
+  }
+  shld(cpu, i8080_read_word(cpu, 0x20F9));
+  if (precompiled_changed(cpu, 0x20F, 0x210)) {
+    cpu->PC = 0x20FB;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_H_M(cpu, 0);
+  op_mov_L_A(cpu, 0);
+  op_ora_H(cpu, 0);
+  cpu->PC = 0x2104; op_jz(cpu, i8080_read_word(cpu, 0x2102));
+  if (cpu->PC != 0x2104) return 1;
+  op_mov_A_M(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x2106));
+  cpu->PC = 0x210A; op_jnz(cpu, i8080_read_word(cpu, 0x2108));
+  if (cpu->PC != 0x210A) return 1;
+  cpu->PC = 0x210B; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_210B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x210, 0x211, 50)) return 0;
+  shld(cpu, i8080_read_word(cpu, 0x210C));
+  if (precompiled_changed(cpu, 0x210, 0x211)) {
+    cpu->PC = 0x210E;
+    return 1;
+  }
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x210F));
+  op_mvi_C(cpu, i8080_read_byte(cpu, 0x2112));
+  cpu->PC = 0x2116; op_call(cpu, i8080_read_word(cpu, 0x2114));
+  return 1;
+}
+
+static int block_2116(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x211, 0x211, 37)) return 0;
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x2117));
+  sta(cpu, i8080_read_word(cpu, 0x2119));
+  if (precompiled_changed(cpu, 0x211, 0x211)) {
+    cpu->PC = 0x211B;
+    return 1;
+  }
+  cpu->PC = 0x211E; op_call(cpu, i8080_read_word(cpu, 0x211C));
+  return 1;
+}
+
+static int block_211E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x211, 0x212, 19)) return 0;
+  op_xchg(cpu, 0);
+  op_stc(cpu, 0);
+  cpu->PC = 0x2123; op_jmp(cpu, i8080_read_word(cpu, 0x2121));
+  return 1;
+}
+
+static int block_212D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x212, 0x213, 78)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x212, 0x213)) {
+    cpu->PC = 0x212E;
+    return 1;
+  }
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x212, 0x213)) {
+    cpu->PC = 0x212F;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x2132));
+  cpu->PC = 0x2136; op_jnz(cpu, i8080_read_word(cpu, 0x2134));
+  if (cpu->PC != 0x2136) return 1;
+  ldhd(cpu, i8080_read_word(cpu, 0x2137));
+  cpu->PC = 0x213A; op_rst_1(cpu, 0);
+  return 1;
+}
+
+static int block_213B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x213, 0x213, 27)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x213, 0x213)) {
+    cpu->PC = 0x213C;
+    return 1;
+  }
+  ldhd(cpu, i8080_read_word(cpu, 0x213D));
+  cpu->PC = 0x213F;
+  return 1;
+}
+
+static int block_213F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x213, 0x214, 17)) return 0;
+  cpu->PC = 0x2142; op_call(cpu, i8080_read_word(cpu, 0x2140));
+  return 1;
+}
+
+static int block_2142(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x214, 0x214, 35)) return 0;
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x214, 0x214)) {
+    cpu->PC = 0x2143;
+    return 1;
+  }
+  cpu->PC = 0x2146; op_call(cpu, i8080_read_word(cpu, 0x2144));
+  return 1;
+}
+
+static int block_2146(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x214, 0x214, 35)) return 0;
+  op_mov_A_M(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x2148));
+  cpu->PC = 0x214C; op_jz(cpu, i8080_read_word(cpu, 0x214A));
+  if (cpu->PC != 0x214C) return 1;
+  cpu->PC = 0x214D; op_rst_1(cpu, 0);
+  return 1;
+}
+
+static int block_2154(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x215, 0x215, 11)) return 0;
+  cpu->PC = 0x2155; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_2155(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x215, 0x215, 29)) return 0;
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x215, 0x215)) {
+    cpu->PC = 0x2156;
+    return 1;
+  }
+  cpu->PC = 0x2157; op_rst_1(cpu, 0);
+  return 1;
+}
+
+static int block_2158(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x215, 0x215, 18)) return 0;
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x2159));
+  cpu->PC = 0x215B; op_rst_1(cpu, 0);
+  return 1;
+}
+
+static int block_215C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x215, 0x215, 17)) return 0;
+  cpu->PC = 0x215F; op_call(cpu, i8080_read_word(cpu, 0x215D));
+  return 1;
+}
+
+static int block_215F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x215, 0x216, 16)) return 0;
+  op_dcx_H(cpu, 0);
+  cpu->PC = 0x2161; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_2161(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x216, 0x216, 31)) return 0;
+  cpu->PC = 0x2164; op_jnz(cpu, i8080_read_word(cpu, 0x2162));
+  if (cpu->PC != 0x2164) return 1;
+  op_pop_D(cpu, 0);
+  cpu->PC = 0x2166; op_rst_6(cpu, 0);
+  return 1;
+}
+
+static int block_2166(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x216, 0x216, 10)) return 0;
+  cpu->PC = 0x2169; op_jz(cpu, i8080_read_word(cpu, 0x2167));
+  return 1;
+}
+
+static int block_2169(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x216, 0x218, 201)) return 0;
+  op_pop_PSW(cpu, 0);
+  cpu->PC = 0x216D; op_jz(cpu, i8080_read_word(cpu, 0x216B));
+  if (cpu->PC != 0x216D) return 1;
+  cpu->PC = 0x2170; op_jnc(cpu, i8080_read_word(cpu, 0x216E));
+  if (cpu->PC != 0x2170) return 1;
+  op_pop_H(cpu, 0);
+  op_pop_B(cpu, 0);
+  op_mov_M_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x216, 0x218)) {
+    cpu->PC = 0x2173;
+    return 1;
+  }
+  op_dcx_H(cpu, 0);
+  op_mov_M_C(cpu, 0);
+  if (precompiled_changed(cpu, 0x216, 0x218)) {
+    cpu->PC = 0x2175;
+    return 1;
+  }
+  cpu->PC = 0x2178; op_jm(cpu, i8080_read_word(cpu, 0x2176));
+  if (cpu->PC != 0x2178) return 1;
+  op_dcx_H(cpu, 0);
+  op_pop_B(cpu, 0);
+  op_mov_M_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x216, 0x218)) {
+    cpu->PC = 0x217B;
+    return 1;
+  }
+  op_dcx_H(cpu, 0);
+  op_mov_M_C(cpu, 0);
+  if (precompiled_changed(cpu, 0x216, 0x218)) {
+    cpu->PC = 0x217D;
+    return 1;
+  }
+  cpu->PC = 0x2180; op_jpo(cpu, i8080_read_word(cpu, 0x217E));
+  if (cpu->PC != 0x2180) return 1;
+  op_dcx_H(cpu, 0);
+  op_pop_B(cpu, 0);
+  op_mov_M_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x216, 0x218)) {
+    cpu->PC = 0x2183;
+    return 1;
+  }
+  op_dcx_H(cpu, 0);
+  op_mov_M_C(cpu, 0);
+  if (precompiled_changed(cpu, 0x216, 0x218)) {
+    cpu->PC = 0x2185;
+    return 1;
+  }
+  op_dcx_H(cpu, 0);
+  op_pop_B(cpu, 0);
+  op_mov_M_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x216, 0x218)) {
+    cpu->PC = 0x2188;
+    return 1;
+  }
+  op_dcx_H(cpu, 0);
+  op_mov_M_C(cpu, 0);
+  if (precompiled_changed(cpu, 0x216, 0x218)) {
+    cpu->PC = 0x218A;
+    return 1;
+  }
+  cpu->PC = 0x218D; op_jmp(cpu, i8080_read_word(cpu, 0x218B));
+  return 1;
+}
+
+static int block_218D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x218, 0x218, 33)) return 0;
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x218, 0x218)) {
+    cpu->PC = 0x218E;
+    return 1;
+  }
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x218, 0x218)) {
+    cpu->PC = 0x218F;
+    return 1;
+  }
+  cpu->PC = 0x2190; op_rst_6(cpu, 0);
+  return 1;
+}
+
+static int block_2190(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x219, 0x219, 27)) return 0;
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x2191));
+  cpu->PC = 0x2196; op_cz(cpu, i8080_read_word(cpu, 0x2194));
+  return 1;
+}
+
+static int block_2196(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x219, 0x21A, 73)) return 0;
+  op_pop_PSW(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x2198));
+  ani(cpu, i8080_read_byte(cpu, 0x219A));
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x219C));
+  op_mov_C_A(cpu, 0);
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x21A0));
+  op_dad_B(cpu, 0);
+  cpu->PC = 0x21A5; op_call(cpu, i8080_read_word(cpu, 0x21A3));
+  return 1;
+}
+
+static int block_2198(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x219, 0x21A, 67)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x219, 0x21A)) {
+    cpu->PC = 0x2199;
+    return 1;
+  }
+  ani(cpu, i8080_read_byte(cpu, 0x219A));
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x219C));
+  op_mov_C_A(cpu, 0);
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x21A0));
+  op_dad_B(cpu, 0);
+  cpu->PC = 0x21A5; op_call(cpu, i8080_read_word(cpu, 0x21A3));
+  return 1;
+}
+
+static int block_21A5(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x21A, 0x21A, 21)) return 0;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x21A7; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_21BE(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x21B, 0x21C, 79)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x21B, 0x21C)) {
+    cpu->PC = 0x21BF;
+    return 1;
+  }
+  ldhd(cpu, i8080_read_word(cpu, 0x21C0));
+  op_inx_H(cpu, 0);
+  op_mov_A_H(cpu, 0);
+  op_ora_L(cpu, 0);
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x21C7; op_rnz(cpu, 0);
+  if (cpu->PC != 0x21C7) return 1;
+  op_mvi_E(cpu, i8080_read_byte(cpu, 0x21C8));
+  cpu->PC = 0x21CC; op_jmp(cpu, i8080_read_word(cpu, 0x21CA));
+  return 1;
+}
+
+static int block_21CC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x21C, 0x21C, 11)) return 0;
+  cpu->PC = 0x21CD; op_rst_1(cpu, 0);
+  return 1;
+}
+
+static int block_21CE(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x21C, 0x21D, 42)) return 0;
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x21CF));
+  sta(cpu, i8080_read_word(cpu, 0x21D1));
+  if (precompiled_changed(cpu, 0x21C, 0x21D)) {
+    cpu->PC = 0x21D3;
+    return 1;
+  }
+  op_ora_M(cpu, 0);
+  op_mov_B_A(cpu, 0);
+  cpu->PC = 0x21D8; op_jmp(cpu, i8080_read_word(cpu, 0x21D6));
+  return 1;
+}
+
+static int block_2202(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x220, 0x220, 17)) return 0;
+  cpu->PC = 0x2205; op_call(cpu, i8080_read_word(cpu, 0x2203));
+  return 1;
+}
+
+static int block_2205(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x220, 0x220, 10)) return 0;
+  cpu->PC = 0x2208; op_jmp(cpu, i8080_read_word(cpu, 0x2206));
+  return 1;
+}
+
+static int block_2208(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x220, 0x220, 17)) return 0;
+  cpu->PC = 0x220B; op_call(cpu, i8080_read_word(cpu, 0x2209));
+  return 1;
+}
+
+static int block_220B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x220, 0x220, 10)) return 0;
+  cpu->PC = 0x220E; op_jmp(cpu, i8080_read_word(cpu, 0x220C));
+  return 1;
+}
+
+static int block_220E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x220, 0x221, 17)) return 0;
+  cpu->PC = 0x2211; op_call(cpu, i8080_read_word(cpu, 0x220F));
+  return 1;
+}
+
+static int block_2211(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x221, 0x221, 17)) return 0;
+  cpu->PC = 0x2214; op_call(cpu, i8080_read_word(cpu, 0x2212));
+  return 1;
+}
+
+static int block_2214(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x221, 0x221, 17)) return 0;
+  cpu->PC = 0x2217; op_call(cpu, i8080_read_word(cpu, 0x2215));
+  return 1;
+}
+
+static int block_2217(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x221, 0x221, 21)) return 0;
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x2218));
+  op_push_B(cpu, 0);
+  cpu->PC = 0x221B;
+  return 1;
+}
+
+static int block_221B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x221, 0x222, 40)) return 0;
+  op_mov_A_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x221, 0x222)) {
+    cpu->PC = 0x221E;
+    return 1;
+  }
+  cpu->PC = 0x2221; op_call(cpu, i8080_read_word(cpu, 0x221F));
+  return 1;
+}
+
+static int block_2221(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x222, 0x222, 46)) return 0;
+  op_pop_H(cpu, 0);
+  op_mov_C_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_B_M(cpu, 0);
+  cpu->PC = 0x2228; op_call(cpu, i8080_read_word(cpu, 0x2226));
+  return 1;
+}
+
+static int block_2228(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x222, 0x222, 33)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x222, 0x222)) {
+    cpu->PC = 0x2229;
+    return 1;
+  }
+  op_mov_L_A(cpu, 0);
+  cpu->PC = 0x222D; op_call(cpu, i8080_read_word(cpu, 0x222B));
+  return 1;
+}
+
+static int block_222D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x222, 0x222, 21)) return 0;
+  op_pop_D(cpu, 0);
+  cpu->PC = 0x222F; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_222F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x222, 0x223, 17)) return 0;
+  cpu->PC = 0x2232; op_call(cpu, i8080_read_word(cpu, 0x2230));
+  return 1;
+}
+
+static int block_2232(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x223, 0x223, 73)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x2233));
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x223, 0x223)) {
+    cpu->PC = 0x2236;
+    return 1;
+  }
+  op_mov_M_A(cpu, 0);
+  if (precompiled_changed(cpu, 0x223, 0x223)) {
+    cpu->PC = 0x2237;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_mov_M_E(cpu, 0);
+  if (precompiled_changed(cpu, 0x223, 0x223)) {
+    cpu->PC = 0x2239;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_mov_M_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x223, 0x223)) {
+    cpu->PC = 0x223B;
+    return 1;
+  }
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x223D; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_223D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x223, 0x223, 5)) return 0;
+  op_dcx_H(cpu, 0);
+  cpu->PC = 0x223E;
+  return 1;
+}
+
+static int block_223E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x223, 0x224, 30)) return 0;
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x223F));
+  op_mov_D_B(cpu, 0);
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x223, 0x224)) {
+    cpu->PC = 0x2242;
+    return 1;
+  }
+  op_mvi_C(cpu, i8080_read_byte(cpu, 0x2243));
+  cpu->PC = 0x2244;
+  return 1;
+}
+
+static int block_2244(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x224, 0x225, 59)) return 0;
+  op_inx_H(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  op_inr_C(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x224B; op_jz(cpu, i8080_read_word(cpu, 0x2249));
+  if (cpu->PC != 0x224B) return 1;
+  op_cmp_D(cpu, 0);
+  cpu->PC = 0x224F; op_jz(cpu, i8080_read_word(cpu, 0x224D));
+  if (cpu->PC != 0x224F) return 1;
+  op_cmp_B(cpu, 0);
+  cpu->PC = 0x2253; op_jnz(cpu, i8080_read_word(cpu, 0x2251));
+  return 1;
+}
+
+static int block_2253(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x225, 0x225, 24)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x2254));
+  cpu->PC = 0x2258; op_cz(cpu, i8080_read_word(cpu, 0x2256));
+  return 1;
+}
+
+static int block_2258(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x225, 0x225, 50)) return 0;
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x225, 0x225)) {
+    cpu->PC = 0x2259;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_xchg(cpu, 0);
+  op_mov_A_C(cpu, 0);
+  cpu->PC = 0x225F; op_call(cpu, i8080_read_word(cpu, 0x225D));
+  return 1;
+}
+
+static int block_225F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x225, 0x227, 86)) return 0;
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x2260));
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x2263));
+  ldhd(cpu, i8080_read_word(cpu, 0x2265));
+  shld(cpu, i8080_read_word(cpu, 0x2268));
+  if (precompiled_changed(cpu, 0x225, 0x227)) {
+    cpu->PC = 0x226A;
+    return 1;
+  }
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x226B));
+  sta(cpu, i8080_read_word(cpu, 0x226D));
+  if (precompiled_changed(cpu, 0x225, 0x227)) {
+    cpu->PC = 0x226F;
+    return 1;
+  }
+  cpu->PC = 0x2272; op_call(cpu, i8080_read_word(cpu, 0x2270));
+  return 1;
+}
+
+static int block_2272(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x227, 0x227, 21)) return 0;
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x2273));
+  cpu->PC = 0x2276; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_2276(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x227, 0x228, 60)) return 0;
+  shld(cpu, i8080_read_word(cpu, 0x2277));
+  if (precompiled_changed(cpu, 0x227, 0x228)) {
+    cpu->PC = 0x2279;
+    return 1;
+  }
+  op_pop_H(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  cpu->PC = 0x227E; op_jnz(cpu, i8080_read_word(cpu, 0x227C));
+  if (cpu->PC != 0x227E) return 1;
+  op_mvi_E(cpu, i8080_read_byte(cpu, 0x227F));
+  cpu->PC = 0x2283; op_jmp(cpu, i8080_read_word(cpu, 0x2281));
+  return 1;
+}
+
+static int block_2283(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x228, 0x228, 44)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x228, 0x228)) {
+    cpu->PC = 0x2284;
+    return 1;
+  }
+  ldhd(cpu, i8080_read_word(cpu, 0x2285));
+  cpu->PC = 0x228A; op_call(cpu, i8080_read_word(cpu, 0x2288));
+  return 1;
+}
+
+static int block_228A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x228, 0x228, 21)) return 0;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x228C; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_228C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x228, 0x229, 114)) return 0;
+  op_mov_A_M(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x228F; op_rz(cpu, 0);
+  if (cpu->PC != 0x228F) return 1;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x228, 0x229)) {
+    cpu->PC = 0x2290;
+    return 1;
+  }
+  op_mov_E_M(cpu, 0);
+  op_mvi_D(cpu, i8080_read_byte(cpu, 0x2292));
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x228, 0x229)) {
+    cpu->PC = 0x2294;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_mov_E_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_D_M(cpu, 0);
+  ldhd(cpu, i8080_read_word(cpu, 0x2299));
+  op_xchg(cpu, 0);
+  cpu->PC = 0x229D; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_229D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x229, 0x22A, 46)) return 0;
+  op_xchg(cpu, 0);
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x22A2; op_jnc(cpu, i8080_read_word(cpu, 0x22A0));
+  if (cpu->PC != 0x22A2) return 1;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x22A4; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_22A4(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x22A, 0x22B, 123)) return 0;
+  op_dad_D(cpu, 0);
+  op_xchg(cpu, 0);
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x22A, 0x22B)) {
+    cpu->PC = 0x22A7;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  op_ldax_D(cpu, 0);
+  op_mov_M_A(cpu, 0);
+  if (precompiled_changed(cpu, 0x22A, 0x22B)) {
+    cpu->PC = 0x22AA;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_mov_M_E(cpu, 0);
+  if (precompiled_changed(cpu, 0x22A, 0x22B)) {
+    cpu->PC = 0x22AC;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_mov_M_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x22A, 0x22B)) {
+    cpu->PC = 0x22AE;
+    return 1;
+  }
+  op_pop_D(cpu, 0);
+  op_dcx_D(cpu, 0);
+  ldhd(cpu, i8080_read_word(cpu, 0x22B1));
+  op_xchg(cpu, 0);
+  cpu->PC = 0x22B5; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_22B5(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x22B, 0x22B, 37)) return 0;
+  cpu->PC = 0x22B6; op_rc(cpu, 0);
+  if (cpu->PC != 0x22B6) return 1;
+  op_mvi_M(cpu, i8080_read_byte(cpu, 0x22B7));
+  if (precompiled_changed(cpu, 0x22B, 0x22B)) {
+    cpu->PC = 0x22B8;
+    return 1;
+  }
+  op_dcx_H(cpu, 0);
+  cpu->PC = 0x22BA; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_22BA(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x22B, 0x22B, 32)) return 0;
+  cpu->PC = 0x22BB; op_rc(cpu, 0);
+  if (cpu->PC != 0x22BB) return 1;
+  op_mvi_M(cpu, i8080_read_byte(cpu, 0x22BC));
+  if (precompiled_changed(cpu, 0x22B, 0x22B)) {
+    cpu->PC = 0x22BD;
+    return 1;
+  }
+  cpu->PC = 0x22BE; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_22BE(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x22B, 0x22B, 5)) return 0;
+  op_inx_H(cpu, 0);
+  cpu->PC = 0x22BF;
+  return 1;
+}
+
+static int block_22BF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x22B, 0x22C, 17)) return 0;
+  cpu->PC = 0x22C2; op_call(cpu, i8080_read_word(cpu, 0x22C0));
+  return 1;
+}
+
+static int block_22C2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x22C, 0x22C, 17)) return 0;
+  cpu->PC = 0x22C5; op_call(cpu, i8080_read_word(cpu, 0x22C3));
+  return 1;
+}
+
+static int block_22C5(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x22C, 0x22C, 17)) return 0;
+  cpu->PC = 0x22C8; op_call(cpu, i8080_read_word(cpu, 0x22C6));
+  return 1;
+}
+
+static int block_22C8(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x22C, 0x22C, 5)) return 0;
+  op_inr_D(cpu, 0);
+  cpu->PC = 0x22C9;
+  return 1;
+}
+
+static int block_22C9(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x22C, 0x22C, 34)) return 0;
+  op_dcr_D(cpu, 0);
+  cpu->PC = 0x22CB; op_rz(cpu, 0);
+  if (cpu->PC != 0x22CB) return 1;
+  op_ldax_B(cpu, 0);
+  cpu->PC = 0x22CD; op_rst_3(cpu, 0);
+  return 1;
+}
+
+static int block_22CD(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x22C, 0x22D, 24)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x22CE));
+  cpu->PC = 0x22D2; op_cz(cpu, i8080_read_word(cpu, 0x22D0));
+  return 1;
+}
+
+static int block_22D2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x22D, 0x22D, 15)) return 0;
+  op_inx_B(cpu, 0);
+  cpu->PC = 0x22D6; op_jmp(cpu, i8080_read_word(cpu, 0x22D4));
+  return 1;
+}
+
+static int block_22D6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x22D, 0x22E, 105)) return 0;
+  op_ora_A(cpu, 0);
+  op_mvi_C(cpu, i8080_read_byte(cpu, 0x22D8));
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x22D, 0x22E)) {
+    cpu->PC = 0x22DA;
+    return 1;
+  }
+  ldhd(cpu, i8080_read_word(cpu, 0x22DB));
+  op_xchg(cpu, 0);
+  ldhd(cpu, i8080_read_word(cpu, 0x22DF));
+  op_cma(cpu, 0);
+  op_mov_C_A(cpu, 0);
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x22E4));
+  op_inr_A(cpu, 0);
+  cpu->PC = 0x22E9; op_jz(cpu, i8080_read_word(cpu, 0x22E7));
+  if (cpu->PC != 0x22E9) return 1;
+  op_dcx_B(cpu, 0);
+  op_dcx_B(cpu, 0);
+  op_dcx_B(cpu, 0);
+  cpu->PC = 0x22EC;
+  return 1;
+}
+
+static int block_22EC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x22E, 0x22E, 26)) return 0;
+  op_dad_B(cpu, 0);
+  op_inx_H(cpu, 0);
+  cpu->PC = 0x22EF; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_22EF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x22E, 0x22F, 36)) return 0;
+  cpu->PC = 0x22F2; op_jc(cpu, i8080_read_word(cpu, 0x22F0));
+  if (cpu->PC != 0x22F2) return 1;
+  shld(cpu, i8080_read_word(cpu, 0x22F3));
+  if (precompiled_changed(cpu, 0x22E, 0x22F)) {
+    cpu->PC = 0x22F5;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_xchg(cpu, 0);
+  cpu->PC = 0x22F7;
+  return 1;
+}
+
+static int block_22F7(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x22F, 0x22F, 21)) return 0;
+  op_pop_PSW(cpu, 0);
+  cpu->PC = 0x22F9; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_238C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x238, 0x239, 92)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x238, 0x239)) {
+    cpu->PC = 0x238D;
+    return 1;
+  }
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x238, 0x239)) {
+    cpu->PC = 0x238E;
+    return 1;
+  }
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x238, 0x239)) {
+    cpu->PC = 0x238F;
+    return 1;
+  }
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x238, 0x239)) {
+    cpu->PC = 0x2390;
+    return 1;
+  }
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x2391));
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x238, 0x239)) {
+    cpu->PC = 0x2394;
+    return 1;
+  }
+  ldhd(cpu, i8080_read_word(cpu, 0x2395));
+  op_push_B(cpu, 0);
+  cpu->PC = 0x2398;
+  return 1;
+}
+
+static int block_2398(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x239, 0x239, 15)) return 0;
+  op_pop_B(cpu, 0);
+  op_xchg(cpu, 0);
+  cpu->PC = 0x239A;
+  return 1;
+}
+
+static int block_239A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x239, 0x239, 32)) return 0;
+  ldhd(cpu, i8080_read_word(cpu, 0x239B));
+  op_xchg(cpu, 0);
+  cpu->PC = 0x239F; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_239F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x239, 0x23A, 40)) return 0;
+  cpu->PC = 0x23A0; op_rz(cpu, 0);
+  if (cpu->PC != 0x23A0) return 1;
+  op_mov_A_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  cpu->PC = 0x23A5; op_call(cpu, i8080_read_word(cpu, 0x23A3));
+  return 1;
+}
+
+static int block_23A5(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x23A, 0x23B, 103)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x23A, 0x23B)) {
+    cpu->PC = 0x23A6;
+    return 1;
+  }
+  op_dad_B(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x23A8));
+  cpu->PC = 0x23AC; op_jnz(cpu, i8080_read_word(cpu, 0x23AA));
+  if (cpu->PC != 0x23AC) return 1;
+  shld(cpu, i8080_read_word(cpu, 0x23AD));
+  if (precompiled_changed(cpu, 0x23A, 0x23B)) {
+    cpu->PC = 0x23AF;
+    return 1;
+  }
+  op_pop_H(cpu, 0);
+  op_mov_C_M(cpu, 0);
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x23B2));
+  op_dad_B(cpu, 0);
+  op_dad_B(cpu, 0);
+  op_inx_H(cpu, 0);
+  cpu->PC = 0x23B6;
+  return 1;
+}
+
+static int block_23EA(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x23E, 0x23E, 51)) return 0;
+  op_pop_PSW(cpu, 0);
+  op_pop_B(cpu, 0);
+  op_pop_D(cpu, 0);
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x23EF; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_23EF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x23E, 0x23F, 73)) return 0;
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x23E, 0x23F)) {
+    cpu->PC = 0x23F0;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x23E, 0x23F)) {
+    cpu->PC = 0x23F1;
+    return 1;
+  }
+  ldhd(cpu, i8080_read_word(cpu, 0x23F2));
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x23E, 0x23F)) {
+    cpu->PC = 0x23F5;
+    return 1;
+  }
+  cpu->PC = 0x23F8; op_call(cpu, i8080_read_word(cpu, 0x23F6));
+  return 1;
+}
+
+static int block_23F8(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x23F, 0x23F, 35)) return 0;
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x23F, 0x23F)) {
+    cpu->PC = 0x23F9;
+    return 1;
+  }
+  cpu->PC = 0x23FC; op_call(cpu, i8080_read_word(cpu, 0x23FA));
+  return 1;
+}
+
+static int block_23FC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x23F, 0x240, 86)) return 0;
+  op_mov_A_M(cpu, 0);
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x23F, 0x240)) {
+    cpu->PC = 0x23FE;
+    return 1;
+  }
+  ldhd(cpu, i8080_read_word(cpu, 0x23FF));
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x23F, 0x240)) {
+    cpu->PC = 0x2402;
+    return 1;
+  }
+  op_add_M(cpu, 0);
+  op_mvi_E(cpu, i8080_read_byte(cpu, 0x2404));
+  cpu->PC = 0x2408; op_jc(cpu, i8080_read_word(cpu, 0x2406));
+  if (cpu->PC != 0x2408) return 1;
+  cpu->PC = 0x240B; op_call(cpu, i8080_read_word(cpu, 0x2409));
+  return 1;
+}
+
+static int block_240B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x240, 0x240, 27)) return 0;
+  op_pop_D(cpu, 0);
+  cpu->PC = 0x240F; op_call(cpu, i8080_read_word(cpu, 0x240D));
+  return 1;
+}
+
+static int block_240F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x240, 0x241, 35)) return 0;
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x240, 0x241)) {
+    cpu->PC = 0x2410;
+    return 1;
+  }
+  cpu->PC = 0x2413; op_call(cpu, i8080_read_word(cpu, 0x2411));
+  return 1;
+}
+
+static int block_2413(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x241, 0x241, 49)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x241, 0x241)) {
+    cpu->PC = 0x2414;
+    return 1;
+  }
+  ldhd(cpu, i8080_read_word(cpu, 0x2415));
+  op_xchg(cpu, 0);
+  cpu->PC = 0x241B; op_call(cpu, i8080_read_word(cpu, 0x2419));
+  return 1;
+}
+
+static int block_241B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x241, 0x241, 17)) return 0;
+  cpu->PC = 0x241E; op_call(cpu, i8080_read_word(cpu, 0x241C));
+  return 1;
+}
+
+static int block_241E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x241, 0x242, 49)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x241F));
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x241, 0x242)) {
+    cpu->PC = 0x2422;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x241, 0x242)) {
+    cpu->PC = 0x2423;
+    return 1;
+  }
+  cpu->PC = 0x2426; op_jmp(cpu, i8080_read_word(cpu, 0x2424));
+  return 1;
+}
+
+static int block_2426(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x242, 0x242, 64)) return 0;
+  op_pop_H(cpu, 0);
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x242, 0x242)) {
+    cpu->PC = 0x2428;
+    return 1;
+  }
+  op_mov_A_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_C_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_B_M(cpu, 0);
+  op_mov_L_A(cpu, 0);
+  cpu->PC = 0x242E;
+  return 1;
+}
+
+static int block_242E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x242, 0x242, 5)) return 0;
+  op_inr_L(cpu, 0);
+  cpu->PC = 0x242F;
+  return 1;
+}
+
+static int block_242F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x242, 0x243, 50)) return 0;
+  op_dcr_L(cpu, 0);
+  cpu->PC = 0x2431; op_rz(cpu, 0);
+  if (cpu->PC != 0x2431) return 1;
+  op_ldax_B(cpu, 0);
+  op_stax_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x242, 0x243)) {
+    cpu->PC = 0x2433;
+    return 1;
+  }
+  op_inx_B(cpu, 0);
+  op_inx_D(cpu, 0);
+  cpu->PC = 0x2438; op_jmp(cpu, i8080_read_word(cpu, 0x2436));
+  return 1;
+}
+
+static int block_2438(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x243, 0x243, 17)) return 0;
+  cpu->PC = 0x243B; op_call(cpu, i8080_read_word(cpu, 0x2439));
+  return 1;
+}
+
+static int block_243B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x243, 0x243, 16)) return 0;
+  ldhd(cpu, i8080_read_word(cpu, 0x243C));
+  cpu->PC = 0x243E;
+  return 1;
+}
+
+static int block_243E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x243, 0x243, 5)) return 0;
+  op_xchg(cpu, 0);
+  cpu->PC = 0x243F;
+  return 1;
+}
+
+static int block_243F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x243, 0x244, 17)) return 0;
+  cpu->PC = 0x2442; op_call(cpu, i8080_read_word(cpu, 0x2440));
+  return 1;
+}
+
+static int block_2442(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x244, 0x244, 17)) return 0;
+  cpu->PC = 0x2445; op_call(cpu, i8080_read_word(cpu, 0x2443));
+  return 1;
+}
+
+static int block_2445(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x244, 0x244, 76)) return 0;
+  op_xchg(cpu, 0);
+  cpu->PC = 0x2447; op_rnz(cpu, 0);
+  if (cpu->PC != 0x2447) return 1;
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x244, 0x244)) {
+    cpu->PC = 0x2448;
+    return 1;
+  }
+  op_mov_D_B(cpu, 0);
+  op_mov_E_C(cpu, 0);
+  op_dcx_D(cpu, 0);
+  op_mov_C_M(cpu, 0);
+  ldhd(cpu, i8080_read_word(cpu, 0x244D));
+  cpu->PC = 0x2450; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_2450(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x245, 0x246, 104)) return 0;
+  cpu->PC = 0x2453; op_jnz(cpu, i8080_read_word(cpu, 0x2451));
+  if (cpu->PC != 0x2453) return 1;
+  op_mov_A_C(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x2458; op_jz(cpu, i8080_read_word(cpu, 0x2456));
+  if (cpu->PC != 0x2458) return 1;
+  op_xra_A(cpu, 0);
+  op_mov_B_A(cpu, 0);
+  op_dad_B(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_inx_H(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x245F));
+  if (precompiled_changed(cpu, 0x245, 0x246)) {
+    cpu->PC = 0x2461;
+    return 1;
+  }
+  op_mvi_M(cpu, i8080_read_byte(cpu, 0x2462));
+  if (precompiled_changed(cpu, 0x245, 0x246)) {
+    cpu->PC = 0x2463;
+    return 1;
+  }
+  op_dcx_H(cpu, 0);
+  op_mvi_M(cpu, i8080_read_byte(cpu, 0x2465));
+  cpu->PC = 0x2466;
+  return 1;
+}
+
+static int block_2466(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x246, 0x246, 21)) return 0;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x2468; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_2468(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x246, 0x247, 56)) return 0;
+  ldhd(cpu, i8080_read_word(cpu, 0x2469));
+  op_dcx_H(cpu, 0);
+  op_mov_B_M(cpu, 0);
+  op_dcx_H(cpu, 0);
+  op_mov_C_M(cpu, 0);
+  op_dcx_H(cpu, 0);
+  cpu->PC = 0x2471; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_2471(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x247, 0x247, 38)) return 0;
+  cpu->PC = 0x2472; op_rnz(cpu, 0);
+  if (cpu->PC != 0x2472) return 1;
+  shld(cpu, i8080_read_word(cpu, 0x2473));
+  if (precompiled_changed(cpu, 0x247, 0x247)) {
+    cpu->PC = 0x2475;
+    return 1;
+  }
+  cpu->PC = 0x2476; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_2476(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x247, 0x248, 135)) return 0;
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x247, 0x248)) {
+    cpu->PC = 0x2477;
+    return 1;
+  }
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x247, 0x248)) {
+    cpu->PC = 0x2478;
+    return 1;
+  }
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x247, 0x248)) {
+    cpu->PC = 0x2479;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x247, 0x248)) {
+    cpu->PC = 0x247A;
+    return 1;
+  }
+  op_mov_A_M(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x247F; op_jz(cpu, i8080_read_word(cpu, 0x247D));
+  if (cpu->PC != 0x247F) return 1;
+  op_mov_C_M(cpu, 0);
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x2481));
+  op_inx_H(cpu, 0);
+  op_mov_E_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_D_M(cpu, 0);
+  ldhd(cpu, i8080_read_word(cpu, 0x2487));
+  op_xchg(cpu, 0);
+  cpu->PC = 0x248B; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_248B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x248, 0x249, 65)) return 0;
+  cpu->PC = 0x248E; op_jc(cpu, i8080_read_word(cpu, 0x248C));
+  if (cpu->PC != 0x248E) return 1;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x248, 0x249)) {
+    cpu->PC = 0x248F;
+    return 1;
+  }
+  op_dad_B(cpu, 0);
+  op_pop_D(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_M_E(cpu, 0);
+  if (precompiled_changed(cpu, 0x248, 0x249)) {
+    cpu->PC = 0x2493;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_mov_M_D(cpu, 0);
+  cpu->PC = 0x2495;
+  return 1;
+}
+
+static int block_2495(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x249, 0x249, 51)) return 0;
+  op_pop_H(cpu, 0);
+  op_pop_B(cpu, 0);
+  op_pop_D(cpu, 0);
+  op_pop_PSW(cpu, 0);
+  cpu->PC = 0x249A; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_249A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x249, 0x249, 21)) return 0;
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x249B));
+  op_push_B(cpu, 0);
+  cpu->PC = 0x249E;
+  return 1;
+}
+
+static int block_249E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x249, 0x24A, 17)) return 0;
+  cpu->PC = 0x24A1; op_call(cpu, i8080_read_word(cpu, 0x249F));
+  return 1;
+}
+
+static int block_24A1(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x24A, 0x24A, 31)) return 0;
+  op_xra_A(cpu, 0);
+  op_mov_D_A(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x24A6; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_24A6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x24A, 0x24A, 21)) return 0;
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x24A7));
+  op_push_B(cpu, 0);
+  cpu->PC = 0x24AA;
+  return 1;
+}
+
+static int block_24AA(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x24A, 0x24A, 17)) return 0;
+  cpu->PC = 0x24AD; op_call(cpu, i8080_read_word(cpu, 0x24AB));
+  return 1;
+}
+
+static int block_24AD(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x24A, 0x24B, 52)) return 0;
+  cpu->PC = 0x24B0; op_jz(cpu, i8080_read_word(cpu, 0x24AE));
+  if (cpu->PC != 0x24B0) return 1;
+  op_inx_H(cpu, 0);
+  op_mov_E_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_D_M(cpu, 0);
+  op_ldax_D(cpu, 0);
+  cpu->PC = 0x24B6; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_24B6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x24B, 0x24B, 24)) return 0;
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x24B7));
+  cpu->PC = 0x24BB; op_call(cpu, i8080_read_word(cpu, 0x24B9));
+  return 1;
+}
+
+static int block_24BB(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x24B, 0x24B, 17)) return 0;
+  cpu->PC = 0x24BE; op_call(cpu, i8080_read_word(cpu, 0x24BC));
+  return 1;
+}
+
+static int block_24BE(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x24B, 0x24C, 23)) return 0;
+  ldhd(cpu, i8080_read_word(cpu, 0x24BF));
+  op_mov_M_E(cpu, 0);
+  cpu->PC = 0x24C2;
+  return 1;
+}
+
+static int block_24C2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x24C, 0x24C, 20)) return 0;
+  op_pop_B(cpu, 0);
+  cpu->PC = 0x24C6; op_jmp(cpu, i8080_read_word(cpu, 0x24C4));
+  return 1;
+}
+
+static int block_24C6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x24C, 0x24C, 11)) return 0;
+  cpu->PC = 0x24C7; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_24C7(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x24C, 0x24C, 11)) return 0;
+  cpu->PC = 0x24C8; op_rst_1(cpu, 0);
+  return 1;
+}
+
+static int block_24C9(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x24C, 0x24C, 17)) return 0;
+  cpu->PC = 0x24CC; op_call(cpu, i8080_read_word(cpu, 0x24CA));
+  return 1;
+}
+
+static int block_24CC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x24C, 0x24C, 22)) return 0;
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x24C, 0x24C)) {
+    cpu->PC = 0x24CD;
+    return 1;
+  }
+  cpu->PC = 0x24CE; op_rst_1(cpu, 0);
+  return 1;
+}
+
+static int block_24CF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x24C, 0x24D, 17)) return 0;
+  cpu->PC = 0x24D2; op_call(cpu, i8080_read_word(cpu, 0x24D0));
+  return 1;
+}
+
+static int block_24D2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x24D, 0x24D, 11)) return 0;
+  cpu->PC = 0x24D3; op_rst_1(cpu, 0);
+  return 1;
+}
+
+static int block_24D4(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x24D, 0x24D, 40)) return 0;
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x24D, 0x24D)) {
+    cpu->PC = 0x24D5;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x24D, 0x24D)) {
+    cpu->PC = 0x24D6;
+    return 1;
+  }
+  cpu->PC = 0x24D7; op_rst_6(cpu, 0);
+  return 1;
+}
+
+static int block_24D7(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x24D, 0x24D, 27)) return 0;
+  cpu->PC = 0x24DA; op_jz(cpu, i8080_read_word(cpu, 0x24D8));
+  if (cpu->PC != 0x24DA) return 1;
+  cpu->PC = 0x24DD; op_call(cpu, i8080_read_word(cpu, 0x24DB));
+  return 1;
+}
+
+static int block_24DD(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x24D, 0x24D, 10)) return 0;
+  cpu->PC = 0x24E0; op_jmp(cpu, i8080_read_word(cpu, 0x24DE));
+  return 1;
+}
+
+static int block_24E3(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x24E, 0x24E, 27)) return 0;
+  op_pop_D(cpu, 0);
+  cpu->PC = 0x24E7; op_call(cpu, i8080_read_word(cpu, 0x24E5));
+  return 1;
+}
+
+static int block_24EC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x24E, 0x24F, 33)) return 0;
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x24E, 0x24F)) {
+    cpu->PC = 0x24ED;
+    return 1;
+  }
+  op_mov_A_E(cpu, 0);
+  cpu->PC = 0x24F1; op_call(cpu, i8080_read_word(cpu, 0x24EF));
+  return 1;
+}
+
+static int block_24F1(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x24F, 0x24F, 51)) return 0;
+  op_mov_E_A(cpu, 0);
+  op_pop_PSW(cpu, 0);
+  op_inr_E(cpu, 0);
+  op_dcr_E(cpu, 0);
+  cpu->PC = 0x24F8; op_jz(cpu, i8080_read_word(cpu, 0x24F6));
+  if (cpu->PC != 0x24F8) return 1;
+  ldhd(cpu, i8080_read_word(cpu, 0x24F9));
+  cpu->PC = 0x24FB;
+  return 1;
+}
+
+static int block_24FB(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x24F, 0x250, 37)) return 0;
+  op_mov_M_A(cpu, 0);
+  if (precompiled_changed(cpu, 0x24F, 0x250)) {
+    cpu->PC = 0x24FC;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_dcr_E(cpu, 0);
+  cpu->PC = 0x2501; op_jnz(cpu, i8080_read_word(cpu, 0x24FF));
+  if (cpu->PC != 0x2501) return 1;
+  cpu->PC = 0x2504; op_jmp(cpu, i8080_read_word(cpu, 0x2502));
+  return 1;
+}
+
+static int block_2504(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x250, 0x250, 17)) return 0;
+  cpu->PC = 0x2507; op_call(cpu, i8080_read_word(cpu, 0x2505));
+  return 1;
+}
+
+static int block_2507(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x250, 0x250, 4)) return 0;
+  op_xra_A(cpu, 0);
+  cpu->PC = 0x2508;
+  return 1;
+}
+
+static int block_2508(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x250, 0x250, 30)) return 0;
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x250, 0x250)) {
+    cpu->PC = 0x2509;
+    return 1;
+  }
+  op_mov_C_A(cpu, 0);
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x250B));
+  cpu->PC = 0x250C;
+  return 1;
+}
+
+static int block_250C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x250, 0x251, 75)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x250, 0x251)) {
+    cpu->PC = 0x250D;
+    return 1;
+  }
+  op_mov_A_M(cpu, 0);
+  op_cmp_B(cpu, 0);
+  cpu->PC = 0x2512; op_jc(cpu, i8080_read_word(cpu, 0x2510));
+  if (cpu->PC != 0x2512) return 1;
+  op_mov_A_B(cpu, 0);
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x2514));
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x250, 0x251)) {
+    cpu->PC = 0x2517;
+    return 1;
+  }
+  cpu->PC = 0x251A; op_call(cpu, i8080_read_word(cpu, 0x2518));
+  return 1;
+}
+
+static int block_251A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x251, 0x252, 104)) return 0;
+  op_pop_B(cpu, 0);
+  op_pop_H(cpu, 0);
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x251, 0x252)) {
+    cpu->PC = 0x251D;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_mov_B_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_H_M(cpu, 0);
+  op_mov_L_B(cpu, 0);
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x2523));
+  op_dad_B(cpu, 0);
+  op_mov_B_H(cpu, 0);
+  op_mov_C_L(cpu, 0);
+  cpu->PC = 0x252A; op_call(cpu, i8080_read_word(cpu, 0x2528));
+  return 1;
+}
+
+static int block_252A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x252, 0x252, 22)) return 0;
+  op_mov_L_A(cpu, 0);
+  cpu->PC = 0x252E; op_call(cpu, i8080_read_word(cpu, 0x252C));
+  return 1;
+}
+
+static int block_252E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x252, 0x253, 27)) return 0;
+  op_pop_D(cpu, 0);
+  cpu->PC = 0x2532; op_call(cpu, i8080_read_word(cpu, 0x2530));
+  return 1;
+}
+
+static int block_2532(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x253, 0x253, 10)) return 0;
+  cpu->PC = 0x2535; op_jmp(cpu, i8080_read_word(cpu, 0x2533));
+  return 1;
+}
+
+static int block_2535(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x253, 0x253, 17)) return 0;
+  cpu->PC = 0x2538; op_call(cpu, i8080_read_word(cpu, 0x2536));
+  return 1;
+}
+
+static int block_2538(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x253, 0x253, 42)) return 0;
+  op_pop_D(cpu, 0);
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x253, 0x253)) {
+    cpu->PC = 0x253A;
+    return 1;
+  }
+  op_ldax_D(cpu, 0);
+  op_sub_B(cpu, 0);
+  cpu->PC = 0x253F; op_jmp(cpu, i8080_read_word(cpu, 0x253D));
+  return 1;
+}
+
+static int block_253F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x253, 0x254, 29)) return 0;
+  op_xchg(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  cpu->PC = 0x2544; op_call(cpu, i8080_read_word(cpu, 0x2542));
+  return 1;
+}
+
+static int block_2544(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x254, 0x254, 28)) return 0;
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x254, 0x254)) {
+    cpu->PC = 0x2545;
+    return 1;
+  }
+  cpu->PC = 0x2548; op_call(cpu, i8080_read_word(cpu, 0x2546));
+  return 1;
+}
+
+static int block_2548(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x254, 0x255, 131)) return 0;
+  op_pop_PSW(cpu, 0);
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x254, 0x255)) {
+    cpu->PC = 0x254A;
+    return 1;
+  }
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x254B));
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x254, 0x255)) {
+    cpu->PC = 0x254E;
+    return 1;
+  }
+  op_dcr_A(cpu, 0);
+  op_cmp_M(cpu, 0);
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x2551));
+  cpu->PC = 0x2553; op_rnc(cpu, 0);
+  if (cpu->PC != 0x2553) return 1;
+  op_mov_C_A(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  op_sub_C(cpu, 0);
+  op_cmp_E(cpu, 0);
+  op_mov_B_A(cpu, 0);
+  cpu->PC = 0x2559; op_rc(cpu, 0);
+  if (cpu->PC != 0x2559) return 1;
+  op_mov_B_E(cpu, 0);
+  cpu->PC = 0x255B; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_255B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x255, 0x255, 17)) return 0;
+  cpu->PC = 0x255E; op_call(cpu, i8080_read_word(cpu, 0x255C));
+  return 1;
+}
+
+static int block_255E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x255, 0x257, 132)) return 0;
+  cpu->PC = 0x2561; op_jz(cpu, i8080_read_word(cpu, 0x255F));
+  if (cpu->PC != 0x2561) return 1;
+  op_mov_E_A(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_H_M(cpu, 0);
+  op_mov_L_A(cpu, 0);
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x255, 0x257)) {
+    cpu->PC = 0x2568;
+    return 1;
+  }
+  op_dad_D(cpu, 0);
+  op_mov_B_M(cpu, 0);
+  op_mov_M_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x255, 0x257)) {
+    cpu->PC = 0x256B;
+    return 1;
+  }
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x255, 0x257)) {
+    cpu->PC = 0x256C;
+    return 1;
+  }
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x255, 0x257)) {
+    cpu->PC = 0x256D;
+    return 1;
+  }
+  op_mov_A_M(cpu, 0);
+  cpu->PC = 0x2571; op_call(cpu, i8080_read_word(cpu, 0x256F));
+  return 1;
+}
+
+static int block_2571(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x257, 0x257, 38)) return 0;
+  op_pop_B(cpu, 0);
+  op_pop_H(cpu, 0);
+  op_mov_M_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x257, 0x257)) {
+    cpu->PC = 0x2574;
+    return 1;
+  }
+  cpu->PC = 0x2575; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_2575(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x257, 0x257, 16)) return 0;
+  op_xchg(cpu, 0);
+  cpu->PC = 0x2577; op_rst_1(cpu, 0);
+  return 1;
+}
+
+static int block_2578(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x257, 0x258, 67)) return 0;
+  op_pop_B(cpu, 0);
+  op_pop_D(cpu, 0);
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x257, 0x258)) {
+    cpu->PC = 0x257B;
+    return 1;
+  }
+  op_mov_B_E(cpu, 0);
+  op_inr_B(cpu, 0);
+  op_dcr_B(cpu, 0);
+  cpu->PC = 0x257F; op_rnz(cpu, 0);
+  if (cpu->PC != 0x257F) return 1;
+  cpu->PC = 0x2582; op_jmp(cpu, i8080_read_word(cpu, 0x2580));
+  return 1;
+}
+
+static int block_2698(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x269, 0x269, 35)) return 0;
+  op_mvi_E(cpu, i8080_read_byte(cpu, 0x2699));
+  cpi(cpu, i8080_read_byte(cpu, 0x269B));
+  cpu->PC = 0x269F; op_jz(cpu, i8080_read_word(cpu, 0x269D));
+  if (cpu->PC != 0x269F) return 1;
+  cpu->PC = 0x26A0; op_rst_1(cpu, 0);
+  return 1;
+}
+
+static int block_26A1(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x26A, 0x26A, 17)) return 0;
+  cpu->PC = 0x26A4; op_call(cpu, i8080_read_word(cpu, 0x26A2));
+  return 1;
+}
+
+static int block_26A4(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x26A, 0x26A, 11)) return 0;
+  cpu->PC = 0x26A5; op_rst_1(cpu, 0);
+  return 1;
+}
+
+static int block_26A6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x26A, 0x26A, 11)) return 0;
+  cpu->PC = 0x26A7; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_270D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x270, 0x270, 17)) return 0;
+  cpu->PC = 0x2710; op_call(cpu, i8080_read_word(cpu, 0x270E));
+  return 1;
+}
+
+static int block_2710(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x271, 0x271, 28)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x271, 0x271)) {
+    cpu->PC = 0x2711;
+    return 1;
+  }
+  cpu->PC = 0x2714; op_call(cpu, i8080_read_word(cpu, 0x2712));
+  return 1;
+}
+
+static int block_2714(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x271, 0x271, 35)) return 0;
+  op_xchg(cpu, 0);
+  op_pop_H(cpu, 0);
+  op_mov_A_D(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x2719; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_271A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x271, 0x271, 17)) return 0;
+  cpu->PC = 0x271D; op_call(cpu, i8080_read_word(cpu, 0x271B));
+  return 1;
+}
+
+static int block_271D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x271, 0x271, 17)) return 0;
+  cpu->PC = 0x2720; op_call(cpu, i8080_read_word(cpu, 0x271E));
+  return 1;
+}
+
+static int block_2720(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x272, 0x272, 26)) return 0;
+  cpu->PC = 0x2723; op_jnz(cpu, i8080_read_word(cpu, 0x2721));
+  if (cpu->PC != 0x2723) return 1;
+  op_dcx_H(cpu, 0);
+  cpu->PC = 0x2725; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_2725(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x272, 0x272, 16)) return 0;
+  op_mov_A_E(cpu, 0);
+  cpu->PC = 0x2727; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_299A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x299, 0x299, 32)) return 0;
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x299B));
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x299, 0x299)) {
+    cpu->PC = 0x299E;
+    return 1;
+  }
+  cpu->PC = 0x299F; op_rst_6(cpu, 0);
+  return 1;
+}
+
+static int block_299F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x299, 0x29A, 72)) return 0;
+  cpu->PC = 0x29A0; op_rm(cpu, 0);
+  if (cpu->PC != 0x29A0) return 1;
+  lda(cpu, i8080_read_word(cpu, 0x29A1));
+  cpi(cpu, i8080_read_byte(cpu, 0x29A4));
+  cpu->PC = 0x29A6; op_rnz(cpu, 0);
+  if (cpu->PC != 0x29A6) return 1;
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x29A7));
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x29AA));
+  cpu->PC = 0x29AF; op_jmp(cpu, i8080_read_word(cpu, 0x29AD));
+  return 1;
+}
+
+static int block_29AF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x29A, 0x29B, 17)) return 0;
+  cpu->PC = 0x29B2; op_call(cpu, i8080_read_word(cpu, 0x29B0));
+  return 1;
+}
+
+static int block_29B2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x29B, 0x29B, 17)) return 0;
+  cpu->PC = 0x29B5; op_call(cpu, i8080_read_word(cpu, 0x29B3));
+  return 1;
+}
+
+static int block_29B5(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x29B, 0x29B, 11)) return 0;
+  cpu->PC = 0x29B6; op_rst_1(cpu, 0);
+  return 1;
+}
+
+static int block_29B7(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x29B, 0x29B, 31)) return 0;
+  op_xchg(cpu, 0);
+  ldhd(cpu, i8080_read_word(cpu, 0x29B9));
+  cpu->PC = 0x29BE; op_jmp(cpu, i8080_read_word(cpu, 0x29BC));
+  return 1;
+}
+
+static int block_29C7(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x29C, 0x29D, 114)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x29C, 0x29D)) {
+    cpu->PC = 0x29C8;
+    return 1;
+  }
+  op_xra_A(cpu, 0);
+  sta(cpu, i8080_read_word(cpu, 0x29CA));
+  if (precompiled_changed(cpu, 0x29C, 0x29D)) {
+    cpu->PC = 0x29CC;
+    return 1;
+  }
+  op_cmp_D(cpu, 0);
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x29C, 0x29D)) {
+    cpu->PC = 0x29CE;
+    return 1;
+  }
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x29C, 0x29D)) {
+    cpu->PC = 0x29CF;
+    return 1;
+  }
+  op_mov_B_M(cpu, 0);
+  op_ora_B(cpu, 0);
+  cpu->PC = 0x29D4; op_jz(cpu, i8080_read_word(cpu, 0x29D2));
+  if (cpu->PC != 0x29D4) return 1;
+  op_inx_H(cpu, 0);
+  op_mov_C_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_H_M(cpu, 0);
+  op_mov_L_C(cpu, 0);
+  cpu->PC = 0x29DC; op_jmp(cpu, i8080_read_word(cpu, 0x29DA));
+  return 1;
+}
+
+static int block_29F9(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x29F, 0x29F, 14)) return 0;
+  op_xra_A(cpu, 0);
+  op_mov_E_A(cpu, 0);
+  op_mov_D_A(cpu, 0);
+  cpu->PC = 0x29FC;
+  return 1;
+}
+
+static int block_29FC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x29F, 0x29F, 17)) return 0;
+  cpu->PC = 0x29FF; op_call(cpu, i8080_read_word(cpu, 0x29FD));
+  return 1;
+}
+
+static int block_29FF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x29F, 0x2A3, 233)) return 0;
+  op_mov_D_A(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x2A03));
+  cpu->PC = 0x2A07; op_jz(cpu, i8080_read_word(cpu, 0x2A05));
+  if (cpu->PC != 0x2A07) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x2A08));
+  cpu->PC = 0x2A0C; op_jz(cpu, i8080_read_word(cpu, 0x2A0A));
+  if (cpu->PC != 0x2A0C) return 1;
+  op_dcr_B(cpu, 0);
+  cpu->PC = 0x2A10; op_jz(cpu, i8080_read_word(cpu, 0x2A0E));
+  if (cpu->PC != 0x2A10) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x2A11));
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x2A13));
+  cpu->PC = 0x2A17; op_jz(cpu, i8080_read_word(cpu, 0x2A15));
+  if (cpu->PC != 0x2A17) return 1;
+  op_dcx_H(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x2A1B));
+  cpu->PC = 0x2A1F; op_jz(cpu, i8080_read_word(cpu, 0x2A1D));
+  if (cpu->PC != 0x2A1F) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x2A20));
+  cpu->PC = 0x2A24; op_jz(cpu, i8080_read_word(cpu, 0x2A22));
+  if (cpu->PC != 0x2A24) return 1;
+  op_cmp_M(cpu, 0);
+  cpu->PC = 0x2A28; op_jnz(cpu, i8080_read_word(cpu, 0x2A26));
+  if (cpu->PC != 0x2A28) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x2A29));
+  cpu->PC = 0x2A2D; op_jz(cpu, i8080_read_word(cpu, 0x2A2B));
+  if (cpu->PC != 0x2A2D) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x2A2E));
+  cpu->PC = 0x2A32; op_jnz(cpu, i8080_read_word(cpu, 0x2A30));
+  if (cpu->PC != 0x2A32) return 1;
+  op_mov_A_B(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x2A34));
+  op_inx_H(cpu, 0);
+  cpu->PC = 0x2A39; op_jc(cpu, i8080_read_word(cpu, 0x2A37));
+  if (cpu->PC != 0x2A39) return 1;
+  op_mov_A_M(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x2A3B));
+  cpu->PC = 0x2A3C;
+  return 1;
+}
+
+static int block_2A4B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2A4, 0x2A6, 117)) return 0;
+  op_inr_E(cpu, 0);
+  op_mvi_C(cpu, i8080_read_byte(cpu, 0x2A4D));
+  op_dcr_B(cpu, 0);
+  cpu->PC = 0x2A52; op_jz(cpu, i8080_read_word(cpu, 0x2A50));
+  if (cpu->PC != 0x2A52) return 1;
+  op_mov_A_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x2A55));
+  cpu->PC = 0x2A59; op_jz(cpu, i8080_read_word(cpu, 0x2A57));
+  if (cpu->PC != 0x2A59) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x2A5A));
+  cpu->PC = 0x2A5E; op_jz(cpu, i8080_read_word(cpu, 0x2A5C));
+  if (cpu->PC != 0x2A5E) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x2A5F));
+  cpu->PC = 0x2A63; op_jnz(cpu, i8080_read_word(cpu, 0x2A61));
+  if (cpu->PC != 0x2A63) return 1;
+  op_mov_A_D(cpu, 0);
+  ori(cpu, i8080_read_byte(cpu, 0x2A65));
+  op_mov_D_A(cpu, 0);
+  cpu->PC = 0x2A6A; op_jmp(cpu, i8080_read_word(cpu, 0x2A68));
+  return 1;
+}
+
+static int block_2A75(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2A7, 0x2A8, 49)) return 0;
+  op_inr_C(cpu, 0);
+  op_dcr_B(cpu, 0);
+  cpu->PC = 0x2A7A; op_jz(cpu, i8080_read_word(cpu, 0x2A78));
+  if (cpu->PC != 0x2A7A) return 1;
+  op_mov_A_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x2A7D));
+  cpu->PC = 0x2A81; op_jz(cpu, i8080_read_word(cpu, 0x2A7F));
+  return 1;
+}
+
+static int block_2AA0(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2AA, 0x2AA, 42)) return 0;
+  op_mov_A_D(cpu, 0);
+  op_dcx_H(cpu, 0);
+  op_inr_E(cpu, 0);
+  ani(cpu, i8080_read_byte(cpu, 0x2AA4));
+  cpu->PC = 0x2AA8; op_jnz(cpu, i8080_read_word(cpu, 0x2AA6));
+  if (cpu->PC != 0x2AA8) return 1;
+  op_dcr_E(cpu, 0);
+  op_mov_A_B(cpu, 0);
+  cpu->PC = 0x2AAA;
+  return 1;
+}
+
+static int block_2AAA(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2AA, 0x2AB, 62)) return 0;
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x2AAE; op_jz(cpu, i8080_read_word(cpu, 0x2AAC));
+  if (cpu->PC != 0x2AAE) return 1;
+  op_mov_A_M(cpu, 0);
+  sui(cpu, i8080_read_byte(cpu, 0x2AB0));
+  cpu->PC = 0x2AB4; op_jz(cpu, i8080_read_word(cpu, 0x2AB2));
+  if (cpu->PC != 0x2AB4) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x2AB5));
+  cpu->PC = 0x2AB9; op_jnz(cpu, i8080_read_word(cpu, 0x2AB7));
+  if (cpu->PC != 0x2AB9) return 1;
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x2ABA));
+  cpu->PC = 0x2ABB;
+  return 1;
+}
+
+static int block_2AC0(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2AC, 0x2AC, 69)) return 0;
+  op_pop_H(cpu, 0);
+  op_pop_PSW(cpu, 0);
+  cpu->PC = 0x2AC5; op_jz(cpu, i8080_read_word(cpu, 0x2AC3));
+  if (cpu->PC != 0x2AC5) return 1;
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x2AC, 0x2AC)) {
+    cpu->PC = 0x2AC6;
+    return 1;
+  }
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x2AC, 0x2AC)) {
+    cpu->PC = 0x2AC7;
+    return 1;
+  }
+  cpu->PC = 0x2ACA; op_call(cpu, i8080_read_word(cpu, 0x2AC8));
+  return 1;
+}
+
+static int block_2ACA(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2AC, 0x2AD, 102)) return 0;
+  op_pop_D(cpu, 0);
+  op_pop_B(cpu, 0);
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x2AC, 0x2AD)) {
+    cpu->PC = 0x2ACD;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x2AC, 0x2AD)) {
+    cpu->PC = 0x2ACE;
+    return 1;
+  }
+  op_mov_B_E(cpu, 0);
+  op_mov_A_B(cpu, 0);
+  op_add_C(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x2AD2));
+  cpu->PC = 0x2AD6; op_jnc(cpu, i8080_read_word(cpu, 0x2AD4));
+  if (cpu->PC != 0x2AD6) return 1;
+  op_mov_A_D(cpu, 0);
+  ori(cpu, i8080_read_byte(cpu, 0x2AD8));
+  cpu->PC = 0x2ADC; op_call(cpu, i8080_read_word(cpu, 0x2ADA));
+  return 1;
+}
+
+static int block_2ADC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2AD, 0x2AD, 17)) return 0;
+  cpu->PC = 0x2ADF; op_call(cpu, i8080_read_word(cpu, 0x2ADD));
+  return 1;
+}
+
+static int block_2ADF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2AD, 0x2AE, 26)) return 0;
+  op_pop_H(cpu, 0);
+  op_dcx_H(cpu, 0);
+  cpu->PC = 0x2AE2; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_2AE2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2AE, 0x2AE, 55)) return 0;
+  op_stc(cpu, 0);
+  cpu->PC = 0x2AE6; op_jz(cpu, i8080_read_word(cpu, 0x2AE4));
+  if (cpu->PC != 0x2AE6) return 1;
+  sta(cpu, i8080_read_word(cpu, 0x2AE7));
+  if (precompiled_changed(cpu, 0x2AE, 0x2AE)) {
+    cpu->PC = 0x2AE9;
+    return 1;
+  }
+  cpi(cpu, i8080_read_byte(cpu, 0x2AEA));
+  cpu->PC = 0x2AEE; op_jz(cpu, i8080_read_word(cpu, 0x2AEC));
+  if (cpu->PC != 0x2AEE) return 1;
+  cpu->PC = 0x2AEF; op_rst_1(cpu, 0);
+  return 1;
+}
+
+static int block_2AF2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2AF, 0x2B0, 149)) return 0;
+  op_pop_B(cpu, 0);
+  op_xchg(cpu, 0);
+  op_pop_H(cpu, 0);
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x2AF, 0x2B0)) {
+    cpu->PC = 0x2AF6;
+    return 1;
+  }
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x2AF, 0x2B0)) {
+    cpu->PC = 0x2AF7;
+    return 1;
+  }
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x2AF, 0x2B0)) {
+    cpu->PC = 0x2AF8;
+    return 1;
+  }
+  op_mov_A_M(cpu, 0);
+  op_sub_B(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_C_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_H_M(cpu, 0);
+  op_mov_L_C(cpu, 0);
+  op_mvi_D(cpu, i8080_read_byte(cpu, 0x2B00));
+  op_mov_E_A(cpu, 0);
+  op_dad_D(cpu, 0);
+  op_mov_A_B(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x2B08; op_jnz(cpu, i8080_read_word(cpu, 0x2B06));
+  if (cpu->PC != 0x2B08) return 1;
+  cpu->PC = 0x2B0B; op_jmp(cpu, i8080_read_word(cpu, 0x2B09));
+  return 1;
+}
+
+static int block_2B0F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2B0, 0x2B1, 30)) return 0;
+  op_pop_H(cpu, 0);
+  op_pop_PSW(cpu, 0);
+  cpu->PC = 0x2B14; op_jnz(cpu, i8080_read_word(cpu, 0x2B12));
+  return 1;
+}
+
+static int block_2B14(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2B1, 0x2B1, 17)) return 0;
+  cpu->PC = 0x2B17; op_cc(cpu, i8080_read_word(cpu, 0x2B15));
+  return 1;
+}
+
+static int block_2B17(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2B1, 0x2B1, 35)) return 0;
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x2B1, 0x2B1)) {
+    cpu->PC = 0x2B18;
+    return 1;
+  }
+  cpu->PC = 0x2B1B; op_call(cpu, i8080_read_word(cpu, 0x2B19));
+  return 1;
+}
+
+static int block_2E87(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2E8, 0x2E8, 68)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x2E8, 0x2E8)) {
+    cpu->PC = 0x2E88;
+    return 1;
+  }
+  op_dcx_H(cpu, 0);
+  op_mov_M_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x2E8, 0x2E8)) {
+    cpu->PC = 0x2E8A;
+    return 1;
+  }
+  op_dcx_H(cpu, 0);
+  op_mov_M_C(cpu, 0);
+  if (precompiled_changed(cpu, 0x2E8, 0x2E8)) {
+    cpu->PC = 0x2E8C;
+    return 1;
+  }
+  op_dcx_H(cpu, 0);
+  op_mov_M_A(cpu, 0);
+  if (precompiled_changed(cpu, 0x2E8, 0x2E8)) {
+    cpu->PC = 0x2E8E;
+    return 1;
+  }
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x2E90; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_2E90(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2E9, 0x2E9, 38)) return 0;
+  lda(cpu, i8080_read_word(cpu, 0x2E91));
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x2E95; op_rz(cpu, 0);
+  if (cpu->PC != 0x2E95) return 1;
+  cpu->PC = 0x2E98; op_jmp(cpu, i8080_read_word(cpu, 0x2E96));
+  return 1;
+}
+
+static int block_2E98(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2E9, 0x2E9, 10)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x2E99));
+  cpu->PC = 0x2E9B;
+  return 1;
+}
+
+static int block_2E9B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2E9, 0x2E9, 17)) return 0;
+  cpu->PC = 0x2E9E; op_call(cpu, i8080_read_word(cpu, 0x2E9C));
+  return 1;
+}
+
+static int block_2E9E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2E9, 0x2EA, 10)) return 0;
+  cpu->PC = 0x2EA1; op_jmp(cpu, i8080_read_word(cpu, 0x2E9F));
+  return 1;
+}
+
+static int block_2EA1(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2EA, 0x2EA, 17)) return 0;
+  cpu->PC = 0x2EA4; op_call(cpu, i8080_read_word(cpu, 0x2EA2));
+  return 1;
+}
+
+static int block_2EA4(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2EA, 0x2EA, 17)) return 0;
+  cpu->PC = 0x2EA7; op_call(cpu, i8080_read_word(cpu, 0x2EA5));
+  return 1;
+}
+
+static int block_2EA7(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2EA, 0x2EB, 92)) return 0;
+  op_mov_A_B(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x2EAA; op_rz(cpu, 0);
+  if (cpu->PC != 0x2EAA) return 1;
+  lda(cpu, i8080_read_word(cpu, 0x2EAB));
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x2EB1; op_jz(cpu, i8080_read_word(cpu, 0x2EAF));
+  if (cpu->PC != 0x2EB1) return 1;
+  op_sub_B(cpu, 0);
+  cpu->PC = 0x2EB5; op_jnc(cpu, i8080_read_word(cpu, 0x2EB3));
+  if (cpu->PC != 0x2EB5) return 1;
+  op_cma(cpu, 0);
+  op_inr_A(cpu, 0);
+  op_xchg(cpu, 0);
+  cpu->PC = 0x2EBB; op_call(cpu, i8080_read_word(cpu, 0x2EB9));
+  return 1;
+}
+
+static int block_2EBB(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2EB, 0x2EB, 22)) return 0;
+  op_xchg(cpu, 0);
+  cpu->PC = 0x2EBF; op_call(cpu, i8080_read_word(cpu, 0x2EBD));
+  return 1;
+}
+
+static int block_2EBF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2EB, 0x2EC, 20)) return 0;
+  op_pop_B(cpu, 0);
+  op_pop_D(cpu, 0);
+  cpu->PC = 0x2EC1;
+  return 1;
+}
+
+static int block_2EC1(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2EC, 0x2EC, 46)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x2EC2));
+  cpu->PC = 0x2EC4; op_rnc(cpu, 0);
+  if (cpu->PC != 0x2EC4) return 1;
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x2EC, 0x2EC)) {
+    cpu->PC = 0x2EC5;
+    return 1;
+  }
+  cpu->PC = 0x2EC8; op_call(cpu, i8080_read_word(cpu, 0x2EC6));
+  return 1;
+}
+
+static int block_2EC8(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2EC, 0x2EC, 32)) return 0;
+  op_mov_H_A(cpu, 0);
+  op_pop_PSW(cpu, 0);
+  cpu->PC = 0x2ECD; op_call(cpu, i8080_read_word(cpu, 0x2ECB));
+  return 1;
+}
+
+static int block_2ECD(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2EC, 0x2ED, 41)) return 0;
+  op_ora_H(cpu, 0);
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x2ECF));
+  cpu->PC = 0x2ED4; op_jp(cpu, i8080_read_word(cpu, 0x2ED2));
+  if (cpu->PC != 0x2ED4) return 1;
+  cpu->PC = 0x2ED7; op_call(cpu, i8080_read_word(cpu, 0x2ED5));
+  return 1;
+}
+
+static int block_2ED7(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2ED, 0x2EE, 59)) return 0;
+  cpu->PC = 0x2EDA; op_jnc(cpu, i8080_read_word(cpu, 0x2ED8));
+  if (cpu->PC != 0x2EDA) return 1;
+  op_inx_H(cpu, 0);
+  op_inr_M(cpu, 0);
+  if (precompiled_changed(cpu, 0x2ED, 0x2EE)) {
+    cpu->PC = 0x2EDC;
+    return 1;
+  }
+  cpu->PC = 0x2EDF; op_jz(cpu, i8080_read_word(cpu, 0x2EDD));
+  if (cpu->PC != 0x2EDF) return 1;
+  op_mvi_L(cpu, i8080_read_byte(cpu, 0x2EE0));
+  cpu->PC = 0x2EE4; op_call(cpu, i8080_read_word(cpu, 0x2EE2));
+  return 1;
+}
+
+static int block_2EE4(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2EE, 0x2EE, 10)) return 0;
+  cpu->PC = 0x2EE7; op_jmp(cpu, i8080_read_word(cpu, 0x2EE5));
+  return 1;
+}
+
+static int block_2EE7(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2EE, 0x2EF, 71)) return 0;
+  op_xra_A(cpu, 0);
+  op_sub_B(cpu, 0);
+  op_mov_B_A(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  op_sbb_E(cpu, 0);
+  op_mov_E_A(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  op_sbb_D(cpu, 0);
+  op_mov_D_A(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  op_sbb_C(cpu, 0);
+  op_mov_C_A(cpu, 0);
+  cpu->PC = 0x2EF5;
+  return 1;
+}
+
+static int block_2EF5(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2EF, 0x2EF, 17)) return 0;
+  cpu->PC = 0x2EF8; op_cc(cpu, i8080_read_word(cpu, 0x2EF6));
+  return 1;
+}
+
+static int block_2EF8(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2EF, 0x2EF, 14)) return 0;
+  op_mov_L_B(cpu, 0);
+  op_mov_H_E(cpu, 0);
+  op_xra_A(cpu, 0);
+  cpu->PC = 0x2EFB;
+  return 1;
+}
+
+static int block_2EFB(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2EF, 0x2F0, 73)) return 0;
+  op_mov_B_A(cpu, 0);
+  op_mov_A_C(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x2F01; op_jnz(cpu, i8080_read_word(cpu, 0x2EFF));
+  if (cpu->PC != 0x2F01) return 1;
+  op_mov_C_D(cpu, 0);
+  op_mov_D_H(cpu, 0);
+  op_mov_H_L(cpu, 0);
+  op_mov_L_A(cpu, 0);
+  op_mov_A_B(cpu, 0);
+  sui(cpu, i8080_read_byte(cpu, 0x2F07));
+  cpi(cpu, i8080_read_byte(cpu, 0x2F09));
+  cpu->PC = 0x2F0D; op_jnz(cpu, i8080_read_word(cpu, 0x2F0B));
+  return 1;
+}
+
+static int block_2F0D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2F0, 0x2F0, 4)) return 0;
+  op_xra_A(cpu, 0);
+  cpu->PC = 0x2F0E;
+  return 1;
+}
+
+static int block_2F0E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2F0, 0x2F1, 24)) return 0;
+  sta(cpu, i8080_read_word(cpu, 0x2F0F));
+  if (precompiled_changed(cpu, 0x2F0, 0x2F1)) {
+    cpu->PC = 0x2F11;
+    return 1;
+  }
+  cpu->PC = 0x2F12; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_2F12(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2F1, 0x2F1, 43)) return 0;
+  op_dcr_B(cpu, 0);
+  op_dad_H(cpu, 0);
+  op_mov_A_D(cpu, 0);
+  op_ral(cpu, 0);
+  op_mov_D_A(cpu, 0);
+  op_mov_A_C(cpu, 0);
+  op_adc_A(cpu, 0);
+  op_mov_C_A(cpu, 0);
+  cpu->PC = 0x2F1A;
+  return 1;
+}
+
+static int block_2F1A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2F1, 0x2F2, 84)) return 0;
+  cpu->PC = 0x2F1D; op_jp(cpu, i8080_read_word(cpu, 0x2F1B));
+  if (cpu->PC != 0x2F1D) return 1;
+  op_mov_A_B(cpu, 0);
+  op_mov_E_H(cpu, 0);
+  op_mov_B_L(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x2F24; op_jz(cpu, i8080_read_word(cpu, 0x2F22));
+  if (cpu->PC != 0x2F24) return 1;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x2F25));
+  op_add_M(cpu, 0);
+  op_mov_M_A(cpu, 0);
+  if (precompiled_changed(cpu, 0x2F1, 0x2F2)) {
+    cpu->PC = 0x2F29;
+    return 1;
+  }
+  cpu->PC = 0x2F2C; op_jnc(cpu, i8080_read_word(cpu, 0x2F2A));
+  if (cpu->PC != 0x2F2C) return 1;
+  cpu->PC = 0x2F2D; op_rz(cpu, 0);
+  return 1;
+}
+
+static int block_2F2D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2F2, 0x2F2, 5)) return 0;
+  op_mov_A_B(cpu, 0);
+  cpu->PC = 0x2F2E;
+  return 1;
+}
+
+static int block_2F2E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2F2, 0x2F3, 31)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x2F2F));
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x2F35; op_cm(cpu, i8080_read_word(cpu, 0x2F33));
+  return 1;
+}
+
+static int block_2F35(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2F3, 0x2F3, 45)) return 0;
+  op_mov_B_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  ani(cpu, i8080_read_byte(cpu, 0x2F39));
+  op_xra_C(cpu, 0);
+  op_mov_C_A(cpu, 0);
+  cpu->PC = 0x2F3F; op_jmp(cpu, i8080_read_word(cpu, 0x2F3D));
+  return 1;
+}
+
+static int block_2F3F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2F3, 0x2F4, 76)) return 0;
+  op_inr_E(cpu, 0);
+  cpu->PC = 0x2F41; op_rnz(cpu, 0);
+  if (cpu->PC != 0x2F41) return 1;
+  op_inr_D(cpu, 0);
+  cpu->PC = 0x2F43; op_rnz(cpu, 0);
+  if (cpu->PC != 0x2F43) return 1;
+  op_inr_C(cpu, 0);
+  cpu->PC = 0x2F45; op_rnz(cpu, 0);
+  if (cpu->PC != 0x2F45) return 1;
+  op_mvi_C(cpu, i8080_read_byte(cpu, 0x2F46));
+  op_inr_M(cpu, 0);
+  if (precompiled_changed(cpu, 0x2F3, 0x2F4)) {
+    cpu->PC = 0x2F48;
+    return 1;
+  }
+  cpu->PC = 0x2F49; op_rnz(cpu, 0);
+  return 1;
+}
+
+static int block_2F4E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2F4, 0x2F5, 69)) return 0;
+  op_mov_A_M(cpu, 0);
+  op_add_E(cpu, 0);
+  op_mov_E_A(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  op_adc_D(cpu, 0);
+  op_mov_D_A(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  op_adc_C(cpu, 0);
+  op_mov_C_A(cpu, 0);
+  cpu->PC = 0x2F5A; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_2F5A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2F5, 0x2F6, 99)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x2F5B));
+  op_mov_A_M(cpu, 0);
+  op_cma(cpu, 0);
+  op_mov_M_A(cpu, 0);
+  if (precompiled_changed(cpu, 0x2F5, 0x2F6)) {
+    cpu->PC = 0x2F60;
+    return 1;
+  }
+  op_xra_A(cpu, 0);
+  op_mov_L_A(cpu, 0);
+  op_sub_B(cpu, 0);
+  op_mov_B_A(cpu, 0);
+  op_mov_A_L(cpu, 0);
+  op_sbb_E(cpu, 0);
+  op_mov_E_A(cpu, 0);
+  op_mov_A_L(cpu, 0);
+  op_sbb_D(cpu, 0);
+  op_mov_D_A(cpu, 0);
+  op_mov_A_L(cpu, 0);
+  op_sbb_C(cpu, 0);
+  op_mov_C_A(cpu, 0);
+  cpu->PC = 0x2F6E; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_2F6E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2F6, 0x2F6, 7)) return 0;
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x2F6F));
+  cpu->PC = 0x2F70;
+  return 1;
+}
+
+static int block_2F70(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2F7, 0x2F7, 49)) return 0;
+  sui(cpu, i8080_read_byte(cpu, 0x2F71));
+  cpu->PC = 0x2F75; op_jc(cpu, i8080_read_word(cpu, 0x2F73));
+  if (cpu->PC != 0x2F75) return 1;
+  op_mov_B_E(cpu, 0);
+  op_mov_E_D(cpu, 0);
+  op_mov_D_C(cpu, 0);
+  op_mvi_C(cpu, i8080_read_byte(cpu, 0x2F79));
+  cpu->PC = 0x2F7D; op_jmp(cpu, i8080_read_word(cpu, 0x2F7B));
+  return 1;
+}
+
+static int block_2F7D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2F7, 0x2F7, 12)) return 0;
+  adi(cpu, i8080_read_byte(cpu, 0x2F7E));
+  op_mov_L_A(cpu, 0);
+  cpu->PC = 0x2F80;
+  return 1;
+}
+
+static int block_2F80(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2F8, 0x2F8, 25)) return 0;
+  op_xra_A(cpu, 0);
+  op_dcr_L(cpu, 0);
+  cpu->PC = 0x2F83; op_rz(cpu, 0);
+  if (cpu->PC != 0x2F83) return 1;
+  op_mov_A_C(cpu, 0);
+  cpu->PC = 0x2F84;
+  return 1;
+}
+
+static int block_2F84(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2F8, 0x2F9, 61)) return 0;
+  op_rar(cpu, 0);
+  op_mov_C_A(cpu, 0);
+  op_mov_A_D(cpu, 0);
+  op_rar(cpu, 0);
+  op_mov_D_A(cpu, 0);
+  op_mov_A_E(cpu, 0);
+  op_rar(cpu, 0);
+  op_mov_E_A(cpu, 0);
+  op_mov_A_B(cpu, 0);
+  op_rar(cpu, 0);
+  op_mov_B_A(cpu, 0);
+  cpu->PC = 0x2F92; op_jmp(cpu, i8080_read_word(cpu, 0x2F90));
+  return 1;
+}
+
+static int block_2FA3(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2FA, 0x2FA, 11)) return 0;
+  cpu->PC = 0x2FA4; op_rst_5(cpu, 0);
+  return 1;
+}
+
+static int block_2FA4(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2FA, 0x2FB, 108)) return 0;
+  cpu->PC = 0x2FA7; op_jpe(cpu, i8080_read_word(cpu, 0x2FA5));
+  if (cpu->PC != 0x2FA7) return 1;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x2FA8));
+  op_mov_A_M(cpu, 0);
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x2FAC));
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x2FAF));
+  op_sub_B(cpu, 0);
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x2FA, 0x2FB)) {
+    cpu->PC = 0x2FB3;
+    return 1;
+  }
+  op_mov_M_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x2FA, 0x2FB)) {
+    cpu->PC = 0x2FB4;
+    return 1;
+  }
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x2FA, 0x2FB)) {
+    cpu->PC = 0x2FB5;
+    return 1;
+  }
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x2FA, 0x2FB)) {
+    cpu->PC = 0x2FB6;
+    return 1;
+  }
+  cpu->PC = 0x2FB9; op_call(cpu, i8080_read_word(cpu, 0x2FB7));
+  return 1;
+}
+
+static int block_2FB9(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2FB, 0x2FB, 42)) return 0;
+  op_pop_B(cpu, 0);
+  op_pop_D(cpu, 0);
+  op_inr_B(cpu, 0);
+  cpu->PC = 0x2FBF; op_call(cpu, i8080_read_word(cpu, 0x2FBD));
+  return 1;
+}
+
+static int block_2FBF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2FB, 0x2FC, 27)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x2FC0));
+  cpu->PC = 0x2FC5; op_call(cpu, i8080_read_word(cpu, 0x2FC3));
+  return 1;
+}
+
+static int block_2FC5(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2FC, 0x2FC, 27)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x2FC6));
+  cpu->PC = 0x2FCB; op_call(cpu, i8080_read_word(cpu, 0x2FC9));
+  return 1;
+}
+
+static int block_2FCB(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2FC, 0x2FD, 37)) return 0;
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x2FCC));
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x2FCF));
+  cpu->PC = 0x2FD4; op_call(cpu, i8080_read_word(cpu, 0x2FD2));
+  return 1;
+}
+
+static int block_2FD4(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2FD, 0x2FD, 27)) return 0;
+  op_pop_PSW(cpu, 0);
+  cpu->PC = 0x2FD8; op_call(cpu, i8080_read_word(cpu, 0x2FD6));
+  return 1;
+}
+
+static int block_2FD8(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2FD, 0x2FD, 20)) return 0;
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x2FD9));
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x2FDC));
+  cpu->PC = 0x2FDE;
+  return 1;
+}
+
+static int block_2FDE(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2FD, 0x2FD, 11)) return 0;
+  cpu->PC = 0x2FDF; op_rst_5(cpu, 0);
+  return 1;
+}
+
+static int block_2FDF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2FD, 0x2FE, 35)) return 0;
+  cpu->PC = 0x2FE0; op_rz(cpu, 0);
+  if (cpu->PC != 0x2FE0) return 1;
+  op_mvi_L(cpu, i8080_read_byte(cpu, 0x2FE1));
+  cpu->PC = 0x2FE5; op_call(cpu, i8080_read_word(cpu, 0x2FE3));
+  return 1;
+}
+
+static int block_2FE5(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2FE, 0x2FF, 122)) return 0;
+  op_mov_A_C(cpu, 0);
+  sta(cpu, i8080_read_word(cpu, 0x2FE7));
+  if (precompiled_changed(cpu, 0x2FE, 0x2FF)) {
+    cpu->PC = 0x2FE9;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x2FEB));
+  if (precompiled_changed(cpu, 0x2FE, 0x2FF)) {
+    cpu->PC = 0x2FED;
+    return 1;
+  }
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x2FEE));
+  op_mov_D_B(cpu, 0);
+  op_mov_E_B(cpu, 0);
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x2FF3));
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x2FE, 0x2FF)) {
+    cpu->PC = 0x2FF6;
+    return 1;
+  }
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x2FF7));
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x2FE, 0x2FF)) {
+    cpu->PC = 0x2FFA;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x2FE, 0x2FF)) {
+    cpu->PC = 0x2FFB;
+    return 1;
+  }
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x2FFC));
+  cpu->PC = 0x2FFE;
+  return 1;
+}
+
+static int block_2FFE(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x2FF, 0x300, 49)) return 0;
+  op_mov_A_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x3004; op_jz(cpu, i8080_read_word(cpu, 0x3002));
+  if (cpu->PC != 0x3004) return 1;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x2FF, 0x300)) {
+    cpu->PC = 0x3005;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  op_mvi_E(cpu, i8080_read_byte(cpu, 0x3007));
+  cpu->PC = 0x3008;
+  return 1;
+}
+
+static int block_3008(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x300, 0x301, 72)) return 0;
+  op_rar(cpu, 0);
+  op_mov_D_A(cpu, 0);
+  op_mov_A_C(cpu, 0);
+  cpu->PC = 0x300E; op_jnc(cpu, i8080_read_word(cpu, 0x300C));
+  if (cpu->PC != 0x300E) return 1;
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x300, 0x301)) {
+    cpu->PC = 0x300F;
+    return 1;
+  }
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x3010));
+  op_dad_D(cpu, 0);
+  op_pop_D(cpu, 0);
+  aci(cpu, i8080_read_byte(cpu, 0x3015));
+  cpu->PC = 0x3016;
+  return 1;
+}
+
+static int block_3016(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x301, 0x301, 14)) return 0;
+  op_rar(cpu, 0);
+  op_mov_C_A(cpu, 0);
+  op_mov_A_H(cpu, 0);
+  cpu->PC = 0x3019;
+  return 1;
+}
+
+static int block_3019(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x301, 0x302, 62)) return 0;
+  op_rar(cpu, 0);
+  op_mov_H_A(cpu, 0);
+  op_mov_A_L(cpu, 0);
+  op_rar(cpu, 0);
+  op_mov_L_A(cpu, 0);
+  op_mov_A_B(cpu, 0);
+  op_rar(cpu, 0);
+  op_mov_B_A(cpu, 0);
+  op_dcr_E(cpu, 0);
+  op_mov_A_D(cpu, 0);
+  cpu->PC = 0x3026; op_jnz(cpu, i8080_read_word(cpu, 0x3024));
+  if (cpu->PC != 0x3026) return 1;
+  op_xchg(cpu, 0);
+  cpu->PC = 0x3027;
+  return 1;
+}
+
+static int block_3027(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x302, 0x302, 10)) return 0;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x3028;
+  return 1;
+}
+
+static int block_3028(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x302, 0x302, 11)) return 0;
+  cpu->PC = 0x3029; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_3029(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x302, 0x302, 31)) return 0;
+  op_mov_B_E(cpu, 0);
+  op_mov_E_D(cpu, 0);
+  op_mov_D_C(cpu, 0);
+  op_mov_C_A(cpu, 0);
+  cpu->PC = 0x302E; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_3039(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x303, 0x303, 11)) return 0;
+  cpu->PC = 0x303A; op_rst_5(cpu, 0);
+  return 1;
+}
+
+static int block_303A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x303, 0x304, 34)) return 0;
+  cpu->PC = 0x303D; op_jz(cpu, i8080_read_word(cpu, 0x303B));
+  if (cpu->PC != 0x303D) return 1;
+  op_mvi_L(cpu, i8080_read_byte(cpu, 0x303E));
+  cpu->PC = 0x3042; op_call(cpu, i8080_read_word(cpu, 0x3040));
+  return 1;
+}
+
+static int block_3042(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x304, 0x305, 137)) return 0;
+  op_inr_M(cpu, 0);
+  if (precompiled_changed(cpu, 0x304, 0x305)) {
+    cpu->PC = 0x3043;
+    return 1;
+  }
+  op_inr_M(cpu, 0);
+  if (precompiled_changed(cpu, 0x304, 0x305)) {
+    cpu->PC = 0x3044;
+    return 1;
+  }
+  op_dcx_H(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  sta(cpu, i8080_read_word(cpu, 0x3047));
+  if (precompiled_changed(cpu, 0x304, 0x305)) {
+    cpu->PC = 0x3049;
+    return 1;
+  }
+  op_dcx_H(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  sta(cpu, i8080_read_word(cpu, 0x304C));
+  if (precompiled_changed(cpu, 0x304, 0x305)) {
+    cpu->PC = 0x304E;
+    return 1;
+  }
+  op_dcx_H(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  sta(cpu, i8080_read_word(cpu, 0x3051));
+  if (precompiled_changed(cpu, 0x304, 0x305)) {
+    cpu->PC = 0x3053;
+    return 1;
+  }
+  op_mov_B_C(cpu, 0);
+  op_xchg(cpu, 0);
+  op_xra_A(cpu, 0);
+  op_mov_C_A(cpu, 0);
+  op_mov_D_A(cpu, 0);
+  op_mov_E_A(cpu, 0);
+  sta(cpu, i8080_read_word(cpu, 0x305A));
+  cpu->PC = 0x305C;
+  return 1;
+}
+
+static int block_305C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x305, 0x306, 91)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x305, 0x306)) {
+    cpu->PC = 0x305D;
+    return 1;
+  }
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x305, 0x306)) {
+    cpu->PC = 0x305E;
+    return 1;
+  }
+  op_mov_A_L(cpu, 0);
+  sui(cpu, i8080_read_byte(cpu, 0x3060));
+  op_mov_L_A(cpu, 0);
+  op_mov_A_H(cpu, 0);
+  sbi(cpu, i8080_read_byte(cpu, 0x3064));
+  op_mov_H_A(cpu, 0);
+  op_mov_A_B(cpu, 0);
+  sbi(cpu, i8080_read_byte(cpu, 0x3068));
+  op_mov_B_A(cpu, 0);
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x306B));
+  sbi(cpu, i8080_read_byte(cpu, 0x306D));
+  op_cmc(cpu, 0);
+  cpu->PC = 0x306F;
+  return 1;
+}
+
+static int block_306F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x306, 0x308, 118)) return 0;
+  cpu->PC = 0x3072; op_jnc(cpu, i8080_read_word(cpu, 0x3070));
+  if (cpu->PC != 0x3072) return 1;
+  sta(cpu, i8080_read_word(cpu, 0x3073));
+  if (precompiled_changed(cpu, 0x306, 0x308)) {
+    cpu->PC = 0x3075;
+    return 1;
+  }
+  op_pop_PSW(cpu, 0);
+  op_pop_PSW(cpu, 0);
+  op_stc(cpu, 0);
+  cpu->PC = 0x307B; op_jnc(cpu, i8080_read_word(cpu, 0x3079));
+  if (cpu->PC != 0x307B) return 1;
+  op_mov_A_C(cpu, 0);
+  op_inr_A(cpu, 0);
+  op_dcr_A(cpu, 0);
+  op_rar(cpu, 0);
+  cpu->PC = 0x3082; op_jm(cpu, i8080_read_word(cpu, 0x3080));
+  if (cpu->PC != 0x3082) return 1;
+  op_ral(cpu, 0);
+  op_mov_A_E(cpu, 0);
+  op_ral(cpu, 0);
+  op_mov_E_A(cpu, 0);
+  op_mov_A_D(cpu, 0);
+  op_ral(cpu, 0);
+  op_mov_D_A(cpu, 0);
+  cpu->PC = 0x3089;
+  return 1;
+}
+
+static int block_3079(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x307, 0x308, 81)) return 0;
+  op_pop_B(cpu, 0);
+  op_pop_H(cpu, 0);
+  op_mov_A_C(cpu, 0);
+  op_inr_A(cpu, 0);
+  op_dcr_A(cpu, 0);
+  op_rar(cpu, 0);
+  cpu->PC = 0x3082; op_jm(cpu, i8080_read_word(cpu, 0x3080));
+  if (cpu->PC != 0x3082) return 1;
+  op_ral(cpu, 0);
+  op_mov_A_E(cpu, 0);
+  op_ral(cpu, 0);
+  op_mov_E_A(cpu, 0);
+  op_mov_A_D(cpu, 0);
+  op_ral(cpu, 0);
+  op_mov_D_A(cpu, 0);
+  cpu->PC = 0x3089;
+  return 1;
+}
+
+static int block_3089(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x308, 0x309, 91)) return 0;
+  op_mov_A_C(cpu, 0);
+  op_ral(cpu, 0);
+  op_mov_C_A(cpu, 0);
+  op_dad_H(cpu, 0);
+  op_mov_A_B(cpu, 0);
+  op_ral(cpu, 0);
+  op_mov_B_A(cpu, 0);
+  lda(cpu, i8080_read_word(cpu, 0x3091));
+  op_ral(cpu, 0);
+  sta(cpu, i8080_read_word(cpu, 0x3095));
+  if (precompiled_changed(cpu, 0x308, 0x309)) {
+    cpu->PC = 0x3097;
+    return 1;
+  }
+  op_mov_A_C(cpu, 0);
+  op_ora_D(cpu, 0);
+  op_ora_E(cpu, 0);
+  cpu->PC = 0x309D; op_jnz(cpu, i8080_read_word(cpu, 0x309B));
+  return 1;
+}
+
+static int block_309D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x309, 0x30A, 41)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x309, 0x30A)) {
+    cpu->PC = 0x309E;
+    return 1;
+  }
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x309F));
+  op_dcr_M(cpu, 0);
+  if (precompiled_changed(cpu, 0x309, 0x30A)) {
+    cpu->PC = 0x30A2;
+    return 1;
+  }
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x30A3;
+  return 1;
+}
+
+static int block_30A3(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x30A, 0x30A, 20)) return 0;
+  cpu->PC = 0x30A6; op_jnz(cpu, i8080_read_word(cpu, 0x30A4));
+  if (cpu->PC != 0x30A6) return 1;
+  cpu->PC = 0x30A9; op_jmp(cpu, i8080_read_word(cpu, 0x30A7));
+  return 1;
+}
+
+static int block_30B6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x30B, 0x30D, 114)) return 0;
+  op_mov_A_B(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x30BB; op_jz(cpu, i8080_read_word(cpu, 0x30B9));
+  if (cpu->PC != 0x30BB) return 1;
+  op_mov_A_L(cpu, 0);
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x30BD));
+  op_xra_M(cpu, 0);
+  op_add_B(cpu, 0);
+  op_mov_B_A(cpu, 0);
+  op_rar(cpu, 0);
+  op_xra_B(cpu, 0);
+  op_mov_A_B(cpu, 0);
+  cpu->PC = 0x30C8; op_jp(cpu, i8080_read_word(cpu, 0x30C6));
+  if (cpu->PC != 0x30C8) return 1;
+  adi(cpu, i8080_read_byte(cpu, 0x30C9));
+  op_mov_M_A(cpu, 0);
+  if (precompiled_changed(cpu, 0x30B, 0x30D)) {
+    cpu->PC = 0x30CB;
+    return 1;
+  }
+  cpu->PC = 0x30CE; op_jz(cpu, i8080_read_word(cpu, 0x30CC));
+  if (cpu->PC != 0x30CE) return 1;
+  cpu->PC = 0x30D1; op_call(cpu, i8080_read_word(cpu, 0x30CF));
+  return 1;
+}
+
+static int block_30D1(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x30D, 0x30D, 7)) return 0;
+  op_mov_M_A(cpu, 0);
+  cpu->PC = 0x30D2;
+  return 1;
+}
+
+static int block_30D2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x30D, 0x30D, 16)) return 0;
+  op_dcx_H(cpu, 0);
+  cpu->PC = 0x30D4; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_30DF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x30D, 0x30E, 17)) return 0;
+  cpu->PC = 0x30E2; op_call(cpu, i8080_read_word(cpu, 0x30E0));
+  return 1;
+}
+
+static int block_30E2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x30E, 0x30E, 59)) return 0;
+  op_mov_A_B(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x30E5; op_rz(cpu, 0);
+  if (cpu->PC != 0x30E5) return 1;
+  adi(cpu, i8080_read_byte(cpu, 0x30E6));
+  cpu->PC = 0x30EA; op_jc(cpu, i8080_read_word(cpu, 0x30E8));
+  if (cpu->PC != 0x30EA) return 1;
+  op_mov_B_A(cpu, 0);
+  cpu->PC = 0x30EE; op_call(cpu, i8080_read_word(cpu, 0x30EC));
+  return 1;
+}
+
+static int block_30EE(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x30E, 0x30F, 41)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x30EF));
+  op_inr_M(cpu, 0);
+  if (precompiled_changed(cpu, 0x30E, 0x30F)) {
+    cpu->PC = 0x30F2;
+    return 1;
+  }
+  cpu->PC = 0x30F3; op_rnz(cpu, 0);
+  if (cpu->PC != 0x30F3) return 1;
+  cpu->PC = 0x30F6; op_jmp(cpu, i8080_read_word(cpu, 0x30F4));
+  return 1;
+}
+
+static int block_30F6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x30F, 0x30F, 20)) return 0;
+  lda(cpu, i8080_read_word(cpu, 0x30F7));
+  cpi(cpu, i8080_read_byte(cpu, 0x30FA));
+  cpu->PC = 0x30FB;
+  return 1;
+}
+
+static int block_30FA(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x30F, 0x30F, 4)) return 0;
+  op_cma(cpu, 0);
+  cpu->PC = 0x30FB;
+  return 1;
+}
+
+static int block_30FB(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x30F, 0x30F, 4)) return 0;
+  op_ral(cpu, 0);
+  cpu->PC = 0x30FC;
+  return 1;
+}
+
+static int block_30FC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x30F, 0x30F, 31)) return 0;
+  op_sbb_A(cpu, 0);
+  cpu->PC = 0x30FE; op_rnz(cpu, 0);
+  if (cpu->PC != 0x30FE) return 1;
+  op_inr_A(cpu, 0);
+  cpu->PC = 0x3100; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_3100(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x310, 0x310, 17)) return 0;
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x3101));
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x3103));
+  cpu->PC = 0x3105;
+  return 1;
+}
+
+static int block_3105(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x310, 0x311, 58)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x3106));
+  op_mov_C_A(cpu, 0);
+  op_mov_M_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x310, 0x311)) {
+    cpu->PC = 0x310A;
+    return 1;
+  }
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x310B));
+  op_inx_H(cpu, 0);
+  op_mvi_M(cpu, i8080_read_byte(cpu, 0x310E));
+  if (precompiled_changed(cpu, 0x310, 0x311)) {
+    cpu->PC = 0x310F;
+    return 1;
+  }
+  op_ral(cpu, 0);
+  cpu->PC = 0x3113; op_jmp(cpu, i8080_read_word(cpu, 0x3111));
+  return 1;
+}
+
+static int block_3117(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x311, 0x311, 11)) return 0;
+  cpu->PC = 0x3118; op_rst_6(cpu, 0);
+  return 1;
+}
+
+static int block_3118(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x311, 0x311, 20)) return 0;
+  cpu->PC = 0x311B; op_jm(cpu, i8080_read_word(cpu, 0x3119));
+  if (cpu->PC != 0x311B) return 1;
+  cpu->PC = 0x311E; op_jz(cpu, i8080_read_word(cpu, 0x311C));
+  return 1;
+}
+
+static int block_311E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x311, 0x312, 42)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x311F));
+  op_mov_A_M(cpu, 0);
+  xri(cpu, i8080_read_byte(cpu, 0x3123));
+  op_mov_M_A(cpu, 0);
+  if (precompiled_changed(cpu, 0x311, 0x312)) {
+    cpu->PC = 0x3125;
+    return 1;
+  }
+  cpu->PC = 0x3126; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_3129(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x312, 0x312, 28)) return 0;
+  op_mov_L_A(cpu, 0);
+  op_ral(cpu, 0);
+  op_sbb_A(cpu, 0);
+  op_mov_H_A(cpu, 0);
+  cpu->PC = 0x3130; op_jmp(cpu, i8080_read_word(cpu, 0x312E));
+  return 1;
+}
+
+static int block_3130(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x313, 0x313, 11)) return 0;
+  cpu->PC = 0x3131; op_rst_6(cpu, 0);
+  return 1;
+}
+
+static int block_3131(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x313, 0x313, 36)) return 0;
+  cpu->PC = 0x3134; op_jz(cpu, i8080_read_word(cpu, 0x3132));
+  if (cpu->PC != 0x3134) return 1;
+  cpu->PC = 0x3137; op_jp(cpu, i8080_read_word(cpu, 0x3135));
+  if (cpu->PC != 0x3137) return 1;
+  ldhd(cpu, i8080_read_word(cpu, 0x3138));
+  cpu->PC = 0x313A;
+  return 1;
+}
+
+static int block_313A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x313, 0x314, 35)) return 0;
+  op_mov_A_H(cpu, 0);
+  op_ora_L(cpu, 0);
+  cpu->PC = 0x313D; op_rz(cpu, 0);
+  if (cpu->PC != 0x313D) return 1;
+  op_mov_A_H(cpu, 0);
+  cpu->PC = 0x3141; op_jmp(cpu, i8080_read_word(cpu, 0x313F));
+  return 1;
+}
+
+static int block_3141(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x314, 0x314, 111)) return 0;
+  op_xchg(cpu, 0);
+  ldhd(cpu, i8080_read_word(cpu, 0x3143));
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x314, 0x314)) {
+    cpu->PC = 0x3146;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x314, 0x314)) {
+    cpu->PC = 0x3147;
+    return 1;
+  }
+  ldhd(cpu, i8080_read_word(cpu, 0x3148));
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x314, 0x314)) {
+    cpu->PC = 0x314B;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x314, 0x314)) {
+    cpu->PC = 0x314C;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  cpu->PC = 0x314E; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_314E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x314, 0x315, 17)) return 0;
+  cpu->PC = 0x3151; op_call(cpu, i8080_read_word(cpu, 0x314F));
+  return 1;
+}
+
+static int block_3151(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x315, 0x315, 63)) return 0;
+  op_xchg(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x3153));
+  if (precompiled_changed(cpu, 0x315, 0x315)) {
+    cpu->PC = 0x3155;
+    return 1;
+  }
+  op_mov_H_B(cpu, 0);
+  op_mov_L_C(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x3158));
+  if (precompiled_changed(cpu, 0x315, 0x315)) {
+    cpu->PC = 0x315A;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  cpu->PC = 0x315C; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_315C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x315, 0x315, 10)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x315D));
+  cpu->PC = 0x315F;
+  return 1;
+}
+
+static int block_315F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x315, 0x316, 12)) return 0;
+  op_mov_E_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  cpu->PC = 0x3161;
+  return 1;
+}
+
+static int block_3161(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x316, 0x316, 31)) return 0;
+  op_mov_D_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_C_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_B_M(cpu, 0);
+  cpu->PC = 0x3166;
+  return 1;
+}
+
+static int block_3166(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x316, 0x316, 16)) return 0;
+  op_inx_H(cpu, 0);
+  cpu->PC = 0x3168; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_3168(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x316, 0x316, 27)) return 0;
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x3169));
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x316C));
+  cpu->PC = 0x3170; op_jmp(cpu, i8080_read_word(cpu, 0x316E));
+  return 1;
+}
+
+static int block_3170(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x317, 0x317, 5)) return 0;
+  op_xchg(cpu, 0);
+  cpu->PC = 0x3171;
+  return 1;
+}
+
+static int block_3171(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x317, 0x317, 18)) return 0;
+  lda(cpu, i8080_read_word(cpu, 0x3172));
+  op_mov_B_A(cpu, 0);
+  cpu->PC = 0x3175;
+  return 1;
+}
+
+static int block_3175(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x317, 0x317, 50)) return 0;
+  op_ldax_D(cpu, 0);
+  op_mov_M_A(cpu, 0);
+  if (precompiled_changed(cpu, 0x317, 0x317)) {
+    cpu->PC = 0x3177;
+    return 1;
+  }
+  op_inx_D(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_dcr_B(cpu, 0);
+  cpu->PC = 0x317D; op_jnz(cpu, i8080_read_word(cpu, 0x317B));
+  if (cpu->PC != 0x317D) return 1;
+  cpu->PC = 0x317E; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_317E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x317, 0x319, 105)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x317F));
+  op_mov_A_M(cpu, 0);
+  op_rlc(cpu, 0);
+  op_stc(cpu, 0);
+  op_rar(cpu, 0);
+  op_mov_M_A(cpu, 0);
+  if (precompiled_changed(cpu, 0x317, 0x319)) {
+    cpu->PC = 0x3186;
+    return 1;
+  }
+  op_cmc(cpu, 0);
+  op_rar(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_M_A(cpu, 0);
+  if (precompiled_changed(cpu, 0x317, 0x319)) {
+    cpu->PC = 0x318B;
+    return 1;
+  }
+  op_mov_A_C(cpu, 0);
+  op_rlc(cpu, 0);
+  op_stc(cpu, 0);
+  op_rar(cpu, 0);
+  op_mov_C_A(cpu, 0);
+  op_rar(cpu, 0);
+  op_xra_M(cpu, 0);
+  cpu->PC = 0x3193; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_3196(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x319, 0x319, 20)) return 0;
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x3197));
+  cpu->PC = 0x319C; op_jmp(cpu, i8080_read_word(cpu, 0x319A));
+  return 1;
+}
+
+static int block_319C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x319, 0x31A, 20)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x319D));
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x31A0));
+  cpu->PC = 0x31A2;
+  return 1;
+}
+
+static int block_31A2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x31A, 0x31A, 11)) return 0;
+  op_push_D(cpu, 0);
+  cpu->PC = 0x31A3;
+  return 1;
+}
+
+static int block_31A3(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x31A, 0x31A, 21)) return 0;
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x31A4));
+  cpu->PC = 0x31A7; op_rst_6(cpu, 0);
+  return 1;
+}
+
+static int block_31A7(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x31A, 0x31A, 32)) return 0;
+  cpu->PC = 0x31A8; op_rc(cpu, 0);
+  if (cpu->PC != 0x31A8) return 1;
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x31A9));
+  cpu->PC = 0x31AC; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_31AC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x31A, 0x31B, 51)) return 0;
+  op_mov_A_B(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x31B1; op_jz(cpu, i8080_read_word(cpu, 0x31AF));
+  if (cpu->PC != 0x31B1) return 1;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x31B2));
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x31A, 0x31B)) {
+    cpu->PC = 0x31B5;
+    return 1;
+  }
+  cpu->PC = 0x31B6; op_rst_5(cpu, 0);
+  return 1;
+}
+
+static int block_31B6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x31B, 0x31C, 66)) return 0;
+  op_mov_A_C(cpu, 0);
+  cpu->PC = 0x31B8; op_rz(cpu, 0);
+  if (cpu->PC != 0x31B8) return 1;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x31B9));
+  op_xra_M(cpu, 0);
+  op_mov_A_C(cpu, 0);
+  cpu->PC = 0x31BE; op_rm(cpu, 0);
+  if (cpu->PC != 0x31BE) return 1;
+  cpu->PC = 0x31C1; op_call(cpu, i8080_read_word(cpu, 0x31BF));
+  return 1;
+}
+
+static int block_31C1(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x31C, 0x31C, 19)) return 0;
+  op_rar(cpu, 0);
+  op_xra_C(cpu, 0);
+  cpu->PC = 0x31C4; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_31C4(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x31C, 0x31D, 143)) return 0;
+  op_inx_H(cpu, 0);
+  op_mov_A_B(cpu, 0);
+  op_cmp_M(cpu, 0);
+  cpu->PC = 0x31C8; op_rnz(cpu, 0);
+  if (cpu->PC != 0x31C8) return 1;
+  op_dcx_H(cpu, 0);
+  op_mov_A_C(cpu, 0);
+  op_cmp_M(cpu, 0);
+  cpu->PC = 0x31CC; op_rnz(cpu, 0);
+  if (cpu->PC != 0x31CC) return 1;
+  op_dcx_H(cpu, 0);
+  op_mov_A_D(cpu, 0);
+  op_cmp_M(cpu, 0);
+  cpu->PC = 0x31D0; op_rnz(cpu, 0);
+  if (cpu->PC != 0x31D0) return 1;
+  op_dcx_H(cpu, 0);
+  op_mov_A_E(cpu, 0);
+  op_sub_M(cpu, 0);
+  cpu->PC = 0x31D4; op_rnz(cpu, 0);
+  if (cpu->PC != 0x31D4) return 1;
+  op_pop_H(cpu, 0);
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x31D7; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_31E7(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x31E, 0x31E, 27)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x31E8));
+  cpu->PC = 0x31ED; op_call(cpu, i8080_read_word(cpu, 0x31EB));
+  return 1;
+}
+
+static int block_31ED(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x31E, 0x31F, 63)) return 0;
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x31EE));
+  op_ldax_D(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x31F5; op_jz(cpu, i8080_read_word(cpu, 0x31F3));
+  if (cpu->PC != 0x31F5) return 1;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x31F6));
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x31E, 0x31F)) {
+    cpu->PC = 0x31F9;
+    return 1;
+  }
+  cpu->PC = 0x31FA; op_rst_5(cpu, 0);
+  return 1;
+}
+
+static int block_31FA(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x31F, 0x320, 78)) return 0;
+  op_dcx_D(cpu, 0);
+  op_ldax_D(cpu, 0);
+  op_mov_C_A(cpu, 0);
+  cpu->PC = 0x31FE; op_rz(cpu, 0);
+  if (cpu->PC != 0x31FE) return 1;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x31FF));
+  op_xra_M(cpu, 0);
+  op_mov_A_C(cpu, 0);
+  cpu->PC = 0x3204; op_rm(cpu, 0);
+  if (cpu->PC != 0x3204) return 1;
+  op_inx_D(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x3207));
+  cpu->PC = 0x3208;
+  return 1;
+}
+
+static int block_3208(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x320, 0x321, 70)) return 0;
+  op_ldax_D(cpu, 0);
+  op_sub_M(cpu, 0);
+  cpu->PC = 0x320D; op_jnz(cpu, i8080_read_word(cpu, 0x320B));
+  if (cpu->PC != 0x320D) return 1;
+  op_dcx_D(cpu, 0);
+  op_dcx_H(cpu, 0);
+  op_dcr_B(cpu, 0);
+  cpu->PC = 0x3213; op_jnz(cpu, i8080_read_word(cpu, 0x3211));
+  if (cpu->PC != 0x3213) return 1;
+  op_pop_B(cpu, 0);
+  cpu->PC = 0x3215; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_321C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x321, 0x321, 11)) return 0;
+  cpu->PC = 0x321D; op_rst_6(cpu, 0);
+  return 1;
+}
+
+static int block_321D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x321, 0x322, 54)) return 0;
+  ldhd(cpu, i8080_read_word(cpu, 0x321E));
+  cpu->PC = 0x3221; op_rm(cpu, 0);
+  if (cpu->PC != 0x3221) return 1;
+  cpu->PC = 0x3224; op_jz(cpu, i8080_read_word(cpu, 0x3222));
+  if (cpu->PC != 0x3224) return 1;
+  cpu->PC = 0x3227; op_cnc(cpu, i8080_read_word(cpu, 0x3225));
+  return 1;
+}
+
+static int block_3227(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x322, 0x322, 21)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x3228));
+  op_push_H(cpu, 0);
+  cpu->PC = 0x322B;
+  return 1;
+}
+
+static int block_322B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x322, 0x323, 47)) return 0;
+  lda(cpu, i8080_read_word(cpu, 0x322C));
+  cpi(cpu, i8080_read_byte(cpu, 0x322F));
+  cpu->PC = 0x3233; op_jnc(cpu, i8080_read_word(cpu, 0x3231));
+  if (cpu->PC != 0x3233) return 1;
+  cpu->PC = 0x3236; op_call(cpu, i8080_read_word(cpu, 0x3234));
+  return 1;
+}
+
+static int block_3236(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x323, 0x323, 5)) return 0;
+  op_xchg(cpu, 0);
+  cpu->PC = 0x3237;
+  return 1;
+}
+
+static int block_3237(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x323, 0x323, 10)) return 0;
+  op_pop_D(cpu, 0);
+  cpu->PC = 0x3238;
+  return 1;
+}
+
+static int block_3238(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x323, 0x323, 16)) return 0;
+  shld(cpu, i8080_read_word(cpu, 0x3239));
+  cpu->PC = 0x323B;
+  return 1;
+}
+
+static int block_323B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x323, 0x323, 7)) return 0;
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x323C));
+  cpu->PC = 0x323D;
+  return 1;
+}
+
+static int block_323D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x323, 0x324, 24)) return 0;
+  sta(cpu, i8080_read_word(cpu, 0x323E));
+  if (precompiled_changed(cpu, 0x323, 0x324)) {
+    cpu->PC = 0x3240;
+    return 1;
+  }
+  cpu->PC = 0x3241; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_3250(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x325, 0x325, 11)) return 0;
+  cpu->PC = 0x3251; op_rst_6(cpu, 0);
+  return 1;
+}
+
+static int block_3251(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x325, 0x325, 31)) return 0;
+  cpu->PC = 0x3252; op_rpo(cpu, 0);
+  if (cpu->PC != 0x3252) return 1;
+  cpu->PC = 0x3255; op_jm(cpu, i8080_read_word(cpu, 0x3253));
+  if (cpu->PC != 0x3255) return 1;
+  cpu->PC = 0x3258; op_jz(cpu, i8080_read_word(cpu, 0x3256));
+  return 1;
+}
+
+static int block_326B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x326, 0x326, 16)) return 0;
+  ldhd(cpu, i8080_read_word(cpu, 0x326C));
+  cpu->PC = 0x326E;
+  return 1;
+}
+
+static int block_326E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x326, 0x327, 17)) return 0;
+  cpu->PC = 0x3271; op_call(cpu, i8080_read_word(cpu, 0x326F));
+  return 1;
+}
+
+static int block_3271(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x327, 0x327, 34)) return 0;
+  op_mov_A_H(cpu, 0);
+  op_mov_D_L(cpu, 0);
+  op_mvi_E(cpu, i8080_read_byte(cpu, 0x3274));
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x3276));
+  cpu->PC = 0x327A; op_jmp(cpu, i8080_read_word(cpu, 0x3278));
+  return 1;
+}
+
+static int block_327A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x327, 0x327, 11)) return 0;
+  cpu->PC = 0x327B; op_rst_6(cpu, 0);
+  return 1;
+}
+
+static int block_327B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x327, 0x328, 38)) return 0;
+  cpu->PC = 0x327C; op_rnc(cpu, 0);
+  if (cpu->PC != 0x327C) return 1;
+  cpu->PC = 0x327F; op_jz(cpu, i8080_read_word(cpu, 0x327D));
+  if (cpu->PC != 0x327F) return 1;
+  cpu->PC = 0x3282; op_cm(cpu, i8080_read_word(cpu, 0x3280));
+  return 1;
+}
+
+static int block_3282(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x328, 0x328, 42)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x3283));
+  shld(cpu, i8080_read_word(cpu, 0x3286));
+  if (precompiled_changed(cpu, 0x328, 0x328)) {
+    cpu->PC = 0x3288;
+    return 1;
+  }
+  shld(cpu, i8080_read_word(cpu, 0x3289));
+  cpu->PC = 0x328B;
+  return 1;
+}
+
+static int block_328B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x328, 0x329, 27)) return 0;
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x328C));
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x328E));
+  cpu->PC = 0x3293; op_jmp(cpu, i8080_read_word(cpu, 0x3291));
+  return 1;
+}
+
+static int block_328E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x328, 0x329, 17)) return 0;
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x328F));
+  cpu->PC = 0x3293; op_jmp(cpu, i8080_read_word(cpu, 0x3291));
+  return 1;
+}
+
+static int block_3293(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x329, 0x329, 11)) return 0;
+  cpu->PC = 0x3294; op_rst_6(cpu, 0);
+  return 1;
+}
+
+static int block_3294(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x329, 0x329, 11)) return 0;
+  cpu->PC = 0x3295; op_rz(cpu, 0);
+  return 1;
+}
+
+static int block_329A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x329, 0x32A, 63)) return 0;
+  op_mov_B_A(cpu, 0);
+  op_mov_C_A(cpu, 0);
+  op_mov_D_A(cpu, 0);
+  op_mov_E_A(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x32A0; op_rz(cpu, 0);
+  if (cpu->PC != 0x32A0) return 1;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x329, 0x32A)) {
+    cpu->PC = 0x32A1;
+    return 1;
+  }
+  cpu->PC = 0x32A4; op_call(cpu, i8080_read_word(cpu, 0x32A2));
+  return 1;
+}
+
+static int block_32A4(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x32A, 0x32A, 17)) return 0;
+  cpu->PC = 0x32A7; op_call(cpu, i8080_read_word(cpu, 0x32A5));
+  return 1;
+}
+
+static int block_32A7(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x32A, 0x32A, 29)) return 0;
+  op_xra_M(cpu, 0);
+  op_mov_H_A(cpu, 0);
+  cpu->PC = 0x32AC; op_cm(cpu, i8080_read_word(cpu, 0x32AA));
+  return 1;
+}
+
+static int block_32AC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x32A, 0x32B, 28)) return 0;
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x32AD));
+  op_sub_B(cpu, 0);
+  cpu->PC = 0x32B2; op_call(cpu, i8080_read_word(cpu, 0x32B0));
+  return 1;
+}
+
+static int block_32B2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x32B, 0x32B, 26)) return 0;
+  op_mov_A_H(cpu, 0);
+  op_ral(cpu, 0);
+  cpu->PC = 0x32B7; op_cc(cpu, i8080_read_word(cpu, 0x32B5));
+  return 1;
+}
+
+static int block_32B7(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x32B, 0x32B, 24)) return 0;
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x32B8));
+  cpu->PC = 0x32BC; op_cc(cpu, i8080_read_word(cpu, 0x32BA));
+  return 1;
+}
+
+static int block_32BC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x32B, 0x32B, 21)) return 0;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x32BE; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_32BE(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x32B, 0x32C, 30)) return 0;
+  op_dcx_D(cpu, 0);
+  op_mov_A_D(cpu, 0);
+  op_ana_E(cpu, 0);
+  op_inr_A(cpu, 0);
+  cpu->PC = 0x32C3; op_rnz(cpu, 0);
+  return 1;
+}
+
+static int block_32DF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x32D, 0x32E, 72)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x32E0));
+  op_mov_A_M(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x32E4));
+  lda(cpu, i8080_read_word(cpu, 0x32E6));
+  cpu->PC = 0x32E9; op_rnc(cpu, 0);
+  if (cpu->PC != 0x32E9) return 1;
+  op_mov_A_M(cpu, 0);
+  cpu->PC = 0x32ED; op_call(cpu, i8080_read_word(cpu, 0x32EB));
+  return 1;
+}
+
+static int block_32ED(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x32E, 0x32F, 52)) return 0;
+  op_mvi_M(cpu, i8080_read_byte(cpu, 0x32EE));
+  if (precompiled_changed(cpu, 0x32E, 0x32F)) {
+    cpu->PC = 0x32EF;
+    return 1;
+  }
+  op_mov_A_E(cpu, 0);
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x32E, 0x32F)) {
+    cpu->PC = 0x32F1;
+    return 1;
+  }
+  op_mov_A_C(cpu, 0);
+  op_ral(cpu, 0);
+  cpu->PC = 0x32F6; op_call(cpu, i8080_read_word(cpu, 0x32F4));
+  return 1;
+}
+
+static int block_32F6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x32F, 0x32F, 21)) return 0;
+  op_pop_PSW(cpu, 0);
+  cpu->PC = 0x32F8; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_334C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x334, 0x335, 47)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x334, 0x335)) {
+    cpu->PC = 0x334D;
+    return 1;
+  }
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x334E));
+  op_mov_A_B(cpu, 0);
+  op_ora_C(cpu, 0);
+  cpu->PC = 0x3355; op_jz(cpu, i8080_read_word(cpu, 0x3353));
+  if (cpu->PC != 0x3355) return 1;
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x3356));
+  cpu->PC = 0x3357;
+  return 1;
+}
+
+static int block_3357(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x335, 0x336, 70)) return 0;
+  op_dad_H(cpu, 0);
+  cpu->PC = 0x335B; op_jc(cpu, i8080_read_word(cpu, 0x3359));
+  if (cpu->PC != 0x335B) return 1;
+  op_xchg(cpu, 0);
+  op_dad_H(cpu, 0);
+  op_xchg(cpu, 0);
+  cpu->PC = 0x3361; op_jnc(cpu, i8080_read_word(cpu, 0x335F));
+  if (cpu->PC != 0x3361) return 1;
+  op_dad_B(cpu, 0);
+  cpu->PC = 0x3365; op_jc(cpu, i8080_read_word(cpu, 0x3363));
+  return 1;
+}
+
+static int block_3365(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x336, 0x336, 15)) return 0;
+  op_dcr_A(cpu, 0);
+  cpu->PC = 0x3369; op_jnz(cpu, i8080_read_word(cpu, 0x3367));
+  return 1;
+}
+
+static int block_3369(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x336, 0x336, 26)) return 0;
+  op_xchg(cpu, 0);
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x336C; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_3378(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x337, 0x338, 107)) return 0;
+  op_mov_A_H(cpu, 0);
+  op_ral(cpu, 0);
+  op_sbb_A(cpu, 0);
+  op_mov_B_A(cpu, 0);
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x337, 0x338)) {
+    cpu->PC = 0x337D;
+    return 1;
+  }
+  op_mov_A_D(cpu, 0);
+  op_ral(cpu, 0);
+  op_sbb_A(cpu, 0);
+  op_dad_D(cpu, 0);
+  op_adc_B(cpu, 0);
+  op_rrc(cpu, 0);
+  op_xra_H(cpu, 0);
+  cpu->PC = 0x3387; op_jp(cpu, i8080_read_word(cpu, 0x3385));
+  if (cpu->PC != 0x3387) return 1;
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x337, 0x338)) {
+    cpu->PC = 0x3388;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  cpu->PC = 0x338C; op_call(cpu, i8080_read_word(cpu, 0x338A));
+  return 1;
+}
+
+static int block_33BE(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x33B, 0x33C, 44)) return 0;
+  op_mov_A_H(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x33C3; op_jm(cpu, i8080_read_word(cpu, 0x33C1));
+  if (cpu->PC != 0x33C3) return 1;
+  op_pop_D(cpu, 0);
+  op_mov_A_B(cpu, 0);
+  cpu->PC = 0x33C8; op_jmp(cpu, i8080_read_word(cpu, 0x33C6));
+  return 1;
+}
+
+static int block_33DC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x33D, 0x33E, 30)) return 0;
+  op_pop_B(cpu, 0);
+  op_pop_D(cpu, 0);
+  cpu->PC = 0x33E1; op_jmp(cpu, i8080_read_word(cpu, 0x33DF));
+  return 1;
+}
+
+static int block_33EF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x33E, 0x33F, 36)) return 0;
+  op_mov_A_H(cpu, 0);
+  op_ora_L(cpu, 0);
+  cpu->PC = 0x33F4; op_jz(cpu, i8080_read_word(cpu, 0x33F2));
+  if (cpu->PC != 0x33F4) return 1;
+  cpu->PC = 0x33F7; op_call(cpu, i8080_read_word(cpu, 0x33F5));
+  return 1;
+}
+
+static int block_33F7(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x33F, 0x33F, 33)) return 0;
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x33F, 0x33F)) {
+    cpu->PC = 0x33F8;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  cpu->PC = 0x33FC; op_call(cpu, i8080_read_word(cpu, 0x33FA));
+  return 1;
+}
+
+static int block_33FC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x33F, 0x340, 52)) return 0;
+  op_mov_B_H(cpu, 0);
+  op_mov_C_L(cpu, 0);
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x33FF));
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x3402));
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x33F, 0x340)) {
+    cpu->PC = 0x3404;
+    return 1;
+  }
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x3408; op_jmp(cpu, i8080_read_word(cpu, 0x3406));
+  return 1;
+}
+
+static int block_3408(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x340, 0x341, 63)) return 0;
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x340, 0x341)) {
+    cpu->PC = 0x3409;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x340, 0x341)) {
+    cpu->PC = 0x340A;
+    return 1;
+  }
+  op_dad_B(cpu, 0);
+  cpu->PC = 0x340E; op_jnc(cpu, i8080_read_word(cpu, 0x340C));
+  if (cpu->PC != 0x340E) return 1;
+  op_pop_PSW(cpu, 0);
+  op_stc(cpu, 0);
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x3411));
+  cpu->PC = 0x3412;
+  return 1;
+}
+
+static int block_3411(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x341, 0x341, 10)) return 0;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x3412;
+  return 1;
+}
+
+static int block_3412(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x341, 0x342, 117)) return 0;
+  op_mov_A_E(cpu, 0);
+  op_ral(cpu, 0);
+  op_mov_E_A(cpu, 0);
+  op_mov_A_D(cpu, 0);
+  op_ral(cpu, 0);
+  op_mov_D_A(cpu, 0);
+  op_mov_A_L(cpu, 0);
+  op_ral(cpu, 0);
+  op_mov_L_A(cpu, 0);
+  op_mov_A_H(cpu, 0);
+  op_ral(cpu, 0);
+  op_mov_H_A(cpu, 0);
+  op_pop_PSW(cpu, 0);
+  op_dcr_A(cpu, 0);
+  cpu->PC = 0x3423; op_jnz(cpu, i8080_read_word(cpu, 0x3421));
+  if (cpu->PC != 0x3423) return 1;
+  op_xchg(cpu, 0);
+  op_pop_B(cpu, 0);
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x341, 0x342)) {
+    cpu->PC = 0x3426;
+    return 1;
+  }
+  cpu->PC = 0x3429; op_jmp(cpu, i8080_read_word(cpu, 0x3427));
+  return 1;
+}
+
+static int block_3429(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x342, 0x342, 31)) return 0;
+  op_mov_A_H(cpu, 0);
+  op_xra_D(cpu, 0);
+  op_mov_B_A(cpu, 0);
+  cpu->PC = 0x342F; op_call(cpu, i8080_read_word(cpu, 0x342D));
+  return 1;
+}
+
+static int block_342F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x342, 0x342, 5)) return 0;
+  op_xchg(cpu, 0);
+  cpu->PC = 0x3430;
+  return 1;
+}
+
+static int block_3430(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x343, 0x343, 5)) return 0;
+  op_mov_A_H(cpu, 0);
+  cpu->PC = 0x3431;
+  return 1;
+}
+
+static int block_3431(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x343, 0x343, 14)) return 0;
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x3435; op_jp(cpu, i8080_read_word(cpu, 0x3433));
+  return 1;
+}
+
+static int block_3435(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x343, 0x343, 42)) return 0;
+  op_xra_A(cpu, 0);
+  op_mov_C_A(cpu, 0);
+  op_sub_L(cpu, 0);
+  op_mov_L_A(cpu, 0);
+  op_mov_A_C(cpu, 0);
+  op_sbb_H(cpu, 0);
+  op_mov_H_A(cpu, 0);
+  cpu->PC = 0x343F; op_jmp(cpu, i8080_read_word(cpu, 0x343D));
+  return 1;
+}
+
+static int block_346D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x346, 0x348, 137)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x346E));
+  op_mov_A_M(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x3473; op_rz(cpu, 0);
+  if (cpu->PC != 0x3473) return 1;
+  op_mov_B_A(cpu, 0);
+  op_dcx_H(cpu, 0);
+  op_mov_C_M(cpu, 0);
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x3477));
+  op_ldax_D(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x347E; op_jz(cpu, i8080_read_word(cpu, 0x347C));
+  if (cpu->PC != 0x347E) return 1;
+  op_sub_B(cpu, 0);
+  cpu->PC = 0x3482; op_jnc(cpu, i8080_read_word(cpu, 0x3480));
+  if (cpu->PC != 0x3482) return 1;
+  op_cma(cpu, 0);
+  op_inr_A(cpu, 0);
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x346, 0x348)) {
+    cpu->PC = 0x3485;
+    return 1;
+  }
+  op_mvi_C(cpu, i8080_read_byte(cpu, 0x3486));
+  op_inx_H(cpu, 0);
+  op_push_H(cpu, 0);
+  cpu->PC = 0x3489;
+  return 1;
+}
+
+static int block_3489(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x348, 0x349, 87)) return 0;
+  op_ldax_D(cpu, 0);
+  op_mov_B_M(cpu, 0);
+  op_mov_M_A(cpu, 0);
+  if (precompiled_changed(cpu, 0x348, 0x349)) {
+    cpu->PC = 0x348C;
+    return 1;
+  }
+  op_mov_A_B(cpu, 0);
+  op_stax_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x348, 0x349)) {
+    cpu->PC = 0x348E;
+    return 1;
+  }
+  op_dcx_D(cpu, 0);
+  op_dcx_H(cpu, 0);
+  op_dcr_C(cpu, 0);
+  cpu->PC = 0x3494; op_jnz(cpu, i8080_read_word(cpu, 0x3492));
+  if (cpu->PC != 0x3494) return 1;
+  op_pop_H(cpu, 0);
+  op_mov_B_M(cpu, 0);
+  op_dcx_H(cpu, 0);
+  op_mov_C_M(cpu, 0);
+  cpu->PC = 0x3498;
+  return 1;
+}
+
+static int block_3498(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x349, 0x349, 10)) return 0;
+  op_pop_PSW(cpu, 0);
+  cpu->PC = 0x3499;
+  return 1;
+}
+
+static int block_3499(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x349, 0x349, 46)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x349A));
+  cpu->PC = 0x349C; op_rnc(cpu, 0);
+  if (cpu->PC != 0x349C) return 1;
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x349, 0x349)) {
+    cpu->PC = 0x349D;
+    return 1;
+  }
+  cpu->PC = 0x34A0; op_call(cpu, i8080_read_word(cpu, 0x349E));
+  return 1;
+}
+
+static int block_34A0(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x34A, 0x34A, 57)) return 0;
+  op_inx_H(cpu, 0);
+  op_mvi_M(cpu, i8080_read_byte(cpu, 0x34A2));
+  if (precompiled_changed(cpu, 0x34A, 0x34A)) {
+    cpu->PC = 0x34A3;
+    return 1;
+  }
+  op_mov_B_A(cpu, 0);
+  op_pop_PSW(cpu, 0);
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x34A6));
+  cpu->PC = 0x34AB; op_call(cpu, i8080_read_word(cpu, 0x34A9));
+  return 1;
+}
+
+static int block_34AB(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x34A, 0x34B, 62)) return 0;
+  lda(cpu, i8080_read_word(cpu, 0x34AC));
+  sta(cpu, i8080_read_word(cpu, 0x34AF));
+  if (precompiled_changed(cpu, 0x34A, 0x34B)) {
+    cpu->PC = 0x34B1;
+    return 1;
+  }
+  op_mov_A_B(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x34B6; op_jp(cpu, i8080_read_word(cpu, 0x34B4));
+  if (cpu->PC != 0x34B6) return 1;
+  cpu->PC = 0x34B9; op_call(cpu, i8080_read_word(cpu, 0x34B7));
+  return 1;
+}
+
+static int block_34B9(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x34B, 0x34C, 52)) return 0;
+  cpu->PC = 0x34BC; op_jnc(cpu, i8080_read_word(cpu, 0x34BA));
+  if (cpu->PC != 0x34BC) return 1;
+  op_xchg(cpu, 0);
+  op_inr_M(cpu, 0);
+  if (precompiled_changed(cpu, 0x34B, 0x34C)) {
+    cpu->PC = 0x34BE;
+    return 1;
+  }
+  cpu->PC = 0x34C1; op_jz(cpu, i8080_read_word(cpu, 0x34BF));
+  if (cpu->PC != 0x34C1) return 1;
+  cpu->PC = 0x34C4; op_call(cpu, i8080_read_word(cpu, 0x34C2));
+  return 1;
+}
+
+static int block_34C4(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x34C, 0x34C, 10)) return 0;
+  cpu->PC = 0x34C7; op_jmp(cpu, i8080_read_word(cpu, 0x34C5));
+  return 1;
+}
+
+static int block_34FB(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x34F, 0x350, 74)) return 0;
+  cpu->PC = 0x34FE; op_jp(cpu, i8080_read_word(cpu, 0x34FC));
+  if (cpu->PC != 0x34FE) return 1;
+  op_mov_A_B(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x3503; op_jz(cpu, i8080_read_word(cpu, 0x3501));
+  if (cpu->PC != 0x3503) return 1;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x3504));
+  op_add_M(cpu, 0);
+  op_mov_M_A(cpu, 0);
+  if (precompiled_changed(cpu, 0x34F, 0x350)) {
+    cpu->PC = 0x3508;
+    return 1;
+  }
+  cpu->PC = 0x350B; op_jnc(cpu, i8080_read_word(cpu, 0x3509));
+  if (cpu->PC != 0x350B) return 1;
+  cpu->PC = 0x350C; op_rz(cpu, 0);
+  return 1;
+}
+
+static int block_350C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x350, 0x350, 13)) return 0;
+  lda(cpu, i8080_read_word(cpu, 0x350D));
+  cpu->PC = 0x350F;
+  return 1;
+}
+
+static int block_350F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x350, 0x351, 21)) return 0;
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x3513; op_cm(cpu, i8080_read_word(cpu, 0x3511));
+  return 1;
+}
+
+static int block_3513(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x351, 0x351, 59)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x3514));
+  op_mov_A_M(cpu, 0);
+  ani(cpu, i8080_read_byte(cpu, 0x3518));
+  op_dcx_H(cpu, 0);
+  op_dcx_H(cpu, 0);
+  op_xra_M(cpu, 0);
+  op_mov_M_A(cpu, 0);
+  if (precompiled_changed(cpu, 0x351, 0x351)) {
+    cpu->PC = 0x351D;
+    return 1;
+  }
+  cpu->PC = 0x351E; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_353B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x353, 0x353, 7)) return 0;
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x353C));
+  cpu->PC = 0x353D;
+  return 1;
+}
+
+static int block_353D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x353, 0x353, 10)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x353E));
+  cpu->PC = 0x3540;
+  return 1;
+}
+
+static int block_3540(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x354, 0x354, 10)) return 0;
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x3541));
+  cpu->PC = 0x3543;
+  return 1;
+}
+
+static int block_3543(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x354, 0x354, 24)) return 0;
+  op_mvi_C(cpu, i8080_read_byte(cpu, 0x3544));
+  sta(cpu, i8080_read_word(cpu, 0x3546));
+  if (precompiled_changed(cpu, 0x354, 0x354)) {
+    cpu->PC = 0x3548;
+    return 1;
+  }
+  op_xra_A(cpu, 0);
+  cpu->PC = 0x3549;
+  return 1;
+}
+
+static int block_3549(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x354, 0x355, 57)) return 0;
+  op_ldax_D(cpu, 0);
+  op_adc_M(cpu, 0);
+  op_stax_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x354, 0x355)) {
+    cpu->PC = 0x354C;
+    return 1;
+  }
+  op_inx_D(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_dcr_C(cpu, 0);
+  cpu->PC = 0x3552; op_jnz(cpu, i8080_read_word(cpu, 0x3550));
+  if (cpu->PC != 0x3552) return 1;
+  cpu->PC = 0x3553; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_3566(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x356, 0x356, 18)) return 0;
+  op_mov_M_C(cpu, 0);
+  if (precompiled_changed(cpu, 0x356, 0x356)) {
+    cpu->PC = 0x3567;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  cpu->PC = 0x3568;
+  return 1;
+}
+
+static int block_3568(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x356, 0x356, 27)) return 0;
+  sui(cpu, i8080_read_byte(cpu, 0x3569));
+  cpu->PC = 0x356D; op_jc(cpu, i8080_read_word(cpu, 0x356B));
+  if (cpu->PC != 0x356D) return 1;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x356E;
+  return 1;
+}
+
+static int block_356E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x356, 0x357, 21)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x356, 0x357)) {
+    cpu->PC = 0x356F;
+    return 1;
+  }
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x3570));
+  cpu->PC = 0x3572;
+  return 1;
+}
+
+static int block_3572(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x357, 0x357, 49)) return 0;
+  op_mov_C_M(cpu, 0);
+  op_mov_M_E(cpu, 0);
+  if (precompiled_changed(cpu, 0x357, 0x357)) {
+    cpu->PC = 0x3574;
+    return 1;
+  }
+  op_mov_E_C(cpu, 0);
+  op_dcx_H(cpu, 0);
+  op_dcr_D(cpu, 0);
+  cpu->PC = 0x357A; op_jnz(cpu, i8080_read_word(cpu, 0x3578));
+  if (cpu->PC != 0x357A) return 1;
+  cpu->PC = 0x357D; op_jmp(cpu, i8080_read_word(cpu, 0x357B));
+  return 1;
+}
+
+static int block_357D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x357, 0x357, 12)) return 0;
+  adi(cpu, i8080_read_byte(cpu, 0x357E));
+  op_mov_D_A(cpu, 0);
+  cpu->PC = 0x3580;
+  return 1;
+}
+
+static int block_3580(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x358, 0x358, 30)) return 0;
+  op_xra_A(cpu, 0);
+  op_pop_H(cpu, 0);
+  op_dcr_D(cpu, 0);
+  cpu->PC = 0x3584; op_rz(cpu, 0);
+  return 1;
+}
+
+static int block_3584(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x358, 0x358, 18)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x358, 0x358)) {
+    cpu->PC = 0x3585;
+    return 1;
+  }
+  op_mvi_E(cpu, i8080_read_byte(cpu, 0x3586));
+  cpu->PC = 0x3587;
+  return 1;
+}
+
+static int block_3587(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x358, 0x359, 48)) return 0;
+  op_mov_A_M(cpu, 0);
+  op_rar(cpu, 0);
+  op_mov_M_A(cpu, 0);
+  if (precompiled_changed(cpu, 0x358, 0x359)) {
+    cpu->PC = 0x358A;
+    return 1;
+  }
+  op_dcx_H(cpu, 0);
+  op_dcr_E(cpu, 0);
+  cpu->PC = 0x358F; op_jnz(cpu, i8080_read_word(cpu, 0x358D));
+  if (cpu->PC != 0x358F) return 1;
+  cpu->PC = 0x3592; op_jmp(cpu, i8080_read_word(cpu, 0x3590));
+  return 1;
+}
+
+static int block_3592(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x359, 0x359, 27)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x3593));
+  op_mvi_D(cpu, i8080_read_byte(cpu, 0x3596));
+  cpu->PC = 0x359A; op_jmp(cpu, i8080_read_word(cpu, 0x3598));
+  return 1;
+}
+
+static int block_359C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x359, 0x35A, 49)) return 0;
+  op_mov_A_M(cpu, 0);
+  op_ral(cpu, 0);
+  op_mov_M_A(cpu, 0);
+  if (precompiled_changed(cpu, 0x359, 0x35A)) {
+    cpu->PC = 0x359F;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_dcr_C(cpu, 0);
+  cpu->PC = 0x35A4; op_jnz(cpu, i8080_read_word(cpu, 0x35A2));
+  if (cpu->PC != 0x35A4) return 1;
+  cpu->PC = 0x35A5; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_35B1(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x35B, 0x35B, 44)) return 0;
+  op_ldax_D(cpu, 0);
+  op_inx_D(cpu, 0);
+  op_ora_A(cpu, 0);
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x35B, 0x35B)) {
+    cpu->PC = 0x35B5;
+    return 1;
+  }
+  cpu->PC = 0x35B8; op_jz(cpu, i8080_read_word(cpu, 0x35B6));
+  if (cpu->PC != 0x35B8) return 1;
+  op_mvi_C(cpu, i8080_read_byte(cpu, 0x35B9));
+  cpu->PC = 0x35BA;
+  return 1;
+}
+
+static int block_35BA(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x35B, 0x35B, 37)) return 0;
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x35B, 0x35B)) {
+    cpu->PC = 0x35BB;
+    return 1;
+  }
+  op_rar(cpu, 0);
+  op_mov_B_A(cpu, 0);
+  cpu->PC = 0x35C0; op_cc(cpu, i8080_read_word(cpu, 0x35BE));
+  return 1;
+}
+
+static int block_35C0(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x35C, 0x35C, 17)) return 0;
+  cpu->PC = 0x35C3; op_call(cpu, i8080_read_word(cpu, 0x35C1));
+  return 1;
+}
+
+static int block_35C3(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x35C, 0x35C, 30)) return 0;
+  op_mov_A_B(cpu, 0);
+  op_pop_B(cpu, 0);
+  op_dcr_C(cpu, 0);
+  cpu->PC = 0x35C9; op_jnz(cpu, i8080_read_word(cpu, 0x35C7));
+  return 1;
+}
+
+static int block_35C9(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x35C, 0x35D, 35)) return 0;
+  op_pop_D(cpu, 0);
+  op_dcr_B(cpu, 0);
+  cpu->PC = 0x35CE; op_jnz(cpu, i8080_read_word(cpu, 0x35CC));
+  if (cpu->PC != 0x35CE) return 1;
+  cpu->PC = 0x35D1; op_jmp(cpu, i8080_read_word(cpu, 0x35CF));
+  return 1;
+}
+
+static int block_35D1(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x35D, 0x35D, 27)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x35D2));
+  cpu->PC = 0x35D7; op_call(cpu, i8080_read_word(cpu, 0x35D5));
+  return 1;
+}
+
+static int block_35D7(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x35D, 0x35D, 10)) return 0;
+  cpu->PC = 0x35DA; op_jmp(cpu, i8080_read_word(cpu, 0x35D8));
+  return 1;
+}
+
+static int block_3645(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x364, 0x364, 57)) return 0;
+  op_mov_A_M(cpu, 0);
+  op_stax_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x364, 0x364)) {
+    cpu->PC = 0x3647;
+    return 1;
+  }
+  op_mov_M_C(cpu, 0);
+  if (precompiled_changed(cpu, 0x364, 0x364)) {
+    cpu->PC = 0x3648;
+    return 1;
+  }
+  op_dcx_D(cpu, 0);
+  op_dcx_H(cpu, 0);
+  op_dcr_B(cpu, 0);
+  cpu->PC = 0x364E; op_jnz(cpu, i8080_read_word(cpu, 0x364C));
+  if (cpu->PC != 0x364E) return 1;
+  cpu->PC = 0x364F; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_364F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x364, 0x365, 17)) return 0;
+  cpu->PC = 0x3652; op_call(cpu, i8080_read_word(cpu, 0x3650));
+  return 1;
+}
+
+static int block_3652(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x365, 0x366, 84)) return 0;
+  op_xchg(cpu, 0);
+  op_dcx_H(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x3657; op_rz(cpu, 0);
+  if (cpu->PC != 0x3657) return 1;
+  adi(cpu, i8080_read_byte(cpu, 0x3658));
+  cpu->PC = 0x365C; op_jc(cpu, i8080_read_word(cpu, 0x365A));
+  if (cpu->PC != 0x365C) return 1;
+  op_mov_M_A(cpu, 0);
+  if (precompiled_changed(cpu, 0x365, 0x366)) {
+    cpu->PC = 0x365D;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x365, 0x366)) {
+    cpu->PC = 0x365E;
+    return 1;
+  }
+  cpu->PC = 0x3661; op_call(cpu, i8080_read_word(cpu, 0x365F));
+  return 1;
+}
+
+static int block_3661(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x366, 0x366, 41)) return 0;
+  op_pop_H(cpu, 0);
+  op_inr_M(cpu, 0);
+  if (precompiled_changed(cpu, 0x366, 0x366)) {
+    cpu->PC = 0x3663;
+    return 1;
+  }
+  cpu->PC = 0x3664; op_rnz(cpu, 0);
+  if (cpu->PC != 0x3664) return 1;
+  cpu->PC = 0x3667; op_jmp(cpu, i8080_read_word(cpu, 0x3665));
+  return 1;
+}
+
+static int block_366E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x366, 0x367, 46)) return 0;
+  op_xra_A(cpu, 0);
+  op_xchg(cpu, 0);
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x3671));
+  op_mov_H_B(cpu, 0);
+  op_mov_L_B(cpu, 0);
+  cpu->PC = 0x3678; op_cz(cpu, i8080_read_word(cpu, 0x3676));
+  return 1;
+}
+
+static int block_3678(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x367, 0x368, 79)) return 0;
+  op_xchg(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x367B));
+  cpu->PC = 0x367F; op_jz(cpu, i8080_read_word(cpu, 0x367D));
+  if (cpu->PC != 0x367F) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x3680));
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x367, 0x368)) {
+    cpu->PC = 0x3682;
+    return 1;
+  }
+  cpu->PC = 0x3685; op_jz(cpu, i8080_read_word(cpu, 0x3683));
+  if (cpu->PC != 0x3685) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x3686));
+  cpu->PC = 0x368A; op_jz(cpu, i8080_read_word(cpu, 0x3688));
+  if (cpu->PC != 0x368A) return 1;
+  op_dcx_H(cpu, 0);
+  cpu->PC = 0x368B;
+  return 1;
+}
+
+static int block_368B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x368, 0x368, 11)) return 0;
+  cpu->PC = 0x368C; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_368C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x368, 0x369, 66)) return 0;
+  cpu->PC = 0x368F; op_jc(cpu, i8080_read_word(cpu, 0x368D));
+  if (cpu->PC != 0x368F) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x3690));
+  cpu->PC = 0x3694; op_jz(cpu, i8080_read_word(cpu, 0x3692));
+  if (cpu->PC != 0x3694) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x3695));
+  cpu->PC = 0x3699; op_jnz(cpu, i8080_read_word(cpu, 0x3697));
+  if (cpu->PC != 0x3699) return 1;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x368, 0x369)) {
+    cpu->PC = 0x369A;
+    return 1;
+  }
+  cpu->PC = 0x369B; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_36A4(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x36A, 0x36B, 68)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x36A5));
+  cpu->PC = 0x36A9; op_jz(cpu, i8080_read_word(cpu, 0x36A7));
+  if (cpu->PC != 0x36A9) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x36AA));
+  cpu->PC = 0x36AE; op_jz(cpu, i8080_read_word(cpu, 0x36AC));
+  if (cpu->PC != 0x36AE) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x36AF));
+  cpu->PC = 0x36B3; op_jz(cpu, i8080_read_word(cpu, 0x36B1));
+  if (cpu->PC != 0x36B3) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x36B4));
+  cpu->PC = 0x36B8; op_jnz(cpu, i8080_read_word(cpu, 0x36B6));
+  return 1;
+}
+
+static int block_36DD(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x36D, 0x36D, 20)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x36D, 0x36D)) {
+    cpu->PC = 0x36DE;
+    return 1;
+  }
+  op_mov_A_E(cpu, 0);
+  op_sub_B(cpu, 0);
+  cpu->PC = 0x36E0;
+  return 1;
+}
+
+static int block_36E0(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x36E, 0x36E, 17)) return 0;
+  cpu->PC = 0x36E3; op_cp(cpu, i8080_read_word(cpu, 0x36E1));
+  return 1;
+}
+
+static int block_36E3(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x36E, 0x36E, 17)) return 0;
+  cpu->PC = 0x36E6; op_cm(cpu, i8080_read_word(cpu, 0x36E4));
+  return 1;
+}
+
+static int block_36E6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x36E, 0x36E, 58)) return 0;
+  cpu->PC = 0x36E9; op_jnz(cpu, i8080_read_word(cpu, 0x36E7));
+  if (cpu->PC != 0x36E9) return 1;
+  op_pop_H(cpu, 0);
+  op_pop_PSW(cpu, 0);
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x36E, 0x36E)) {
+    cpu->PC = 0x36EC;
+    return 1;
+  }
+  cpu->PC = 0x36EF; op_cz(cpu, i8080_read_word(cpu, 0x36ED));
+  return 1;
+}
+
+static int block_36EF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x36E, 0x36F, 21)) return 0;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x36F1; op_rst_6(cpu, 0);
+  return 1;
+}
+
+static int block_36F1(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x36F, 0x36F, 60)) return 0;
+  cpu->PC = 0x36F2; op_rpe(cpu, 0);
+  if (cpu->PC != 0x36F2) return 1;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x36F, 0x36F)) {
+    cpu->PC = 0x36F3;
+    return 1;
+  }
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x36F4));
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x36F, 0x36F)) {
+    cpu->PC = 0x36F7;
+    return 1;
+  }
+  cpu->PC = 0x36FA; op_call(cpu, i8080_read_word(cpu, 0x36F8));
+  return 1;
+}
+
+static int block_3724(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x372, 0x372, 11)) return 0;
+  cpu->PC = 0x3725; op_rz(cpu, 0);
+  return 1;
+}
+
+static int block_3725(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x372, 0x372, 22)) return 0;
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x372, 0x372)) {
+    cpu->PC = 0x3726;
+    return 1;
+  }
+  cpu->PC = 0x3727; op_rst_6(cpu, 0);
+  return 1;
+}
+
+static int block_3727(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x372, 0x372, 28)) return 0;
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x372, 0x372)) {
+    cpu->PC = 0x3728;
+    return 1;
+  }
+  cpu->PC = 0x372B; op_cpo(cpu, i8080_read_word(cpu, 0x3729));
+  return 1;
+}
+
+static int block_372B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x372, 0x372, 27)) return 0;
+  op_pop_PSW(cpu, 0);
+  cpu->PC = 0x372F; op_cpe(cpu, i8080_read_word(cpu, 0x372D));
+  return 1;
+}
+
+static int block_372F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x372, 0x372, 10)) return 0;
+  op_pop_PSW(cpu, 0);
+  cpu->PC = 0x3730;
+  return 1;
+}
+
+static int block_3730(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x373, 0x373, 16)) return 0;
+  op_dcr_A(cpu, 0);
+  cpu->PC = 0x3732; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_3743(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x374, 0x374, 83)) return 0;
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x374, 0x374)) {
+    cpu->PC = 0x3744;
+    return 1;
+  }
+  op_mov_A_B(cpu, 0);
+  op_adc_C(cpu, 0);
+  op_mov_B_A(cpu, 0);
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x374, 0x374)) {
+    cpu->PC = 0x3748;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x374, 0x374)) {
+    cpu->PC = 0x3749;
+    return 1;
+  }
+  op_mov_A_M(cpu, 0);
+  sui(cpu, i8080_read_byte(cpu, 0x374B));
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x374, 0x374)) {
+    cpu->PC = 0x374D;
+    return 1;
+  }
+  cpu->PC = 0x374E; op_rst_6(cpu, 0);
+  return 1;
+}
+
+static int block_374E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x374, 0x375, 47)) return 0;
+  cpu->PC = 0x3751; op_jp(cpu, i8080_read_word(cpu, 0x374F));
+  if (cpu->PC != 0x3751) return 1;
+  ldhd(cpu, i8080_read_word(cpu, 0x3752));
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x3755));
+  cpu->PC = 0x3758; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_3758(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x375, 0x376, 120)) return 0;
+  cpu->PC = 0x375B; op_jnc(cpu, i8080_read_word(cpu, 0x3759));
+  if (cpu->PC != 0x375B) return 1;
+  op_mov_D_H(cpu, 0);
+  op_mov_E_L(cpu, 0);
+  op_dad_H(cpu, 0);
+  op_dad_H(cpu, 0);
+  op_dad_D(cpu, 0);
+  op_dad_H(cpu, 0);
+  op_pop_PSW(cpu, 0);
+  op_mov_C_A(cpu, 0);
+  op_dad_B(cpu, 0);
+  op_mov_A_H(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x3769; op_jm(cpu, i8080_read_word(cpu, 0x3767));
+  if (cpu->PC != 0x3769) return 1;
+  shld(cpu, i8080_read_word(cpu, 0x376A));
+  cpu->PC = 0x376C;
+  return 1;
+}
+
+static int block_376C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x376, 0x377, 40)) return 0;
+  op_pop_H(cpu, 0);
+  op_pop_B(cpu, 0);
+  op_pop_D(cpu, 0);
+  cpu->PC = 0x3772; op_jmp(cpu, i8080_read_word(cpu, 0x3770));
+  return 1;
+}
+
+static int block_3778(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x377, 0x378, 47)) return 0;
+  cpu->PC = 0x377B; op_jnc(cpu, i8080_read_word(cpu, 0x3779));
+  if (cpu->PC != 0x377B) return 1;
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x377C));
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x377F));
+  cpu->PC = 0x3784; op_call(cpu, i8080_read_word(cpu, 0x3782));
+  return 1;
+}
+
+static int block_3794(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x379, 0x379, 17)) return 0;
+  cpu->PC = 0x3797; op_call(cpu, i8080_read_word(cpu, 0x3795));
+  return 1;
+}
+
+static int block_3797(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x379, 0x379, 17)) return 0;
+  cpu->PC = 0x379A; op_call(cpu, i8080_read_word(cpu, 0x3798));
+  return 1;
+}
+
+static int block_379A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x379, 0x379, 27)) return 0;
+  op_pop_PSW(cpu, 0);
+  cpu->PC = 0x379E; op_call(cpu, i8080_read_word(cpu, 0x379C));
+  return 1;
+}
+
+static int block_379E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x379, 0x37A, 17)) return 0;
+  cpu->PC = 0x37A1; op_call(cpu, i8080_read_word(cpu, 0x379F));
+  return 1;
+}
+
+static int block_37A1(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x37A, 0x37A, 17)) return 0;
+  cpu->PC = 0x37A4; op_call(cpu, i8080_read_word(cpu, 0x37A2));
+  return 1;
+}
+
+static int block_37A4(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x37A, 0x37A, 10)) return 0;
+  cpu->PC = 0x37A7; op_jmp(cpu, i8080_read_word(cpu, 0x37A5));
+  return 1;
+}
+
+static int block_37A7(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x37A, 0x37A, 17)) return 0;
+  cpu->PC = 0x37AA; op_call(cpu, i8080_read_word(cpu, 0x37A8));
+  return 1;
+}
+
+static int block_37AA(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x37A, 0x37A, 17)) return 0;
+  cpu->PC = 0x37AD; op_call(cpu, i8080_read_word(cpu, 0x37AB));
+  return 1;
+}
+
+static int block_37AD(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x37A, 0x37B, 30)) return 0;
+  op_pop_B(cpu, 0);
+  op_pop_D(cpu, 0);
+  cpu->PC = 0x37B2; op_jmp(cpu, i8080_read_word(cpu, 0x37B0));
+  return 1;
+}
+
+static int block_37DC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x37D, 0x37D, 4)) return 0;
+  op_xra_A(cpu, 0);
+  cpu->PC = 0x37DD;
+  return 1;
+}
+
+static int block_37DD(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x37D, 0x37D, 17)) return 0;
+  cpu->PC = 0x37E0; op_call(cpu, i8080_read_word(cpu, 0x37DE));
+  return 1;
+}
+
+static int block_37E0(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x37E, 0x37E, 27)) return 0;
+  ani(cpu, i8080_read_byte(cpu, 0x37E1));
+  cpu->PC = 0x37E5; op_jz(cpu, i8080_read_word(cpu, 0x37E3));
+  if (cpu->PC != 0x37E5) return 1;
+  op_mvi_M(cpu, i8080_read_byte(cpu, 0x37E6));
+  cpu->PC = 0x37E7;
+  return 1;
+}
+
+static int block_37E7(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x37E, 0x37E, 22)) return 0;
+  op_xchg(cpu, 0);
+  cpu->PC = 0x37EB; op_call(cpu, i8080_read_word(cpu, 0x37E9));
+  return 1;
+}
+
+static int block_37EB(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x37E, 0x37F, 64)) return 0;
+  op_xchg(cpu, 0);
+  cpu->PC = 0x37EF; op_jp(cpu, i8080_read_word(cpu, 0x37ED));
+  if (cpu->PC != 0x37EF) return 1;
+  op_mvi_M(cpu, i8080_read_byte(cpu, 0x37F0));
+  if (precompiled_changed(cpu, 0x37E, 0x37F)) {
+    cpu->PC = 0x37F1;
+    return 1;
+  }
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x37E, 0x37F)) {
+    cpu->PC = 0x37F2;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x37E, 0x37F)) {
+    cpu->PC = 0x37F3;
+    return 1;
+  }
+  cpu->PC = 0x37F6; op_call(cpu, i8080_read_word(cpu, 0x37F4));
+  return 1;
+}
+
+static int block_37F9(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x37F, 0x381, 114)) return 0;
+  op_inx_H(cpu, 0);
+  op_mvi_M(cpu, i8080_read_byte(cpu, 0x37FB));
+  if (precompiled_changed(cpu, 0x37F, 0x381)) {
+    cpu->PC = 0x37FC;
+    return 1;
+  }
+  lda(cpu, i8080_read_word(cpu, 0x37FD));
+  op_mov_D_A(cpu, 0);
+  op_ral(cpu, 0);
+  lda(cpu, i8080_read_word(cpu, 0x3802));
+  cpu->PC = 0x3807; op_jc(cpu, i8080_read_word(cpu, 0x3805));
+  if (cpu->PC != 0x3807) return 1;
+  cpu->PC = 0x380A; op_jz(cpu, i8080_read_word(cpu, 0x3808));
+  if (cpu->PC != 0x380A) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x380B));
+  cpu->PC = 0x380F; op_jpe(cpu, i8080_read_word(cpu, 0x380D));
+  if (cpu->PC != 0x380F) return 1;
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x3810));
+  cpu->PC = 0x3815; op_call(cpu, i8080_read_word(cpu, 0x3813));
+  return 1;
+}
+
+static int block_3815(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x381, 0x382, 90)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x3816));
+  op_mov_B_M(cpu, 0);
+  op_mvi_C(cpu, i8080_read_byte(cpu, 0x381A));
+  lda(cpu, i8080_read_word(cpu, 0x381C));
+  op_mov_E_A(cpu, 0);
+  ani(cpu, i8080_read_byte(cpu, 0x3820));
+  cpu->PC = 0x3824; op_jz(cpu, i8080_read_word(cpu, 0x3822));
+  if (cpu->PC != 0x3824) return 1;
+  op_mov_A_B(cpu, 0);
+  op_cmp_C(cpu, 0);
+  op_mvi_C(cpu, i8080_read_byte(cpu, 0x3827));
+  cpu->PC = 0x382B; op_jnz(cpu, i8080_read_word(cpu, 0x3829));
+  if (cpu->PC != 0x382B) return 1;
+  op_mov_B_C(cpu, 0);
+  cpu->PC = 0x382C;
+  return 1;
+}
+
+static int block_382C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x382, 0x382, 18)) return 0;
+  op_mov_M_C(cpu, 0);
+  if (precompiled_changed(cpu, 0x382, 0x382)) {
+    cpu->PC = 0x382D;
+    return 1;
+  }
+  cpu->PC = 0x382E; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_382E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x382, 0x384, 95)) return 0;
+  cpu->PC = 0x3831; op_jz(cpu, i8080_read_word(cpu, 0x382F));
+  if (cpu->PC != 0x3831) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x3832));
+  cpu->PC = 0x3836; op_jz(cpu, i8080_read_word(cpu, 0x3834));
+  if (cpu->PC != 0x3836) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x3837));
+  cpu->PC = 0x383B; op_jz(cpu, i8080_read_word(cpu, 0x3839));
+  if (cpu->PC != 0x383B) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x383C));
+  cpu->PC = 0x3840; op_jz(cpu, i8080_read_word(cpu, 0x383E));
+  if (cpu->PC != 0x3840) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x3841));
+  cpu->PC = 0x3845; op_jz(cpu, i8080_read_word(cpu, 0x3843));
+  if (cpu->PC != 0x3845) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x3846));
+  cpu->PC = 0x384A; op_jnz(cpu, i8080_read_word(cpu, 0x3848));
+  return 1;
+}
+
+static int block_384D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x384, 0x385, 37)) return 0;
+  op_mov_A_E(cpu, 0);
+  ani(cpu, i8080_read_byte(cpu, 0x384F));
+  cpu->PC = 0x3853; op_jz(cpu, i8080_read_word(cpu, 0x3851));
+  if (cpu->PC != 0x3853) return 1;
+  op_dcx_H(cpu, 0);
+  op_mvi_M(cpu, i8080_read_byte(cpu, 0x3855));
+  cpu->PC = 0x3856;
+  return 1;
+}
+
+static int block_3856(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x385, 0x385, 46)) return 0;
+  op_mov_A_E(cpu, 0);
+  ani(cpu, i8080_read_byte(cpu, 0x3858));
+  cpu->PC = 0x385A; op_rnz(cpu, 0);
+  if (cpu->PC != 0x385A) return 1;
+  op_dcx_H(cpu, 0);
+  op_mov_M_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x385, 0x385)) {
+    cpu->PC = 0x385C;
+    return 1;
+  }
+  cpu->PC = 0x385D; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_385D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x385, 0x386, 44)) return 0;
+  sta(cpu, i8080_read_word(cpu, 0x385E));
+  if (precompiled_changed(cpu, 0x385, 0x386)) {
+    cpu->PC = 0x3860;
+    return 1;
+  }
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x3861));
+  op_mvi_M(cpu, i8080_read_byte(cpu, 0x3864));
+  if (precompiled_changed(cpu, 0x385, 0x386)) {
+    cpu->PC = 0x3865;
+    return 1;
+  }
+  cpu->PC = 0x3866; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_3866(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x386, 0x386, 49)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x386, 0x386)) {
+    cpu->PC = 0x3867;
+    return 1;
+  }
+  sbi(cpu, i8080_read_byte(cpu, 0x3868));
+  op_ral(cpu, 0);
+  op_mov_D_A(cpu, 0);
+  op_inr_D(cpu, 0);
+  cpu->PC = 0x386F; op_call(cpu, i8080_read_word(cpu, 0x386D));
+  return 1;
+}
+
+static int block_386F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x386, 0x387, 60)) return 0;
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x3870));
+  op_add_D(cpu, 0);
+  cpu->PC = 0x3876; op_jm(cpu, i8080_read_word(cpu, 0x3874));
+  if (cpu->PC != 0x3876) return 1;
+  op_inr_D(cpu, 0);
+  op_cmp_D(cpu, 0);
+  cpu->PC = 0x387B; op_jnc(cpu, i8080_read_word(cpu, 0x3879));
+  if (cpu->PC != 0x387B) return 1;
+  op_inr_A(cpu, 0);
+  op_mov_B_A(cpu, 0);
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x387E));
+  cpu->PC = 0x387F;
+  return 1;
+}
+
+static int block_387F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x387, 0x388, 45)) return 0;
+  sui(cpu, i8080_read_byte(cpu, 0x3880));
+  op_pop_H(cpu, 0);
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x387, 0x388)) {
+    cpu->PC = 0x3883;
+    return 1;
+  }
+  cpu->PC = 0x3886; op_call(cpu, i8080_read_word(cpu, 0x3884));
+  return 1;
+}
+
+static int block_3886(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x388, 0x388, 27)) return 0;
+  op_mvi_M(cpu, i8080_read_byte(cpu, 0x3887));
+  if (precompiled_changed(cpu, 0x388, 0x388)) {
+    cpu->PC = 0x3888;
+    return 1;
+  }
+  cpu->PC = 0x388B; op_cz(cpu, i8080_read_word(cpu, 0x3889));
+  return 1;
+}
+
+static int block_388B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x388, 0x388, 17)) return 0;
+  cpu->PC = 0x388E; op_call(cpu, i8080_read_word(cpu, 0x388C));
+  return 1;
+}
+
+static int block_388E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x388, 0x389, 53)) return 0;
+  op_dcx_H(cpu, 0);
+  op_mov_A_M(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x3891));
+  cpu->PC = 0x3895; op_jz(cpu, i8080_read_word(cpu, 0x3893));
+  if (cpu->PC != 0x3895) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x3896));
+  cpu->PC = 0x389A; op_cnz(cpu, i8080_read_word(cpu, 0x3898));
+  return 1;
+}
+
+static int block_389A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x389, 0x389, 20)) return 0;
+  op_pop_PSW(cpu, 0);
+  cpu->PC = 0x389E; op_jz(cpu, i8080_read_word(cpu, 0x389C));
+  return 1;
+}
+
+static int block_38BE(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x38B, 0x38C, 36)) return 0;
+  op_mvi_M(cpu, i8080_read_byte(cpu, 0x38BF));
+  if (precompiled_changed(cpu, 0x38B, 0x38C)) {
+    cpu->PC = 0x38C0;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x38C2));
+  cpu->PC = 0x38C5; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_38F9(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x38F, 0x38F, 5)) return 0;
+  op_inx_H(cpu, 0);
+  cpu->PC = 0x38FA;
+  return 1;
+}
+
+static int block_38FA(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x38F, 0x390, 89)) return 0;
+  lda(cpu, i8080_read_word(cpu, 0x38FB));
+  op_sub_L(cpu, 0);
+  op_sub_D(cpu, 0);
+  cpu->PC = 0x3900; op_rz(cpu, 0);
+  if (cpu->PC != 0x3900) return 1;
+  op_mov_A_M(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x3902));
+  cpu->PC = 0x3906; op_jz(cpu, i8080_read_word(cpu, 0x3904));
+  if (cpu->PC != 0x3906) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x3907));
+  cpu->PC = 0x390B; op_jz(cpu, i8080_read_word(cpu, 0x3909));
+  if (cpu->PC != 0x390B) return 1;
+  op_dcx_H(cpu, 0);
+  op_push_H(cpu, 0);
+  cpu->PC = 0x390D;
+  return 1;
+}
+
+static int block_3A30(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3A3, 0x3A3, 37)) return 0;
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x3A3, 0x3A3)) {
+    cpu->PC = 0x3A31;
+    return 1;
+  }
+  op_xra_A(cpu, 0);
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x3A3, 0x3A3)) {
+    cpu->PC = 0x3A33;
+    return 1;
+  }
+  cpu->PC = 0x3A34; op_rst_6(cpu, 0);
+  return 1;
+}
+
+static int block_3A34(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3A3, 0x3A3, 10)) return 0;
+  cpu->PC = 0x3A37; op_jpo(cpu, i8080_read_word(cpu, 0x3A35));
+  return 1;
+}
+
+static int block_3A37(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3A3, 0x3A4, 67)) return 0;
+  lda(cpu, i8080_read_word(cpu, 0x3A38));
+  cpi(cpu, i8080_read_byte(cpu, 0x3A3B));
+  cpu->PC = 0x3A3F; op_jnc(cpu, i8080_read_word(cpu, 0x3A3D));
+  if (cpu->PC != 0x3A3F) return 1;
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x3A40));
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x3A43));
+  cpu->PC = 0x3A48; op_call(cpu, i8080_read_word(cpu, 0x3A46));
+  return 1;
+}
+
+static int block_3A52(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3A5, 0x3A5, 17)) return 0;
+  cpu->PC = 0x3A55; op_call(cpu, i8080_read_word(cpu, 0x3A53));
+  return 1;
+}
+
+static int block_3A55(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3A5, 0x3A5, 11)) return 0;
+  cpu->PC = 0x3A56; op_rst_6(cpu, 0);
+  return 1;
+}
+
+static int block_3A56(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3A5, 0x3A6, 47)) return 0;
+  cpu->PC = 0x3A59; op_jpe(cpu, i8080_read_word(cpu, 0x3A57));
+  if (cpu->PC != 0x3A59) return 1;
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x3A5A));
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x3A5D));
+  cpu->PC = 0x3A62; op_call(cpu, i8080_read_word(cpu, 0x3A60));
+  return 1;
+}
+
+static int block_3A62(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3A6, 0x3A6, 10)) return 0;
+  cpu->PC = 0x3A65; op_jmp(cpu, i8080_read_word(cpu, 0x3A63));
+  return 1;
+}
+
+static int block_3A65(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3A6, 0x3A6, 27)) return 0;
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x3A66));
+  cpu->PC = 0x3A6B; op_call(cpu, i8080_read_word(cpu, 0x3A69));
+  return 1;
+}
+
+static int block_3A6B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3A6, 0x3A7, 37)) return 0;
+  cpu->PC = 0x3A6E; op_jp(cpu, i8080_read_word(cpu, 0x3A6C));
+  if (cpu->PC != 0x3A6E) return 1;
+  op_pop_PSW(cpu, 0);
+  cpu->PC = 0x3A72; op_call(cpu, i8080_read_word(cpu, 0x3A70));
+  return 1;
+}
+
+static int block_3A72(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3A7, 0x3A7, 21)) return 0;
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x3A7, 0x3A7)) {
+    cpu->PC = 0x3A73;
+    return 1;
+  }
+  cpu->PC = 0x3A76; op_jmp(cpu, i8080_read_word(cpu, 0x3A74));
+  return 1;
+}
+
+static int block_3A7E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3A7, 0x3A8, 31)) return 0;
+  op_pop_PSW(cpu, 0);
+  op_pop_D(cpu, 0);
+  cpu->PC = 0x3A81; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_3A81(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3A8, 0x3A8, 11)) return 0;
+  cpu->PC = 0x3A82; op_rst_6(cpu, 0);
+  return 1;
+}
+
+static int block_3A82(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3A8, 0x3A8, 47)) return 0;
+  cpu->PC = 0x3A85; op_jpe(cpu, i8080_read_word(cpu, 0x3A83));
+  if (cpu->PC != 0x3A85) return 1;
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x3A86));
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x3A89));
+  cpu->PC = 0x3A8E; op_call(cpu, i8080_read_word(cpu, 0x3A8C));
+  return 1;
+}
+
+static int block_3A8E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3A8, 0x3A9, 10)) return 0;
+  cpu->PC = 0x3A91; op_jmp(cpu, i8080_read_word(cpu, 0x3A8F));
+  return 1;
+}
+
+static int block_3A97(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3A9, 0x3A9, 25)) return 0;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x3A9B; op_jp(cpu, i8080_read_word(cpu, 0x3A99));
+  if (cpu->PC != 0x3A9B) return 1;
+  cpu->PC = 0x3A9C; op_pchl(cpu, 0);
+  return 1;
+}
+
+static int block_3A9D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3A9, 0x3AA, 41)) return 0;
+  cpu->PC = 0x3A9E; op_rz(cpu, 0);
+  if (cpu->PC != 0x3A9E) return 1;
+  op_dcr_A(cpu, 0);
+  op_mvi_M(cpu, i8080_read_byte(cpu, 0x3AA0));
+  if (precompiled_changed(cpu, 0x3A9, 0x3AA)) {
+    cpu->PC = 0x3AA1;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  cpu->PC = 0x3AA5; op_jmp(cpu, i8080_read_word(cpu, 0x3AA3));
+  return 1;
+}
+
+static int block_3AB8(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3AB, 0x3AB, 29)) return 0;
+  sui(cpu, i8080_read_byte(cpu, 0x3AB9));
+  cpu->PC = 0x3ABD; op_jnc(cpu, i8080_read_word(cpu, 0x3ABB));
+  if (cpu->PC != 0x3ABD) return 1;
+  adi(cpu, i8080_read_byte(cpu, 0x3ABE));
+  op_mov_C_A(cpu, 0);
+  cpu->PC = 0x3AC0;
+  return 1;
+}
+
+static int block_3AC8(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3AC, 0x3AC, 15)) return 0;
+  op_dcr_B(cpu, 0);
+  cpu->PC = 0x3ACC; op_jnz(cpu, i8080_read_word(cpu, 0x3ACA));
+  return 1;
+}
+
+static int block_3ACC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3AC, 0x3AD, 47)) return 0;
+  op_mvi_M(cpu, i8080_read_byte(cpu, 0x3ACD));
+  if (precompiled_changed(cpu, 0x3AC, 0x3AD)) {
+    cpu->PC = 0x3ACE;
+    return 1;
+  }
+  shld(cpu, i8080_read_word(cpu, 0x3ACF));
+  if (precompiled_changed(cpu, 0x3AC, 0x3AD)) {
+    cpu->PC = 0x3AD1;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_mov_C_B(cpu, 0);
+  cpu->PC = 0x3AD4; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_3AD4(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3AD, 0x3AD, 49)) return 0;
+  op_dcr_C(cpu, 0);
+  cpu->PC = 0x3AD6; op_rnz(cpu, 0);
+  if (cpu->PC != 0x3AD6) return 1;
+  op_mvi_M(cpu, i8080_read_byte(cpu, 0x3AD7));
+  if (precompiled_changed(cpu, 0x3AD, 0x3AD)) {
+    cpu->PC = 0x3AD8;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_mvi_C(cpu, i8080_read_byte(cpu, 0x3ADA));
+  cpu->PC = 0x3ADC; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_3ADC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3AD, 0x3AD, 22)) return 0;
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x3AD, 0x3AD)) {
+    cpu->PC = 0x3ADD;
+    return 1;
+  }
+  cpu->PC = 0x3ADE; op_rst_6(cpu, 0);
+  return 1;
+}
+
+static int block_3ADE(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3AD, 0x3AE, 49)) return 0;
+  cpu->PC = 0x3AE1; op_jpo(cpu, i8080_read_word(cpu, 0x3ADF));
+  if (cpu->PC != 0x3AE1) return 1;
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x3AD, 0x3AE)) {
+    cpu->PC = 0x3AE2;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x3AD, 0x3AE)) {
+    cpu->PC = 0x3AE3;
+    return 1;
+  }
+  cpu->PC = 0x3AE6; op_call(cpu, i8080_read_word(cpu, 0x3AE4));
+  return 1;
+}
+
+static int block_3AFA(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3AF, 0x3AF, 17)) return 0;
+  cpu->PC = 0x3AFD; op_call(cpu, i8080_read_word(cpu, 0x3AFB));
+  return 1;
+}
+
+static int block_3AFD(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3AF, 0x3B0, 51)) return 0;
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x3AF, 0x3B0)) {
+    cpu->PC = 0x3AFE;
+    return 1;
+  }
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x3AF, 0x3B0)) {
+    cpu->PC = 0x3AFF;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x3AF, 0x3B0)) {
+    cpu->PC = 0x3B00;
+    return 1;
+  }
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x3AF, 0x3B0)) {
+    cpu->PC = 0x3B01;
+    return 1;
+  }
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x3B02));
+  cpu->PC = 0x3B03;
+  return 1;
+}
+
+static int block_3B03(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3B0, 0x3B0, 50)) return 0;
+  op_inr_B(cpu, 0);
+  op_pop_H(cpu, 0);
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x3B0, 0x3B0)) {
+    cpu->PC = 0x3B06;
+    return 1;
+  }
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x3B07));
+  cpu->PC = 0x3B0B; op_call(cpu, i8080_read_word(cpu, 0x3B09));
+  return 1;
+}
+
+static int block_3B0B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3B0, 0x3B1, 44)) return 0;
+  cpu->PC = 0x3B0E; op_jnc(cpu, i8080_read_word(cpu, 0x3B0C));
+  if (cpu->PC != 0x3B0E) return 1;
+  op_pop_H(cpu, 0);
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x3B10));
+  cpu->PC = 0x3B14; op_call(cpu, i8080_read_word(cpu, 0x3B12));
+  return 1;
+}
+
+static int block_3B14(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3B1, 0x3B2, 111)) return 0;
+  op_xchg(cpu, 0);
+  op_pop_H(cpu, 0);
+  op_mov_M_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x3B1, 0x3B2)) {
+    cpu->PC = 0x3B17;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_pop_PSW(cpu, 0);
+  op_pop_B(cpu, 0);
+  op_dcr_A(cpu, 0);
+  cpu->PC = 0x3B1E; op_jnz(cpu, i8080_read_word(cpu, 0x3B1C));
+  if (cpu->PC != 0x3B1E) return 1;
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x3B1, 0x3B2)) {
+    cpu->PC = 0x3B1F;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x3B1, 0x3B2)) {
+    cpu->PC = 0x3B20;
+    return 1;
+  }
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x3B21));
+  cpu->PC = 0x3B26; op_call(cpu, i8080_read_word(cpu, 0x3B24));
+  return 1;
+}
+
+static int block_3B29(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3B2, 0x3B2, 39)) return 0;
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x3B2, 0x3B2)) {
+    cpu->PC = 0x3B2A;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x3B2, 0x3B2)) {
+    cpu->PC = 0x3B2B;
+    return 1;
+  }
+  cpu->PC = 0x3B2E; op_call(cpu, i8080_read_word(cpu, 0x3B2C));
+  return 1;
+}
+
+static int block_3B2E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3B2, 0x3B3, 22)) return 0;
+  op_inr_A(cpu, 0);
+  cpu->PC = 0x3B32; op_call(cpu, i8080_read_word(cpu, 0x3B30));
+  return 1;
+}
+
+static int block_3B32(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3B3, 0x3B3, 17)) return 0;
+  cpu->PC = 0x3B35; op_call(cpu, i8080_read_word(cpu, 0x3B33));
+  return 1;
+}
+
+static int block_3B35(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3B3, 0x3B3, 34)) return 0;
+  op_pop_H(cpu, 0);
+  op_pop_B(cpu, 0);
+  op_xra_A(cpu, 0);
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x3B39));
+  cpu->PC = 0x3B3B;
+  return 1;
+}
+
+static int block_3B3B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3B3, 0x3B3, 21)) return 0;
+  op_cmc(cpu, 0);
+  cpu->PC = 0x3B3F; op_call(cpu, i8080_read_word(cpu, 0x3B3D));
+  return 1;
+}
+
+static int block_3B3F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3B3, 0x3B4, 61)) return 0;
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x3B3, 0x3B4)) {
+    cpu->PC = 0x3B40;
+    return 1;
+  }
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x3B3, 0x3B4)) {
+    cpu->PC = 0x3B41;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x3B3, 0x3B4)) {
+    cpu->PC = 0x3B42;
+    return 1;
+  }
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x3B3, 0x3B4)) {
+    cpu->PC = 0x3B43;
+    return 1;
+  }
+  cpu->PC = 0x3B46; op_call(cpu, i8080_read_word(cpu, 0x3B44));
+  return 1;
+}
+
+static int block_3B46(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3B4, 0x3B4, 17)) return 0;
+  op_pop_H(cpu, 0);
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x3B48));
+  cpu->PC = 0x3B49;
+  return 1;
+}
+
+static int block_3B49(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3B4, 0x3B5, 103)) return 0;
+  op_inr_B(cpu, 0);
+  op_mov_A_E(cpu, 0);
+  op_sub_M(cpu, 0);
+  op_mov_E_A(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_A_D(cpu, 0);
+  op_sbb_M(cpu, 0);
+  op_mov_D_A(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_A_C(cpu, 0);
+  op_sbb_M(cpu, 0);
+  op_mov_C_A(cpu, 0);
+  op_dcx_H(cpu, 0);
+  op_dcx_H(cpu, 0);
+  cpu->PC = 0x3B5A; op_jnc(cpu, i8080_read_word(cpu, 0x3B58));
+  if (cpu->PC != 0x3B5A) return 1;
+  cpu->PC = 0x3B5D; op_call(cpu, i8080_read_word(cpu, 0x3B5B));
+  return 1;
+}
+
+static int block_3B5D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3B5, 0x3B6, 22)) return 0;
+  op_inx_H(cpu, 0);
+  cpu->PC = 0x3B61; op_call(cpu, i8080_read_word(cpu, 0x3B5F));
+  return 1;
+}
+
+static int block_3B61(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3B6, 0x3B7, 84)) return 0;
+  op_xchg(cpu, 0);
+  op_pop_H(cpu, 0);
+  op_mov_M_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x3B6, 0x3B7)) {
+    cpu->PC = 0x3B64;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_pop_PSW(cpu, 0);
+  op_pop_B(cpu, 0);
+  cpu->PC = 0x3B6A; op_jc(cpu, i8080_read_word(cpu, 0x3B68));
+  if (cpu->PC != 0x3B6A) return 1;
+  op_inx_D(cpu, 0);
+  op_inx_D(cpu, 0);
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x3B6D));
+  cpu->PC = 0x3B71; op_jmp(cpu, i8080_read_word(cpu, 0x3B6F));
+  return 1;
+}
+
+static int block_3B71(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3B7, 0x3B7, 28)) return 0;
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x3B7, 0x3B7)) {
+    cpu->PC = 0x3B72;
+    return 1;
+  }
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x3B73));
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x3B76));
+  cpu->PC = 0x3B77;
+  return 1;
+}
+
+static int block_3B77(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3B7, 0x3B7, 17)) return 0;
+  cpu->PC = 0x3B7A; op_call(cpu, i8080_read_word(cpu, 0x3B78));
+  return 1;
+}
+
+static int block_3B7A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3B7, 0x3B8, 119)) return 0;
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x3B7, 0x3B8)) {
+    cpu->PC = 0x3B7B;
+    return 1;
+  }
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x3B7, 0x3B8)) {
+    cpu->PC = 0x3B7C;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x3B7, 0x3B8)) {
+    cpu->PC = 0x3B7D;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  op_mov_C_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_B_M(cpu, 0);
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x3B7, 0x3B8)) {
+    cpu->PC = 0x3B82;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_xthl(cpu, 0);
+  if (precompiled_changed(cpu, 0x3B7, 0x3B8)) {
+    cpu->PC = 0x3B84;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  ldhd(cpu, i8080_read_word(cpu, 0x3B86));
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x3B89));
+  cpu->PC = 0x3B8A;
+  return 1;
+}
+
+static int block_3B8A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3B8, 0x3BA, 153)) return 0;
+  op_inr_B(cpu, 0);
+  op_mov_A_L(cpu, 0);
+  op_sub_E(cpu, 0);
+  op_mov_L_A(cpu, 0);
+  op_mov_A_H(cpu, 0);
+  op_sbb_D(cpu, 0);
+  op_mov_H_A(cpu, 0);
+  cpu->PC = 0x3B94; op_jnc(cpu, i8080_read_word(cpu, 0x3B92));
+  if (cpu->PC != 0x3B94) return 1;
+  op_dad_D(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x3B96));
+  if (precompiled_changed(cpu, 0x3B8, 0x3BA)) {
+    cpu->PC = 0x3B98;
+    return 1;
+  }
+  op_pop_D(cpu, 0);
+  op_pop_H(cpu, 0);
+  op_mov_M_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x3B8, 0x3BA)) {
+    cpu->PC = 0x3B9B;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_pop_PSW(cpu, 0);
+  op_pop_B(cpu, 0);
+  op_dcr_A(cpu, 0);
+  cpu->PC = 0x3BA2; op_jnz(cpu, i8080_read_word(cpu, 0x3BA0));
+  if (cpu->PC != 0x3BA2) return 1;
+  cpu->PC = 0x3BA5; op_call(cpu, i8080_read_word(cpu, 0x3BA3));
+  return 1;
+}
+
+static int block_3BA5(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3BA, 0x3BA, 28)) return 0;
+  op_mov_M_A(cpu, 0);
+  if (precompiled_changed(cpu, 0x3BA, 0x3BA)) {
+    cpu->PC = 0x3BA6;
+    return 1;
+  }
+  op_pop_D(cpu, 0);
+  cpu->PC = 0x3BA8; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_3D0E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3D0, 0x3D1, 76)) return 0;
+  op_pop_B(cpu, 0);
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x3D10));
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x3D0, 0x3D1)) {
+    cpu->PC = 0x3D13;
+    return 1;
+  }
+  op_xra_A(cpu, 0);
+  op_stax_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x3D0, 0x3D1)) {
+    cpu->PC = 0x3D15;
+    return 1;
+  }
+  op_dcr_B(cpu, 0);
+  op_inr_B(cpu, 0);
+  op_mvi_C(cpu, i8080_read_byte(cpu, 0x3D18));
+  cpu->PC = 0x3D1C; op_jz(cpu, i8080_read_word(cpu, 0x3D1A));
+  if (cpu->PC != 0x3D1C) return 1;
+  op_mvi_C(cpu, i8080_read_byte(cpu, 0x3D1D));
+  cpu->PC = 0x3D1E;
+  return 1;
+}
+
+static int block_3D1E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3D1, 0x3D1, 14)) return 0;
+  op_dad_H(cpu, 0);
+  op_adc_A(cpu, 0);
+  cpu->PC = 0x3D20;
+  return 1;
+}
+
+static int block_3D20(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3D2, 0x3D2, 28)) return 0;
+  op_dad_H(cpu, 0);
+  op_adc_A(cpu, 0);
+  op_dad_H(cpu, 0);
+  op_adc_A(cpu, 0);
+  cpu->PC = 0x3D24;
+  return 1;
+}
+
+static int block_3D24(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3D2, 0x3D3, 73)) return 0;
+  op_dad_H(cpu, 0);
+  op_adc_A(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x3D2A; op_jnz(cpu, i8080_read_word(cpu, 0x3D28));
+  if (cpu->PC != 0x3D2A) return 1;
+  op_mov_A_C(cpu, 0);
+  op_dcr_A(cpu, 0);
+  cpu->PC = 0x3D2F; op_jz(cpu, i8080_read_word(cpu, 0x3D2D));
+  if (cpu->PC != 0x3D2F) return 1;
+  op_ldax_D(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x3D34; op_jz(cpu, i8080_read_word(cpu, 0x3D32));
+  if (cpu->PC != 0x3D34) return 1;
+  op_xra_A(cpu, 0);
+  cpu->PC = 0x3D35;
+  return 1;
+}
+
+static int block_3D35(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3D3, 0x3D3, 31)) return 0;
+  adi(cpu, i8080_read_byte(cpu, 0x3D36));
+  cpi(cpu, i8080_read_byte(cpu, 0x3D38));
+  cpu->PC = 0x3D3C; op_jc(cpu, i8080_read_word(cpu, 0x3D3A));
+  if (cpu->PC != 0x3D3C) return 1;
+  adi(cpu, i8080_read_byte(cpu, 0x3D3D));
+  cpu->PC = 0x3D3E;
+  return 1;
+}
+
+static int block_3D3E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3D3, 0x3D3, 7)) return 0;
+  op_stax_D(cpu, 0);
+  cpu->PC = 0x3D3F;
+  return 1;
+}
+
+static int block_3D3F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3D3, 0x3D4, 12)) return 0;
+  op_inx_D(cpu, 0);
+  op_stax_D(cpu, 0);
+  cpu->PC = 0x3D41;
+  return 1;
+}
+
+static int block_3D41(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3D4, 0x3D4, 49)) return 0;
+  op_xra_A(cpu, 0);
+  op_dcr_C(cpu, 0);
+  cpu->PC = 0x3D46; op_jz(cpu, i8080_read_word(cpu, 0x3D44));
+  if (cpu->PC != 0x3D46) return 1;
+  op_dcr_B(cpu, 0);
+  op_inr_B(cpu, 0);
+  cpu->PC = 0x3D4B; op_jz(cpu, i8080_read_word(cpu, 0x3D49));
+  if (cpu->PC != 0x3D4B) return 1;
+  cpu->PC = 0x3D4E; op_jmp(cpu, i8080_read_word(cpu, 0x3D4C));
+  return 1;
+}
+
+static int block_3D4E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3D4, 0x3D5, 28)) return 0;
+  op_stax_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x3D4, 0x3D5)) {
+    cpu->PC = 0x3D4F;
+    return 1;
+  }
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x3D51; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_3D62(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3D6, 0x3D6, 17)) return 0;
+  cpu->PC = 0x3D65; op_call(cpu, i8080_read_word(cpu, 0x3D63));
+  return 1;
+}
+
+static int block_3D65(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3D6, 0x3D6, 31)) return 0;
+  op_pop_B(cpu, 0);
+  op_pop_D(cpu, 0);
+  cpu->PC = 0x3D68; op_rst_5(cpu, 0);
+  return 1;
+}
+
+static int block_3D68(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3D6, 0x3D7, 39)) return 0;
+  op_mov_A_B(cpu, 0);
+  cpu->PC = 0x3D6C; op_jz(cpu, i8080_read_word(cpu, 0x3D6A));
+  if (cpu->PC != 0x3D6C) return 1;
+  cpu->PC = 0x3D6F; op_jp(cpu, i8080_read_word(cpu, 0x3D6D));
+  if (cpu->PC != 0x3D6F) return 1;
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x3D73; op_jz(cpu, i8080_read_word(cpu, 0x3D71));
+  return 1;
+}
+
+static int block_3D73(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3D7, 0x3D7, 65)) return 0;
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x3D77; op_jz(cpu, i8080_read_word(cpu, 0x3D75));
+  if (cpu->PC != 0x3D77) return 1;
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x3D7, 0x3D7)) {
+    cpu->PC = 0x3D78;
+    return 1;
+  }
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x3D7, 0x3D7)) {
+    cpu->PC = 0x3D79;
+    return 1;
+  }
+  op_mov_A_C(cpu, 0);
+  ori(cpu, i8080_read_byte(cpu, 0x3D7B));
+  cpu->PC = 0x3D7F; op_call(cpu, i8080_read_word(cpu, 0x3D7D));
+  return 1;
+}
+
+static int block_3D7F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3D7, 0x3D8, 49)) return 0;
+  cpu->PC = 0x3D82; op_jp(cpu, i8080_read_word(cpu, 0x3D80));
+  if (cpu->PC != 0x3D82) return 1;
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x3D7, 0x3D8)) {
+    cpu->PC = 0x3D83;
+    return 1;
+  }
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x3D7, 0x3D8)) {
+    cpu->PC = 0x3D84;
+    return 1;
+  }
+  cpu->PC = 0x3D87; op_call(cpu, i8080_read_word(cpu, 0x3D85));
+  return 1;
+}
+
+static int block_3D90(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3D9, 0x3D9, 69)) return 0;
+  op_pop_H(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x3D92));
+  if (precompiled_changed(cpu, 0x3D9, 0x3D9)) {
+    cpu->PC = 0x3D94;
+    return 1;
+  }
+  op_pop_H(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x3D96));
+  if (precompiled_changed(cpu, 0x3D9, 0x3D9)) {
+    cpu->PC = 0x3D98;
+    return 1;
+  }
+  cpu->PC = 0x3D9B; op_cc(cpu, i8080_read_word(cpu, 0x3D99));
+  return 1;
+}
+
+static int block_3D9B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3D9, 0x3D9, 17)) return 0;
+  cpu->PC = 0x3D9E; op_cz(cpu, i8080_read_word(cpu, 0x3D9C));
+  return 1;
+}
+
+static int block_3D9E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3D9, 0x3DA, 39)) return 0;
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x3D9, 0x3DA)) {
+    cpu->PC = 0x3D9F;
+    return 1;
+  }
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x3D9, 0x3DA)) {
+    cpu->PC = 0x3DA0;
+    return 1;
+  }
+  cpu->PC = 0x3DA3; op_call(cpu, i8080_read_word(cpu, 0x3DA1));
+  return 1;
+}
+
+static int block_3DA3(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3DA, 0x3DA, 37)) return 0;
+  op_pop_B(cpu, 0);
+  op_pop_D(cpu, 0);
+  cpu->PC = 0x3DA8; op_call(cpu, i8080_read_word(cpu, 0x3DA6));
+  return 1;
+}
+
+static int block_3DA8(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3DA, 0x3DA, 17)) return 0;
+  cpu->PC = 0x3DAB; op_call(cpu, i8080_read_word(cpu, 0x3DA9));
+  return 1;
+}
+
+static int block_3DAB(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3DA, 0x3DB, 37)) return 0;
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x3DAC));
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x3DAF));
+  cpu->PC = 0x3DB4; op_call(cpu, i8080_read_word(cpu, 0x3DB2));
+  return 1;
+}
+
+static int block_3DB4(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3DB, 0x3DB, 47)) return 0;
+  lda(cpu, i8080_read_word(cpu, 0x3DB5));
+  cpi(cpu, i8080_read_byte(cpu, 0x3DB8));
+  cpu->PC = 0x3DBC; op_jnc(cpu, i8080_read_word(cpu, 0x3DBA));
+  if (cpu->PC != 0x3DBC) return 1;
+  cpu->PC = 0x3DBF; op_call(cpu, i8080_read_word(cpu, 0x3DBD));
+  return 1;
+}
+
+static int block_3DBF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3DB, 0x3DC, 62)) return 0;
+  adi(cpu, i8080_read_byte(cpu, 0x3DC0));
+  adi(cpu, i8080_read_byte(cpu, 0x3DC2));
+  cpu->PC = 0x3DC6; op_jc(cpu, i8080_read_word(cpu, 0x3DC4));
+  if (cpu->PC != 0x3DC6) return 1;
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x3DB, 0x3DC)) {
+    cpu->PC = 0x3DC7;
+    return 1;
+  }
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x3DC8));
+  cpu->PC = 0x3DCD; op_call(cpu, i8080_read_word(cpu, 0x3DCB));
+  return 1;
+}
+
+static int block_3DCD(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3DC, 0x3DC, 17)) return 0;
+  cpu->PC = 0x3DD0; op_call(cpu, i8080_read_word(cpu, 0x3DCE));
+  return 1;
+}
+
+static int block_3DD0(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3DD, 0x3DD, 58)) return 0;
+  op_pop_PSW(cpu, 0);
+  op_pop_B(cpu, 0);
+  op_pop_D(cpu, 0);
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x3DD, 0x3DD)) {
+    cpu->PC = 0x3DD4;
+    return 1;
+  }
+  cpu->PC = 0x3DD7; op_call(cpu, i8080_read_word(cpu, 0x3DD5));
+  return 1;
+}
+
+static int block_3DD7(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3DD, 0x3DD, 17)) return 0;
+  cpu->PC = 0x3DDA; op_call(cpu, i8080_read_word(cpu, 0x3DD8));
+  return 1;
+}
+
+static int block_3DDA(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3DD, 0x3DD, 27)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x3DDB));
+  cpu->PC = 0x3DE0; op_call(cpu, i8080_read_word(cpu, 0x3DDE));
+  return 1;
+}
+
+static int block_3DE0(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3DE, 0x3DE, 35)) return 0;
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x3DE1));
+  op_pop_B(cpu, 0);
+  op_mov_C_D(cpu, 0);
+  cpu->PC = 0x3DE8; op_jmp(cpu, i8080_read_word(cpu, 0x3DE6));
+  return 1;
+}
+
+static int block_3E09(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3E0, 0x3E0, 17)) return 0;
+  cpu->PC = 0x3E0C; op_call(cpu, i8080_read_word(cpu, 0x3E0A));
+  return 1;
+}
+
+static int block_3E0C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3E0, 0x3E1, 49)) return 0;
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x3E0D));
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x3E0, 0x3E1)) {
+    cpu->PC = 0x3E10;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x3E0, 0x3E1)) {
+    cpu->PC = 0x3E11;
+    return 1;
+  }
+  cpu->PC = 0x3E14; op_call(cpu, i8080_read_word(cpu, 0x3E12));
+  return 1;
+}
+
+static int block_3E14(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3E1, 0x3E1, 17)) return 0;
+  cpu->PC = 0x3E17; op_call(cpu, i8080_read_word(cpu, 0x3E15));
+  return 1;
+}
+
+static int block_3E17(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3E1, 0x3E1, 10)) return 0;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x3E18;
+  return 1;
+}
+
+static int block_3E18(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3E1, 0x3E1, 17)) return 0;
+  cpu->PC = 0x3E1B; op_call(cpu, i8080_read_word(cpu, 0x3E19));
+  return 1;
+}
+
+static int block_3E1B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3E1, 0x3E1, 29)) return 0;
+  op_mov_A_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  cpu->PC = 0x3E20; op_call(cpu, i8080_read_word(cpu, 0x3E1E));
+  return 1;
+}
+
+static int block_3E20(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3E2, 0x3E2, 104)) return 0;
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x3E21));
+  op_pop_B(cpu, 0);
+  op_pop_D(cpu, 0);
+  op_dcr_A(cpu, 0);
+  cpu->PC = 0x3E26; op_rz(cpu, 0);
+  if (cpu->PC != 0x3E26) return 1;
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x3E2, 0x3E2)) {
+    cpu->PC = 0x3E27;
+    return 1;
+  }
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x3E2, 0x3E2)) {
+    cpu->PC = 0x3E28;
+    return 1;
+  }
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x3E2, 0x3E2)) {
+    cpu->PC = 0x3E29;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x3E2, 0x3E2)) {
+    cpu->PC = 0x3E2A;
+    return 1;
+  }
+  cpu->PC = 0x3E2D; op_call(cpu, i8080_read_word(cpu, 0x3E2B));
+  return 1;
+}
+
+static int block_3E21(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3E2, 0x3E2, 107)) return 0;
+  op_pop_PSW(cpu, 0);
+  op_pop_B(cpu, 0);
+  op_pop_D(cpu, 0);
+  op_dcr_A(cpu, 0);
+  cpu->PC = 0x3E26; op_rz(cpu, 0);
+  if (cpu->PC != 0x3E26) return 1;
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x3E2, 0x3E2)) {
+    cpu->PC = 0x3E27;
+    return 1;
+  }
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x3E2, 0x3E2)) {
+    cpu->PC = 0x3E28;
+    return 1;
+  }
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x3E2, 0x3E2)) {
+    cpu->PC = 0x3E29;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x3E2, 0x3E2)) {
+    cpu->PC = 0x3E2A;
+    return 1;
+  }
+  cpu->PC = 0x3E2D; op_call(cpu, i8080_read_word(cpu, 0x3E2B));
+  return 1;
+}
+
+static int block_3E2D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3E2, 0x3E3, 27)) return 0;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x3E31; op_call(cpu, i8080_read_word(cpu, 0x3E2F));
+  return 1;
+}
+
+static int block_3E31(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3E3, 0x3E3, 28)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x3E3, 0x3E3)) {
+    cpu->PC = 0x3E32;
+    return 1;
+  }
+  cpu->PC = 0x3E35; op_call(cpu, i8080_read_word(cpu, 0x3E33));
+  return 1;
+}
+
+static int block_3E35(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3E3, 0x3E3, 20)) return 0;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x3E39; op_jmp(cpu, i8080_read_word(cpu, 0x3E37));
+  return 1;
+}
+
+static int block_3ED3(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3ED, 0x3ED, 27)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x3ED4));
+  cpu->PC = 0x3ED9; op_call(cpu, i8080_read_word(cpu, 0x3ED7));
+  return 1;
+}
+
+static int block_3ED9(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3ED, 0x3ED, 17)) return 0;
+  cpu->PC = 0x3EDC; op_call(cpu, i8080_read_word(cpu, 0x3EDA));
+  return 1;
+}
+
+static int block_3EDC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3ED, 0x3EE, 37)) return 0;
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x3EDD));
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x3EE0));
+  cpu->PC = 0x3EE5; op_call(cpu, i8080_read_word(cpu, 0x3EE3));
+  return 1;
+}
+
+static int block_3EE5(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3EE, 0x3EE, 37)) return 0;
+  op_pop_B(cpu, 0);
+  op_pop_D(cpu, 0);
+  cpu->PC = 0x3EEA; op_call(cpu, i8080_read_word(cpu, 0x3EE8));
+  return 1;
+}
+
+static int block_3EEA(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3EE, 0x3EE, 17)) return 0;
+  cpu->PC = 0x3EED; op_call(cpu, i8080_read_word(cpu, 0x3EEB));
+  return 1;
+}
+
+static int block_3EED(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3EE, 0x3EE, 17)) return 0;
+  cpu->PC = 0x3EF0; op_call(cpu, i8080_read_word(cpu, 0x3EEE));
+  return 1;
+}
+
+static int block_3EF0(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3EF, 0x3EF, 37)) return 0;
+  op_pop_B(cpu, 0);
+  op_pop_D(cpu, 0);
+  cpu->PC = 0x3EF5; op_call(cpu, i8080_read_word(cpu, 0x3EF3));
+  return 1;
+}
+
+static int block_3EF5(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3EF, 0x3EF, 27)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x3EF6));
+  cpu->PC = 0x3EFB; op_call(cpu, i8080_read_word(cpu, 0x3EF9));
+  return 1;
+}
+
+static int block_3EFB(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3EF, 0x3EF, 11)) return 0;
+  cpu->PC = 0x3EFC; op_rst_5(cpu, 0);
+  return 1;
+}
+
+static int block_3EFC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3EF, 0x3F0, 31)) return 0;
+  op_stc(cpu, 0);
+  cpu->PC = 0x3F00; op_jp(cpu, i8080_read_word(cpu, 0x3EFE));
+  if (cpu->PC != 0x3F00) return 1;
+  cpu->PC = 0x3F03; op_call(cpu, i8080_read_word(cpu, 0x3F01));
+  return 1;
+}
+
+static int block_3F03(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3F0, 0x3F0, 11)) return 0;
+  cpu->PC = 0x3F04; op_rst_5(cpu, 0);
+  return 1;
+}
+
+static int block_3F04(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3F0, 0x3F0, 4)) return 0;
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x3F05;
+  return 1;
+}
+
+static int block_3F05(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3F0, 0x3F0, 28)) return 0;
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x3F0, 0x3F0)) {
+    cpu->PC = 0x3F06;
+    return 1;
+  }
+  cpu->PC = 0x3F09; op_cp(cpu, i8080_read_word(cpu, 0x3F07));
+  return 1;
+}
+
+static int block_3F09(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3F0, 0x3F0, 27)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x3F0A));
+  cpu->PC = 0x3F0F; op_call(cpu, i8080_read_word(cpu, 0x3F0D));
+  return 1;
+}
+
+static int block_3F0F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3F0, 0x3F1, 27)) return 0;
+  op_pop_PSW(cpu, 0);
+  cpu->PC = 0x3F13; op_cnc(cpu, i8080_read_word(cpu, 0x3F11));
+  return 1;
+}
+
+static int block_3F13(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x3F1, 0x3F1, 20)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x3F14));
+  cpu->PC = 0x3F19; op_jmp(cpu, i8080_read_word(cpu, 0x3F17));
+  return 1;
+}
+
+static int block_4099(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x409, 0x409, 11)) return 0;
+  op_push_H(cpu, 0);
+  cpu->PC = 0x409A;
+  return 1;
+}
+
+static int block_409A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x409, 0x40A, 65)) return 0;
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x409, 0x40A)) {
+    cpu->PC = 0x409B;
+    return 1;
+  }
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x409, 0x40A)) {
+    cpu->PC = 0x409C;
+    return 1;
+  }
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x409D));
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x409, 0x40A)) {
+    cpu->PC = 0x40A0;
+    return 1;
+  }
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x409, 0x40A)) {
+    cpu->PC = 0x40A1;
+    return 1;
+  }
+  cpu->PC = 0x40A2; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_40A2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x40A, 0x40A, 56)) return 0;
+  op_pop_PSW(cpu, 0);
+  op_pop_B(cpu, 0);
+  op_dcr_A(cpu, 0);
+  cpu->PC = 0x40A8; op_jp(cpu, i8080_read_word(cpu, 0x40A6));
+  if (cpu->PC != 0x40A8) return 1;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x40AA; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_40BC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x40B, 0x40C, 43)) return 0;
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x40B, 0x40C)) {
+    cpu->PC = 0x40BD;
+    return 1;
+  }
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x40B, 0x40C)) {
+    cpu->PC = 0x40BE;
+    return 1;
+  }
+  op_xra_A(cpu, 0);
+  cpu->PC = 0x40C2; op_call(cpu, i8080_read_word(cpu, 0x40C0));
+  return 1;
+}
+
+static int block_40C2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x40C, 0x40C, 35)) return 0;
+  op_pop_B(cpu, 0);
+  op_pop_D(cpu, 0);
+  op_xra_A(cpu, 0);
+  cpu->PC = 0x40C6; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_40C6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x40C, 0x40D, 43)) return 0;
+  op_lxi_B(cpu, i8080_read_word(cpu, 0x40C7));
+  cpu->PC = 0x40CC; op_jnz(cpu, i8080_read_word(cpu, 0x40CA));
+  if (cpu->PC != 0x40CC) return 1;
+  lda(cpu, i8080_read_word(cpu, 0x40CD));
+  cpu->PC = 0x40D2; op_jmp(cpu, i8080_read_word(cpu, 0x40D0));
+  return 1;
+}
+
+static int block_40D2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x40D, 0x40D, 60)) return 0;
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x40D, 0x40D)) {
+    cpu->PC = 0x40D3;
+    return 1;
+  }
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x40D, 0x40D)) {
+    cpu->PC = 0x40D4;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x40D, 0x40D)) {
+    cpu->PC = 0x40D5;
+    return 1;
+  }
+  lda(cpu, i8080_read_word(cpu, 0x40D6));
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x40DC; op_jz(cpu, i8080_read_word(cpu, 0x40DA));
+  return 1;
+}
+
+static int block_40E5(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x40E, 0x40E, 41)) return 0;
+  op_pop_H(cpu, 0);
+  op_pop_B(cpu, 0);
+  op_pop_D(cpu, 0);
+  cpu->PC = 0x40E9; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_4596(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x459, 0x459, 17)) return 0;
+  cpu->PC = 0x4599; op_call(cpu, i8080_read_word(cpu, 0x4597));
+  return 1;
+}
+
+static int block_4599(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x459, 0x459, 17)) return 0;
+  cpu->PC = 0x459C; op_call(cpu, i8080_read_word(cpu, 0x459A));
+  return 1;
+}
+
+static int block_459C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x459, 0x459, 27)) return 0;
+  ldhd(cpu, i8080_read_word(cpu, 0x459D));
+  cpu->PC = 0x45A0; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_46C1(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x46C, 0x46C, 5)) return 0;
+  op_mov_E_A(cpu, 0);
+  cpu->PC = 0x46C2;
+  return 1;
+}
+
+static int block_46C2(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x46C, 0x46D, 152)) return 0;
+  lda(cpu, i8080_read_word(cpu, 0x46C3));
+  op_cmp_E(cpu, 0);
+  cpu->PC = 0x46C9; op_jc(cpu, i8080_read_word(cpu, 0x46C7));
+  if (cpu->PC != 0x46C9) return 1;
+  op_mvi_D(cpu, i8080_read_byte(cpu, 0x46CA));
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x46C, 0x46D)) {
+    cpu->PC = 0x46CC;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x46CE));
+  if (precompiled_changed(cpu, 0x46C, 0x46D)) {
+    cpu->PC = 0x46D0;
+    return 1;
+  }
+  op_xchg(cpu, 0);
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x46D2));
+  op_dad_D(cpu, 0);
+  op_dad_D(cpu, 0);
+  op_mov_C_M(cpu, 0);
+  op_inx_H(cpu, 0);
+  op_mov_B_M(cpu, 0);
+  op_pop_H(cpu, 0);
+  op_ldax_B(cpu, 0);
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x46DD; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_4709(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x470, 0x470, 36)) return 0;
+  op_dcr_A(cpu, 0);
+  cpu->PC = 0x470B; op_rz(cpu, 0);
+  if (cpu->PC != 0x470B) return 1;
+  op_dad_D(cpu, 0);
+  cpu->PC = 0x470F; op_jmp(cpu, i8080_read_word(cpu, 0x470D));
+  return 1;
+}
+
+static int block_4711(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x471, 0x471, 46)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x4712));
+  cpu->PC = 0x4714; op_rnz(cpu, 0);
+  if (cpu->PC != 0x4714) return 1;
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x471, 0x471)) {
+    cpu->PC = 0x4715;
+    return 1;
+  }
+  cpu->PC = 0x4718; op_call(cpu, i8080_read_word(cpu, 0x4716));
+  return 1;
+}
+
+static int block_486E(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x486, 0x487, 17)) return 0;
+  cpu->PC = 0x4871; op_call(cpu, i8080_read_word(cpu, 0x486F));
+  return 1;
+}
+
+static int block_4871(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x487, 0x487, 10)) return 0;
+  cpu->PC = 0x4874; op_jz(cpu, i8080_read_word(cpu, 0x4872));
+  return 1;
+}
+
+static int block_4892(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x489, 0x48A, 124)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x489, 0x48A)) {
+    cpu->PC = 0x4893;
+    return 1;
+  }
+  op_push_D(cpu, 0);
+  if (precompiled_changed(cpu, 0x489, 0x48A)) {
+    cpu->PC = 0x4894;
+    return 1;
+  }
+  op_lxi_D(cpu, i8080_read_word(cpu, 0x4895));
+  ldhd(cpu, i8080_read_word(cpu, 0x4898));
+  op_dad_H(cpu, 0);
+  op_dad_D(cpu, 0);
+  op_mvi_M(cpu, i8080_read_byte(cpu, 0x489D));
+  if (precompiled_changed(cpu, 0x489, 0x48A)) {
+    cpu->PC = 0x489E;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_mvi_M(cpu, i8080_read_byte(cpu, 0x48A0));
+  if (precompiled_changed(cpu, 0x489, 0x48A)) {
+    cpu->PC = 0x48A1;
+    return 1;
+  }
+  op_pop_D(cpu, 0);
+  op_pop_H(cpu, 0);
+  op_mvi_D(cpu, i8080_read_byte(cpu, 0x48A4));
+  op_xra_A(cpu, 0);
+  cpu->PC = 0x48A6;
+  return 1;
+}
+
+static int block_48A6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x48A, 0x48A, 38)) return 0;
+  op_stax_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x48A, 0x48A)) {
+    cpu->PC = 0x48A7;
+    return 1;
+  }
+  op_inx_B(cpu, 0);
+  op_dcr_D(cpu, 0);
+  cpu->PC = 0x48AC; op_jnz(cpu, i8080_read_word(cpu, 0x48AA));
+  if (cpu->PC != 0x48AC) return 1;
+  cpu->PC = 0x48AD; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_515C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x515, 0x515, 17)) return 0;
+  cpu->PC = 0x515F; op_call(cpu, i8080_read_word(cpu, 0x515D));
+  return 1;
+}
+
+static int block_515F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x515, 0x516, 37)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x5160));
+  cpu->PC = 0x5164; op_jnz(cpu, i8080_read_word(cpu, 0x5162));
+  if (cpu->PC != 0x5164) return 1;
+  op_mvi_M(cpu, i8080_read_byte(cpu, 0x5165));
+  if (precompiled_changed(cpu, 0x515, 0x516)) {
+    cpu->PC = 0x5166;
+    return 1;
+  }
+  cpu->PC = 0x5169; op_jmp(cpu, i8080_read_word(cpu, 0x5167));
+  return 1;
+}
+
+static int block_516A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x516, 0x516, 17)) return 0;
+  cpu->PC = 0x516D; op_call(cpu, i8080_read_word(cpu, 0x516B));
+  return 1;
+}
+
+static int block_516D(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x516, 0x517, 17)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x516E));
+  cpu->PC = 0x5172; op_jnz(cpu, i8080_read_word(cpu, 0x5170));
+  return 1;
+}
+
+static int block_51B1(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x51B, 0x51B, 55)) return 0;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x51B2));
+  op_mvi_B(cpu, i8080_read_byte(cpu, 0x51B5));
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x51B, 0x51B)) {
+    cpu->PC = 0x51B7;
+    return 1;
+  }
+  op_xra_A(cpu, 0);
+  sta(cpu, i8080_read_word(cpu, 0x51B9));
+  if (precompiled_changed(cpu, 0x51B, 0x51B)) {
+    cpu->PC = 0x51BB;
+    return 1;
+  }
+  op_pop_PSW(cpu, 0);
+  cpu->PC = 0x51BC;
+  return 1;
+}
+
+static int block_51BC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x51B, 0x51D, 89)) return 0;
+  op_mov_C_A(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x51BE));
+  cpu->PC = 0x51C2; op_jz(cpu, i8080_read_word(cpu, 0x51C0));
+  if (cpu->PC != 0x51C2) return 1;
+  lda(cpu, i8080_read_word(cpu, 0x51C3));
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x51C9; op_jz(cpu, i8080_read_word(cpu, 0x51C7));
+  if (cpu->PC != 0x51C9) return 1;
+  op_mov_A_C(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x51CB));
+  cpu->PC = 0x51CF; op_jz(cpu, i8080_read_word(cpu, 0x51CD));
+  if (cpu->PC != 0x51CF) return 1;
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x51D0));
+  cpu->PC = 0x51D2; op_rst_3(cpu, 0);
+  return 1;
+}
+
+static int block_51D6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x51D, 0x51E, 63)) return 0;
+  op_mov_A_C(cpu, 0);
+  cpi(cpu, i8080_read_byte(cpu, 0x51D8));
+  cpu->PC = 0x51DC; op_jz(cpu, i8080_read_word(cpu, 0x51DA));
+  if (cpu->PC != 0x51DC) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x51DD));
+  cpu->PC = 0x51E1; op_jz(cpu, i8080_read_word(cpu, 0x51DF));
+  if (cpu->PC != 0x51E1) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x51E2));
+  cpu->PC = 0x51E6; op_cz(cpu, i8080_read_word(cpu, 0x51E4));
+  return 1;
+}
+
+static int block_51E6(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x51E, 0x51F, 96)) return 0;
+  op_stc(cpu, 0);
+  cpu->PC = 0x51E8; op_rz(cpu, 0);
+  if (cpu->PC != 0x51E8) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x51E9));
+  cpu->PC = 0x51ED; op_jz(cpu, i8080_read_word(cpu, 0x51EB));
+  if (cpu->PC != 0x51ED) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x51EE));
+  cpu->PC = 0x51F2; op_jz(cpu, i8080_read_word(cpu, 0x51F0));
+  if (cpu->PC != 0x51F2) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x51F3));
+  cpu->PC = 0x51F7; op_jnz(cpu, i8080_read_word(cpu, 0x51F5));
+  if (cpu->PC != 0x51F7) return 1;
+  op_dcr_B(cpu, 0);
+  cpu->PC = 0x51FB; op_jz(cpu, i8080_read_word(cpu, 0x51F9));
+  if (cpu->PC != 0x51FB) return 1;
+  op_inr_B(cpu, 0);
+  cpu->PC = 0x51FF; op_jmp(cpu, i8080_read_word(cpu, 0x51FD));
+  return 1;
+}
+
+static int block_51FF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x51F, 0x520, 24)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x5200));
+  cpu->PC = 0x5204; op_cz(cpu, i8080_read_word(cpu, 0x5202));
+  return 1;
+}
+
+static int block_5204(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x520, 0x520, 27)) return 0;
+  cpu->PC = 0x5207; op_jz(cpu, i8080_read_word(cpu, 0x5205));
+  if (cpu->PC != 0x5207) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x5208));
+  cpu->PC = 0x520C; op_jc(cpu, i8080_read_word(cpu, 0x520A));
+  return 1;
+}
+
+static int block_520C(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x520, 0x521, 49)) return 0;
+  op_mov_A_B(cpu, 0);
+  op_inr_A(cpu, 0);
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x520F));
+  cpu->PC = 0x5213; op_jz(cpu, i8080_read_word(cpu, 0x5211));
+  if (cpu->PC != 0x5213) return 1;
+  op_mov_A_C(cpu, 0);
+  op_mov_M_C(cpu, 0);
+  if (precompiled_changed(cpu, 0x520, 0x521)) {
+    cpu->PC = 0x5215;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_inr_B(cpu, 0);
+  cpu->PC = 0x5217;
+  return 1;
+}
+
+static int block_5217(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x521, 0x521, 11)) return 0;
+  cpu->PC = 0x5218; op_rst_3(cpu, 0);
+  return 1;
+}
+
+static int block_5218(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x521, 0x522, 48)) return 0;
+  sui(cpu, i8080_read_byte(cpu, 0x5219));
+  cpu->PC = 0x521D; op_jnz(cpu, i8080_read_word(cpu, 0x521B));
+  if (cpu->PC != 0x521D) return 1;
+  sta(cpu, i8080_read_word(cpu, 0x521E));
+  if (precompiled_changed(cpu, 0x521, 0x522)) {
+    cpu->PC = 0x5220;
+    return 1;
+  }
+  op_mvi_A(cpu, i8080_read_byte(cpu, 0x5221));
+  cpu->PC = 0x5223; op_rst_3(cpu, 0);
+  return 1;
+}
+
+static int block_5232(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x523, 0x523, 35)) return 0;
+  op_mvi_M(cpu, i8080_read_byte(cpu, 0x5233));
+  if (precompiled_changed(cpu, 0x523, 0x523)) {
+    cpu->PC = 0x5234;
+    return 1;
+  }
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x5235));
+  op_dcx_H(cpu, 0);
+  cpu->PC = 0x523B; op_jmp(cpu, i8080_read_word(cpu, 0x5239));
+  return 1;
+}
+
+static int block_523B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x523, 0x524, 63)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x523, 0x524)) {
+    cpu->PC = 0x523C;
+    return 1;
+  }
+  ldhd(cpu, i8080_read_word(cpu, 0x523D));
+  op_mov_A_H(cpu, 0);
+  op_ora_L(cpu, 0);
+  cpu->PC = 0x5244; op_jz(cpu, i8080_read_word(cpu, 0x5242));
+  if (cpu->PC != 0x5244) return 1;
+  cpu->PC = 0x5247; op_call(cpu, i8080_read_word(cpu, 0x5245));
+  return 1;
+}
+
+static int block_5270(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x527, 0x527, 10)) return 0;
+  op_pop_H(cpu, 0);
+  cpu->PC = 0x5271;
+  return 1;
+}
+
+static int block_5271(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x527, 0x527, 10)) return 0;
+  cpu->PC = 0x5273; in(cpu, i8080_read_byte(cpu, 0x5272));
+  return 1;
+}
+
+static int block_5273(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x527, 0x527, 27)) return 0;
+  ani(cpu, i8080_read_byte(cpu, 0x5274));
+  cpu->PC = 0x5278; op_jz(cpu, i8080_read_word(cpu, 0x5276));
+  if (cpu->PC != 0x5278) return 1;
+  cpu->PC = 0x527A; in(cpu, i8080_read_byte(cpu, 0x5279));
+  return 1;
+}
+
+static int block_527A(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x527, 0x528, 59)) return 0;
+  ani(cpu, i8080_read_byte(cpu, 0x527B));
+  cpi(cpu, i8080_read_byte(cpu, 0x527D));
+  cpu->PC = 0x527F; op_rnz(cpu, 0);
+  if (cpu->PC != 0x527F) return 1;
+  lda(cpu, i8080_read_word(cpu, 0x5280));
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x5286; op_cz(cpu, i8080_read_word(cpu, 0x5284));
+  return 1;
+}
+
+static int block_5294(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x529, 0x52B, 170)) return 0;
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x529, 0x52B)) {
+    cpu->PC = 0x5295;
+    return 1;
+  }
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x529, 0x52B)) {
+    cpu->PC = 0x5296;
+    return 1;
+  }
+  ldhd(cpu, i8080_read_word(cpu, 0x5297));
+  op_mov_A_H(cpu, 0);
+  op_ora_L(cpu, 0);
+  cpu->PC = 0x529E; op_jnz(cpu, i8080_read_word(cpu, 0x529C));
+  if (cpu->PC != 0x529E) return 1;
+  op_pop_H(cpu, 0);
+  lda(cpu, i8080_read_word(cpu, 0x52A0));
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x52A6; op_jnz(cpu, i8080_read_word(cpu, 0x52A4));
+  if (cpu->PC != 0x52A6) return 1;
+  lda(cpu, i8080_read_word(cpu, 0x52A7));
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x52AD; op_jnz(cpu, i8080_read_word(cpu, 0x52AB));
+  if (cpu->PC != 0x52AD) return 1;
+  op_pop_PSW(cpu, 0);
+  op_push_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x529, 0x52B)) {
+    cpu->PC = 0x52AF;
+    return 1;
+  }
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x529, 0x52B)) {
+    cpu->PC = 0x52B0;
+    return 1;
+  }
+  cpi(cpu, i8080_read_byte(cpu, 0x52B1));
+  cpu->PC = 0x52B5; op_jnz(cpu, i8080_read_word(cpu, 0x52B3));
+  return 1;
+}
+
+static int block_52C3(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x52C, 0x52D, 69)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x52C4));
+  cpu->PC = 0x52C8; op_jc(cpu, i8080_read_word(cpu, 0x52C6));
+  if (cpu->PC != 0x52C8) return 1;
+  lda(cpu, i8080_read_word(cpu, 0x52C9));
+  op_mov_B_A(cpu, 0);
+  lda(cpu, i8080_read_word(cpu, 0x52CD));
+  op_cmp_B(cpu, 0);
+  cpu->PC = 0x52D3; op_cz(cpu, i8080_read_word(cpu, 0x52D1));
+  return 1;
+}
+
+static int block_52D3(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x52D, 0x52D, 28)) return 0;
+  op_inr_A(cpu, 0);
+  sta(cpu, i8080_read_word(cpu, 0x52D5));
+  if (precompiled_changed(cpu, 0x52D, 0x52D)) {
+    cpu->PC = 0x52D7;
+    return 1;
+  }
+  cpu->PC = 0x52DA; op_jmp(cpu, i8080_read_word(cpu, 0x52D8));
+  return 1;
+}
+
+static int block_52DA(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x52D, 0x52E, 62)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x52DB));
+  cpu->PC = 0x52DF; op_jnz(cpu, i8080_read_word(cpu, 0x52DD));
+  if (cpu->PC != 0x52DF) return 1;
+  lda(cpu, i8080_read_word(cpu, 0x52E0));
+  op_ora_A(cpu, 0);
+  cpu->PC = 0x52E6; op_jz(cpu, i8080_read_word(cpu, 0x52E4));
+  if (cpu->PC != 0x52E6) return 1;
+  op_dcr_A(cpu, 0);
+  sta(cpu, i8080_read_word(cpu, 0x52E8));
+  cpu->PC = 0x52EA;
+  return 1;
+}
+
+static int block_52EA(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x52E, 0x52E, 31)) return 0;
+  op_pop_PSW(cpu, 0);
+  op_pop_B(cpu, 0);
+  op_push_PSW(cpu, 0);
+  cpu->PC = 0x52ED;
+  return 1;
+}
+
+static int block_52ED(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x52E, 0x52E, 10)) return 0;
+  cpu->PC = 0x52EF; in(cpu, i8080_read_byte(cpu, 0x52EE));
+  return 1;
+}
+
+static int block_52EF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x52E, 0x52F, 37)) return 0;
+  ani(cpu, i8080_read_byte(cpu, 0x52F0));
+  cpu->PC = 0x52F4; op_jz(cpu, i8080_read_word(cpu, 0x52F2));
+  if (cpu->PC != 0x52F4) return 1;
+  op_pop_PSW(cpu, 0);
+  cpu->PC = 0x52F7; out(cpu, i8080_read_byte(cpu, 0x52F6));
+  return 1;
+}
+
+static int block_52F7(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x52F, 0x52F, 40)) return 0;
+  op_push_PSW(cpu, 0);
+  if (precompiled_changed(cpu, 0x52F, 0x52F)) {
+    cpu->PC = 0x52F8;
+    return 1;
+  }
+  op_nop(cpu, 0);
+  op_nop(cpu, 0);
+  op_pop_PSW(cpu, 0);
+  cpu->PC = 0x52FC; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_52FC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x52F, 0x52F, 10)) return 0;
+  cpu->PC = 0x52FE; in(cpu, i8080_read_byte(cpu, 0x52FD));
+  return 1;
+}
+
+static int block_52FE(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x52F, 0x530, 18)) return 0;
+  ani(cpu, i8080_read_byte(cpu, 0x52FF));
+  cpu->PC = 0x5301; op_rz(cpu, 0);
+  return 1;
+}
+
+static int block_5301(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x530, 0x530, 17)) return 0;
+  cpu->PC = 0x5304; op_call(cpu, i8080_read_word(cpu, 0x5302));
+  return 1;
+}
+
+static int block_5304(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x530, 0x530, 24)) return 0;
+  cpi(cpu, i8080_read_byte(cpu, 0x5305));
+  cpu->PC = 0x5309; op_cz(cpu, i8080_read_word(cpu, 0x5307));
+  return 1;
+}
+
+static int block_5309(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x530, 0x531, 55)) return 0;
+  cpu->PC = 0x530C; op_jz(cpu, i8080_read_word(cpu, 0x530A));
+  if (cpu->PC != 0x530C) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x530D));
+  cpu->PC = 0x5311; op_jz(cpu, i8080_read_word(cpu, 0x530F));
+  if (cpu->PC != 0x5311) return 1;
+  cpi(cpu, i8080_read_byte(cpu, 0x5312));
+  cpu->PC = 0x5316; op_jz(cpu, i8080_read_word(cpu, 0x5314));
+  if (cpu->PC != 0x5316) return 1;
+  cpu->PC = 0x5317; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_53CA(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x53C, 0x53C, 10)) return 0;
+  cpu->PC = 0x53CC; out(cpu, i8080_read_byte(cpu, 0x53CB));
+  return 1;
+}
+
+static int block_53CC(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x53C, 0x53C, 11)) return 0;
+  cpu->PC = 0x53CD; op_ret(cpu, 0);
+  return 1;
+}
+
+static int block_5425(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x542, 0x542, 10)) return 0;
+  cpu->PC = 0x5428; op_jmp(cpu, i8080_read_word(cpu, 0x5426));
+  return 1;
+}
+
+static int block_5486(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x548, 0x548, 52)) return 0;
+  ldhd(cpu, i8080_read_word(cpu, 0x5487));
+  op_dad_D(cpu, 0);
+  shld(cpu, i8080_read_word(cpu, 0x548B));
+  if (precompiled_changed(cpu, 0x548, 0x548)) {
+    cpu->PC = 0x548D;
+    return 1;
+  }
+  cpu->PC = 0x5490; op_jmp(cpu, i8080_read_word(cpu, 0x548E));
+  return 1;
+}
+
+static int block_569F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x569, 0x56B, 81)) return 0;
+  op_inx_H(cpu, 0);
+  op_mov_A_H(cpu, 0);
+  op_ora_L(cpu, 0);
+  cpu->PC = 0x56A5; op_jz(cpu, i8080_read_word(cpu, 0x56A3));
+  if (cpu->PC != 0x56A5) return 1;
+  op_mov_A_M(cpu, 0);
+  op_mov_B_A(cpu, 0);
+  op_cma(cpu, 0);
+  op_mov_M_A(cpu, 0);
+  if (precompiled_changed(cpu, 0x569, 0x56B)) {
+    cpu->PC = 0x56A9;
+    return 1;
+  }
+  op_cmp_M(cpu, 0);
+  op_mov_M_B(cpu, 0);
+  if (precompiled_changed(cpu, 0x569, 0x56B)) {
+    cpu->PC = 0x56AB;
+    return 1;
+  }
+  cpu->PC = 0x56AE; op_jz(cpu, i8080_read_word(cpu, 0x56AC));
+  if (cpu->PC != 0x56AE) return 1;
+  cpu->PC = 0x56B1; op_jmp(cpu, i8080_read_word(cpu, 0x56AF));
+  return 1;
+}
+
+static int block_56DF(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x56D, 0x56E, 57)) return 0;
+  op_mvi_M(cpu, i8080_read_byte(cpu, 0x56E0));
+  if (precompiled_changed(cpu, 0x56D, 0x56E)) {
+    cpu->PC = 0x56E1;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_dcr_B(cpu, 0);
+  cpu->PC = 0x56E6; op_jnz(cpu, i8080_read_word(cpu, 0x56E4));
+  if (cpu->PC != 0x56E6) return 1;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x56E7));
+  cpu->PC = 0x56EC; op_call(cpu, i8080_read_word(cpu, 0x56EA));
+  return 1;
+}
+
+static int block_57B4(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x57B, 0x57B, 49)) return 0;
+  op_ldax_D(cpu, 0);
+  op_mov_M_A(cpu, 0);
+  if (precompiled_changed(cpu, 0x57B, 0x57B)) {
+    cpu->PC = 0x57B6;
+    return 1;
+  }
+  op_inx_H(cpu, 0);
+  op_inx_D(cpu, 0);
+  op_dcr_C(cpu, 0);
+  cpu->PC = 0x57BC; op_jnz(cpu, i8080_read_word(cpu, 0x57BA));
+  if (cpu->PC != 0x57BC) return 1;
+  cpu->PC = 0x57BF; op_jmp(cpu, i8080_read_word(cpu, 0x57BD));
+  return 1;
+}
+
+static int block_582B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x582, 0x582, 28)) return 0;
+  op_push_H(cpu, 0);
+  if (precompiled_changed(cpu, 0x582, 0x582)) {
+    cpu->PC = 0x582C;
+    return 1;
+  }
+  cpu->PC = 0x582F; op_call(cpu, i8080_read_word(cpu, 0x582D));
+  return 1;
+}
+
+static int block_582F(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x582, 0x583, 17)) return 0;
+  cpu->PC = 0x5832; op_call(cpu, i8080_read_word(cpu, 0x5830));
+  return 1;
+}
+
+static int block_5832(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x583, 0x583, 21)) return 0;
+  cpu->PC = 0x5835; op_jc(cpu, i8080_read_word(cpu, 0x5833));
+  if (cpu->PC != 0x5835) return 1;
+  cpu->PC = 0x5836; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_5836(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x583, 0x583, 17)) return 0;
+  cpu->PC = 0x5839; op_call(cpu, i8080_read_word(cpu, 0x5837));
+  return 1;
+}
+
+static int block_5839(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x583, 0x583, 16)) return 0;
+  op_dcx_H(cpu, 0);
+  cpu->PC = 0x583B; op_rst_2(cpu, 0);
+  return 1;
+}
+
+static int block_583B(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x583, 0x584, 31)) return 0;
+  cpu->PC = 0x583E; op_jnz(cpu, i8080_read_word(cpu, 0x583C));
+  if (cpu->PC != 0x583E) return 1;
+  op_lxi_H(cpu, i8080_read_word(cpu, 0x583F));
+  cpu->PC = 0x5842; op_rst_4(cpu, 0);
+  return 1;
+}
+
+static int block_5842(struct i8080 *cpu) {
+  if (!precompiled_enter(cpu, 0x584, 0x584, 36)) return 0;
+  cpu->PC = 0x5845; op_jc(cpu, i8080_read_word(cpu, 0x5843));
+  if (cpu->PC != 0x5845) return 1;
+  op_pop_PSW(cpu, 0);
+  op_mov_A_E(cpu, 0);
+  cpu->PC = 0x5848; op_ret(cpu, 0);
+  return 1;
+}
+
+// Bytes the blocks depend on, one bit per byte
+static const uint8_t precompiled_guarded[2988] = {
+  0x03, 0x3F, 0x37, 0x01, 0x3F, 0x99, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x40, 0xDE, 0xFF, 0x73, 0x9E, 0xFC, 0xCF, 0xF4, 0xDD, 0x3C, 0x48, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xC0, 0x4C, 0x92, 0xA4, 0x24, 0x99, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x92, 0x67, 0xB2, 0xCC, 0xC9, 0x9F, 0xC9, 0xF9, 0x7C, 0x9E, 0xF9, 0x99, 0xFF, 0xE7, 0xFF, 0x99,
+  0x24, 0x93, 0x0C, 0xFC, 0x3F, 0xA5, 0x64, 0x7E, 0x00, 0x00, 0x00, 0x80, 0xFC, 0xFF, 0xFF, 0x27,
+  0xF3, 0x9F, 0x64, 0x20, 0xC9, 0x27, 0x53, 0x3A, 0x39, 0x49, 0xFE, 0x24, 0x99, 0x4C, 0x92, 0xE7,
+  0x6C, 0x33, 0x49, 0x96, 0x32, 0x39, 0x95, 0x93, 0x64, 0xBA, 0x7F, 0x2E, 0xE7, 0x79, 0x6E, 0x99,
+  0xC9, 0x67, 0x2E, 0xD9, 0xB6, 0x6D, 0xDB, 0xB6, 0x2F, 0xBF, 0xCC, 0x32, 0x00, 0x2C, 0xA5, 0xE4,
+  0x93, 0x52, 0x26, 0xCF, 0xC9, 0x93, 0xA7, 0xE4, 0x72, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x28, 0x03,
+  0x00, 0x00, 0xB9, 0x3C, 0x39, 0x4B, 0x29, 0x29, 0x7F, 0xE6, 0x49, 0xFE, 0xFC, 0xFB, 0xCB, 0xB6,
+  0x9F, 0x2C, 0xA5, 0x34, 0x33, 0x97, 0x52, 0x2E, 0x99, 0x19, 0xCB, 0x9C, 0x4D, 0xE6, 0x04, 0x00,
+  0x00, 0xC9, 0xF3, 0x4A, 0x00, 0xFC, 0xB3, 0x93, 0x99, 0xCB, 0x7C, 0x7E, 0x32, 0x0B, 0x38, 0x97,
+  0x72, 0xF3, 0xDF, 0x92, 0x52, 0x72, 0x49, 0x4E, 0x29, 0xE5, 0x4B, 0x99, 0xE7, 0x9C, 0x67, 0x2E,
+  0xA5, 0x27, 0xA5, 0x24, 0x7F, 0x20, 0x49, 0x32, 0x33, 0x38, 0x93, 0x64, 0x7E, 0x92, 0x4C, 0x32,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x4E, 0xF2, 0xF2, 0x3C, 0xF3, 0x73, 0xFE,
+  0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x66, 0x32, 0x98, 0x92, 0xFC, 0x33, 0x3F, 0xCD, 0xF9, 0x79, 0x72, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x7B, 0x02, 0x00,
+  0x5C, 0x9A, 0x99, 0xCF, 0xFC, 0xDB, 0x03, 0x00, 0x00, 0x00, 0x00, 0x20, 0x33, 0x00, 0x00, 0x40,
+  0xC9, 0xB3, 0x47, 0xD2, 0x67, 0xE6, 0x49, 0x96, 0x39, 0x58, 0xA6, 0x32, 0x59, 0xF7, 0x7F, 0x99,
+  0xF2, 0xE4, 0xCD, 0x3C, 0x97, 0x4C, 0x7E, 0x26, 0x27, 0x13, 0x00, 0x39, 0x73, 0x5E, 0x02, 0x00,
+  0x00, 0x00, 0x80, 0x5C, 0xFA, 0xA4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x4B, 0xE9, 0xCC, 0x52, 0x52, 0x5E, 0x26, 0x00, 0xE5, 0xA4,
+  0x94, 0xB2, 0x94, 0x39, 0x49, 0x4E, 0x32, 0x39, 0x27, 0x73, 0xD2, 0x99, 0x9C, 0x4C, 0x3B, 0xCF,
+  0x99, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0x33, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x24, 0xF3, 0x9F,
+  0x9C, 0x99, 0x09, 0x00, 0x00, 0x00, 0x00, 0x80, 0x27, 0x73, 0x26, 0x4B, 0xB4, 0x25, 0xC9, 0x95,
+  0xD2, 0x27, 0x73, 0xA6, 0x9D, 0x26, 0x7F, 0x2E, 0xA5, 0x92, 0x79, 0x3E, 0x3F, 0x13, 0x00, 0xE9,
+  0x99, 0x24, 0x29, 0x73, 0xB2, 0x27, 0x27, 0x93, 0xB3, 0xA4, 0x5C, 0x96, 0xA4, 0x3F, 0x03, 0x00,
+  0x20, 0xC9, 0xFB, 0xCF, 0x94, 0x49, 0x4E, 0x26, 0x99, 0x09, 0x00, 0x60, 0x49, 0x99, 0x49, 0x29,
+  0xA5, 0x94, 0x12, 0x00, 0x00, 0x00, 0x25, 0x80, 0x12, 0x00, 0x00, 0xA5, 0x94, 0x92, 0x96, 0xCC,
+  0x39, 0x73, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xBF,
+  0xA4, 0xCC, 0x73, 0x72, 0x69, 0x66, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x4D, 0x4A, 0xFE,
+  0xCC, 0xCF, 0xA5, 0x64, 0xF9, 0xCB, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0xCB, 0x33, 0x79, 0x12, 0x00,
+  0x64, 0xDD, 0xAD, 0x6B, 0xF3, 0x67, 0x26, 0x4B, 0x99, 0x33, 0xE7, 0x73, 0x9E, 0x6F, 0x80, 0x9F,
+  0xC9, 0xF9, 0x7D, 0x3E, 0x73, 0xB2, 0xF9, 0x3F, 0x00, 0x00, 0x98, 0xCF, 0xFF, 0x52, 0xA2, 0x4C,
+  0x9F, 0xE6, 0xE4, 0x3C, 0xF7, 0x93, 0x99, 0x01, 0x6F, 0x7E, 0xCE, 0x39, 0xF9, 0xE7, 0xFC, 0x24,
+  0x9B, 0xF3, 0xFF, 0xF9, 0xFE, 0xC9, 0x4F, 0x5E, 0x26, 0x3C, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xC9, 0x5F, 0x66, 0x09, 0xC9, 0xF9,
+  0xB3, 0x4C, 0x4A, 0xC9, 0x01, 0xE0, 0x4B, 0x9A, 0xCC, 0x12, 0x70, 0x95, 0x73, 0x26, 0x3F, 0x3F,
+  0xFF, 0xE7, 0xC9, 0xCB, 0x66, 0x00, 0x00, 0xC0, 0xFC, 0x52, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x24, 0x49, 0x92, 0x7C, 0x3E, 0xE7, 0xE4, 0x7F, 0xF7, 0x99, 0x29, 0x9F, 0x94, 0x94, 0x64, 0x4E,
+  0x99, 0xFC, 0xFB, 0xF9, 0xFC, 0xFF, 0x79, 0xEF, 0x24, 0xBF, 0xCC, 0x66, 0x6E, 0xFE, 0xE4, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xF0, 0x99, 0xE7, 0xE7, 0x92, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x33, 0x73,
+  0x2E, 0x99, 0x99, 0x49, 0xCE, 0xFF, 0x3F, 0xC9, 0xE4, 0x9F, 0x39, 0x7F, 0xDA, 0xF9, 0xE7, 0x9F,
+  0x7D, 0xCE, 0xFF, 0x67, 0x7E, 0x26, 0x7F, 0x49, 0xCE, 0xB2, 0xF4, 0x24, 0x18, 0x70, 0x3E, 0x79,
+  0x92, 0xF7, 0xCC, 0xFC, 0xF7, 0xCC, 0x24, 0x9F, 0x33, 0xE7, 0xFD, 0x4F, 0xFE, 0x7F, 0x7E, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x95, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x20, 0xF3, 0x25, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xE4, 0x69, 0x92, 0xA4, 0x09, 0x80, 0xF3, 0xF3, 0x03, 0x00, 0x00, 0x00, 0x9E,
+  0x97, 0x32, 0x95, 0x97, 0x32, 0xA5, 0x6C, 0x06, 0x00, 0xD8, 0x5C, 0x4A, 0xD9, 0x00, 0xE0, 0x5C,
+  0x00, 0x00, 0x00, 0x00, 0x2F, 0xCF, 0x52, 0x02, 0xE7, 0xFC, 0xCB, 0x92, 0x4F, 0x4A, 0xFC, 0xFF,
+  0x3E, 0x81, 0x93, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0xFF, 0x39, 0x49, 0x92, 0x67, 0xE6, 0x99, 0x3B, 0x67, 0x92, 0x9C, 0x92, 0xFF, 0x3F, 0x7F,
+  0x7E, 0x65, 0xFE, 0xE7, 0x93, 0x73, 0xE6, 0x9D, 0xBF, 0xC1, 0xFF, 0xE7, 0xFF, 0x7F, 0xE5, 0xA5,
+  0xFF, 0xFF, 0x00, 0x00, 0x98, 0x4C, 0x7E, 0x9E, 0x24, 0x49, 0x32, 0xC9, 0x65, 0x26, 0x67, 0xCE,
+  0x73, 0xCF, 0xDC, 0xFF, 0xCF, 0x3F, 0x00, 0xA6, 0x7C, 0xCE, 0xF9, 0xF3, 0xEE, 0xD6, 0xE4, 0xFF,
+  0xFC, 0xFF, 0x99, 0x67, 0x4E, 0x00, 0xC0, 0x99, 0x3F, 0x4D, 0x0E, 0x80, 0xBC, 0x4C, 0x4E, 0xFE,
+  0x25, 0xB7, 0x81, 0x49, 0x36, 0x3E, 0x93, 0x7C, 0xE6, 0x7C, 0xE6, 0x9C, 0xFF, 0x29, 0xF3, 0x67,
+  0xFE, 0xFF, 0x47, 0x92, 0xCC, 0x79, 0xF2, 0x79, 0xFE, 0xFF, 0x7F, 0x00, 0x80, 0x24, 0x27, 0x7F,
+  0x7E, 0xE7, 0x19, 0x30, 0x93, 0x4C, 0xC9, 0x29, 0x01, 0x00, 0x27, 0x00, 0x00, 0x48, 0xAE, 0x9C,
+  0x24, 0x69, 0x19, 0xFC, 0x93, 0xD3, 0x9C, 0xF2, 0x07, 0x00, 0x00, 0x80, 0x2C, 0xA7, 0xCF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xA7, 0x79, 0x66, 0x0E, 0x00, 0xFF,
+  0x9F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x39, 0x00, 0x00, 0x70, 0x00, 0x80, 0x93, 0x73,
+  0x3A, 0xCF, 0xFF, 0xFF, 0x79, 0x9E, 0xE7, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x7F, 0xCE,
+  0xBC, 0xFF, 0xF3, 0x3B, 0x3B, 0x49, 0x4E, 0x72, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8,
+  0xC9, 0x99, 0xC9, 0x3E, 0x00, 0x00, 0x00, 0x28, 0x29, 0xFF, 0x04, 0x00, 0xC0, 0xE5, 0xFC, 0xA4,
+  0xBF, 0x9F, 0xA4, 0xF0, 0x13, 0x00, 0x3E, 0x3D, 0x79, 0x4E, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xCF, 0xFC, 0x72, 0x1E, 0xC0, 0x39, 0x97,
+  0xA6, 0x9C, 0x52, 0x06, 0x50, 0x4A, 0x29, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x49, 0x9E, 0xCF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0x99, 0x03, 0x00, 0xF8, 0x77, 0x92, 0xF9, 0x7F, 0xF2, 0x00, 0x49,
+  0x02, 0x00, 0x90, 0x4C, 0x92, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xA5, 0x99, 0x0E, 0x96,
+  0x93, 0x94, 0x24, 0xCB, 0x72, 0x79, 0x4A, 0x29, 0xA5, 0x60, 0xD9, 0x3E, 0xE9, 0x9E, 0xCC, 0xB9,
+  0x4E, 0xC9, 0xA5, 0x0C, 0x00, 0x00, 0x00, 0x40, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6,
+  0x4B, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x94, 0x24, 0x00, 0x64, 0x92, 0x24, 0xC9, 0x0C, 0xC0,
+  0x27, 0x49, 0x80, 0xE9, 0x06, 0x00, 0x00, 0xA5, 0x00, 0x53, 0x7E, 0x7B, 0x0E, 0x00, 0x00, 0xE4,
+  0x7B, 0xC9, 0xF2, 0xCF, 0x09, 0xCE, 0xE4, 0x99, 0xCF, 0xFE, 0xFF, 0x64, 0xFE, 0x5C, 0xA6, 0xFC,
+  0x3F, 0xFD, 0x33, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xC0, 0xFC, 0xD2, 0xFF, 0x9C, 0xB3, 0xD2, 0xCF, 0xC9, 0x01, 0x00, 0xE4, 0x93, 0x99, 0x97,
+  0x1C, 0x00, 0x33, 0xC9, 0x39, 0x49, 0x92, 0x92, 0xCA, 0x24, 0x9F, 0x24, 0x39, 0x00, 0x00, 0x00,
+  0x00, 0x92, 0x93, 0x39, 0xFF, 0x67, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x92, 0xE4, 0x24, 0x27, 0x39,
+  0x79, 0x92, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x9E, 0x3F, 0x03, 0x00, 0xF0, 0x7C, 0x92, 0x3C, 0x03, 0xE0, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x40, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x3A, 0xF3, 0x1F, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1E, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00,
+  0x00, 0x00, 0x9C, 0xDC, 0xEE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x52, 0xA4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0xB9, 0x64, 0x96, 0xC2, 0x52, 0xCA, 0xA5, 0x94, 0x99,
+  0x92, 0x72, 0xF9, 0x25, 0x05, 0x00, 0x94, 0x99, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xD5,
+  0x0C, 0x00, 0x70, 0xCE, 0x4C, 0xE6, 0x05, 0x00, 0x28, 0x99, 0x99, 0x94, 0xCC, 0xBC, 0xB2, 0x5F,
+  0x53, 0x52, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x80, 0xE7, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x4E, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x64, 0x4E, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// FNV-1a hash of the guarded bytes of each granule
+static const uint32_t precompiled_hashes[1494] = {
+  0x59902562u, 0x31C002E8u, 0xA0E1E7E2u, 0x7054289Eu, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x4C2A09E0u, 0x885C3B40u, 0xADA82E17u,
+  0x72906B1Eu, 0xED9F9296u, 0xE1519580u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x9E98A213u, 0x69A5280Cu, 0xE63C85A0u, 0x297ED028u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x47E977A4u, 0x8DA0FCF4u, 0xC50C136Eu, 0xE1CE0AAFu,
+  0x7B295055u, 0xA1C42D6Fu, 0x7423CCB5u, 0xEB99C9C7u, 0xF08A9466u, 0x508EC5B3u,
+  0x85106C0Fu, 0x586CFED5u, 0x811C9DC5u, 0x2F0C9F3Du, 0x2A42B84Du, 0x3D8C967Bu,
+  0x5BBC60E6u, 0xD0E52D58u, 0xE5226A66u, 0x413D7175u, 0x9206D503u, 0x9F8F480Au,
+  0x948702D4u, 0x7DD733F8u, 0x00D35058u, 0x96AFC513u, 0x11314463u, 0x6BDC6628u,
+  0x476E2908u, 0xB1823BFFu, 0x85AE791Du, 0x4B289521u, 0xF85ADF04u, 0xA2C1E805u,
+  0x568461EBu, 0x5564EA19u, 0xAA67018Eu, 0x1E7225A8u, 0x4447F785u, 0xE5A7FEBBu,
+  0xC7EF1EEDu, 0x2726AB01u, 0xCA92CB80u, 0x49D90F3Cu, 0x2A4BCC00u, 0x811C9DC5u,
+  0x811C9DC5u, 0xC7B4EFD9u, 0x811C9DC5u, 0x2B0484CEu, 0xF881231Eu, 0x51801E95u,
+  0xF1FF7AD9u, 0x8020D8FFu, 0x7156794Cu, 0x8AB4A971u, 0x0962A40Au, 0xB17E9D22u,
+  0xE2F33E14u, 0xBC23ECB9u, 0x6FD50619u, 0xE08215B2u, 0xC93F3D03u, 0x480B3398u,
+  0x01FBE97Du, 0x925ED7EFu, 0x57C6B4E9u, 0xF9324789u, 0xC0AE270Bu, 0x8FE0ADF0u,
+  0xE0CB1E80u, 0x793A8D9Fu, 0x8C4F4639u, 0x20F45826u, 0x7891720Du, 0x5242864Au,
+  0x20C2F3C1u, 0x04E0EB57u, 0xF3844BB1u, 0xE5D271ADu, 0x872C1FE6u, 0xB84DB635u,
+  0xFEE9FDAFu, 0x1B2B6E74u, 0xA0400FD9u, 0x3C805313u, 0x0B2F1AD6u, 0xEBA25028u,
+  0x9CA0EDB2u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0xE4FD75CEu, 0x856ADD0Cu,
+  0x6CF7812Cu, 0x3410C631u, 0xC9009AF7u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x893E9ACAu,
+  0xE440C525u, 0x0FE77C46u, 0xD9E9242Fu, 0x76CEC98Au, 0xD54457BAu, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x36D7FDA7u, 0x750B7A6Fu, 0x2DFCC2B3u, 0x1198AA8Eu, 0xDDC8777Cu, 0xECE73BBDu,
+  0x811C9DC5u, 0x470B3205u, 0xD3552E33u, 0x0B0C6691u, 0xF8ADE9D2u, 0x7DA8D372u,
+  0x0DEDC34Fu, 0x6124C509u, 0x33BA1F3Bu, 0x44E24A17u, 0x0438FF63u, 0xDAFBE656u,
+  0xB65CBE13u, 0xE1E736D7u, 0xAA5369A6u, 0xDCF88277u, 0x0F79A3BAu, 0x6C520255u,
+  0x9A89C4C1u, 0x520B4356u, 0x811C9DC5u, 0x1CE6A3CBu, 0x28AEC18Au, 0x460B3072u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x480B3398u, 0x51CABFCBu, 0x23C5D68Fu, 0x7122B23Du, 0x8A3F67AFu, 0x9653698Cu,
+  0x1FD13440u, 0x95F75DABu, 0x43D8C768u, 0x20F7263Eu, 0x812B5B3Eu, 0x29EF8A6Au,
+  0xBAE8711Cu, 0x05CF0A3Eu, 0xF52E79DBu, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x640B5FACu, 0x9F797AC1u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0xA91D97D1u, 0x2FFE7C79u, 0x4A4DD4EBu, 0xC4A1D841u,
+  0x811C9DC5u, 0x640B5FACu, 0x2BBDE734u, 0x12D1193Fu, 0x61418A7Au, 0x1DE31C4Au,
+  0x3B0A94CBu, 0xC0D6C5B8u, 0x45017594u, 0x443D3675u, 0x63314A45u, 0xB8938790u,
+  0x6F2B25EEu, 0x80D62C4Au, 0xA7594C3Eu, 0x9F75E47Au, 0x39B00A84u, 0xF983B12Bu,
+  0xE69993F4u, 0x3FF2FD5Eu, 0x40443334u, 0x9A8FA16Bu, 0x61019EBBu, 0x3E395790u,
+  0x0AC39726u, 0x7A1C7034u, 0x821CC105u, 0x6FBAEA58u, 0xB353E05Eu, 0x1EBAE37Eu,
+  0x3972702Du, 0xA8A10096u, 0x811C9DC5u, 0xAE44175Cu, 0xA8A10096u, 0x08C5FDB5u,
+  0xFDEEF665u, 0x78177A1Du, 0x1C8C8C8Fu, 0x470B3205u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0xB5A9CD1Du, 0xA0EA0E81u, 0x5060F89Fu,
+  0x0206A720u, 0xF8CF8D85u, 0x811C9DC5u, 0x811C9DC5u, 0x42E8738Au, 0xAB502420u,
+  0xBD437579u, 0xE2B43C3Fu, 0x1A72D62Fu, 0x38406BBFu, 0x811C9DC5u, 0x603CCDD2u,
+  0xB563D0F6u, 0xABA1B0E6u, 0xE5AAC027u, 0x47189F1Eu, 0xF11C7542u, 0x6E6F6608u,
+  0x367724B1u, 0x1EE27B58u, 0x7E3BCFB5u, 0xEF118ABDu, 0x59BEB8EDu, 0x9CFBA65Eu,
+  0x8F1AB4EEu, 0xB62A8B7Fu, 0x811C9DC5u, 0x0473477Bu, 0x3986CFD8u, 0xB33A9C4Eu,
+  0x2C8A253Cu, 0x4865D860u, 0x25F2CF59u, 0x93C5AB62u, 0x03AD6C40u, 0xE0784436u,
+  0xE4F84EF2u, 0x52AA3F34u, 0x9DD46032u, 0x12A650DFu, 0x472A6211u, 0x1219F48Fu,
+  0xC6EE07A6u, 0x4C0B39E4u, 0x811C9DC5u, 0xB803F1DDu, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0xDE1F7CB1u, 0xE60845B9u, 0x56DA54E2u, 0xE422FF01u,
+  0xE8295231u, 0x73E64B15u, 0x9DC7F4B1u, 0x97E49044u, 0x0B8465E6u, 0xE2BCA0D7u,
+  0xE022C985u, 0x4EEE06F7u, 0xE0A80835u, 0x1F5B2926u, 0xB5C5CE75u, 0x7BDD8F7Eu,
+  0x875C521Au, 0xEDEBD27Bu, 0x811C9DC5u, 0x811C9DC5u, 0x714134F8u, 0x27E754F4u,
+  0xDC75893Au, 0x6354350Cu, 0xF6F7E802u, 0x2509751Fu, 0x89B9B4F8u, 0x5109E3DAu,
+  0x74FC9B76u, 0xE6898322u, 0x737F1FF9u, 0x323D50D8u, 0xAC764ED5u, 0x39E98824u,
+  0x41C44C11u, 0xE12210F5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x0EC3E6F1u, 0xBFFEF902u,
+  0x4E259B66u, 0x1C996AACu, 0x811C9DC5u, 0x811C9DC5u, 0xE2FC08EFu, 0xD8A8B6CFu,
+  0x3AAA19F0u, 0x9EE3D899u, 0xA65DE316u, 0x51775155u, 0x8268DD5Fu, 0x36D24541u,
+  0x9B763FA9u, 0x59B976ECu, 0x2F83EECDu, 0x6E4B0F1Bu, 0x7F99E6F2u, 0x433D05A6u,
+  0x2197854Eu, 0x03023AC3u, 0x4A78C822u, 0xF69D9D37u, 0x4CD8A8EBu, 0x3714B549u,
+  0xB35146DAu, 0x46391A77u, 0x413CD12Bu, 0x5F7576A2u, 0xF555F828u, 0x50CA67AEu,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0xA108E7DEu,
+  0x7ABC6174u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x480B3398u, 0xAD374215u, 0x05ED63C7u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0xA1092284u,
+  0xA407CA75u, 0x402D5B89u, 0x888F8E5Bu, 0xB8366027u, 0x811C9DC5u, 0x6F6FC5CCu,
+  0x2787E3E9u, 0x62EC6745u, 0x9DB5DA39u, 0x3FB5EC32u, 0x0D97691Cu, 0x5BCD3648u,
+  0x1B91FCF3u, 0xCA5DF1EFu, 0x811C9DC5u, 0x811C9DC5u, 0x7FEBD6EAu, 0x140607ADu,
+  0x8C702573u, 0x70146B91u, 0xC4FD9189u, 0xF08168ACu, 0x6E19A69Au, 0x36A3E9EAu,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x490B1E7Fu, 0xC7B97396u, 0x68FFE8BDu, 0x25DB8E37u, 0xF8DE8C24u, 0x07CAE325u,
+  0x90CFB17Eu, 0x2FC3A7E0u, 0xEF98E2B4u, 0x97A91792u, 0x32404B59u, 0xFEB6581Au,
+  0xD5759D98u, 0x14FF5861u, 0xBD686667u, 0x4488136Fu, 0x6DAD4480u, 0x811C9DC5u,
+  0x0AADF9CDu, 0x459798A5u, 0x45CC4DB8u, 0xFA84E5D7u, 0x08AFEB81u, 0x6F7ABEA8u,
+  0xB5933F11u, 0xF7ABE6DFu, 0xCCD1A008u, 0x81660181u, 0xF2D33E96u, 0x9815DFDCu,
+  0xDFC7CCE5u, 0x27FCB3B9u, 0xCEE4D153u, 0x4F8C02FCu, 0xA49334D0u, 0x7F9E9F02u,
+  0x7E7DFC3Fu, 0x7A39ACA5u, 0xF89B834Bu, 0x7623704Cu, 0x2190C1B4u, 0x63E8640Au,
+  0xAA67E696u, 0x7AA59CD4u, 0x925C3F69u, 0x05D8B788u, 0xE8EDF50Cu, 0xA5A97075u,
+  0x5E5CB8B5u, 0x1B769EC9u, 0xBFB9D1ABu, 0x0B725526u, 0xBE7EA0C8u, 0x4BBB57B2u,
+  0xB3A981C6u, 0x65169C00u, 0xB8A8FCD3u, 0xB06858D6u, 0x96B61FEBu, 0x2A3136E6u,
+  0x4C0B39E4u, 0xEA30AFA6u, 0x00DFC6D0u, 0xE58E27D6u, 0x36694815u, 0x7FC3EE3Eu,
+  0x1CEBFBD0u, 0x08483EB1u, 0x5B58A41Eu, 0x240C8DECu, 0x0B90EBADu, 0xE9FF2A75u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x72DD8153u, 0xFC284EF8u,
+  0x75BA8768u, 0x16DE0B33u, 0xC9DCBDF6u, 0x811C9DC5u, 0x811C9DC5u, 0x9A595A64u,
+  0x843498A5u, 0xA28DB0ECu, 0xF90C4A3Bu, 0xD033FE16u, 0x3676CF57u, 0x9FACFAA6u,
+  0xEC02A8F0u, 0x3A5954F7u, 0x811C9DC5u, 0x811C9DC5u, 0x240C8DECu, 0x5131974Eu,
+  0x64186242u, 0xDFF8E7A7u, 0x9BC2DB96u, 0x572826A4u, 0xC4A1D841u, 0x811C9DC5u,
+  0x811C9DC5u, 0x00946FE0u, 0x35277462u, 0x49CA2BEAu, 0x811C9DC5u, 0xF4FC3600u,
+  0x347F4328u, 0x4C0B39E4u, 0x4F70F9FCu, 0xCBE8CA91u, 0xBE80A4DAu, 0x644E682Eu,
+  0x0A8CFE65u, 0x95DD2741u, 0x8797B6B1u, 0x01A86990u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x95FFCF2Fu, 0x936EA7E7u,
+  0x81528CD3u, 0x1217D0CDu, 0xE1DC10E8u, 0xFE9D0E61u, 0x1AADBD11u, 0x381C9981u,
+  0x811C9DC5u, 0x1153B9C3u, 0xDE31E145u, 0xF1582B5Au, 0x811C9DC5u, 0x811C9DC5u,
+  0xDCFBC9FAu, 0xDCF55473u, 0x60C340E0u, 0x915FBE5Fu, 0x92BE45E8u, 0x54E088B7u,
+  0x480B3398u, 0x9CA99328u, 0x44B5639Au, 0x811C9DC5u, 0x811C9DC5u, 0xC393D4E9u,
+  0x08A51162u, 0x5D49E70Cu, 0x4418E313u, 0x3321B936u, 0x4C229FB5u, 0xDA81DFC1u,
+  0x3C854FECu, 0x505B341Bu, 0xB86E2586u, 0x8638F2B2u, 0x319B856Eu, 0xB99F33BCu,
+  0x811C9DC5u, 0x330CA589u, 0x5D519D08u, 0x811C9DC5u, 0x811C9DC5u, 0x74C01735u,
+  0x25EF4711u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x3D72DDC8u, 0xE0C22AF3u, 0xBB885FCEu, 0x628CE404u, 0x6F13821Bu,
+  0xD7F5D613u, 0x7DEA5934u, 0xB6C98C03u, 0xF336F11Eu, 0x8FFC3ED6u, 0xB8ECE55Cu,
+  0x1660CF36u, 0x5B29A249u, 0x8015E16Au, 0xADFA0236u, 0x91EEB593u, 0x93EFCF05u,
+  0x52AB0375u, 0x3C4CADFEu, 0xA90F20A5u, 0xBD6E4B0Bu, 0x4A1028A4u, 0xCE566541u,
+  0x4003AB37u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x7A986967u, 0x0EC70076u,
+  0x280648E6u, 0xF339ECF2u, 0xF3E155EAu, 0x4C0B39E4u, 0x8F9A05CAu, 0x3E2E3BD6u,
+  0xC47BED46u, 0xAA584C73u, 0xD76E8E52u, 0x8849E1EDu, 0xCCF99CA1u, 0xC923CB75u,
+  0x23D698DCu, 0x811C9DC5u, 0x7339265Au, 0x9FC81B32u, 0x2953CC38u, 0x64604353u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0xC9224C30u, 0xB5B4B293u, 0x2A952D84u,
+  0x250462F4u, 0xE9C689DFu, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0xD596EBB8u, 0x48CBF274u, 0xD524EBB7u, 0xC9C613F3u, 0xD9620F31u,
+  0x2734AD21u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x1FC15482u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x56FB2865u, 0xD9E4EFADu,
+  0x811C9DC5u, 0x811C9DC5u, 0xFA1A7F28u, 0xA3E260DDu, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x480B3398u, 0x4F0B3E9Du, 0x811C9DC5u, 0x4D624EADu, 0xBF97D88Bu, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0xCFA1E992u,
+  0x53E4F5B5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x62336E34u,
+  0xBB2A06EFu, 0xCBA7D8A5u, 0x70FA9B38u, 0x7F6DBB3Fu, 0x61288957u, 0x50EEA179u,
+  0xF2FDC5DAu, 0x55BF3717u, 0x99CF2599u, 0x811C9DC5u, 0x811C9DC5u, 0xBB92C55Cu,
+  0x02A952CEu, 0xAA5F5F29u, 0x3769AB90u, 0xD61F7019u, 0x9409B420u, 0xB18A8878u,
+  0xCCF6F53Du, 0xA61995FBu, 0x4E668B32u, 0x2390F0E8u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0xDEC49371u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x460B3072u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x99060CEBu, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x260C9112u,
+  0xFED482D0u, 0x811C9DC5u, 0x811C9DC5u, 0x330CA589u, 0xB8A01A03u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0xE157D440u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x71BEA36Eu, 0xE422C466u, 0x65A4BD1Fu, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+  0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u, 0x811C9DC5u,
+};
+
+// One bit per address a block starts at
+static const uint32_t precompiled_entries[747] = {
+  0x01010101u, 0x00010101u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x04400000u, 0x64804040u,
+  0x00008040u, 0x00000048u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0xC0000000u, 0x04041204u, 0x00000000u, 0x00000000u, 0x44120112u, 0x10080200u,
+  0x08000204u, 0x88020000u, 0x04040100u, 0x02600014u, 0x80000000u, 0x20010004u,
+  0x20240040u, 0x02022008u, 0x04000000u, 0x00900C00u, 0x02001248u, 0x80000000u,
+  0x02600004u, 0x08000000u, 0x000200C8u, 0x00000000u, 0x00C0042Cu, 0x04000400u,
+  0xC5220000u, 0x00009048u, 0x00000000u, 0x00080000u, 0x00090000u, 0x08200108u,
+  0x0048A002u, 0x00400A00u, 0x10000402u, 0x08000100u, 0x04410088u, 0x0000200Cu,
+  0x00004900u, 0x12204400u, 0x00000000u, 0x06380000u, 0x008C0000u, 0x02084000u,
+  0x80008000u, 0x08048001u, 0x00002020u, 0x12002000u, 0x40030800u, 0x12040000u,
+  0x00000000u, 0x00000000u, 0x52420242u, 0x00000200u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x10220000u, 0x00008008u, 0x00184004u, 0x00000010u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00026060u, 0x8180081Cu, 0x00000000u,
+  0x20000000u, 0x40000010u, 0x02400048u, 0x00484200u, 0x00060808u, 0x00039140u,
+  0x3404A400u, 0x04000481u, 0x09000202u, 0x00001251u, 0x04800000u, 0x00002038u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x60412000u, 0x125000C4u, 0x04A10000u,
+  0x28000000u, 0x00000048u, 0x89924020u, 0x001A0080u, 0x00000009u, 0x00000000u,
+  0x00000000u, 0x80000000u, 0x00000012u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00022092u, 0x00088884u, 0x80000000u, 0x00060020u, 0x044920B4u,
+  0x00120000u, 0x00000000u, 0x00019000u, 0xE1000000u, 0x11012408u, 0x80040010u,
+  0x00000000u, 0x00000000u, 0x44000920u, 0x220A4000u, 0x60000009u, 0x00080000u,
+  0x00000000u, 0x80010000u, 0x01000000u, 0x40869000u, 0x00005209u, 0x00000000u,
+  0x00000000u, 0x10040000u, 0x121004A0u, 0x00024600u, 0x00000000u, 0x02424010u,
+  0x00004440u, 0x00000200u, 0x09400000u, 0x00104121u, 0x00000004u, 0x00004200u,
+  0x00021008u, 0x00800100u, 0x00000081u, 0x08011001u, 0x42080000u, 0x00A00000u,
+  0x00008004u, 0x00000010u, 0x20020001u, 0x20002020u, 0x08000011u, 0x00004100u,
+  0x00002400u, 0x50000000u, 0x00000000u, 0x00000000u, 0x00480800u, 0x00090024u,
+  0x40400800u, 0x88002000u, 0x91300044u, 0x00000242u, 0x01412000u, 0x40000020u,
+  0x00005000u, 0x00000000u, 0x08924924u, 0x6004A102u, 0x81080010u, 0x00440000u,
+  0x20001408u, 0xC4200010u, 0x00442324u, 0x00809000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x85001000u, 0x00000020u, 0x00000000u, 0x11008400u,
+  0x48088800u, 0xC900C040u, 0x00010024u, 0x00420140u, 0x44200800u, 0x48402442u,
+  0x209492C4u, 0x08021008u, 0x04001190u, 0x81244400u, 0x48000110u, 0x01220000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x01000000u, 0x00000052u, 0x00000000u, 0x00000000u,
+  0x24112000u, 0x00000021u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x84000000u, 0x00A48000u, 0x00000080u, 0x92000000u,
+  0x00000000u, 0x00000000u, 0x00000800u, 0x00200000u, 0x00000000u, 0x00000401u,
+  0x90000401u, 0x00040004u, 0x00908000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x49010080u, 0x88000092u, 0x00802102u, 0x09200090u, 0x04046000u, 0x80206000u,
+  0x04004000u, 0x20014000u, 0x00000011u, 0x82000018u, 0xC1100820u, 0x40000020u,
+  0x02400100u, 0x06000380u, 0x10000004u, 0x02008000u, 0x20000200u, 0x00400008u,
+  0x80060000u, 0x1C404004u, 0x41800021u, 0x04030200u, 0x90024002u, 0x40230142u,
+  0x10400000u, 0x0040108Cu, 0x00000012u, 0x04002080u, 0x30000100u, 0x29C00880u,
+  0x00030000u, 0x0C024800u, 0x04184804u, 0x50841090u, 0x80000000u, 0x00402000u,
+  0x00000000u, 0x00000000u, 0x00801000u, 0x01000220u, 0x00000000u, 0x40000000u,
+  0x10000000u, 0x10808000u, 0x00060100u, 0x00238200u, 0x00000000u, 0x00002000u,
+  0x03000200u, 0x02000801u, 0x00000010u, 0x08000000u, 0x00089000u, 0x28000000u,
+  0x00000209u, 0x20044140u, 0x10040091u, 0x04020000u, 0x00820209u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00048020u, 0x01004002u, 0x00001800u, 0x00000010u,
+  0x20000000u, 0x00028049u, 0x00000000u, 0x000188B0u, 0x01004008u, 0x01001000u,
+  0x44900000u, 0x00002492u, 0x30000000u, 0x02000881u, 0x00200000u, 0x00005000u,
+  0x20402000u, 0x80008040u, 0x04004840u, 0x40000000u, 0x00000000u, 0x06000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00910000u, 0x00640000u, 0x40040824u,
+  0x20804006u, 0x01000000u, 0x50101100u, 0x24000000u, 0x00100808u, 0x88244200u,
+  0x20000240u, 0x04820002u, 0x00000400u, 0x00000020u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x40004000u, 0xC0200011u, 0x00004002u, 0x80080124u,
+  0x48010000u, 0x80100908u, 0x04812000u, 0x00000001u, 0x09901200u, 0x00222003u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x12080000u, 0x18212420u,
+  0x00088238u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x06000000u, 0x10000004u, 0x00040044u, 0x00000020u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x12400000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000006u, 0x00000000u, 0x00020200u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00024000u, 0x00040000u, 0x00000040u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x90000000u, 0x00002400u, 0x00000000u, 0x10020000u,
+  0x00400000u, 0x80000040u, 0x01801010u, 0x08040000u, 0x00000000u, 0x040B0000u,
+  0x00100000u, 0x00000000u, 0x04080008u, 0x5080A400u, 0x00000212u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00001400u, 0x00000000u,
+  0x00000000u, 0x00000020u, 0x00000000u, 0x00000000u, 0x00000040u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00100000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x0A448800u, 0x00000004u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x00000000u, 0x00000000u, 0x00000000u,
+};
+
+// Blocks starting before each word of precompiled_entries
+static const uint16_t precompiled_ranks[747] = {
+  0, 4, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 9, 15, 17, 19, 19, 19, 19,
+  19, 21, 26, 26, 26, 33, 36, 39, 42, 45, 50, 51,
+  54, 58, 62, 63, 67, 72, 73, 77, 78, 82, 82, 88,
+  90, 96, 100, 100, 101, 103, 107, 112, 115, 118, 120, 125,
+  128, 131, 136, 136, 141, 144, 147, 149, 153, 155, 158, 162,
+  165, 165, 165, 173, 174, 174, 174, 174, 174, 177, 179, 183,
+  184, 184, 184, 184, 189, 196, 196, 197, 199, 203, 207, 211,
+  217, 224, 228, 232, 237, 239, 243, 243, 243, 243, 248, 255,
+  259, 261, 263, 271, 275, 277, 277, 277, 278, 280, 280, 280,
+  280, 280, 280, 280, 280, 280, 280, 280, 285, 290, 291, 294,
+  303, 305, 305, 308, 312, 318, 321, 321, 321, 326, 331, 335,
+  336, 336, 338, 339, 345, 350, 350, 350, 352, 358, 362, 362,
+  367, 370, 371, 374, 379, 380, 382, 385, 387, 389, 393, 396,
+  398, 400, 401, 404, 407, 410, 412, 414, 416, 416, 416, 419,
+  423, 426, 429, 436, 439, 443, 445, 447, 447, 456, 463, 467,
+  469, 473, 478, 485, 488, 488, 488, 488, 488, 492, 493, 493,
+  497, 502, 509, 512, 516, 520, 527, 537, 541, 546, 552, 556,
+  559, 559, 559, 559, 559, 559, 559, 559, 559, 560, 563, 563,
+  563, 568, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570,
+  570, 570, 570, 570, 570, 570, 570, 570, 570, 572, 576, 577,
+  580, 580, 580, 581, 582, 582, 584, 588, 590, 593, 593, 593,
+  593, 593, 593, 593, 593, 593, 593, 593, 593, 593, 593, 593,
+  593, 593, 593, 593, 593, 593, 593, 593, 593, 593, 593, 593,
+  593, 598, 603, 607, 612, 616, 620, 622, 625, 627, 631, 637,
+  639, 642, 647, 649, 651, 653, 655, 658, 664, 669, 673, 678,
+  685, 687, 692, 694, 697, 700, 707, 709, 714, 720, 727, 728,
+  730, 730, 730, 732, 735, 735, 736, 737, 740, 743, 748, 748,
+  749, 752, 755, 756, 757, 760, 762, 765, 770, 775, 777, 782,
+  782, 782, 782, 785, 788, 790, 791, 792, 797, 797, 803, 806,
+  808, 812, 817, 819, 823, 824, 826, 829, 832, 836, 837, 837,
+  839, 839, 839, 839, 839, 839, 839, 839, 839, 839, 842, 845,
+  850, 855, 856, 861, 863, 866, 872, 875, 879, 880, 881, 881,
+  881, 881, 881, 881, 881, 881, 881, 881, 881, 883, 888, 890,
+  895, 898, 903, 907, 908, 914, 919, 919, 919, 919, 919, 922,
+  929, 935, 935, 935, 935, 935, 935, 935, 935, 935, 935, 935,
+  935, 937, 939, 942, 943, 943, 943, 943, 943, 943, 943, 943,
+  943, 943, 943, 943, 943, 943, 943, 943, 943, 943, 943, 943,
+  943, 943, 943, 943, 943, 943, 943, 943, 943, 943, 943, 943,
+  943, 943, 943, 943, 943, 946, 946, 946, 946, 946, 946, 946,
+  946, 946, 946, 948, 948, 950, 950, 950, 950, 950, 950, 950,
+  950, 950, 950, 950, 952, 953, 954, 954, 954, 954, 954, 954,
+  954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954,
+  954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954,
+  954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954,
+  954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954,
+  954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954,
+  954, 954, 954, 956, 958, 958, 960, 961, 963, 967, 969, 969,
+  973, 974, 974, 977, 983, 986, 986, 986, 986, 986, 986, 988,
+  988, 988, 989, 989, 989, 990, 990, 990, 990, 990, 990, 990,
+  990, 990, 990, 990, 990, 990, 990, 990, 990, 991, 991, 992,
+  992, 992, 992, 992, 992, 992, 993, 993, 993, 993, 999, 1000,
+  1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000,
+  1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000,
+  1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000,
+  1000, 1000, 1000,
+};
+
+static int (*const precompiled_blocks[1000])(struct i8080 *) = {
+  block_0000, block_0008, block_0010, block_0018, block_0020, block_0028,
+  block_0030, block_0C96, block_0C9A, block_0CA6, block_0CAE, block_0CB7,
+  block_0CBA, block_0CBD, block_0CBE, block_0CC6, block_0CCF, block_0CE3,
+  block_0CE6, block_0D9E, block_0D9F, block_0DA2, block_0DA9, block_0DAC,
+  block_0DB2, block_0DBA, block_0E01, block_0E04, block_0E08, block_0E11,
+  block_0E14, block_0E1A, block_0E1E, block_0E29, block_0E33, block_0E3C,
+  block_0E42, block_0E49, block_0E5B, block_0E71, block_0E7B, block_0E7F,
+  block_0E88, block_0E92, block_0E9A, block_0EA2, block_0EA4, block_0EB5,
+  block_0EB6, block_0EB9, block_0EDF, block_0EE2, block_0EF0, block_0EFD,
+  block_0F06, block_0F12, block_0F15, block_0F1D, block_0F23, block_0F2D,
+  block_0F31, block_0F39, block_0F5A, block_0F6A, block_0F6B, block_0F74,
+  block_0F77, block_0F83, block_0F86, block_0F89, block_0F8C, block_0F99,
+  block_0FBF, block_0FC2, block_0FD5, block_0FD6, block_0FD9, block_0FFB,
+  block_1003, block_1006, block_1007, block_1011, block_1042, block_1043,
+  block_1045, block_104A, block_1056, block_1057, block_106A, block_107A,
+  block_1091, block_1095, block_1098, block_109A, block_109E, block_109F,
+  block_10A3, block_10A6, block_10AC, block_10AF, block_10F3, block_1110,
+  block_1113, block_1123, block_1128, block_1135, block_113B, block_1141,
+  block_114D, block_114F, block_1153, block_1156, block_1169, block_116B,
+  block_1176, block_1181, block_118A, block_119C, block_11A8, block_11BB,
+  block_11C3, block_11C7, block_11D0, block_11D6, block_11DA, block_11E2,
+  block_11E3, block_11ED, block_1208, block_120B, block_120E, block_122A,
+  block_122E, block_1235, block_1239, block_123C, block_1273, block_1274,
+  block_1275, block_1279, block_127A, block_1292, block_1293, block_1297,
+  block_12AE, block_12B3, block_12B9, block_12CF, block_12DF, block_12E0,
+  block_12EF, block_12F2, block_12FB, block_1305, block_130D, block_132D,
+  block_1339, block_133C, block_134B, block_1350, block_1351, block_135E,
+  block_1372, block_1379, block_137C, block_13C1, block_13C6, block_13C9,
+  block_13D1, block_13D6, block_13D9, block_13DC, block_13DE, block_13E9,
+  block_1491, block_1495, block_149C, block_14A3, block_14AF, block_14C2,
+  block_14CE, block_14D3, block_14D4, block_14E4, block_1565, block_1566,
+  block_156D, block_156E, block_1571, block_1582, block_1583, block_1584,
+  block_158B, block_1597, block_1598, block_159F, block_15DD, block_15E4,
+  block_15FE, block_1603, block_1606, block_1616, block_1619, block_1629,
+  block_162E, block_1633, block_1636, block_1643, block_164B, block_1651,
+  block_1652, block_1666, block_1668, block_166C, block_166F, block_1670,
+  block_1671, block_168A, block_168D, block_168F, block_1692, block_169A,
+  block_169C, block_169D, block_16A0, block_16A7, block_16AA, block_16BA,
+  block_16C1, block_16C9, block_16D8, block_16DB, block_16E0, block_16E4,
+  block_16E6, block_16E9, block_16EC, block_1717, block_171A, block_1723,
+  block_1724, block_1725, block_172D, block_17AD, block_17B0, block_17B6,
+  block_17BD, block_17BE, block_17C2, block_17C6, block_17C7, block_17D4,
+  block_17D6, block_17D9, block_17DC, block_17F0, block_17F5, block_17F7,
+  block_17FA, block_181B, block_181D, block_1823, block_1826, block_1845,
+  block_184E, block_1851, block_1854, block_1857, block_1858, block_185B,
+  block_185F, block_1867, block_1871, block_1873, block_1874, block_1880,
+  block_1883, block_18FF, block_1901, block_1904, block_1A61, block_1A64,
+  block_1A67, block_1A6D, block_1A71, block_1A82, block_1A87, block_1A8B,
+  block_1A8F, block_1A93, block_1ABF, block_1AC5, block_1AD1, block_1AD2,
+  block_1AE2, block_1AE4, block_1AE5, block_1AE7, block_1AED, block_1AF0,
+  block_1AF3, block_1AF6, block_1AFA, block_1B11, block_1B14, block_1B4C,
+  block_1B4F, block_1B50, block_1B78, block_1B7D, block_1B7E, block_1B7F,
+  block_1B83, block_1B8A, block_1B8D, block_1B90, block_1B98, block_1B9C,
+  block_1BA4, block_1BB2, block_1BBF, block_1C05, block_1C08, block_1C0B,
+  block_1C1A, block_1C1E, block_1C2E, block_1C31, block_1C33, block_1C39,
+  block_1C3D, block_1C40, block_1C43, block_1C5D, block_1C5E, block_1C73,
+  block_1CB0, block_1CBF, block_1CD8, block_1CEC, block_1CEF, block_1CF1,
+  block_1CF2, block_1CF7, block_1CFE, block_1D00, block_1D03, block_1D09,
+  block_1D0C, block_1D0E, block_1D72, block_1D7C, block_1D85, block_1D87,
+  block_1D8A, block_1D94, block_1D99, block_1D9C, block_1DA9, block_1DAA,
+  block_1DAE, block_1DB1, block_1DE4, block_1DEE, block_1DF1, block_1DF6,
+  block_1DF9, block_1E06, block_1E0A, block_1E0E, block_1E29, block_1E56,
+  block_1E58, block_1E5B, block_1E60, block_1E65, block_1E68, block_1E6E,
+  block_1E74, block_1E82, block_1EA9, block_1EAE, block_1EC3, block_1ECC,
+  block_1ED1, block_1EE8, block_1EF7, block_1F00, block_1F07, block_1F20,
+  block_1F2C, block_1F30, block_1F3B, block_1F53, block_1F59, block_1F5E,
+  block_1F75, block_1F77, block_1F82, block_1F8F, block_1FA4, block_1FC0,
+  block_1FD1, block_1FDD, block_1FE5, block_1FED, block_1FFD, block_2000,
+  block_2004, block_201B, block_2028, block_202E, block_204A, block_204D,
+  block_207C, block_207E, block_20CB, block_20D3, block_20D6, block_20E2,
+  block_20E5, block_20F0, block_20F3, block_210B, block_2116, block_211E,
+  block_212D, block_213B, block_213F, block_2142, block_2146, block_2154,
+  block_2155, block_2158, block_215C, block_215F, block_2161, block_2166,
+  block_2169, block_218D, block_2190, block_2196, block_2198, block_21A5,
+  block_21BE, block_21CC, block_21CE, block_2202, block_2205, block_2208,
+  block_220B, block_220E, block_2211, block_2214, block_2217, block_221B,
+  block_2221, block_2228, block_222D, block_222F, block_2232, block_223D,
+  block_223E, block_2244, block_2253, block_2258, block_225F, block_2272,
+  block_2276, block_2283, block_228A, block_228C, block_229D, block_22A4,
+  block_22B5, block_22BA, block_22BE, block_22BF, block_22C2, block_22C5,
+  block_22C8, block_22C9, block_22CD, block_22D2, block_22D6, block_22EC,
+  block_22EF, block_22F7, block_238C, block_2398, block_239A, block_239F,
+  block_23A5, block_23EA, block_23EF, block_23F8, block_23FC, block_240B,
+  block_240F, block_2413, block_241B, block_241E, block_2426, block_242E,
+  block_242F, block_2438, block_243B, block_243E, block_243F, block_2442,
+  block_2445, block_2450, block_2466, block_2468, block_2471, block_2476,
+  block_248B, block_2495, block_249A, block_249E, block_24A1, block_24A6,
+  block_24AA, block_24AD, block_24B6, block_24BB, block_24BE, block_24C2,
+  block_24C6, block_24C7, block_24C9, block_24CC, block_24CF, block_24D2,
+  block_24D4, block_24D7, block_24DD, block_24E3, block_24EC, block_24F1,
+  block_24FB, block_2504, block_2507, block_2508, block_250C, block_251A,
+  block_252A, block_252E, block_2532, block_2535, block_2538, block_253F,
+  block_2544, block_2548, block_255B, block_255E, block_2571, block_2575,
+  block_2578, block_2698, block_26A1, block_26A4, block_26A6, block_270D,
+  block_2710, block_2714, block_271A, block_271D, block_2720, block_2725,
+  block_299A, block_299F, block_29AF, block_29B2, block_29B5, block_29B7,
+  block_29C7, block_29F9, block_29FC, block_29FF, block_2A4B, block_2A75,
+  block_2AA0, block_2AAA, block_2AC0, block_2ACA, block_2ADC, block_2ADF,
+  block_2AE2, block_2AF2, block_2B0F, block_2B14, block_2B17, block_2E87,
+  block_2E90, block_2E98, block_2E9B, block_2E9E, block_2EA1, block_2EA4,
+  block_2EA7, block_2EBB, block_2EBF, block_2EC1, block_2EC8, block_2ECD,
+  block_2ED7, block_2EE4, block_2EE7, block_2EF5, block_2EF8, block_2EFB,
+  block_2F0D, block_2F0E, block_2F12, block_2F1A, block_2F2D, block_2F2E,
+  block_2F35, block_2F3F, block_2F4E, block_2F5A, block_2F6E, block_2F70,
+  block_2F7D, block_2F80, block_2F84, block_2FA3, block_2FA4, block_2FB9,
+  block_2FBF, block_2FC5, block_2FCB, block_2FD4, block_2FD8, block_2FDE,
+  block_2FDF, block_2FE5, block_2FFE, block_3008, block_3016, block_3019,
+  block_3027, block_3028, block_3029, block_3039, block_303A, block_3042,
+  block_305C, block_306F, block_3079, block_3089, block_309D, block_30A3,
+  block_30B6, block_30D1, block_30D2, block_30DF, block_30E2, block_30EE,
+  block_30F6, block_30FA, block_30FB, block_30FC, block_3100, block_3105,
+  block_3117, block_3118, block_311E, block_3129, block_3130, block_3131,
+  block_313A, block_3141, block_314E, block_3151, block_315C, block_315F,
+  block_3161, block_3166, block_3168, block_3170, block_3171, block_3175,
+  block_317E, block_3196, block_319C, block_31A2, block_31A3, block_31A7,
+  block_31AC, block_31B6, block_31C1, block_31C4, block_31E7, block_31ED,
+  block_31FA, block_3208, block_321C, block_321D, block_3227, block_322B,
+  block_3236, block_3237, block_3238, block_323B, block_323D, block_3250,
+  block_3251, block_326B, block_326E, block_3271, block_327A, block_327B,
+  block_3282, block_328B, block_328E, block_3293, block_3294, block_329A,
+  block_32A4, block_32A7, block_32AC, block_32B2, block_32B7, block_32BC,
+  block_32BE, block_32DF, block_32ED, block_32F6, block_334C, block_3357,
+  block_3365, block_3369, block_3378, block_33BE, block_33DC, block_33EF,
+  block_33F7, block_33FC, block_3408, block_3411, block_3412, block_3429,
+  block_342F, block_3430, block_3431, block_3435, block_346D, block_3489,
+  block_3498, block_3499, block_34A0, block_34AB, block_34B9, block_34C4,
+  block_34FB, block_350C, block_350F, block_3513, block_353B, block_353D,
+  block_3540, block_3543, block_3549, block_3566, block_3568, block_356E,
+  block_3572, block_357D, block_3580, block_3584, block_3587, block_3592,
+  block_359C, block_35B1, block_35BA, block_35C0, block_35C3, block_35C9,
+  block_35D1, block_35D7, block_3645, block_364F, block_3652, block_3661,
+  block_366E, block_3678, block_368B, block_368C, block_36A4, block_36DD,
+  block_36E0, block_36E3, block_36E6, block_36EF, block_36F1, block_3724,
+  block_3725, block_3727, block_372B, block_372F, block_3730, block_3743,
+  block_374E, block_3758, block_376C, block_3778, block_3794, block_3797,
+  block_379A, block_379E, block_37A1, block_37A4, block_37A7, block_37AA,
+  block_37AD, block_37DC, block_37DD, block_37E0, block_37E7, block_37EB,
+  block_37F9, block_3815, block_382C, block_382E, block_384D, block_3856,
+  block_385D, block_3866, block_386F, block_387F, block_3886, block_388B,
+  block_388E, block_389A, block_38BE, block_38F9, block_38FA, block_3A30,
+  block_3A34, block_3A37, block_3A52, block_3A55, block_3A56, block_3A62,
+  block_3A65, block_3A6B, block_3A72, block_3A7E, block_3A81, block_3A82,
+  block_3A8E, block_3A97, block_3A9D, block_3AB8, block_3AC8, block_3ACC,
+  block_3AD4, block_3ADC, block_3ADE, block_3AFA, block_3AFD, block_3B03,
+  block_3B0B, block_3B14, block_3B29, block_3B2E, block_3B32, block_3B35,
+  block_3B3B, block_3B3F, block_3B46, block_3B49, block_3B5D, block_3B61,
+  block_3B71, block_3B77, block_3B7A, block_3B8A, block_3BA5, block_3D0E,
+  block_3D1E, block_3D20, block_3D24, block_3D35, block_3D3E, block_3D3F,
+  block_3D41, block_3D4E, block_3D62, block_3D65, block_3D68, block_3D73,
+  block_3D7F, block_3D90, block_3D9B, block_3D9E, block_3DA3, block_3DA8,
+  block_3DAB, block_3DB4, block_3DBF, block_3DCD, block_3DD0, block_3DD7,
+  block_3DDA, block_3DE0, block_3E09, block_3E0C, block_3E14, block_3E17,
+  block_3E18, block_3E1B, block_3E20, block_3E21, block_3E2D, block_3E31,
+  block_3E35, block_3ED3, block_3ED9, block_3EDC, block_3EE5, block_3EEA,
+  block_3EED, block_3EF0, block_3EF5, block_3EFB, block_3EFC, block_3F03,
+  block_3F04, block_3F05, block_3F09, block_3F0F, block_3F13, block_4099,
+  block_409A, block_40A2, block_40BC, block_40C2, block_40C6, block_40D2,
+  block_40E5, block_4596, block_4599, block_459C, block_46C1, block_46C2,
+  block_4709, block_4711, block_486E, block_4871, block_4892, block_48A6,
+  block_515C, block_515F, block_516A, block_516D, block_51B1, block_51BC,
+  block_51D6, block_51E6, block_51FF, block_5204, block_520C, block_5217,
+  block_5218, block_5232, block_523B, block_5270, block_5271, block_5273,
+  block_527A, block_5294, block_52C3, block_52D3, block_52DA, block_52EA,
+  block_52ED, block_52EF, block_52F7, block_52FC, block_52FE, block_5301,
+  block_5304, block_5309, block_53CA, block_53CC, block_5425, block_5486,
+  block_569F, block_56DF, block_57B4, block_582B, block_582F, block_5832,
+  block_5836, block_5839, block_583B, block_5842,
+};
@@ -2,12 +2,66 @@
 #define LIB8080_H_
 
 #include <stddef.h>
+#include <stdint.h>
+
+// Build options, defined on the compiler command line
+//
+// I8080_DISPATCH_TABLE  Dispatch through a table of handlers specialised per
+//                       opcode instead of the switch in i8080_step
+// I8080_LAZY_FLAGS      Keep the last ALU result and only work out flags
+//                       when they are read, so flags is only current after
+//                       i8080_sync_flags
+// I8080_NO_CYCLES       Count every instruction as one cycle, so cyc and
+//                       i8080_run budgets count instructions
+// I8080_NO_INTERRUPTS   Leave out i8080_request_interrupt and the checks
+//                       for a pending interrupt
+// I8080_TRACE           Call trace_handler before each instruction, which
+//                       i8080_run then always interprets
+// I8080_MEMORY_64K      Memory is a flat 64 KiB, so addresses only wrap at
+//                       16 bits and are never checked against memsize
+// I8080_ALU_TABLES      Take ALU flags and DAA from tables built in RAM on
+//                       the first i8080_reset
+// I8080_BLOCK_CACHE     Let i8080_run replay pre-decoded basic blocks from
+//                       an i8080_block_cache attached with
+//                       i8080_set_block_cache
+// I8080_JIT             Let i8080_run call x86-64 code translated by
+//                       src/i8080_jit.c, see i8080_jit.h
+// I8080_SUPERINSTRUCTIONS
+//                       Let the block cache decode the opcode sequences in
+//                       i8080_superinstructions.h, written by
+//                       host/profile.c, to one handler each. Needs
+//                       I8080_BLOCK_CACHE
+// I8080_FLAG_LIVENESS   Let the block cache decode instructions whose flags
+//                       are all written again before being read to
+//                       handlers that leave them out. Needs
+//                       I8080_BLOCK_CACHE
+// I8080_PRECOMPILED     Header of C blocks written by host/precompile.c,
+//                       as a quoted file name, that i8080_run calls once
+//                       i8080_set_precompiled has checked memory holds the
+//                       image they were generated from
+// I8080_PAGE_CACHE      Let memory accesses go through a write-back cache of
+//                       pages attached with i8080_set_page_cache, so memory
+//                       itself can sit on a slower bus. Does not work with
+//                       I8080_JIT
+// I8080_LAZY_MEMORY     Let i8080_clear_memory and i8080_map_image set up
+//                       memory without writing it, by keeping a map of
+//                       which pages memory holds. Does not work with
+//                       I8080_JIT
+// I8080_DIRTY_PAGES     Keep a bitmap of the pages written through the API
+//                       or by I8080_JIT code, read with i8080_page_dirty and
+//                       cleared with i8080_clear_dirty_pages
 
 typedef unsigned int uint;
 
 struct i8080;
+struct i8080_jit;
+struct i8080_io;
 typedef uint (*i8080_in_handler)(struct i8080 *, uint);
 typedef void (*i8080_out_handler)(struct i8080 *, uint, uint);
+typedef void (*i8080_op_handler)(struct i8080 *, uint);
+#ifdef I8080_TRACE
+typedef void (*i8080_trace_handler)(struct i8080 *, uint pc, uint opcode);
+#endif
 
 #define I8080_RST_0 0xC7
 #define I8080_RST_1 0xCF
@@ -18,37 +72,293 @@ typedef void (*i8080_out_handler)(struct i8080 *, uint, uint);
 #define I8080_RST_6 0xF7
 #define I8080_RST_7 0xFF
 
+// Why i8080_run returned
+enum i8080_exit_reason {
+  I8080_EXIT_BUDGET,    // Cycle budget used up
+  I8080_EXIT_HALT,      // HLT executed, or halted on entry
+  I8080_EXIT_INTERRUPT, // Interrupt requested, taken by the next call
+  I8080_EXIT_IO         // IN or OUT handler called i8080_yield
+};
+
+struct i8080_exit {
+  enum i8080_exit_reason reason;
+  uint cycles;
+  uint port; // IN or OUT port for I8080_EXIT_IO
+};
+
+#ifdef I8080_BLOCK_CACHE
+// Blocks are direct mapped on their start address, so the size must be a
+// power of two
+#ifndef I8080_BLOCK_CACHE_SIZE
+#define I8080_BLOCK_CACHE_SIZE 256
+#endif
+
+// Most instructions in one block; a block also ends after any instruction
+// that can change PC, halt or do I/O
+#ifndef I8080_BLOCK_LENGTH
+#define I8080_BLOCK_LENGTH 8
+#endif
+
+// Writes are only checked against blocks when they land in a code page
+#define I8080_CODE_PAGE_SHIFT 4
+
+struct i8080_uop {
+  i8080_op_handler handler;
+  uint16_t operand;
+  uint16_t next_pc;
+};
+
+struct i8080_block {
+  uint16_t pc;
+  uint8_t length; // Bytes of code
+  uint8_t count;  // Instructions, 0 if empty or invalidated
+  uint16_t cycles; // Most cycles the block can take
+  struct i8080_uop uops[I8080_BLOCK_LENGTH];
+};
+
+struct i8080_block_cache {
+  struct i8080_block blocks[I8080_BLOCK_CACHE_SIZE];
+  uint8_t code_pages[(0x10000 >> I8080_CODE_PAGE_SHIFT) / 8];
+  uint longest; // Bytes in the longest block decoded, how far back a write can hit one
+
+#ifdef I8080_SUPERINSTRUCTIONS
+  // Per opcode, one more than the first superinstruction starting with it
+  uint8_t superinstructions[256];
+#endif
+
+  uint hits;
+  uint misses;
+  uint invalidations;
+#ifdef I8080_FLAG_LIVENESS
+  uint dead_flags; // Uops decoded without their flags
+#endif
+};
+#endif
+
+// Memory is cached and tracked in pages of 256 bytes
+#define I8080_PAGE_SHIFT 8
+#define I8080_PAGE_SIZE (1 << I8080_PAGE_SHIFT)
+#define I8080_PAGES (0x10000 >> I8080_PAGE_SHIFT)
+
+#ifdef I8080_LAZY_MEMORY
+// Where the bytes of a page are read from until it is first written, when
+// it is copied into memory
+enum i8080_page_owner {
+  I8080_PAGE_MEMORY, // Memory itself
+  I8080_PAGE_ZERO,   // Nowhere, the page reads as 0
+  I8080_PAGE_IMAGE   // The image mapped with i8080_map_image
+};
+#endif
+
+#ifdef I8080_PAGE_CACHE
+// Each page can be held in either line of a pair picked by its address,
+// replacing the one used less recently, so the number of lines must be a
+// power of two
+#ifndef I8080_PAGE_CACHE_PAGES
+#define I8080_PAGE_CACHE_PAGES 16
+#endif
+
+struct i8080_page_cache {
+  uint8_t data[I8080_PAGE_CACHE_PAGES][I8080_PAGE_SIZE];
+  uint16_t tags[I8080_PAGE_CACHE_PAGES]; // Page held, or 0xFFFF if none
+  uint8_t dirty[I8080_PAGE_CACHE_PAGES];
+  uint8_t recent[I8080_PAGE_CACHE_PAGES / 2]; // Line of each pair used last
+
+  uint hits;
+  uint misses;
+  uint writebacks; // Dirty pages written back to memory
+};
+#endif
+
+#ifdef I8080_PRECOMPILED
+// Guarded bytes are hashed and tracked in granules of this many bits of
+// address, matching GRANULE_SHIFT in host/precompile.c
+#define I8080_PRECOMPILED_GRANULE_SHIFT 4
+
+struct i8080_precompiled {
+  uint8_t changed[(0x10000 >> I8080_PRECOMPILED_GRANULE_SHIFT) / 8];
+
+  uint hits;   // Blocks run
+  uint misses; // Instructions interpreted
+};
+#endif
+
+// Each register pair is a native 16-bit value overlaid by its two 8-bit
+// registers, so pair and byte access are both a single load. reg is indexed
+// by an opcode's register field through I8080_REG_INDEX, and pair by its
+// register pair field for BC, DE and HL.
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define I8080_REG_INDEX(reg) (reg)
+#else
+#define I8080_REG_INDEX(reg) ((reg) ^ 1)
+#endif
+
 struct i8080 {
-  uint A, B, C, D, E;
-  uint H, L;
-  uint flags;
-  uint SP;
-  uint PC;
+  union {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    struct { uint8_t B, C, D, E, H, L, flags, A; };
+#else
+    struct { uint8_t C, B, E, D, L, H, A, flags; };
+#endif
+    struct { uint16_t BC, DE, HL; };
+    uint8_t reg[8];
+    uint16_t pair[4];
+  };
+#ifdef I8080_LAZY_FLAGS
+  uint lazy_mask;
+  uint lazy_result;
+  uint lazy_aux;
+#endif
+  uint16_t SP;
+  uint16_t PC;
   int INTE;
   int halted;
   char *memory;
   size_t memsize;
 
+#ifndef I8080_NO_INTERRUPTS
   int pending_interrupt;
   uint interrupt_opcode;
+#endif
 
   i8080_in_handler input_handler;
   i8080_out_handler output_handler;
+  struct i8080_io *io; // Port table attached with i8080_set_io, see i8080_io.h
+#ifdef I8080_TRACE
+  i8080_trace_handler trace_handler;
+#endif
 
   uint cyc;
+
+  uint run_end;
+  enum i8080_exit_reason exit_reason;
+  uint exit_port;
+
+#ifdef I8080_BLOCK_CACHE
+  struct i8080_block_cache *block_cache;
+#endif
+
+#ifdef I8080_JIT
+  struct i8080_jit *jit;
+#endif
+
+#ifdef I8080_PRECOMPILED
+  struct i8080_precompiled *precompiled;
+#endif
+
+#ifdef I8080_PAGE_CACHE
+  struct i8080_page_cache *page_cache;
+#endif
+
+#ifdef I8080_LAZY_MEMORY
+  uint8_t page_owners[I8080_PAGES]; // An i8080_page_owner for each page
+  const char *image;
+#endif
+
+#ifdef I8080_DIRTY_PAGES
+  uint8_t dirty_pages[I8080_PAGES / 8];
+  uint dirty_generation; // Times the dirty pages have been cleared
+#endif
 };
 
 enum i8080_flag {FLAG_S, FLAG_Z, FLAG_A, FLAG_P, FLAG_C};
 
+// Flag bits of the PSW, as read and written by each opcode
+#define I8080_F_S 0x80
+#define I8080_F_Z 0x40
+#define I8080_F_A 0x10
+#define I8080_F_P 0x04
+#define I8080_F_C 0x01
+#define I8080_F_SZAP (I8080_F_S | I8080_F_Z | I8080_F_A | I8080_F_P)
+#define I8080_F_ALL (I8080_F_SZAP | I8080_F_C)
+
+// Per opcode details from i8080_opcodes.h
+struct i8080_opcode {
+  const char *mnemonic; // printf format, given the operand
+  uint8_t length;
+  uint8_t cycles;       // Cycles, or when the condition fails
+  uint8_t taken_cycles; // Cycles when the condition holds
+  uint8_t flags_read;
+  uint8_t flags_written;
+  uint8_t ends_block;    // Can change PC, halt or do I/O
+  uint8_t writes_memory;
+};
+
+extern const struct i8080_opcode i8080_opcodes[256];
+
 void i8080_reset(struct i8080 *);
 void i8080_load_memory(struct i8080 *, char *, size_t);
 
 void i8080_step(struct i8080 *);
 
+// Runs until at least cycle_budget cycles have passed (less than 2^31), or
+// sooner on HLT, an interrupt request or a call to i8080_yield
+struct i8080_exit i8080_run(struct i8080 *, uint cycle_budget);
+
+// Called from an IN or OUT handler to end the current i8080_run
+void i8080_yield(struct i8080 *);
+
+#ifdef I8080_BLOCK_CACHE
+// Attaches an empty cache, or detaches with NULL. Writes through the API
+// invalidate the blocks they touch, so call this again after changing
+// memory directly.
+void i8080_set_block_cache(struct i8080 *, struct i8080_block_cache *);
+#endif
+
+#ifdef I8080_PRECOMPILED
+// Attaches the precompiled blocks, or detaches with NULL. Granules whose
+// guarded bytes differ from the image are marked changed, as are writes that
+// change them through the API afterwards, so call this again after changing
+// memory directly.
+void i8080_set_precompiled(struct i8080 *, struct i8080_precompiled *);
+#endif
+
+#ifdef I8080_PAGE_CACHE
+// Attaches an empty cache, or writes back and detaches with NULL. Memory
+// only holds the bytes written through the API once written back, so call
+// i8080_flush_page_cache before reading memory directly, and attach the
+// cache again after changing it directly.
+void i8080_set_page_cache(struct i8080 *, struct i8080_page_cache *);
+
+// Writes every dirty page back to memory
+void i8080_flush_page_cache(struct i8080 *);
+#endif
+
+#ifdef I8080_LAZY_MEMORY
+// Makes all of memory read as 0 without writing it. Each page is zeroed on
+// its first write, so reset takes no time whatever the size of memory. Like
+// any direct change to memory, attach caches again afterwards.
+void i8080_clear_memory(struct i8080 *);
+
+// Copies bytes into memory, filling in the rest of any page they land in
+void i8080_copy_memory(struct i8080 *, uint addr, const void *, size_t);
+
+// Makes memory from address 0 read as the image, which must stay in place,
+// such as a constant array in flash. Each whole page of the image is copied
+// into memory on its first write, and a last part page is copied straight
+// away. Like any direct change to memory, attach caches again afterwards.
+void i8080_map_image(struct i8080 *, const void *, size_t);
+#endif
+
+#ifdef I8080_DIRTY_PAGES
+// Whether a page has been written since the dirty pages were last cleared,
+// or since i8080_reset
+int i8080_page_dirty(struct i8080 *, uint page);
+
+uint i8080_count_dirty_pages(struct i8080 *);
+
+// Clears every dirty page, returning the generation that starts, so a
+// reader can tell whether another has cleared them since it last did
+uint i8080_clear_dirty_pages(struct i8080 *);
+#endif
+
 void i8080_set_flag(struct i8080 *, enum i8080_flag, int);
 int i8080_get_flag(struct i8080 *, enum i8080_flag);
+void i8080_sync_flags(struct i8080 *);
 
+#ifndef I8080_NO_INTERRUPTS
 void i8080_request_interrupt(struct i8080 *, uint);
+#endif
 
 void i8080_push_stackb(struct i8080 *, uint);
 void i8080_push_stackw(struct i8080 *, uint);
@@ -62,4 +372,7 @@ void i8080_write_byte(struct i8080 *, uint, uint);
 uint i8080_read_word(struct i8080 *, uint);
 void i8080_write_word(struct i8080 *, uint, uint);
 
+// Writes the instruction at addr to buffer, returning its length in bytes
+uint i8080_disassemble(struct i8080 *, uint addr, char *buffer, size_t size);
+
 #endif
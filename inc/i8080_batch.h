@@ -0,0 +1,69 @@
+#ifndef LIB8080_BATCH_H_
+#define LIB8080_BATCH_H_
+
+#include "i8080.h"
+
+// Many machines in lockstep, for the host build
+//
+// Build src/i8080_batch.c and src/i8080_io.c with the core. A batch holds
+// I8080_BATCH_LANES independent machines as arrays of registers, one lane
+// per machine, each with its own flat 64 KiB of memory. Lanes about to run
+// the same opcode are stepped together as a group. Register operations run
+// in loops over the lanes that the compiler turns into SSE or AVX2 code.
+// Loads and stores go a lane at a time within the group. Machines running
+// the same code stay together, and i8080_batch_run brings them back
+// together after a branch sends them different ways. HLT, IN, OUT, EI, DI,
+// RST, XTHL and DAA go through i8080_step a lane at a time.
+
+#ifndef I8080_BATCH_LANES
+#define I8080_BATCH_LANES 32
+#endif
+
+// i8080_batch_run checks the lanes stepped per group every
+// I8080_BATCH_WINDOW groups, and once the lanes have drifted apart so far
+// that groups average fewer than I8080_BATCH_MIN_GROUP lanes, runs each on
+// its own with i8080_run for the rest of the budget
+#ifndef I8080_BATCH_WINDOW
+#define I8080_BATCH_WINDOW 256
+#endif
+
+#ifndef I8080_BATCH_MIN_GROUP
+#define I8080_BATCH_MIN_GROUP 4
+#endif
+
+struct i8080_batch {
+  // Registers by the opcode register field, B C D E H L and A, with the
+  // flags in place of M
+  uint8_t reg[8][I8080_BATCH_LANES];
+  uint16_t SP[I8080_BATCH_LANES];
+  uint16_t PC[I8080_BATCH_LANES];
+  uint8_t INTE[I8080_BATCH_LANES];
+  uint8_t halted[I8080_BATCH_LANES];
+  uint cyc[I8080_BATCH_LANES];
+
+  char *memory[I8080_BATCH_LANES];
+  struct i8080_io *io[I8080_BATCH_LANES]; // Port table for each lane, or NULL
+
+  uint vector_steps; // Lane steps taken by the vector forms
+  uint scalar_steps; // Lane steps taken through i8080_step
+};
+
+// Resets every lane as i8080_reset does, with no memory or ports, and
+// halted until given memory with i8080_batch_load
+void i8080_batch_init(struct i8080_batch *);
+
+// Copies a machine's registers, memory pointer and port table into a lane,
+// which then runs. Memory must be a flat 64 KiB.
+void i8080_batch_load(struct i8080_batch *, uint lane, struct i8080 *);
+
+// Copies a lane back out to a machine
+void i8080_batch_save(struct i8080_batch *, uint lane, struct i8080 *);
+
+// Executes one instruction on every lane that is not halted
+void i8080_batch_step(struct i8080_batch *);
+
+// Steps until every lane has run at least cycle_budget cycles or halted,
+// returning the number of lanes still running
+uint i8080_batch_run(struct i8080_batch *, uint cycle_budget);
+
+#endif
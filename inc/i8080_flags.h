@@ -0,0 +1,48 @@
+#ifndef LIB8080_FLAGS_H_
+#define LIB8080_FLAGS_H_
+
+#include "i8080.h"
+
+// Flag arithmetic shared by the core and src/i8080_batch.c
+//
+// Each works out the flag bits an operation sets from its operands and
+// result, in arithmetic rather than from tables, so the batch engine's loops
+// over the lanes stay vectorisable. Callers merge the bits into the flags
+// byte, keeping the ones the operation leaves alone.
+
+// Sign, zero and parity of a byte
+static inline uint i8080_szp_flags(uint res) {
+  uint parity = res ^ (res >> 4);
+  parity ^= parity >> 2;
+  parity ^= parity >> 1;
+
+  return (res & 0x80) | (res == 0 ? 0x40 : 0) | ((parity & 1) ? 0 : 0x04);
+}
+
+// All five flags of an addition, given the 9 bit result with any carry in
+static inline uint i8080_add_flags(uint a, uint b, uint res) {
+  return i8080_szp_flags(res & 0xFF) | ((a ^ b ^ res) & 0x10) | ((res >> 8) & 0x01);
+}
+
+// All five flags of a subtraction, worked as an addition of the ones
+// complement of the subtrahend, subt_ones, with the carry in inverted. The
+// carry out is inverted to give the borrow.
+static inline uint i8080_sub_flags(uint minu, uint subt_ones, uint res) {
+  return i8080_szp_flags(res & 0xFF) | ((minu ^ subt_ones ^ res) & 0x10) | ((~res >> 8) & 0x01);
+}
+
+// Logical operations clear the carry and set the auxiliary carry as given
+static inline uint i8080_logic_flags(uint res, int aux_carry) {
+  return i8080_szp_flags(res & 0xFF) | (aux_carry ? 0x10 : 0);
+}
+
+// INR and DCR set all but the carry
+static inline uint i8080_inc_flags(uint before, uint after) {
+  return i8080_szp_flags(after & 0xFF) | ((before ^ after) & 0x10);
+}
+
+static inline uint i8080_dec_flags(uint before, uint after) {
+  return i8080_szp_flags(after & 0xFF) | ((before ^ 0xFF ^ after) & 0x10);
+}
+
+#endif
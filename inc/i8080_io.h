@@ -0,0 +1,44 @@
+#ifndef LIB8080_IO_H_
+#define LIB8080_IO_H_
+
+#include "i8080.h"
+
+// Port dispatch for IN and OUT
+//
+// Build src/i8080_io.c with the core. Each device maps its ports into a
+// 256-entry table, so IN and OUT cost one indexed call whatever the port.
+// Once the table is attached with i8080_set_io, it takes over the input and
+// output handlers. Unmapped ports read 0x00 and ignore writes.
+
+struct i8080_device {
+  void *state; // Passed to every callback
+  uint (*input)(struct i8080 *, void *state, uint port);
+  void (*output)(struct i8080 *, void *state, uint port, uint data);
+};
+
+struct i8080_port {
+  uint (*input)(struct i8080 *, void *state, uint port);
+  void (*output)(struct i8080 *, void *state, uint port, uint data);
+  void *state;
+};
+
+struct i8080_io {
+  struct i8080_port ports[256];
+};
+
+// Unmaps every port
+void i8080_io_init(struct i8080_io *);
+
+// Maps ports first to last to a device. A device can be mapped more than
+// once, for ports that are not contiguous.
+void i8080_io_map(struct i8080_io *, struct i8080_device *, uint first, uint last);
+
+// Attaches the table, or detaches it with NULL, which also clears the
+// input and output handlers
+void i8080_set_io(struct i8080 *, struct i8080_io *);
+
+// The input and output handlers i8080_set_io installs
+uint i8080_io_input(struct i8080 *, uint port);
+void i8080_io_output(struct i8080 *, uint port, uint data);
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef LIB8080_JIT_H_
+#define LIB8080_JIT_H_
+
+#include "i8080.h"
+
+// x86-64 translator for the Linux host build
+//
+// Build src/i8080_jit.c with the core and define I8080_JIT for both. Once a
+// translator is attached with i8080_set_jit, i8080_run turns straight-line
+// guest code into native blocks the first time it runs and calls them
+// afterwards. HLT, DAA, XTHL, interrupts and the end of a cycle budget go
+// through the interpreter. Memory must be a flat 64 KiB.
+
+struct i8080_jit;
+
+struct i8080_jit_stats {
+  uint translations;  // Blocks translated
+  uint invalidations; // Blocks dropped because their code was written
+  uint flushes;       // Times the code buffer filled and was emptied
+};
+
+struct i8080_jit *i8080_jit_create(void);
+void i8080_jit_destroy(struct i8080_jit *);
+
+// Attaches an empty translator, or detaches with NULL. Writes through the
+// API drop the blocks they touch, so call this again after changing memory
+// directly.
+void i8080_set_jit(struct i8080 *, struct i8080_jit *);
+
+struct i8080_jit_stats i8080_jit_get_stats(struct i8080_jit *);
+
+// Called by the core
+void i8080_jit_run(struct i8080 *);
+void i8080_jit_invalidate(struct i8080 *, uint addr, uint data);
+
+#endif
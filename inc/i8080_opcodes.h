@@ -0,0 +1,275 @@
+// 8080 opcode table
+//
+// Define I8080_OPCODE(OPCODE, MNEMONIC, LENGTH, CYCLES, TAKEN, READS, WRITES,
+// ENDS, STORES, HANDLER) and include this file to expand it once per opcode,
+// in order. The table engine, the block cache, i8080_opcodes,
+// i8080_disassemble and the host tools are all generated from it.
+//
+// MNEMONIC  printf format of the instruction, given its operand
+// LENGTH    Bytes, counting the operand
+// CYCLES    Cycles taken, or when the condition fails for conditional calls
+//           and returns
+// TAKEN     Cycles taken when the condition holds
+// READS     I8080_F_* flags the instruction reads
+// WRITES    I8080_F_* flags the instruction writes
+// ENDS      1 if it can change PC, halt or do I/O, so ends a block
+// STORES    1 if it writes memory, through i8080_write_byte or
+//           i8080_write_word
+// HANDLER   Handler in src/i8080.c, given the operand
+
+I8080_OPCODE(0x00, "NOP",          1, 4,  4,  0,                     0,            0, 0, op_nop)
+I8080_OPCODE(0x01, "LXI B,%04XH",  3, 10, 10, 0,                     0,            0, 0, op_lxi_B)
+I8080_OPCODE(0x02, "STAX B",       1, 7,  7,  0,                     0,            0, 1, op_stax_B)
+I8080_OPCODE(0x03, "INX B",        1, 5,  5,  0,                     0,            0, 0, op_inx_B)
+I8080_OPCODE(0x04, "INR B",        1, 5,  5,  0,                     I8080_F_SZAP, 0, 0, op_inr_B)
+I8080_OPCODE(0x05, "DCR B",        1, 5,  5,  0,                     I8080_F_SZAP, 0, 0, op_dcr_B)
+I8080_OPCODE(0x06, "MVI B,%02XH",  2, 7,  7,  0,                     0,            0, 0, op_mvi_B)
+I8080_OPCODE(0x07, "RLC",          1, 4,  4,  0,                     I8080_F_C,    0, 0, op_rlc)
+I8080_OPCODE(0x08, "NOP",          1, 4,  4,  0,                     0,            0, 0, op_nop)
+I8080_OPCODE(0x09, "DAD B",        1, 10, 10, 0,                     I8080_F_C,    0, 0, op_dad_B)
+I8080_OPCODE(0x0A, "LDAX B",       1, 7,  7,  0,                     0,            0, 0, op_ldax_B)
+I8080_OPCODE(0x0B, "DCX B",        1, 5,  5,  0,                     0,            0, 0, op_dcx_B)
+I8080_OPCODE(0x0C, "INR C",        1, 5,  5,  0,                     I8080_F_SZAP, 0, 0, op_inr_C)
+I8080_OPCODE(0x0D, "DCR C",        1, 5,  5,  0,                     I8080_F_SZAP, 0, 0, op_dcr_C)
+I8080_OPCODE(0x0E, "MVI C,%02XH",  2, 7,  7,  0,                     0,            0, 0, op_mvi_C)
+I8080_OPCODE(0x0F, "RRC",          1, 4,  4,  0,                     I8080_F_C,    0, 0, op_rrc)
+I8080_OPCODE(0x10, "NOP",          1, 4,  4,  0,                     0,            0, 0, op_nop)
+I8080_OPCODE(0x11, "LXI D,%04XH",  3, 10, 10, 0,                     0,            0, 0, op_lxi_D)
+I8080_OPCODE(0x12, "STAX D",       1, 7,  7,  0,                     0,            0, 1, op_stax_D)
+I8080_OPCODE(0x13, "INX D",        1, 5,  5,  0,                     0,            0, 0, op_inx_D)
+I8080_OPCODE(0x14, "INR D",        1, 5,  5,  0,                     I8080_F_SZAP, 0, 0, op_inr_D)
+I8080_OPCODE(0x15, "DCR D",        1, 5,  5,  0,                     I8080_F_SZAP, 0, 0, op_dcr_D)
+I8080_OPCODE(0x16, "MVI D,%02XH",  2, 7,  7,  0,                     0,            0, 0, op_mvi_D)
+I8080_OPCODE(0x17, "RAL",          1, 4,  4,  I8080_F_C,             I8080_F_C,    0, 0, op_ral)
+I8080_OPCODE(0x18, "NOP",          1, 4,  4,  0,                     0,            0, 0, op_nop)
+I8080_OPCODE(0x19, "DAD D",        1, 10, 10, 0,                     I8080_F_C,    0, 0, op_dad_D)
+I8080_OPCODE(0x1A, "LDAX D",       1, 7,  7,  0,                     0,            0, 0, op_ldax_D)
+I8080_OPCODE(0x1B, "DCX D",        1, 5,  5,  0,                     0,            0, 0, op_dcx_D)
+I8080_OPCODE(0x1C, "INR E",        1, 5,  5,  0,                     I8080_F_SZAP, 0, 0, op_inr_E)
+I8080_OPCODE(0x1D, "DCR E",        1, 5,  5,  0,                     I8080_F_SZAP, 0, 0, op_dcr_E)
+I8080_OPCODE(0x1E, "MVI E,%02XH",  2, 7,  7,  0,                     0,            0, 0, op_mvi_E)
+I8080_OPCODE(0x1F, "RAR",          1, 4,  4,  I8080_F_C,             I8080_F_C,    0, 0, op_rar)
+I8080_OPCODE(0x20, "NOP",          1, 4,  4,  0,                     0,            0, 0, op_nop)
+I8080_OPCODE(0x21, "LXI H,%04XH",  3, 10, 10, 0,                     0,            0, 0, op_lxi_H)
+I8080_OPCODE(0x22, "SHLD %04XH",   3, 16, 16, 0,                     0,            0, 1, shld)
+I8080_OPCODE(0x23, "INX H",        1, 5,  5,  0,                     0,            0, 0, op_inx_H)
+I8080_OPCODE(0x24, "INR H",        1, 5,  5,  0,                     I8080_F_SZAP, 0, 0, op_inr_H)
+I8080_OPCODE(0x25, "DCR H",        1, 5,  5,  0,                     I8080_F_SZAP, 0, 0, op_dcr_H)
+I8080_OPCODE(0x26, "MVI H,%02XH",  2, 7,  7,  0,                     0,            0, 0, op_mvi_H)
+I8080_OPCODE(0x27, "DAA",          1, 4,  4,  I8080_F_A | I8080_F_C, I8080_F_ALL,  0, 0, op_daa)
+I8080_OPCODE(0x28, "NOP",          1, 4,  4,  0,                     0,            0, 0, op_nop)
+I8080_OPCODE(0x29, "DAD H",        1, 10, 10, 0,                     I8080_F_C,    0, 0, op_dad_H)
+I8080_OPCODE(0x2A, "LHLD %04XH",   3, 16, 16, 0,                     0,            0, 0, ldhd)
+I8080_OPCODE(0x2B, "DCX H",        1, 5,  5,  0,                     0,            0, 0, op_dcx_H)
+I8080_OPCODE(0x2C, "INR L",        1, 5,  5,  0,                     I8080_F_SZAP, 0, 0, op_inr_L)
+I8080_OPCODE(0x2D, "DCR L",        1, 5,  5,  0,                     I8080_F_SZAP, 0, 0, op_dcr_L)
+I8080_OPCODE(0x2E, "MVI L,%02XH",  2, 7,  7,  0,                     0,            0, 0, op_mvi_L)
+I8080_OPCODE(0x2F, "CMA",          1, 4,  4,  0,                     0,            0, 0, op_cma)
+I8080_OPCODE(0x30, "NOP",          1, 4,  4,  0,                     0,            0, 0, op_nop)
+I8080_OPCODE(0x31, "LXI SP,%04XH", 3, 10, 10, 0,                     0,            0, 0, op_lxi_SP)
+I8080_OPCODE(0x32, "STA %04XH",    3, 13, 13, 0,                     0,            0, 1, sta)
+I8080_OPCODE(0x33, "INX SP",       1, 5,  5,  0,                     0,            0, 0, op_inx_SP)
+I8080_OPCODE(0x34, "INR M",        1, 10, 10, 0,                     I8080_F_SZAP, 0, 1, op_inr_M)
+I8080_OPCODE(0x35, "DCR M",        1, 10, 10, 0,                     I8080_F_SZAP, 0, 1, op_dcr_M)
+I8080_OPCODE(0x36, "MVI M,%02XH",  2, 10, 10, 0,                     0,            0, 1, op_mvi_M)
+I8080_OPCODE(0x37, "STC",          1, 4,  4,  0,                     I8080_F_C,    0, 0, op_stc)
+I8080_OPCODE(0x38, "NOP",          1, 4,  4,  0,                     0,            0, 0, op_nop)
+I8080_OPCODE(0x39, "DAD SP",       1, 10, 10, 0,                     I8080_F_C,    0, 0, op_dad_SP)
+I8080_OPCODE(0x3A, "LDA %04XH",    3, 13, 13, 0,                     0,            0, 0, lda)
+I8080_OPCODE(0x3B, "DCX SP",       1, 5,  5,  0,                     0,            0, 0, op_dcx_SP)
+I8080_OPCODE(0x3C, "INR A",        1, 5,  5,  0,                     I8080_F_SZAP, 0, 0, op_inr_A)
+I8080_OPCODE(0x3D, "DCR A",        1, 5,  5,  0,                     I8080_F_SZAP, 0, 0, op_dcr_A)
+I8080_OPCODE(0x3E, "MVI A,%02XH",  2, 7,  7,  0,                     0,            0, 0, op_mvi_A)
+I8080_OPCODE(0x3F, "CMC",          1, 4,  4,  I8080_F_C,             I8080_F_C,    0, 0, op_cmc)
+I8080_OPCODE(0x40, "MOV B,B",      1, 5,  5,  0,                     0,            0, 0, op_mov_B_B)
+I8080_OPCODE(0x41, "MOV B,C",      1, 5,  5,  0,                     0,            0, 0, op_mov_B_C)
+I8080_OPCODE(0x42, "MOV B,D",      1, 5,  5,  0,                     0,            0, 0, op_mov_B_D)
+I8080_OPCODE(0x43, "MOV B,E",      1, 5,  5,  0,                     0,            0, 0, op_mov_B_E)
+I8080_OPCODE(0x44, "MOV B,H",      1, 5,  5,  0,                     0,            0, 0, op_mov_B_H)
+I8080_OPCODE(0x45, "MOV B,L",      1, 5,  5,  0,                     0,            0, 0, op_mov_B_L)
+I8080_OPCODE(0x46, "MOV B,M",      1, 7,  7,  0,                     0,            0, 0, op_mov_B_M)
+I8080_OPCODE(0x47, "MOV B,A",      1, 5,  5,  0,                     0,            0, 0, op_mov_B_A)
+I8080_OPCODE(0x48, "MOV C,B",      1, 5,  5,  0,                     0,            0, 0, op_mov_C_B)
+I8080_OPCODE(0x49, "MOV C,C",      1, 5,  5,  0,                     0,            0, 0, op_mov_C_C)
+I8080_OPCODE(0x4A, "MOV C,D",      1, 5,  5,  0,                     0,            0, 0, op_mov_C_D)
+I8080_OPCODE(0x4B, "MOV C,E",      1, 5,  5,  0,                     0,            0, 0, op_mov_C_E)
+I8080_OPCODE(0x4C, "MOV C,H",      1, 5,  5,  0,                     0,            0, 0, op_mov_C_H)
+I8080_OPCODE(0x4D, "MOV C,L",      1, 5,  5,  0,                     0,            0, 0, op_mov_C_L)
+I8080_OPCODE(0x4E, "MOV C,M",      1, 7,  7,  0,                     0,            0, 0, op_mov_C_M)
+I8080_OPCODE(0x4F, "MOV C,A",      1, 5,  5,  0,                     0,            0, 0, op_mov_C_A)
+I8080_OPCODE(0x50, "MOV D,B",      1, 5,  5,  0,                     0,            0, 0, op_mov_D_B)
+I8080_OPCODE(0x51, "MOV D,C",      1, 5,  5,  0,                     0,            0, 0, op_mov_D_C)
+I8080_OPCODE(0x52, "MOV D,D",      1, 5,  5,  0,                     0,            0, 0, op_mov_D_D)
+I8080_OPCODE(0x53, "MOV D,E",      1, 5,  5,  0,                     0,            0, 0, op_mov_D_E)
+I8080_OPCODE(0x54, "MOV D,H",      1, 5,  5,  0,                     0,            0, 0, op_mov_D_H)
+I8080_OPCODE(0x55, "MOV D,L",      1, 5,  5,  0,                     0,            0, 0, op_mov_D_L)
+I8080_OPCODE(0x56, "MOV D,M",      1, 7,  7,  0,                     0,            0, 0, op_mov_D_M)
+I8080_OPCODE(0x57, "MOV D,A",      1, 5,  5,  0,                     0,            0, 0, op_mov_D_A)
+I8080_OPCODE(0x58, "MOV E,B",      1, 5,  5,  0,                     0,            0, 0, op_mov_E_B)
+I8080_OPCODE(0x59, "MOV E,C",      1, 5,  5,  0,                     0,            0, 0, op_mov_E_C)
+I8080_OPCODE(0x5A, "MOV E,D",      1, 5,  5,  0,                     0,            0, 0, op_mov_E_D)
+I8080_OPCODE(0x5B, "MOV E,E",      1, 5,  5,  0,                     0,            0, 0, op_mov_E_E)
+I8080_OPCODE(0x5C, "MOV E,H",      1, 5,  5,  0,                     0,            0, 0, op_mov_E_H)
+I8080_OPCODE(0x5D, "MOV E,L",      1, 5,  5,  0,                     0,            0, 0, op_mov_E_L)
+I8080_OPCODE(0x5E, "MOV E,M",      1, 7,  7,  0,                     0,            0, 0, op_mov_E_M)
+I8080_OPCODE(0x5F, "MOV E,A",      1, 5,  5,  0,                     0,            0, 0, op_mov_E_A)
+I8080_OPCODE(0x60, "MOV H,B",      1, 5,  5,  0,                     0,            0, 0, op_mov_H_B)
+I8080_OPCODE(0x61, "MOV H,C",      1, 5,  5,  0,                     0,            0, 0, op_mov_H_C)
+I8080_OPCODE(0x62, "MOV H,D",      1, 5,  5,  0,                     0,            0, 0, op_mov_H_D)
+I8080_OPCODE(0x63, "MOV H,E",      1, 5,  5,  0,                     0,            0, 0, op_mov_H_E)
+I8080_OPCODE(0x64, "MOV H,H",      1, 5,  5,  0,                     0,            0, 0, op_mov_H_H)
+I8080_OPCODE(0x65, "MOV H,L",      1, 5,  5,  0,                     0,            0, 0, op_mov_H_L)
+I8080_OPCODE(0x66, "MOV H,M",      1, 7,  7,  0,                     0,            0, 0, op_mov_H_M)
+I8080_OPCODE(0x67, "MOV H,A",      1, 5,  5,  0,                     0,            0, 0, op_mov_H_A)
+I8080_OPCODE(0x68, "MOV L,B",      1, 5,  5,  0,                     0,            0, 0, op_mov_L_B)
+I8080_OPCODE(0x69, "MOV L,C",      1, 5,  5,  0,                     0,            0, 0, op_mov_L_C)
+I8080_OPCODE(0x6A, "MOV L,D",      1, 5,  5,  0,                     0,            0, 0, op_mov_L_D)
+I8080_OPCODE(0x6B, "MOV L,E",      1, 5,  5,  0,                     0,            0, 0, op_mov_L_E)
+I8080_OPCODE(0x6C, "MOV L,H",      1, 5,  5,  0,                     0,            0, 0, op_mov_L_H)
+I8080_OPCODE(0x6D, "MOV L,L",      1, 5,  5,  0,                     0,            0, 0, op_mov_L_L)
+I8080_OPCODE(0x6E, "MOV L,M",      1, 7,  7,  0,                     0,            0, 0, op_mov_L_M)
+I8080_OPCODE(0x6F, "MOV L,A",      1, 5,  5,  0,                     0,            0, 0, op_mov_L_A)
+I8080_OPCODE(0x70, "MOV M,B",      1, 7,  7,  0,                     0,            0, 1, op_mov_M_B)
+I8080_OPCODE(0x71, "MOV M,C",      1, 7,  7,  0,                     0,            0, 1, op_mov_M_C)
+I8080_OPCODE(0x72, "MOV M,D",      1, 7,  7,  0,                     0,            0, 1, op_mov_M_D)
+I8080_OPCODE(0x73, "MOV M,E",      1, 7,  7,  0,                     0,            0, 1, op_mov_M_E)
+I8080_OPCODE(0x74, "MOV M,H",      1, 7,  7,  0,                     0,            0, 1, op_mov_M_H)
+I8080_OPCODE(0x75, "MOV M,L",      1, 7,  7,  0,                     0,            0, 1, op_mov_M_L)
+I8080_OPCODE(0x76, "HLT",          1, 7,  7,  0,                     0,            1, 0, op_hlt)
+I8080_OPCODE(0x77, "MOV M,A",      1, 7,  7,  0,                     0,            0, 1, op_mov_M_A)
+I8080_OPCODE(0x78, "MOV A,B",      1, 5,  5,  0,                     0,            0, 0, op_mov_A_B)
+I8080_OPCODE(0x79, "MOV A,C",      1, 5,  5,  0,                     0,            0, 0, op_mov_A_C)
+I8080_OPCODE(0x7A, "MOV A,D",      1, 5,  5,  0,                     0,            0, 0, op_mov_A_D)
+I8080_OPCODE(0x7B, "MOV A,E",      1, 5,  5,  0,                     0,            0, 0, op_mov_A_E)
+I8080_OPCODE(0x7C, "MOV A,H",      1, 5,  5,  0,                     0,            0, 0, op_mov_A_H)
+I8080_OPCODE(0x7D, "MOV A,L",      1, 5,  5,  0,                     0,            0, 0, op_mov_A_L)
+I8080_OPCODE(0x7E, "MOV A,M",      1, 7,  7,  0,                     0,            0, 0, op_mov_A_M)
+I8080_OPCODE(0x7F, "MOV A,A",      1, 5,  5,  0,                     0,            0, 0, op_mov_A_A)
+I8080_OPCODE(0x80, "ADD B",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_add_B)
+I8080_OPCODE(0x81, "ADD C",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_add_C)
+I8080_OPCODE(0x82, "ADD D",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_add_D)
+I8080_OPCODE(0x83, "ADD E",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_add_E)
+I8080_OPCODE(0x84, "ADD H",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_add_H)
+I8080_OPCODE(0x85, "ADD L",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_add_L)
+I8080_OPCODE(0x86, "ADD M",        1, 7,  7,  0,                     I8080_F_ALL,  0, 0, op_add_M)
+I8080_OPCODE(0x87, "ADD A",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_add_A)
+I8080_OPCODE(0x88, "ADC B",        1, 4,  4,  I8080_F_C,             I8080_F_ALL,  0, 0, op_adc_B)
+I8080_OPCODE(0x89, "ADC C",        1, 4,  4,  I8080_F_C,             I8080_F_ALL,  0, 0, op_adc_C)
+I8080_OPCODE(0x8A, "ADC D",        1, 4,  4,  I8080_F_C,             I8080_F_ALL,  0, 0, op_adc_D)
+I8080_OPCODE(0x8B, "ADC E",        1, 4,  4,  I8080_F_C,             I8080_F_ALL,  0, 0, op_adc_E)
+I8080_OPCODE(0x8C, "ADC H",        1, 4,  4,  I8080_F_C,             I8080_F_ALL,  0, 0, op_adc_H)
+I8080_OPCODE(0x8D, "ADC L",        1, 4,  4,  I8080_F_C,             I8080_F_ALL,  0, 0, op_adc_L)
+I8080_OPCODE(0x8E, "ADC M",        1, 7,  7,  I8080_F_C,             I8080_F_ALL,  0, 0, op_adc_M)
+I8080_OPCODE(0x8F, "ADC A",        1, 4,  4,  I8080_F_C,             I8080_F_ALL,  0, 0, op_adc_A)
+I8080_OPCODE(0x90, "SUB B",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_sub_B)
+I8080_OPCODE(0x91, "SUB C",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_sub_C)
+I8080_OPCODE(0x92, "SUB D",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_sub_D)
+I8080_OPCODE(0x93, "SUB E",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_sub_E)
+I8080_OPCODE(0x94, "SUB H",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_sub_H)
+I8080_OPCODE(0x95, "SUB L",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_sub_L)
+I8080_OPCODE(0x96, "SUB M",        1, 7,  7,  0,                     I8080_F_ALL,  0, 0, op_sub_M)
+I8080_OPCODE(0x97, "SUB A",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_sub_A)
+I8080_OPCODE(0x98, "SBB B",        1, 4,  4,  I8080_F_C,             I8080_F_ALL,  0, 0, op_sbb_B)
+I8080_OPCODE(0x99, "SBB C",        1, 4,  4,  I8080_F_C,             I8080_F_ALL,  0, 0, op_sbb_C)
+I8080_OPCODE(0x9A, "SBB D",        1, 4,  4,  I8080_F_C,             I8080_F_ALL,  0, 0, op_sbb_D)
+I8080_OPCODE(0x9B, "SBB E",        1, 4,  4,  I8080_F_C,             I8080_F_ALL,  0, 0, op_sbb_E)
+I8080_OPCODE(0x9C, "SBB H",        1, 4,  4,  I8080_F_C,             I8080_F_ALL,  0, 0, op_sbb_H)
+I8080_OPCODE(0x9D, "SBB L",        1, 4,  4,  I8080_F_C,             I8080_F_ALL,  0, 0, op_sbb_L)
+I8080_OPCODE(0x9E, "SBB M",        1, 7,  7,  I8080_F_C,             I8080_F_ALL,  0, 0, op_sbb_M)
+I8080_OPCODE(0x9F, "SBB A",        1, 4,  4,  I8080_F_C,             I8080_F_ALL,  0, 0, op_sbb_A)
+I8080_OPCODE(0xA0, "ANA B",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_ana_B)
+I8080_OPCODE(0xA1, "ANA C",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_ana_C)
+I8080_OPCODE(0xA2, "ANA D",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_ana_D)
+I8080_OPCODE(0xA3, "ANA E",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_ana_E)
+I8080_OPCODE(0xA4, "ANA H",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_ana_H)
+I8080_OPCODE(0xA5, "ANA L",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_ana_L)
+I8080_OPCODE(0xA6, "ANA M",        1, 7,  7,  0,                     I8080_F_ALL,  0, 0, op_ana_M)
+I8080_OPCODE(0xA7, "ANA A",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_ana_A)
+I8080_OPCODE(0xA8, "XRA B",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_xra_B)
+I8080_OPCODE(0xA9, "XRA C",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_xra_C)
+I8080_OPCODE(0xAA, "XRA D",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_xra_D)
+I8080_OPCODE(0xAB, "XRA E",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_xra_E)
+I8080_OPCODE(0xAC, "XRA H",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_xra_H)
+I8080_OPCODE(0xAD, "XRA L",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_xra_L)
+I8080_OPCODE(0xAE, "XRA M",        1, 7,  7,  0,                     I8080_F_ALL,  0, 0, op_xra_M)
+I8080_OPCODE(0xAF, "XRA A",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_xra_A)
+I8080_OPCODE(0xB0, "ORA B",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_ora_B)
+I8080_OPCODE(0xB1, "ORA C",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_ora_C)
+I8080_OPCODE(0xB2, "ORA D",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_ora_D)
+I8080_OPCODE(0xB3, "ORA E",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_ora_E)
+I8080_OPCODE(0xB4, "ORA H",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_ora_H)
+I8080_OPCODE(0xB5, "ORA L",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_ora_L)
+I8080_OPCODE(0xB6, "ORA M",        1, 7,  7,  0,                     I8080_F_ALL,  0, 0, op_ora_M)
+I8080_OPCODE(0xB7, "ORA A",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_ora_A)
+I8080_OPCODE(0xB8, "CMP B",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_cmp_B)
+I8080_OPCODE(0xB9, "CMP C",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_cmp_C)
+I8080_OPCODE(0xBA, "CMP D",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_cmp_D)
+I8080_OPCODE(0xBB, "CMP E",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_cmp_E)
+I8080_OPCODE(0xBC, "CMP H",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_cmp_H)
+I8080_OPCODE(0xBD, "CMP L",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_cmp_L)
+I8080_OPCODE(0xBE, "CMP M",        1, 7,  7,  0,                     I8080_F_ALL,  0, 0, op_cmp_M)
+I8080_OPCODE(0xBF, "CMP A",        1, 4,  4,  0,                     I8080_F_ALL,  0, 0, op_cmp_A)
+I8080_OPCODE(0xC0, "RNZ",          1, 5,  11, I8080_F_Z,             0,            1, 0, op_rnz)
+I8080_OPCODE(0xC1, "POP B",        1, 10, 10, 0,                     0,            0, 0, op_pop_B)
+I8080_OPCODE(0xC2, "JNZ %04XH",    3, 10, 10, I8080_F_Z,             0,            1, 0, op_jnz)
+I8080_OPCODE(0xC3, "JMP %04XH",    3, 10, 10, 0,                     0,            1, 0, op_jmp)
+I8080_OPCODE(0xC4, "CNZ %04XH",    3, 11, 17, I8080_F_Z,             0,            1, 0, op_cnz)
+I8080_OPCODE(0xC5, "PUSH B",       1, 11, 11, 0,                     0,            0, 1, op_push_B)
+I8080_OPCODE(0xC6, "ADI %02XH",    2, 7,  7,  0,                     I8080_F_ALL,  0, 0, adi)
+I8080_OPCODE(0xC7, "RST 0",        1, 11, 11, 0,                     0,            1, 0, op_rst_0)
+I8080_OPCODE(0xC8, "RZ",           1, 5,  11, I8080_F_Z,             0,            1, 0, op_rz)
+I8080_OPCODE(0xC9, "RET",          1, 11, 11, 0,                     0,            1, 0, op_ret)
+I8080_OPCODE(0xCA, "JZ %04XH",     3, 10, 10, I8080_F_Z,             0,            1, 0, op_jz)
+I8080_OPCODE(0xCB, "JMP %04XH",    3, 10, 10, 0,                     0,            1, 0, op_jmp)
+I8080_OPCODE(0xCC, "CZ %04XH",     3, 11, 17, I8080_F_Z,             0,            1, 0, op_cz)
+I8080_OPCODE(0xCD, "CALL %04XH",   3, 17, 17, 0,                     0,            1, 0, op_call)
+I8080_OPCODE(0xCE, "ACI %02XH",    2, 7,  7,  I8080_F_C,             I8080_F_ALL,  0, 0, aci)
+I8080_OPCODE(0xCF, "RST 1",        1, 11, 11, 0,                     0,            1, 0, op_rst_1)
+I8080_OPCODE(0xD0, "RNC",          1, 5,  11, I8080_F_C,             0,            1, 0, op_rnc)
+I8080_OPCODE(0xD1, "POP D",        1, 10, 10, 0,                     0,            0, 0, op_pop_D)
+I8080_OPCODE(0xD2, "JNC %04XH",    3, 10, 10, I8080_F_C,             0,            1, 0, op_jnc)
+I8080_OPCODE(0xD3, "OUT %02XH",    2, 10, 10, 0,                     0,            1, 0, out)
+I8080_OPCODE(0xD4, "CNC %04XH",    3, 11, 17, I8080_F_C,             0,            1, 0, op_cnc)
+I8080_OPCODE(0xD5, "PUSH D",       1, 11, 11, 0,                     0,            0, 1, op_push_D)
+I8080_OPCODE(0xD6, "SUI %02XH",    2, 7,  7,  0,                     I8080_F_ALL,  0, 0, sui)
+I8080_OPCODE(0xD7, "RST 2",        1, 11, 11, 0,                     0,            1, 0, op_rst_2)
+I8080_OPCODE(0xD8, "RC",           1, 5,  11, I8080_F_C,             0,            1, 0, op_rc)
+I8080_OPCODE(0xD9, "RET",          1, 11, 11, 0,                     0,            1, 0, op_ret)
+I8080_OPCODE(0xDA, "JC %04XH",     3, 10, 10, I8080_F_C,             0,            1, 0, op_jc)
+I8080_OPCODE(0xDB, "IN %02XH",     2, 10, 10, 0,                     0,            1, 0, in)
+I8080_OPCODE(0xDC, "CC %04XH",     3, 11, 17, I8080_F_C,             0,            1, 0, op_cc)
+I8080_OPCODE(0xDD, "CALL %04XH",   3, 17, 17, 0,                     0,            1, 0, op_call)
+I8080_OPCODE(0xDE, "SBI %02XH",    2, 7,  7,  I8080_F_C,             I8080_F_ALL,  0, 0, sbi)
+I8080_OPCODE(0xDF, "RST 3",        1, 11, 11, 0,                     0,            1, 0, op_rst_3)
+I8080_OPCODE(0xE0, "RPO",          1, 5,  11, I8080_F_P,             0,            1, 0, op_rpo)
+I8080_OPCODE(0xE1, "POP H",        1, 10, 10, 0,                     0,            0, 0, op_pop_H)
+I8080_OPCODE(0xE2, "JPO %04XH",    3, 10, 10, I8080_F_P,             0,            1, 0, op_jpo)
+I8080_OPCODE(0xE3, "XTHL",         1, 18, 18, 0,                     0,            0, 1, op_xthl)
+I8080_OPCODE(0xE4, "CPO %04XH",    3, 11, 17, I8080_F_P,             0,            1, 0, op_cpo)
+I8080_OPCODE(0xE5, "PUSH H",       1, 11, 11, 0,                     0,            0, 1, op_push_H)
+I8080_OPCODE(0xE6, "ANI %02XH",    2, 7,  7,  0,                     I8080_F_ALL,  0, 0, ani)
+I8080_OPCODE(0xE7, "RST 4",        1, 11, 11, 0,                     0,            1, 0, op_rst_4)
+I8080_OPCODE(0xE8, "RPE",          1, 5,  11, I8080_F_P,             0,            1, 0, op_rpe)
+I8080_OPCODE(0xE9, "PCHL",         1, 5,  5,  0,                     0,            1, 0, op_pchl)
+I8080_OPCODE(0xEA, "JPE %04XH",    3, 10, 10, I8080_F_P,             0,            1, 0, op_jpe)
+I8080_OPCODE(0xEB, "XCHG",         1, 5,  5,  0,                     0,            0, 0, op_xchg)
+I8080_OPCODE(0xEC, "CPE %04XH",    3, 11, 17, I8080_F_P,             0,            1, 0, op_cpe)
+I8080_OPCODE(0xED, "CALL %04XH",   3, 17, 17, 0,                     0,            1, 0, op_call)
+I8080_OPCODE(0xEE, "XRI %02XH",    2, 7,  7,  0,                     I8080_F_ALL,  0, 0, xri)
+I8080_OPCODE(0xEF, "RST 5",        1, 11, 11, 0,                     0,            1, 0, op_rst_5)
+I8080_OPCODE(0xF0, "RP",           1, 5,  11, I8080_F_S,             0,            1, 0, op_rp)
+I8080_OPCODE(0xF1, "POP PSW",      1, 10, 10, 0,                     I8080_F_ALL,  0, 0, op_pop_PSW)
+I8080_OPCODE(0xF2, "JP %04XH",     3, 10, 10, I8080_F_S,             0,            1, 0, op_jp)
+I8080_OPCODE(0xF3, "DI",           1, 4,  4,  0,                     0,            0, 0, op_di)
+I8080_OPCODE(0xF4, "CP %04XH",     3, 11, 17, I8080_F_S,             0,            1, 0, op_cp)
+I8080_OPCODE(0xF5, "PUSH PSW",     1, 11, 11, I8080_F_ALL,           0,            0, 1, op_push_PSW)
+I8080_OPCODE(0xF6, "ORI %02XH",    2, 7,  7,  0,                     I8080_F_ALL,  0, 0, ori)
+I8080_OPCODE(0xF7, "RST 6",        1, 11, 11, 0,                     0,            1, 0, op_rst_6)
+I8080_OPCODE(0xF8, "RM",           1, 5,  11, I8080_F_S,             0,            1, 0, op_rm)
+I8080_OPCODE(0xF9, "SPHL",         1, 5,  5,  0,                     0,            1, 0, op_sphl)
+I8080_OPCODE(0xFA, "JM %04XH",     3, 10, 10, I8080_F_S,             0,            1, 0, op_jm)
+I8080_OPCODE(0xFB, "EI",           1, 4,  4,  0,                     0,            0, 0, op_ei)
+I8080_OPCODE(0xFC, "CM %04XH",     3, 11, 17, I8080_F_S,             0,            1, 0, op_cm)
+I8080_OPCODE(0xFD, "CALL %04XH",   3, 17, 17, 0,                     0,            1, 0, op_call)
+I8080_OPCODE(0xFE, "CPI %02XH",    2, 7,  7,  0,                     I8080_F_ALL,  0, 0, cpi)
+I8080_OPCODE(0xFF, "RST 7",        1, 11, 11, 0,                     0,            1, 0, op_rst_7)
@@ -0,0 +1,67 @@
+#ifndef LIB8080_SCHEDULER_H_
+#define LIB8080_SCHEDULER_H_
+
+#include "i8080.h"
+
+// Events in emulated time
+//
+// Build src/i8080_scheduler.c with the core. The scheduler keeps a 64-bit
+// cycle clock, extended from the processor's 32-bit cyc, and a timer wheel
+// of events due at future cycles. i8080_scheduler_run runs the processor up
+// to the next deadline and calls the events that are due, so devices and
+// housekeeping are only called when they have something to do.
+
+// Cycles covered by each slot of the wheel, as a power of two, and the
+// number of slots. Events further off than a turn of the wheel wait in
+// their slot until it comes round to them.
+#ifndef I8080_WHEEL_SHIFT
+#define I8080_WHEEL_SHIFT 12
+#endif
+
+#ifndef I8080_WHEEL_SLOTS
+#define I8080_WHEEL_SLOTS 64
+#endif
+
+struct i8080_event;
+typedef void (*i8080_event_handler)(struct i8080_event *, void *state);
+
+struct i8080_event {
+  i8080_event_handler handler;
+  void *state;
+  uint64_t deadline;
+  int pending; // Scheduled and not yet called
+  struct i8080_event *next;
+};
+
+struct i8080_scheduler {
+  struct i8080 *cpu;
+  uint64_t now;
+  uint64_t fired; // Events up to this cycle have been called
+  uint last_cyc;  // cpu->cyc when now was last brought up to date
+  struct i8080_event *slots[I8080_WHEEL_SLOTS];
+};
+
+void i8080_event_init(struct i8080_event *, i8080_event_handler, void *state);
+
+// Empties the wheel and starts the clock at 0 for the processor
+void i8080_scheduler_init(struct i8080_scheduler *, struct i8080 *);
+
+// Cycles since i8080_scheduler_init, as of the current instruction
+uint64_t i8080_scheduler_now(struct i8080_scheduler *);
+
+// Calls the event's handler once delay cycles have passed, moving it if
+// already scheduled. Can be called from handlers, including IN and OUT, and
+// ends the current i8080_run early if the event falls due before its end.
+void i8080_schedule(struct i8080_scheduler *, struct i8080_event *, uint64_t delay);
+
+void i8080_cancel(struct i8080_scheduler *, struct i8080_event *);
+
+// Runs the processor until the next deadline, for at most max_cycles, then
+// calls the events due. A halted processor skips straight to the deadline.
+struct i8080_exit i8080_scheduler_run(struct i8080_scheduler *, uint max_cycles);
+
+// Moves the clock on by cycles without running the processor, for one that
+// is only waiting, calling the events due on the way at their deadlines
+void i8080_scheduler_skip(struct i8080_scheduler *, uint cycles);
+
+#endif
@@ -0,0 +1,37 @@
+// Generated by host/profile.c, do not edit
+//
+// Opcode sequences BASIC runs most, by first opcode, with the dispatches
+// each saves as a share of the instructions profiled
+
+SUPERINSTRUCTION3(0x03, 0x13, 0xC3, op_inx_B, op_inx_D, op_jmp) // 0.28%
+SUPERINSTRUCTION3(0x07, 0x37, 0x1F, op_rlc, op_stc, op_rar) // 0.44%
+SUPERINSTRUCTION3(0x11, 0x19, 0xD1, op_lxi_D, op_dad_D, op_pop_D) // 0.61%
+SUPERINSTRUCTION2(0x1A, 0x77, op_ldax_D, op_mov_M_A) // 0.41%
+SUPERINSTRUCTION3(0x1D, 0x7A, 0xC2, op_dcr_E, op_mov_A_D, op_jnz) // 1.23%
+SUPERINSTRUCTION3(0x1F, 0x57, 0x79, op_rar, op_mov_D_A, op_mov_A_C) // 1.23%
+SUPERINSTRUCTION3(0x1F, 0x4F, 0x7C, op_rar, op_mov_C_A, op_mov_A_H) // 1.23%
+SUPERINSTRUCTION3(0x1F, 0x67, 0x7D, op_rar, op_mov_H_A, op_mov_A_L) // 1.23%
+SUPERINSTRUCTION3(0x1F, 0x4F, 0x7A, op_rar, op_mov_C_A, op_mov_A_D) // 0.47%
+SUPERINSTRUCTION3(0x1F, 0x57, 0x7B, op_rar, op_mov_D_A, op_mov_A_E) // 0.47%
+SUPERINSTRUCTION2(0x1F, 0x6F, op_rar, op_mov_L_A) // 0.61%
+SUPERINSTRUCTION3(0x23, 0x05, 0xC2, op_inx_H, op_dcr_B, op_jnz) // 0.75%
+SUPERINSTRUCTION2(0x23, 0x7E, op_inx_H, op_mov_A_M) // 0.27%
+SUPERINSTRUCTION3(0x2A, 0xEB, 0xE7, ldhd, op_xchg, op_rst_4) // 0.28%
+SUPERINSTRUCTION3(0x3D, 0x3D, 0x3D, op_dcr_A, op_dcr_A, op_dcr_A) // 0.45%
+SUPERINSTRUCTION3(0x4E, 0x23, 0x46, op_mov_C_M, op_inx_H, op_mov_B_M) // 0.47%
+SUPERINSTRUCTION3(0x5E, 0x23, 0x56, op_mov_E_M, op_inx_H, op_mov_D_M) // 0.52%
+SUPERINSTRUCTION3(0x60, 0x69, 0x22, op_mov_H_B, op_mov_L_C, shld) // 0.38%
+SUPERINSTRUCTION3(0x78, 0x1F, 0x47, op_mov_A_B, op_rar, op_mov_B_A) // 1.70%
+SUPERINSTRUCTION3(0x7A, 0x17, 0x57, op_mov_A_D, op_ral, op_mov_D_A) // 0.42%
+SUPERINSTRUCTION3(0x7C, 0x92, 0xC0, op_mov_A_H, op_sub_D, op_rnz) // 1.23%
+SUPERINSTRUCTION3(0x7C, 0xB5, 0xCA, op_mov_A_H, op_ora_L, op_jz) // 0.66%
+SUPERINSTRUCTION3(0x7D, 0x93, 0xC9, op_mov_A_L, op_sub_E, op_ret) // 0.94%
+SUPERINSTRUCTION3(0x7E, 0xFE, 0xD0, op_mov_A_M, cpi, op_rnc) // 0.81%
+SUPERINSTRUCTION3(0x7E, 0x47, 0x2F, op_mov_A_M, op_mov_B_A, op_cma) // 0.66%
+SUPERINSTRUCTION3(0x7E, 0xFE, 0xD8, op_mov_A_M, cpi, op_rc) // 0.31%
+SUPERINSTRUCTION3(0xAF, 0x2D, 0xC8, op_xra_A, op_dcr_L, op_rz) // 0.63%
+SUPERINSTRUCTION2(0xB7, 0xCA, op_ora_A, op_jz) // 0.34%
+SUPERINSTRUCTION2(0xB7, 0xC2, op_ora_A, op_jnz) // 0.32%
+SUPERINSTRUCTION2(0xBE, 0x70, op_cmp_M, op_mov_M_B) // 0.33%
+SUPERINSTRUCTION2(0xE1, 0xC9, op_pop_H, op_ret) // 0.31%
+SUPERINSTRUCTION2(0xEB, 0x22, op_xchg, shld) // 0.30%
@@ -0,0 +1,35 @@
+#ifndef LIB8080_UNPACK_H_
+#define LIB8080_UNPACK_H_
+
+#include "i8080.h"
+
+// Packed memory images
+//
+// Build src/i8080_unpack.c with the core. host/pack.c packs an image, such
+// as the BASIC interpreter, into a header to be built into the firmware in
+// place of the raw array, and i8080_unpack writes it into memory at reset.
+//
+// A packed image is a run of sequences, each made of:
+//
+//   token     Literal count in the high nibble and match length less 4 in
+//             the low nibble
+//   count     If the literal count is 15, bytes added to it, up to and
+//             including the first below 255
+//   literals  Bytes copied as they are
+//   offset    Two bytes, low first, back from the end of the literals to
+//             where the match is copied from, or 0 for a run of zeros
+//   length    If the match length is 15, bytes added to it as for the count
+//
+// The last sequence ends after its literals. Literals and runs of zeros
+// are written in straight runs with no reads of memory, which on the
+// AudioMoth is the external SRAM, so only matches read memory back.
+
+// Smallest match worth encoding
+#define I8080_UNPACK_MIN_MATCH 4
+
+// Unpacks into memory, returning the bytes unpacked, or 0 if the image is
+// damaged or does not fit in size bytes. Clear only what lies past those
+// bytes, as the image's own zeros are written.
+size_t i8080_unpack(char *memory, size_t size, const uint8_t *packed, size_t packed_size);
+
+#endif
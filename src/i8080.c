@@ -1,7 +1,42 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "i8080.h"
+#include "i8080_flags.h"
+#ifdef I8080_JIT
+#include "i8080_jit.h"
+#endif
+
+#if defined(I8080_SUPERINSTRUCTIONS) && !defined(I8080_BLOCK_CACHE)
+#error "I8080_SUPERINSTRUCTIONS needs I8080_BLOCK_CACHE"
+#endif
+
+#if defined(I8080_FLAG_LIVENESS) && !defined(I8080_BLOCK_CACHE)
+#error "I8080_FLAG_LIVENESS needs I8080_BLOCK_CACHE"
+#endif
+
+#if defined(I8080_NO_CYCLES) && (defined(I8080_JIT) || defined(I8080_PRECOMPILED))
+#error "I8080_NO_CYCLES does not work with I8080_JIT or I8080_PRECOMPILED"
+#endif
+
+#if defined(I8080_PAGE_CACHE) && defined(I8080_JIT)
+#error "I8080_PAGE_CACHE does not work with I8080_JIT"
+#endif
+
+#if defined(I8080_LAZY_MEMORY) && defined(I8080_JIT)
+#error "I8080_LAZY_MEMORY does not work with I8080_JIT"
+#endif
+
+// Every instruction adds its cycles once, plus the extra when a conditional
+// call or return is taken. I8080_NO_CYCLES counts one per instruction.
+#ifdef I8080_NO_CYCLES
+#define CYCLES(N) cpu->cyc++
+#define TAKEN_CYCLES(N)
+#else
+#define CYCLES(N) cpu->cyc += (N)
+#define TAKEN_CYCLES(N) cpu->cyc += (N)
+#endif
 
 #define CONCAT(HI, LO) ((((HI) << 8) | ((LO) & 0XFF)) & 0XFFFF)
 
@@ -24,39 +59,146 @@ int parity_table[] = {
   1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1
 };
 
+#ifdef I8080_ALU_TABLES
+// ALU tables
+//
+// Filled on the first reset and left writable, so on the device they sit in
+// internal RAM rather than behind the flash wait states. szp_table holds the
+// S, Z and P bits of each result, and daa_table the result of DAA for A plus
+// C in bit 8 and A in bit 9, with the flags it sets in bits 8-15. The carry
+// and auxiliary carry of an add or subtract are bits 8 and 4 of the operands
+// xored with the result, which needs no table.
+static uint8_t szp_table[256];
+static uint16_t daa_table[1024];
+
+static uint daa_result(uint a, int carry, int aux_carry) {
+  uint add = 0;
+
+  if ((a & 0xF) > 9 || aux_carry) {
+    add |= 0x06;
+  }
+
+  if ((a & 0xF0) > 0x90 || ((a & 0xF0) >= 0x90 && (a & 0xF) > 9) || carry) {
+    add |= 0x60;
+    carry = 1;
+  }
+
+  uint res16 = a + add;
+  uint flags = szp_table[res16 & 0xFF] | ((a ^ add ^ res16) & 0x10) | (carry ? 0x01 : 0);
+
+  return (res16 & 0xFF) | (flags << 8);
+}
+
+static void init_alu_tables(void) {
+  static int initialised;
+
+  if (initialised) {
+    return;
+  }
+
+  for (uint i=0;i<256;i++) {
+    szp_table[i] = (i & 0x80) | (i == 0 ? 0x40 : 0) | (parity_table[i] ? 0x04 : 0);
+  }
+
+  for (uint i=0;i<1024;i++) {
+    daa_table[i] = daa_result(i & 0xFF, i & 0x100, i & 0x200);
+  }
+
+  initialised = 1;
+}
+#endif
+
 // External API
 void i8080_reset(struct i8080 *cpu) {
   cpu->A = 0;
-  cpu->B = 0;
-  cpu->C = 0;
-  cpu->D = 0;
-  cpu->E = 0;
-  cpu->H = 0;
-  cpu->L = 0;
+  cpu->BC = 0;
+  cpu->DE = 0;
+  cpu->HL = 0;
   cpu->PC = 0;
   cpu->SP = 0;
   cpu->flags = 2;
+#ifdef I8080_LAZY_FLAGS
+  cpu->lazy_mask = 0;
+#endif
 
   cpu->INTE = 0;
   cpu->halted = 0;
 
   cpu->cyc = 0;
 
+#ifdef I8080_ALU_TABLES
+  init_alu_tables();
+#endif
+
   cpu->input_handler = NULL;
   cpu->output_handler = NULL;
+  cpu->io = NULL;
+
+#ifdef I8080_TRACE
+  cpu->trace_handler = NULL;
+#endif
 
+#ifndef I8080_NO_INTERRUPTS
   cpu->pending_interrupt = 0;
   cpu->interrupt_opcode = 0;
-}
-
+#endif
+
+  cpu->run_end = 0;
+  cpu->exit_reason = I8080_EXIT_BUDGET;
+  cpu->exit_port = 0;
+
+#ifdef I8080_BLOCK_CACHE
+  cpu->block_cache = NULL;
+#endif
+#ifdef I8080_JIT
+  cpu->jit = NULL;
+#endif
+#ifdef I8080_PRECOMPILED
+  cpu->precompiled = NULL;
+#endif
+#ifdef I8080_PAGE_CACHE
+  cpu->page_cache = NULL;
+#endif
+#ifdef I8080_LAZY_MEMORY
+  memset(cpu->page_owners, I8080_PAGE_MEMORY, sizeof(cpu->page_owners));
+  cpu->image = NULL;
+#endif
+#ifdef I8080_DIRTY_PAGES
+  memset(cpu->dirty_pages, 0, sizeof(cpu->dirty_pages));
+  cpu->dirty_generation = 0;
+#endif
+}
+
+void stop_run(struct i8080 *cpu, enum i8080_exit_reason reason);
+#ifdef I8080_BLOCK_CACHE
+void invalidate_code(struct i8080 *cpu, uint addr, uint data);
+#endif
+#ifdef I8080_PRECOMPILED
+void guard_precompiled(struct i8080 *cpu, uint addr, uint data);
+void execute(struct i8080 *cpu, uint opcode);
+#endif
+#ifdef I8080_PAGE_CACHE
+uint8_t *cached_byte(struct i8080 *cpu, uint addr, int write);
+#endif
+#ifdef I8080_LAZY_MEMORY
+void fill_in_page(struct i8080 *cpu, uint page);
+#endif
+
+#ifndef I8080_NO_INTERRUPTS
 void i8080_request_interrupt(struct i8080 *cpu, uint opcode) {
   cpu->halted = 0;
   if (cpu->INTE) {
     cpu->INTE = 0;
     cpu->pending_interrupt = 1;
     cpu->interrupt_opcode = opcode;
+    stop_run(cpu, I8080_EXIT_INTERRUPT);
   }
 }
+#endif
+
+void i8080_yield(struct i8080 *cpu) {
+  stop_run(cpu, I8080_EXIT_IO);
+}
 
 void i8080_load_memory(struct i8080 *cpu, char *path, size_t offset) {
   FILE *file = fopen(path, "r");
@@ -74,39 +216,98 @@ void i8080_load_memory(struct i8080 *cpu, char *path, size_t offset) {
   fclose(file);
 }
 
+// Addresses wrap at 16 bits as on the 8080. With I8080_MEMORY_64K memory
+// covers all of them, otherwise bytes past memsize read as 0 and ignore
+// writes
+#ifdef I8080_MEMORY_64K
+#define IN_MEMORY(cpu, addr) 1
+#else
+#define IN_MEMORY(cpu, addr) ((addr) < (cpu)->memsize)
+#endif
+
 uint i8080_read_byte(struct i8080 *cpu, uint addr) {
-  if (addr >= cpu->memsize) {
+  addr &= 0xFFFF;
+
+  if (!IN_MEMORY(cpu, addr)) {
     return '\0';
   }
 
+#ifdef I8080_PAGE_CACHE
+  if (cpu->page_cache != NULL) {
+    return *cached_byte(cpu, addr, 0);
+  }
+#endif
+#ifdef I8080_LAZY_MEMORY
+  uint owner = cpu->page_owners[addr >> I8080_PAGE_SHIFT];
+  if (owner != I8080_PAGE_MEMORY) {
+    return owner == I8080_PAGE_IMAGE ? cpu->image[addr] & 0xFF : 0;
+  }
+#endif
+
   return cpu->memory[addr] & 0xFF;
 }
 
 uint i8080_read_word(struct i8080 *cpu, uint addr) {
-  int hi = cpu->memory[addr+1] & 0xFF;
-  int lo = cpu->memory[addr] & 0xFF;
+  uint hi = i8080_read_byte(cpu, addr + 1);
+  uint lo = i8080_read_byte(cpu, addr);
 
   return (hi << 8) | lo;
 }
 
 void i8080_write_byte(struct i8080 *cpu, uint addr, uint data) {
-  if (addr < cpu->memsize) {
+  addr &= 0xFFFF;
+
+  if (IN_MEMORY(cpu, addr)) {
+#ifdef I8080_DIRTY_PAGES
+    cpu->dirty_pages[addr >> (I8080_PAGE_SHIFT + 3)] |= 1 << ((addr >> I8080_PAGE_SHIFT) & 7);
+#endif
+#ifdef I8080_BLOCK_CACHE
+    if (cpu->block_cache != NULL) {
+      invalidate_code(cpu, addr, data);
+    }
+#endif
+#ifdef I8080_JIT
+    if (cpu->jit != NULL) {
+      i8080_jit_invalidate(cpu, addr, data);
+    }
+#endif
+#ifdef I8080_PRECOMPILED
+    if (cpu->precompiled != NULL) {
+      guard_precompiled(cpu, addr, data);
+    }
+#endif
+#ifdef I8080_PAGE_CACHE
+    if (cpu->page_cache != NULL) {
+      *cached_byte(cpu, addr, 1) = data;
+      return;
+    }
+#endif
+#ifdef I8080_LAZY_MEMORY
+    if (cpu->page_owners[addr >> I8080_PAGE_SHIFT] != I8080_PAGE_MEMORY) {
+      fill_in_page(cpu, addr >> I8080_PAGE_SHIFT);
+    }
+#endif
     cpu->memory[addr] = (char) data;
   }
 }
 
 void i8080_write_word(struct i8080 *cpu, uint addr, uint data) {
-  char hi = (data >> 8) & 0xFF;
-  char lo = data & 0xFF;
-
-  cpu->memory[addr] = lo;
-  cpu->memory[addr+1] = hi;
+  i8080_write_byte(cpu, addr, data & 0xFF);
+  i8080_write_byte(cpu, addr + 1, (data >> 8) & 0xFF);
 }
 
 uint get_flag_mask(enum i8080_flag flag);
+#ifdef I8080_LAZY_FLAGS
+int lazy_flag(struct i8080 *cpu, enum i8080_flag flag);
+#endif
+
 void i8080_set_flag(struct i8080 *cpu, enum i8080_flag flag, int val) {
   uint mask = get_flag_mask(flag);
 
+#ifdef I8080_LAZY_FLAGS
+  cpu->lazy_mask &= ~mask;
+#endif
+
   if (val) {
     cpu->flags = (cpu->flags | mask) & 0xFF;
   } else {
@@ -116,9 +317,32 @@ void i8080_set_flag(struct i8080 *cpu, enum i8080_flag flag, int val) {
 
 int i8080_get_flag(struct i8080 *cpu, enum i8080_flag flag) {
   uint mask = get_flag_mask(flag);
+
+#ifdef I8080_LAZY_FLAGS
+  if (cpu->lazy_mask & mask) {
+    return lazy_flag(cpu, flag);
+  }
+#endif
+
   return (cpu->flags & mask) != 0;
 }
 
+void i8080_sync_flags(struct i8080 *cpu) {
+#ifdef I8080_LAZY_FLAGS
+  if (cpu->lazy_mask) {
+    uint res = cpu->lazy_result;
+    uint lazy = (res & 0x80) |
+                ((res & 0xFF) == 0 ? 0x40 : 0) |
+                (cpu->lazy_aux & 0x10) |
+                (parity_table[res & 0xFF] ? 0x04 : 0) |
+                ((res >> 8) & 0x01);
+
+    cpu->flags = (cpu->flags & ~cpu->lazy_mask) | (lazy & cpu->lazy_mask);
+    cpu->lazy_mask = 0;
+  }
+#endif
+}
+
 void i8080_push_stackb(struct i8080 *cpu, uint val) {
   cpu->SP = (cpu->SP-1) & 0XFFFF;
   i8080_write_byte(cpu, cpu->SP, val & 0xFF);
@@ -143,6 +367,13 @@ uint i8080_pop_stackw(struct i8080 *cpu) {
 }
 
 // Internal logic
+
+// Ends i8080_run after the current instruction
+void stop_run(struct i8080 *cpu, enum i8080_exit_reason reason) {
+  cpu->exit_reason = reason;
+  cpu->run_end = cpu->cyc;
+}
+
 uint get_flag_mask(enum i8080_flag flag) {
   switch (flag) {
     case FLAG_S: return 0x80;
@@ -172,94 +403,132 @@ int check_condition(struct i8080 *cpu, uint condition) {
   }
 }
 
+// Register 6 is the memory location addressed by HL
 void set_reg(struct i8080 *cpu, uint reg, uint val) {
-  val &= 0xFF;
-
-  switch (reg) {
-    case 7: cpu->A = val;
-      break;
-    case 0: cpu->B = val;
-      break;
-    case 1: cpu->C = val;
-      break;
-    case 2: cpu->D = val;
-      break;
-    case 3: cpu->E = val;
-      break;
-    case 4: cpu->H = val;
-      break;
-    case 5: cpu->L = val;
-      break;
-    case 6: i8080_write_byte(cpu, CONCAT(cpu->H, cpu->L), val);
-      break;
-    default:
-      fprintf(stderr, "Invalid register %d\n", reg);
-      exit(1);
+  if (reg == 6) {
+    i8080_write_byte(cpu, cpu->HL, val & 0xFF);
+  } else {
+    cpu->reg[I8080_REG_INDEX(reg)] = val;
   }
 }
 
 uint get_reg(struct i8080 *cpu, uint reg) {
-  switch (reg) {
-    case 7: return cpu->A;
-    case 0: return cpu->B;
-    case 1: return cpu->C;
-    case 2: return cpu->D;
-    case 3: return cpu->E;
-    case 4: return cpu->H;
-    case 5: return cpu->L;
-    case 6: return i8080_read_byte(cpu, CONCAT(cpu->H, cpu->L));
-    default:
-      fprintf(stderr, "Invalid register %d\n", reg);
-      exit(1);
+  if (reg == 6) {
+    return i8080_read_byte(cpu, cpu->HL);
   }
+
+  return cpu->reg[I8080_REG_INDEX(reg)];
 }
 
+// Register pair 3 is SP, except for PUSH and POP where it is PSW
 uint get_reg_pair(struct i8080 *cpu, uint reg_pair) {
-  switch (reg_pair) {
-    case 0: return CONCAT(cpu->B, cpu->C);
-    case 1: return CONCAT(cpu->D, cpu->E);
-    case 2: return CONCAT(cpu->H, cpu->L);
-    case 3: return cpu->SP;
-    default:
-      fprintf(stderr, "Invalid register pair %d\n", reg_pair);
-      exit(1);
-  }
+  return reg_pair == 3 ? cpu->SP : cpu->pair[reg_pair];
 }
 
 void set_reg_pair(struct i8080 *cpu, uint reg_pair, uint val) {
-  uint hi = (val >> 8) & 0xFF;
-  uint lo = val & 0xFF;
+  if (reg_pair == 3) {
+    cpu->SP = val;
+  } else {
+    cpu->pair[reg_pair] = val;
+  }
+}
 
-  switch (reg_pair) {
-    case 0:
-      cpu->B = hi;
-      cpu->C = lo;
-      break;
-    case 1:
-      cpu->D = hi;
-      cpu->E = lo;
-      break;
-    case 2:
-      cpu->H = hi;
-      cpu->L = lo;
-      break;
-    case 3:
-      cpu->SP = CONCAT(hi, lo);
-      break;
+// Each ALU operation writes the flags byte once, keeping the bits it leaves
+// alone
+#define SET_FLAGS(MASK, VAL) cpu->flags = (cpu->flags & ~(MASK)) | (VAL)
+
+#ifdef I8080_LAZY_FLAGS
+// Lazy flags
+//
+// ALU operations only record their result and the carries into each bit,
+// and lazy_mask says which flags are still held that way. A flag is worked
+// out when something reads it and the packed flags byte is only rebuilt by
+// i8080_sync_flags, which PUSH PSW calls.
+#define LAZY_SZP (0x80 | 0x40 | 0x04)
+#define LAZY_SZAP (LAZY_SZP | 0x10)
+#define LAZY_ALL (LAZY_SZAP | 0x01)
+
+// Bits 0-7 of the result give S, Z and P, bit 8 gives C and bit 4 of the
+// carries gives A
+void set_lazy_flags(struct i8080 *cpu, uint mask, uint res, uint carries) {
+  // Flags this operation leaves alone must not be lost with the old result
+  if (cpu->lazy_mask & ~mask) {
+    i8080_sync_flags(cpu);
+  }
+
+  cpu->lazy_mask = mask;
+  cpu->lazy_result = res;
+  cpu->lazy_aux = carries;
+}
+
+int lazy_flag(struct i8080 *cpu, enum i8080_flag flag) {
+  uint res = cpu->lazy_result;
+
+  switch (flag) {
+    case FLAG_S: return (res & 0x80) != 0;
+    case FLAG_Z: return (res & 0xFF) == 0;
+    case FLAG_A: return (cpu->lazy_aux & 0x10) != 0;
+    case FLAG_P: return parity_table[res & 0xFF];
+    case FLAG_C: return (res & 0x100) != 0;
     default:
-      fprintf(stderr, "Invalid register pair %d\n", reg_pair);
+      fprintf(stderr, "Invalid flag %d", flag);
       exit(1);
   }
 }
 
 void setSZP(struct i8080 *cpu, uint val) {
-  val &= 0xFF;
+  set_lazy_flags(cpu, LAZY_SZP, val & 0xFF, 0);
+}
+
+void set_inc_flags(struct i8080 *cpu, uint before, uint after) {
+  set_lazy_flags(cpu, LAZY_SZAP, after, before ^ after);
+}
+
+void set_dec_flags(struct i8080 *cpu, uint before, uint after) {
+  set_lazy_flags(cpu, LAZY_SZAP, after, before ^ 0xFF ^ after);
+}
+
+// Logical operations clear the carry and set the auxiliary carry as given
+void set_logic_flags(struct i8080 *cpu, uint val, int aux_carry) {
+  set_lazy_flags(cpu, LAZY_ALL, val & 0xFF, aux_carry ? 0x10 : 0);
+}
+#elif defined(I8080_ALU_TABLES)
+void setSZP(struct i8080 *cpu, uint val) {
+  SET_FLAGS(I8080_F_S | I8080_F_Z | I8080_F_P, szp_table[val & 0xFF]);
+}
 
-  i8080_set_flag(cpu, FLAG_S, val & 0x80);
-  i8080_set_flag(cpu, FLAG_Z, val == 0);
-  i8080_set_flag(cpu, FLAG_P, parity_table[val]);
+void set_inc_flags(struct i8080 *cpu, uint before, uint after) {
+  SET_FLAGS(I8080_F_SZAP, szp_table[after & 0xFF] | ((before ^ after) & 0x10));
 }
 
+void set_dec_flags(struct i8080 *cpu, uint before, uint after) {
+  SET_FLAGS(I8080_F_SZAP, szp_table[after & 0xFF] | ((before ^ 0xFF ^ after) & 0x10));
+}
+
+// Logical operations clear the carry and set the auxiliary carry as given
+void set_logic_flags(struct i8080 *cpu, uint val, int aux_carry) {
+  SET_FLAGS(I8080_F_ALL, szp_table[val & 0xFF] | (aux_carry ? 0x10 : 0));
+}
+#else
+// The flags come from i8080_flags.h, which the batch engine also uses
+void setSZP(struct i8080 *cpu, uint val) {
+  SET_FLAGS(I8080_F_S | I8080_F_Z | I8080_F_P, i8080_szp_flags(val & 0xFF));
+}
+
+void set_inc_flags(struct i8080 *cpu, uint before, uint after) {
+  SET_FLAGS(I8080_F_SZAP, i8080_inc_flags(before, after));
+}
+
+void set_dec_flags(struct i8080 *cpu, uint before, uint after) {
+  SET_FLAGS(I8080_F_SZAP, i8080_dec_flags(before, after));
+}
+
+// Logical operations clear the carry and set the auxiliary carry as given
+void set_logic_flags(struct i8080 *cpu, uint val, int aux_carry) {
+  SET_FLAGS(I8080_F_ALL, i8080_logic_flags(val, aux_carry));
+}
+#endif
+
 uint next_byte(struct i8080 *cpu) {
   return i8080_read_byte(cpu, cpu->PC++);
 }
@@ -271,11 +540,13 @@ uint next_word(struct i8080 *cpu) {
 }
 
 uint next_instruction_opcode(struct i8080 *cpu) {
+#ifndef I8080_NO_INTERRUPTS
   if (cpu->pending_interrupt) {
+    cpu->pending_interrupt = 0;
     return cpu->interrupt_opcode;
-  } else {
-    return next_byte(cpu);
   }
+#endif
+  return next_byte(cpu);
 }
 
 uint perform_sub(struct i8080 *cpu, uint minu, uint subt, int borrow) {
@@ -287,9 +558,15 @@ uint perform_sub(struct i8080 *cpu, uint minu, uint subt, int borrow) {
   uint res16 = minu + subt_ones + (borrow ? 0 : 1);
   uint res8 = res16 & 0xFF;
 
-  i8080_set_flag(cpu, FLAG_C, !(res16 & 0x100));
-  i8080_set_flag(cpu, FLAG_A, ((minu & 0xF) + (subt_ones & 0xF) + (borrow ? 0 : 1)) & 0x10);
-  setSZP(cpu, res8);
+#ifdef I8080_LAZY_FLAGS
+  // The carry out is inverted to give the borrow
+  set_lazy_flags(cpu, LAZY_ALL, res16 ^ 0x100, minu ^ subt_ones ^ res16);
+#elif defined(I8080_ALU_TABLES)
+  SET_FLAGS(I8080_F_ALL, szp_table[res8] | ((minu ^ subt_ones ^ res16) & 0x10) |
+                         (~res16 >> 8 & 0x01));
+#else
+  SET_FLAGS(I8080_F_ALL, i8080_sub_flags(minu, subt_ones, res16));
+#endif
 
   return res8;
 }
@@ -300,9 +577,13 @@ uint perform_add(struct i8080 *cpu, uint a, uint b, int carry) {
   uint res16 = a + b + carry_val;
   uint res8 = res16 & 0xFF;
 
-  i8080_set_flag(cpu, FLAG_C, res16 & 0x100);
-  i8080_set_flag(cpu, FLAG_A, (((a & 0xF) + (b & 0xF) + carry_val) & 0x10));
-  setSZP(cpu, res8);
+#ifdef I8080_LAZY_FLAGS
+  set_lazy_flags(cpu, LAZY_ALL, res16, a ^ b ^ res16);
+#elif defined(I8080_ALU_TABLES)
+  SET_FLAGS(I8080_F_ALL, szp_table[res8] | ((a ^ b ^ res16) & 0x10) | (res16 >> 8 & 0x01));
+#else
+  SET_FLAGS(I8080_F_ALL, i8080_add_flags(a, b, res16));
+#endif
 
   return res8;
 }
@@ -310,20 +591,21 @@ uint perform_add(struct i8080 *cpu, uint a, uint b, int carry) {
 // Instructions follow
 // HLT - Halt
 void hlt(struct i8080 *cpu) {
-  cpu->cyc += 7;
+  CYCLES(7);
   cpu->halted = 1;
+  stop_run(cpu, I8080_EXIT_HALT);
 }
 
 // NOP - No Operation
 void nop(struct i8080 *cpu) {
-  cpu->cyc += 4;
+  CYCLES(4);
 }
 
 // MOV - Move
 void mov(struct i8080 *cpu, uint opcode) {
   uint dst = (opcode & 0x38) >> 3;
   uint src = opcode & 0x07;
-  cpu->cyc += (dst == 6 || src == 6) ? 7 : 5;
+  CYCLES((dst == 6 || src == 6) ? 7 : 5);
 
   set_reg(cpu, dst, get_reg(cpu, src));
 }
@@ -331,39 +613,39 @@ void mov(struct i8080 *cpu, uint opcode) {
 // MVI - Move Immediate
 void mvi(struct i8080 *cpu, uint opcode) {
   uint reg = (opcode & 0x38) >> 3;
-  cpu->cyc += (reg == 6) ? 10 : 7;
+  CYCLES((reg == 6) ? 10 : 7);
   set_reg(cpu, reg, next_byte(cpu));
 }
 
 // STA - Store Accumulator Direct
-void sta(struct i8080 *cpu) {
-  cpu->cyc += 13;
-  i8080_write_byte(cpu, next_word(cpu), cpu->A);
+void sta(struct i8080 *cpu, uint addr) {
+  CYCLES(13);
+  i8080_write_byte(cpu, addr, cpu->A);
 }
 
 // LDA - Load Accumulator Direct
-void lda(struct i8080 *cpu) {
-  cpu->cyc += 13;
-  cpu->A = i8080_read_byte(cpu, next_word(cpu));
+void lda(struct i8080 *cpu, uint addr) {
+  CYCLES(13);
+  cpu->A = i8080_read_byte(cpu, addr);
 }
 
 // LXI - Load Register Pair Immediate
 void lxi(struct i8080 *cpu, uint opcode) {
-  cpu->cyc += 10;
+  CYCLES(10);
   uint reg_pair = (opcode & 0x30) >> 4;
   set_reg_pair(cpu, reg_pair, next_word(cpu));
 }
 
 // STAX - Store Accumulator
 void stax(struct i8080 *cpu, uint opcode) {
-  cpu->cyc += 7;
+  CYCLES(7);
   uint reg_pair = (opcode & 0x30) >> 4;
   i8080_write_byte(cpu, get_reg_pair(cpu, reg_pair), cpu->A);
 }
 
 // LDAX - Load Accumulator
 void ldax(struct i8080 *cpu, uint opcode) {
-  cpu->cyc += 7;
+  CYCLES(7);
   uint reg_pair = (opcode & 0x30) >> 4;
   cpu->A = i8080_read_byte(cpu, get_reg_pair(cpu, reg_pair));
 }
@@ -371,40 +653,51 @@ void ldax(struct i8080 *cpu, uint opcode) {
 // INR - Increment Register or Memory
 void inr(struct i8080 *cpu, uint opcode) {
   uint reg = (opcode & 0x38) >> 3;
-  cpu->cyc += (reg == 6) ? 10 : 5;
+  CYCLES((reg == 6) ? 10 : 5);
 
-  i8080_set_flag(cpu, FLAG_A, (get_reg(cpu, reg) & 0x0F) == 0x0F);
-  set_reg(cpu, reg, get_reg(cpu, reg)+1);
-  setSZP(cpu, get_reg(cpu, reg));
+  uint val = get_reg(cpu, reg);
+  set_reg(cpu, reg, val+1);
+  set_inc_flags(cpu, val, (val+1) & 0xFF);
 }
 
 // DCR - Decrement Register or Memory
 void dcr(struct i8080 *cpu, uint opcode) {
   uint reg = (opcode & 0x38) >> 3;
-  cpu->cyc += (reg == 6) ? 10 : 5;
+  CYCLES((reg == 6) ? 10 : 5);
 
-  i8080_set_flag(cpu, FLAG_A, (!(get_reg(cpu, reg) & 0x0F)) == 0);
-  set_reg(cpu, reg, get_reg(cpu, reg)-1);
-  setSZP(cpu, get_reg(cpu, reg));
+  uint val = get_reg(cpu, reg);
+  set_reg(cpu, reg, val-1);
+  set_dec_flags(cpu, val, (val-1) & 0xFF);
 }
 
 // INX - Increment Register Pair
 void inx(struct i8080 *cpu, uint opcode) {
-  cpu->cyc += 5;
+  CYCLES(5);
   uint reg = (opcode & 0x30) >> 4;
   set_reg_pair(cpu, reg, get_reg_pair(cpu, reg)+1);
 }
 
 // DCX - Decrement Register Pair
 void dcx(struct i8080 *cpu, uint opcode) {
-  cpu->cyc += 5;
+  CYCLES(5);
   uint reg = (opcode & 0x30) >> 4;
   set_reg_pair(cpu, reg, get_reg_pair(cpu, reg)-1);
 }
 
 // DAA - Decimal Adjust Accumulator
 void daa(struct i8080 *cpu) {
-  cpu->cyc += 4;
+  CYCLES(4);
+#ifdef I8080_ALU_TABLES
+  uint index = cpu->A | (i8080_get_flag(cpu, FLAG_C) << 8) | (i8080_get_flag(cpu, FLAG_A) << 9);
+  uint res = daa_table[index];
+
+  cpu->A = res & 0xFF;
+#ifdef I8080_LAZY_FLAGS
+  set_lazy_flags(cpu, LAZY_ALL, res & 0x1FF, res >> 8);
+#else
+  SET_FLAGS(I8080_F_ALL, res >> 8);
+#endif
+#else
   uint add = 0;
 
   if (((cpu->A & 0xF) > 9) || i8080_get_flag(cpu, FLAG_A)) {
@@ -428,145 +721,134 @@ void daa(struct i8080 *cpu) {
 
   // The carry bit is unaffected if there is no carry out of the upper nibble
   i8080_set_flag(cpu, FLAG_C, carry);
+#endif
 }
 
 // ADD - Add Register or Memory to Accumulator
 void add(struct i8080 *cpu, uint opcode) {
   uint reg = opcode & 0x7;
-  cpu->cyc += (reg == 6) ? 7 : 4;
+  CYCLES((reg == 6) ? 7 : 4);
   cpu->A = perform_add(cpu, cpu->A, get_reg(cpu, reg), 0);
 }
 
 // ADC - Add Register or Memory to Accumulator With Carry
 void adc(struct i8080 *cpu, uint opcode) {
   uint reg = opcode & 0x7;
-  cpu->cyc += (reg == 6) ? 7 : 4;
+  CYCLES((reg == 6) ? 7 : 4);
   cpu->A = perform_add(cpu, cpu->A, get_reg(cpu, reg), i8080_get_flag(cpu, FLAG_C));
 }
 
 // SBB - Subtract Register or Memory from Accumulator with Borrow
 void sbb(struct i8080 *cpu, uint opcode) {
   uint reg = opcode & 0x7;
-  cpu->cyc += (reg == 6) ? 7 : 4;
+  CYCLES((reg == 6) ? 7 : 4);
   cpu->A = perform_sub(cpu, cpu->A, get_reg(cpu, reg), i8080_get_flag(cpu, FLAG_C));
 }
 
 // SUB - Subtract Register or Memory from Accumulator
 void sub(struct i8080 *cpu, uint opcode) {
   uint reg = opcode & 0x7;
-  cpu->cyc += (reg == 6) ? 7 : 4;
+  CYCLES((reg == 6) ? 7 : 4);
   cpu->A = perform_sub(cpu, cpu->A, get_reg(cpu, reg), 0);
 }
 
 // ANA - Logical and Memory or Register with Accumulator
 void ana(struct i8080 *cpu, uint opcode) {
   uint reg = opcode & 0x07;
-  cpu->cyc += (reg == 6) ? 7 : 4;
-  i8080_set_flag(cpu, FLAG_A, (get_reg(cpu, reg) | cpu->A) & 0x08);
+  CYCLES((reg == 6) ? 7 : 4);
+  uint val = get_reg(cpu, reg);
+  uint aux_carry = (val | cpu->A) & 0x08;
 
-  cpu->A &= get_reg(cpu, reg);
+  cpu->A &= val;
 
-  i8080_set_flag(cpu, FLAG_C, 0);
-  setSZP(cpu, cpu->A);
+  set_logic_flags(cpu, cpu->A, aux_carry);
 }
 
 // XRA - Logical Exclusive-Or Register or Memory With Accumulator
 void xra(struct i8080 *cpu, uint opcode) {
   uint reg = opcode & 0x07;
-  cpu->cyc += (reg == 6) ? 7 : 4;
+  CYCLES((reg == 6) ? 7 : 4);
   cpu->A ^= get_reg(cpu, reg);
 
-  i8080_set_flag(cpu, FLAG_C, 0);
-  i8080_set_flag(cpu, FLAG_A, 0);
-  setSZP(cpu, cpu->A);
+  set_logic_flags(cpu, cpu->A, 0);
 }
 
 // ADI - Add Immediate to Accumulator
-void adi(struct i8080 *cpu) {
-  cpu->cyc += 7;
-  cpu->A = perform_add(cpu, cpu->A, next_byte(cpu), 0);
+void adi(struct i8080 *cpu, uint val) {
+  CYCLES(7);
+  cpu->A = perform_add(cpu, cpu->A, val, 0);
 }
 
 // SUI - Subtract Immediate From Accumulator
-void sui(struct i8080 *cpu) {
-  cpu->cyc += 7;
-  cpu->A = perform_sub(cpu, cpu->A, next_byte(cpu), 0);
+void sui(struct i8080 *cpu, uint val) {
+  CYCLES(7);
+  cpu->A = perform_sub(cpu, cpu->A, val, 0);
 }
 
 // ANI - Logical and Immediate With Accumulator
-void ani(struct i8080 *cpu) {
-  cpu->cyc += 7;
-  uint val = next_byte(cpu);
-  i8080_set_flag(cpu, FLAG_A, (val | cpu->A) & 0x08);
+void ani(struct i8080 *cpu, uint val) {
+  CYCLES(7);
+  uint aux_carry = (val | cpu->A) & 0x08;
 
   cpu->A &= val;
 
-  i8080_set_flag(cpu, FLAG_C, 0);
-  setSZP(cpu, cpu->A);
+  set_logic_flags(cpu, cpu->A, aux_carry);
 }
 
 // ORI - Logical or Immediate With Accumulator
-void ori(struct i8080 *cpu) {
-  cpu->cyc += 7;
-  uint val = next_byte(cpu);
+void ori(struct i8080 *cpu, uint val) {
+  CYCLES(7);
 
   cpu->A |= val;
 
-  i8080_set_flag(cpu, FLAG_A, 0);
-  i8080_set_flag(cpu, FLAG_C, 0);
-  setSZP(cpu, cpu->A);
+  set_logic_flags(cpu, cpu->A, 0);
 }
 
 // ACI - Add Immediate to Accumulator With Carry
-void aci(struct i8080 *cpu) {
-  cpu->cyc += 7;
-  cpu->A = perform_add(cpu, cpu->A, next_byte(cpu), i8080_get_flag(cpu, FLAG_C));
+void aci(struct i8080 *cpu, uint val) {
+  CYCLES(7);
+  cpu->A = perform_add(cpu, cpu->A, val, i8080_get_flag(cpu, FLAG_C));
 }
 
 // SBI - Subtract Immediate from Accumulator With Borrow
-void sbi(struct i8080 *cpu) {
-  cpu->cyc += 7;
-  cpu->A = perform_sub(cpu, cpu->A, next_byte(cpu), i8080_get_flag(cpu, FLAG_C));
+void sbi(struct i8080 *cpu, uint val) {
+  CYCLES(7);
+  cpu->A = perform_sub(cpu, cpu->A, val, i8080_get_flag(cpu, FLAG_C));
 }
 
 // XRI - Logical Exclusive-Or Immediate With Accumulator
-void xri(struct i8080 *cpu) {
-  cpu->cyc += 7;
-  uint val = next_byte(cpu);
+void xri(struct i8080 *cpu, uint val) {
+  CYCLES(7);
   cpu->A ^= val;
 
-  i8080_set_flag(cpu, FLAG_C, 0);
-  i8080_set_flag(cpu, FLAG_A, 0);
-  setSZP(cpu, cpu->A);
+  set_logic_flags(cpu, cpu->A, 0);
 }
 
 // CPI - Compare Immediate With Accumulator
-void cpi(struct i8080 *cpu) {
-  cpu->cyc += 7;
-  perform_sub(cpu, cpu->A, next_byte(cpu), 0);
+void cpi(struct i8080 *cpu, uint val) {
+  CYCLES(7);
+  perform_sub(cpu, cpu->A, val, 0);
 }
 
 // CMP - Compare Memory or Register With Accumulator
 void cmp(struct i8080 *cpu, uint opcode) {
   uint reg = opcode & 0x7;
-  cpu->cyc += (reg == 6) ? 7 : 4;
+  CYCLES((reg == 6) ? 7 : 4);
   perform_sub(cpu, cpu->A, get_reg(cpu, reg), 0);
 }
 
 // ORA - Logical or Memory or Register with Accumulator
 void ora(struct i8080 *cpu, uint opcode) {
   uint reg = opcode & 0x07;
-  cpu->cyc += (reg == 6) ? 7 : 4;
+  CYCLES((reg == 6) ? 7 : 4);
   cpu->A |= get_reg(cpu, reg);
 
-  i8080_set_flag(cpu, FLAG_A, 0);
-  i8080_set_flag(cpu, FLAG_C, 0);
-  setSZP(cpu, cpu->A);
+  set_logic_flags(cpu, cpu->A, 0);
 }
 
 // RLC - Rotate Accumulator Left
 void rlc(struct i8080 *cpu) {
-  cpu->cyc += 4;
+  CYCLES(4);
   uint hi_bit = (cpu->A & 0x80) ? 1 : 0;
 
   cpu->A <<= 1;
@@ -579,7 +861,7 @@ void rlc(struct i8080 *cpu) {
 
 // RRC - Rotate Accumulator Right
 void rrc(struct i8080 *cpu) {
-  cpu->cyc += 4;
+  CYCLES(4);
   uint lo_bit = cpu->A & 0x01;
 
   cpu->A >>= 1;
@@ -591,7 +873,7 @@ void rrc(struct i8080 *cpu) {
 
 // RAL - Rotate Accumulator Left Through Carry
 void ral(struct i8080 *cpu) {
-  cpu->cyc += 4;
+  CYCLES(4);
   uint old_carry = i8080_get_flag(cpu, FLAG_C) ? 1 : 0;
 
   i8080_set_flag(cpu, FLAG_C, cpu->A & 0x80);
@@ -603,7 +885,7 @@ void ral(struct i8080 *cpu) {
 
 // RAR - Rotate Accumulator Right Through Carry
 void rar(struct i8080 *cpu) {
-  cpu->cyc += 4;
+  CYCLES(4);
   uint old_carry = i8080_get_flag(cpu, FLAG_C) ? 1 : 0;
 
   i8080_set_flag(cpu, FLAG_C, cpu->A & 0x01);
@@ -615,81 +897,79 @@ void rar(struct i8080 *cpu) {
 
 // CMC - Complement Carry Bit
 void cmc(struct i8080 *cpu) {
-  cpu->cyc += 4;
+  CYCLES(4);
   i8080_set_flag(cpu, FLAG_C, !i8080_get_flag(cpu, FLAG_C));
 }
 
 // CMA - Complement Accumulator
 void cma(struct i8080 *cpu) {
-  cpu->cyc += 4;
+  CYCLES(4);
   cpu->A = (~cpu->A) & 0xFF;
 }
 
 // STC - Set Carry Bit
 void stc(struct i8080 *cpu) {
-  cpu->cyc += 4;
+  CYCLES(4);
   i8080_set_flag(cpu, FLAG_C, 1);
 }
 
 // DAD - Double Add
 void dad(struct i8080 *cpu, uint opcode) {
-  cpu->cyc += 10;
+  CYCLES(10);
   uint reg_pair = (opcode & 0x30) >> 4;
 
-  uint new_val = (CONCAT(cpu->H, cpu->L) + get_reg_pair(cpu, reg_pair));
+  uint new_val = cpu->HL + get_reg_pair(cpu, reg_pair);
   i8080_set_flag(cpu, FLAG_C, new_val & 0x10000);
 
-  cpu->H = (new_val >> 8) & 0xFF;
-  cpu->L = new_val & 0xFF;
+  cpu->HL = new_val;
 }
 
 // XCHG - Exchange Registers
 void xchg(struct i8080 *cpu) {
-  cpu->cyc += 5;
-  uint h_temp = cpu->H;
-  uint l_temp = cpu->L;
+  CYCLES(5);
+  uint hl_temp = cpu->HL;
 
-  cpu->H = cpu->D;
-  cpu->L = cpu->E;
-  cpu->D = h_temp;
-  cpu->E = l_temp;
+  cpu->HL = cpu->DE;
+  cpu->DE = hl_temp;
 }
 
 // SPHL - Load SP from H and L
 void sphl(struct i8080 *cpu) {
-  cpu->cyc += 5;
-  cpu->SP = CONCAT(cpu->H, cpu->L);
+  CYCLES(5);
+  cpu->SP = cpu->HL;
 }
 
 // SHLD - Store H and L direct
-void shld(struct i8080 *cpu) {
-  cpu->cyc += 16;
-  uint addr = next_word(cpu);
+void shld(struct i8080 *cpu, uint addr) {
+  CYCLES(16);
   i8080_write_byte(cpu, addr, cpu->L);
   i8080_write_byte(cpu, addr + 1, cpu->H);
 }
 
 // LHLD - Load H and L direct
-void ldhd(struct i8080 *cpu) {
-  cpu->cyc += 16;
-  uint addr = next_word(cpu);
+void ldhd(struct i8080 *cpu, uint addr) {
+  CYCLES(16);
   cpu->L = i8080_read_byte(cpu, addr);
   cpu->H = i8080_read_byte(cpu, addr + 1);
 }
 
 // PUSH - Push Data Onto Stack
 void push(struct i8080 *cpu, uint opcode) {
-  cpu->cyc += 11;
+  CYCLES(11);
   uint reg_pair = (opcode & 0x30) >> 4;
 
   // Register pair 3 refers to the concatenation of A and flags with push/pop
+  if (reg_pair == 3) {
+    i8080_sync_flags(cpu);
+  }
+
   uint data = reg_pair == 3 ? CONCAT(cpu->A, cpu->flags) : get_reg_pair(cpu, reg_pair);
   i8080_push_stackw(cpu, data);
 }
 
 // POP - Pop Data From Stack
 void pop(struct i8080 *cpu, uint opcode) {
-  cpu->cyc += 10;
+  CYCLES(10);
   uint reg_pair = (opcode & 0x30) >> 4;
 
   if (reg_pair == 3) { // PSW special case for push/pop
@@ -697,6 +977,9 @@ void pop(struct i8080 *cpu, uint opcode) {
 
     cpu->flags |= 2; // Bit 1 of flags always set
     cpu->flags &= 0xD7; // Bits 3 and 5 of flags always reset
+#ifdef I8080_LAZY_FLAGS
+    cpu->lazy_mask = 0;
+#endif
 
     cpu->A = i8080_pop_stackb(cpu);
   } else {
@@ -706,7 +989,7 @@ void pop(struct i8080 *cpu, uint opcode) {
 
 // XTHL - Exchange Stack
 void xthl(struct i8080 *cpu) {
-  cpu->cyc += 18;
+  CYCLES(18);
   uint temp_h = cpu->H;
   uint temp_l = cpu->L;
 
@@ -726,13 +1009,14 @@ void xthl(struct i8080 *cpu) {
 // CP   - Call if Plus
 // CM   - Call if Minus
 void general_call(struct i8080 *cpu, uint opcode) {
-  cpu->cyc += 11;
+  CYCLES(11);
 
   // Unconditional call has LSB set, conditional calls do not
   if ((opcode & 1) || check_condition(cpu, (opcode >> 3) & 0x07)) {
-    cpu->cyc += 6;
-    i8080_push_stackw(cpu, cpu->PC + 2);
-    cpu->PC = next_word(cpu);
+    TAKEN_CYCLES(6);
+    uint addr = next_word(cpu);
+    i8080_push_stackw(cpu, cpu->PC);
+    cpu->PC = addr;
   } else {
     cpu->PC += 2;
   }
@@ -749,11 +1033,11 @@ void general_call(struct i8080 *cpu, uint opcode) {
 // RP  - Return if Plus
 // RM  - Return if Minus
 void general_return(struct i8080 *cpu, uint opcode) {
-  cpu->cyc += 5;
+  CYCLES(5);
 
   // Unconditional return has LSB set, conditional returns do not
   if ((opcode & 1) || check_condition(cpu, (opcode >> 3) & 0x07)) {
-    cpu->cyc += 6;
+    TAKEN_CYCLES(6);
     cpu->PC = i8080_pop_stackw(cpu);
   }
 }
@@ -769,7 +1053,7 @@ void general_return(struct i8080 *cpu, uint opcode) {
 // JP  - Jump if Plus
 // JM  - Jump if Minus
 void general_jump(struct i8080 *cpu, uint opcode) {
-  cpu->cyc += 10;
+  CYCLES(10);
   if ((opcode & 1) || check_condition(cpu, (opcode >> 3) & 0x07)) {
     cpu->PC = next_word(cpu);
   } else {
@@ -779,53 +1063,1009 @@ void general_jump(struct i8080 *cpu, uint opcode) {
 
 // PCHL - Load Program Counter
 void pchl(struct i8080 *cpu) {
-  cpu->cyc += 5;
-  cpu->PC = CONCAT(cpu->H, cpu->L);
+  CYCLES(5);
+  cpu->PC = cpu->HL;
 }
 
 // EI - Enable Interrupts
 void ei(struct i8080 *cpu) {
-  cpu->cyc += 4;
+  CYCLES(4);
   cpu->INTE = 1;
 }
 
 // DI - Disable Interrupts
 void di(struct i8080 *cpu) {
-  cpu->cyc += 4;
+  CYCLES(4);
   cpu->INTE = 0;
 }
 
 // RST - Restart
 void rst(struct i8080 *cpu, uint opcode) {
-  cpu->cyc += 11;
+  CYCLES(11);
   i8080_push_stackw(cpu, cpu->PC);
   cpu->PC = opcode & 0x38;
 }
 
 // IN - Input
-void in(struct i8080 *cpu) {
-  cpu->cyc += 10;
-  uint dev = next_byte(cpu);
+void in(struct i8080 *cpu, uint dev) {
+  CYCLES(10);
   if (cpu->input_handler != NULL) {
     cpu->A = cpu->input_handler(cpu, dev);
+
+    if (cpu->exit_reason == I8080_EXIT_IO) {
+      cpu->exit_port = dev;
+    }
   }
 }
 
-void out(struct i8080 *cpu) {
-  cpu->cyc += 10;
-  uint dev = next_byte(cpu);
+void out(struct i8080 *cpu, uint dev) {
+  CYCLES(10);
   if (cpu->output_handler != NULL) {
     cpu->output_handler(cpu, dev, cpu->A);
+
+    if (cpu->exit_reason == I8080_EXIT_IO) {
+      cpu->exit_port = dev;
+    }
   }
 }
 
-void i8080_step(struct i8080 *cpu) {
-  if (cpu->halted) {
+#if defined(I8080_DISPATCH_TABLE) || defined(I8080_BLOCK_CACHE) || defined(I8080_PRECOMPILED)
+// Table dispatch
+//
+// One handler per opcode, with register and register pair operands fixed at
+// compile time so nothing is decoded from the opcode at run time. Handlers
+// are called with PC already past the instruction and its immediate operand
+// as an argument, so the block cache can replay them from pre-decoded
+// operands, precompiled blocks can pass operands read from memory and the
+// table engine fetches them through small adapters.
+
+// Precompiled blocks on their own only call the handlers their image uses
+#if defined(I8080_PRECOMPILED) && !defined(I8080_DISPATCH_TABLE) && !defined(I8080_BLOCK_CACHE)
+#define OP_HANDLER static __attribute__((unused))
+#else
+#define OP_HANDLER static
+#endif
+
+// MOV - Move
+#define MOV_RR(DST, SRC) \
+  OP_HANDLER void op_mov_##DST##_##SRC(struct i8080 *cpu, uint operand) { \
+    CYCLES(5); \
+    cpu->DST = cpu->SRC; \
+  }
+
+#define MOV_RM(DST) \
+  OP_HANDLER void op_mov_##DST##_M(struct i8080 *cpu, uint operand) { \
+    CYCLES(7); \
+    cpu->DST = i8080_read_byte(cpu, cpu->HL); \
+  }
+
+#define MOV_MR(SRC) \
+  OP_HANDLER void op_mov_M_##SRC(struct i8080 *cpu, uint operand) { \
+    CYCLES(7); \
+    i8080_write_byte(cpu, cpu->HL, cpu->SRC); \
+  }
+
+#define MOV_ROW(DST) \
+  MOV_RR(DST, B) MOV_RR(DST, C) MOV_RR(DST, D) MOV_RR(DST, E) \
+  MOV_RR(DST, H) MOV_RR(DST, L) MOV_RM(DST) MOV_RR(DST, A)
+
+MOV_ROW(B) MOV_ROW(C) MOV_ROW(D) MOV_ROW(E) MOV_ROW(H) MOV_ROW(L) MOV_ROW(A)
+MOV_MR(B) MOV_MR(C) MOV_MR(D) MOV_MR(E) MOV_MR(H) MOV_MR(L) MOV_MR(A)
+
+// ADD, ADC, SUB, SBB, ANA, XRA, ORA, CMP - Register or Memory with Accumulator
+static void perform_and(struct i8080 *cpu, uint val) {
+  uint aux_carry = (val | cpu->A) & 0x08;
+  cpu->A &= val;
+  set_logic_flags(cpu, cpu->A, aux_carry);
+}
+
+static void perform_xor(struct i8080 *cpu, uint val) {
+  cpu->A ^= val;
+  set_logic_flags(cpu, cpu->A, 0);
+}
+
+static void perform_or(struct i8080 *cpu, uint val) {
+  cpu->A |= val;
+  set_logic_flags(cpu, cpu->A, 0);
+}
+
+#define DO_ADD(VAL) cpu->A = perform_add(cpu, cpu->A, VAL, 0)
+#define DO_ADC(VAL) cpu->A = perform_add(cpu, cpu->A, VAL, i8080_get_flag(cpu, FLAG_C))
+#define DO_SUB(VAL) cpu->A = perform_sub(cpu, cpu->A, VAL, 0)
+#define DO_SBB(VAL) cpu->A = perform_sub(cpu, cpu->A, VAL, i8080_get_flag(cpu, FLAG_C))
+#define DO_ANA(VAL) perform_and(cpu, VAL)
+#define DO_XRA(VAL) perform_xor(cpu, VAL)
+#define DO_ORA(VAL) perform_or(cpu, VAL)
+#define DO_CMP(VAL) perform_sub(cpu, cpu->A, VAL, 0)
+
+#define ALU_R(NAME, OPERATION, SRC) \
+  OP_HANDLER void op_##NAME##_##SRC(struct i8080 *cpu, uint operand) { \
+    CYCLES(4); \
+    OPERATION(cpu->SRC); \
+  }
+
+#define ALU_M(NAME, OPERATION) \
+  OP_HANDLER void op_##NAME##_M(struct i8080 *cpu, uint operand) { \
+    CYCLES(7); \
+    OPERATION(i8080_read_byte(cpu, cpu->HL)); \
+  }
+
+#define ALU_ROW(NAME, OPERATION) \
+  ALU_R(NAME, OPERATION, B) ALU_R(NAME, OPERATION, C) \
+  ALU_R(NAME, OPERATION, D) ALU_R(NAME, OPERATION, E) \
+  ALU_R(NAME, OPERATION, H) ALU_R(NAME, OPERATION, L) \
+  ALU_M(NAME, OPERATION) ALU_R(NAME, OPERATION, A)
+
+ALU_ROW(add, DO_ADD) ALU_ROW(adc, DO_ADC) ALU_ROW(sub, DO_SUB) ALU_ROW(sbb, DO_SBB)
+ALU_ROW(ana, DO_ANA) ALU_ROW(xra, DO_XRA) ALU_ROW(ora, DO_ORA) ALU_ROW(cmp, DO_CMP)
+
+// INR, DCR - Increment or Decrement Register or Memory
+// MVI - Move Immediate
+#define INR_DCR_MVI_R(REG) \
+  OP_HANDLER void op_inr_##REG(struct i8080 *cpu, uint operand) { \
+    CYCLES(5); \
+    uint val = cpu->REG; \
+    cpu->REG = (val + 1) & 0xFF; \
+    set_inc_flags(cpu, val, cpu->REG); \
+  } \
+  OP_HANDLER void op_dcr_##REG(struct i8080 *cpu, uint operand) { \
+    CYCLES(5); \
+    uint val = cpu->REG; \
+    cpu->REG = (val - 1) & 0xFF; \
+    set_dec_flags(cpu, val, cpu->REG); \
+  } \
+  OP_HANDLER void op_mvi_##REG(struct i8080 *cpu, uint operand) { \
+    CYCLES(7); \
+    cpu->REG = operand; \
+  }
+
+INR_DCR_MVI_R(B) INR_DCR_MVI_R(C) INR_DCR_MVI_R(D) INR_DCR_MVI_R(E)
+INR_DCR_MVI_R(H) INR_DCR_MVI_R(L) INR_DCR_MVI_R(A)
+
+OP_HANDLER void op_inr_M(struct i8080 *cpu, uint operand) {
+  CYCLES(10);
+  uint addr = cpu->HL;
+  uint val = i8080_read_byte(cpu, addr);
+  i8080_write_byte(cpu, addr, val + 1);
+  set_inc_flags(cpu, val, (val + 1) & 0xFF);
+}
+
+OP_HANDLER void op_dcr_M(struct i8080 *cpu, uint operand) {
+  CYCLES(10);
+  uint addr = cpu->HL;
+  uint val = i8080_read_byte(cpu, addr);
+  i8080_write_byte(cpu, addr, val - 1);
+  set_dec_flags(cpu, val, (val - 1) & 0xFF);
+}
+
+OP_HANDLER void op_mvi_M(struct i8080 *cpu, uint operand) {
+  CYCLES(10);
+  i8080_write_byte(cpu, cpu->HL, operand);
+}
+
+// LXI, INX, DCX, DAD - Register Pair Operations
+#define PAIR_OPS(NAME, PAIR) \
+  OP_HANDLER void op_lxi_##NAME(struct i8080 *cpu, uint operand) { \
+    CYCLES(10); \
+    cpu->PAIR = operand; \
+  } \
+  OP_HANDLER void op_inx_##NAME(struct i8080 *cpu, uint operand) { \
+    CYCLES(5); \
+    cpu->PAIR++; \
+  } \
+  OP_HANDLER void op_dcx_##NAME(struct i8080 *cpu, uint operand) { \
+    CYCLES(5); \
+    cpu->PAIR--; \
+  } \
+  OP_HANDLER void op_dad_##NAME(struct i8080 *cpu, uint operand) { \
+    CYCLES(10); \
+    uint val = cpu->HL + cpu->PAIR; \
+    i8080_set_flag(cpu, FLAG_C, val & 0x10000); \
+    cpu->HL = val; \
+  }
+
+PAIR_OPS(B, BC) PAIR_OPS(D, DE) PAIR_OPS(H, HL) PAIR_OPS(SP, SP)
+
+// PUSH, POP - Push and Pop Register Pairs
+#define STACK_OPS(NAME, PAIR) \
+  OP_HANDLER void op_push_##NAME(struct i8080 *cpu, uint operand) { \
+    CYCLES(11); \
+    i8080_push_stackw(cpu, cpu->PAIR); \
+  } \
+  OP_HANDLER void op_pop_##NAME(struct i8080 *cpu, uint operand) { \
+    CYCLES(10); \
+    cpu->PAIR = i8080_pop_stackw(cpu); \
+  }
+
+STACK_OPS(B, BC) STACK_OPS(D, DE) STACK_OPS(H, HL)
+
+// STAX, LDAX - Store and Load Accumulator Indirect
+#define INDIRECT_OPS(NAME, PAIR) \
+  OP_HANDLER void op_stax_##NAME(struct i8080 *cpu, uint operand) { \
+    CYCLES(7); \
+    i8080_write_byte(cpu, cpu->PAIR, cpu->A); \
+  } \
+  OP_HANDLER void op_ldax_##NAME(struct i8080 *cpu, uint operand) { \
+    CYCLES(7); \
+    cpu->A = i8080_read_byte(cpu, cpu->PAIR); \
+  }
+
+INDIRECT_OPS(B, BC) INDIRECT_OPS(D, DE)
+
+OP_HANDLER void op_push_PSW(struct i8080 *cpu, uint operand) {
+  CYCLES(11);
+  i8080_sync_flags(cpu);
+  i8080_push_stackw(cpu, CONCAT(cpu->A, cpu->flags));
+}
+
+OP_HANDLER void op_pop_PSW(struct i8080 *cpu, uint operand) {
+  CYCLES(10);
+  cpu->flags = (i8080_pop_stackb(cpu) | 2) & 0xD7;
+#ifdef I8080_LAZY_FLAGS
+  cpu->lazy_mask = 0;
+#endif
+  cpu->A = i8080_pop_stackb(cpu);
+}
+
+// JMP, CALL, RET - Jump, Call and Return, Conditionally or Not
+#define COND_ALWAYS 1
+#define COND_NZ !i8080_get_flag(cpu, FLAG_Z)
+#define COND_Z i8080_get_flag(cpu, FLAG_Z)
+#define COND_NC !i8080_get_flag(cpu, FLAG_C)
+#define COND_C i8080_get_flag(cpu, FLAG_C)
+#define COND_PO !i8080_get_flag(cpu, FLAG_P)
+#define COND_PE i8080_get_flag(cpu, FLAG_P)
+#define COND_P !i8080_get_flag(cpu, FLAG_S)
+#define COND_M i8080_get_flag(cpu, FLAG_S)
+
+#define BRANCH_OPS(JUMP, CALL, RETURN, COND) \
+  OP_HANDLER void op_##JUMP(struct i8080 *cpu, uint operand) { \
+    CYCLES(10); \
+    if (COND) { \
+      cpu->PC = operand; \
+    } \
+  } \
+  OP_HANDLER void op_##CALL(struct i8080 *cpu, uint operand) { \
+    CYCLES(11); \
+    if (COND) { \
+      TAKEN_CYCLES(6); \
+      i8080_push_stackw(cpu, cpu->PC); \
+      cpu->PC = operand; \
+    } \
+  } \
+  OP_HANDLER void op_##RETURN(struct i8080 *cpu, uint operand) { \
+    CYCLES(5); \
+    if (COND) { \
+      TAKEN_CYCLES(6); \
+      cpu->PC = i8080_pop_stackw(cpu); \
+    } \
+  }
+
+BRANCH_OPS(jmp, call, ret, COND_ALWAYS)
+BRANCH_OPS(jnz, cnz, rnz, COND_NZ) BRANCH_OPS(jz, cz, rz, COND_Z)
+BRANCH_OPS(jnc, cnc, rnc, COND_NC) BRANCH_OPS(jc, cc, rc, COND_C)
+BRANCH_OPS(jpo, cpo, rpo, COND_PO) BRANCH_OPS(jpe, cpe, rpe, COND_PE)
+BRANCH_OPS(jp, cp, rp, COND_P) BRANCH_OPS(jm, cm, rm, COND_M)
+
+// RST - Restart
+#define RST(N) \
+  OP_HANDLER void op_rst_##N(struct i8080 *cpu, uint operand) { \
+    CYCLES(11); \
+    i8080_push_stackw(cpu, cpu->PC); \
+    cpu->PC = (N) << 3; \
+  }
+
+RST(0) RST(1) RST(2) RST(3) RST(4) RST(5) RST(6) RST(7)
+
+// Instructions without register operands
+#define SIMPLE_OP(NAME) \
+  OP_HANDLER void op_##NAME(struct i8080 *cpu, uint operand) { \
+    NAME(cpu); \
+  }
+
+SIMPLE_OP(nop) SIMPLE_OP(rlc) SIMPLE_OP(rrc) SIMPLE_OP(ral) SIMPLE_OP(rar)
+SIMPLE_OP(daa) SIMPLE_OP(cma) SIMPLE_OP(stc) SIMPLE_OP(cmc) SIMPLE_OP(hlt)
+SIMPLE_OP(xthl) SIMPLE_OP(xchg) SIMPLE_OP(pchl) SIMPLE_OP(sphl) SIMPLE_OP(di)
+SIMPLE_OP(ei)
+
+#ifdef I8080_BLOCK_CACHE
+static const i8080_op_handler decoded_table[256] = {
+#define I8080_OPCODE(OPCODE, MNEMONIC, LENGTH, CYCLES, TAKEN, READS, WRITES, ENDS, STORES, HANDLER) HANDLER,
+#include "i8080_opcodes.h"
+#undef I8080_OPCODE
+};
+#endif
+
+#ifdef I8080_DISPATCH_TABLE
+// The table engine fetches immediate operands itself, through an adapter
+// named after the opcode for those with one
+#define FETCH_1(OPCODE, HANDLER)
+#define FETCH_2(OPCODE, HANDLER) \
+  static void fetch_##OPCODE(struct i8080 *cpu, uint operand) { \
+    HANDLER(cpu, next_byte(cpu)); \
+  }
+#define FETCH_3(OPCODE, HANDLER) \
+  static void fetch_##OPCODE(struct i8080 *cpu, uint operand) { \
+    HANDLER(cpu, next_word(cpu)); \
+  }
+
+#define I8080_OPCODE(OPCODE, MNEMONIC, LENGTH, CYCLES, TAKEN, READS, WRITES, ENDS, STORES, HANDLER) \
+  FETCH_##LENGTH(OPCODE, HANDLER)
+#include "i8080_opcodes.h"
+#undef I8080_OPCODE
+
+#define DISPATCH_1(OPCODE, HANDLER) HANDLER
+#define DISPATCH_2(OPCODE, HANDLER) fetch_##OPCODE
+#define DISPATCH_3(OPCODE, HANDLER) fetch_##OPCODE
+
+static const i8080_op_handler dispatch_table[256] = {
+#define I8080_OPCODE(OPCODE, MNEMONIC, LENGTH, CYCLES, TAKEN, READS, WRITES, ENDS, STORES, HANDLER) \
+  DISPATCH_##LENGTH(OPCODE, HANDLER),
+#include "i8080_opcodes.h"
+#undef I8080_OPCODE
+};
+#endif
+#endif
+
+#ifdef I8080_BLOCK_CACHE
+// Block cache
+//
+// A block is a run of decoded instructions ending at the first one that can
+// change PC, halt or do I/O. Decoding sets the bits of the code pages the
+// block covers, and a write into a code page empties every block holding the
+// written byte, which also stops a block that modifies itself mid-replay.
+static const uint8_t opcode_length[256] = {
+#define I8080_OPCODE(OPCODE, MNEMONIC, LENGTH, CYCLES, TAKEN, READS, WRITES, ENDS, STORES, HANDLER) LENGTH,
+#include "i8080_opcodes.h"
+#undef I8080_OPCODE
+};
+
+// Longest time each opcode can take, for fitting a whole block in the budget
+static const uint8_t opcode_cycles[256] = {
+#ifdef I8080_NO_CYCLES
+#define I8080_OPCODE(OPCODE, MNEMONIC, LENGTH, CYCLES, TAKEN, READS, WRITES, ENDS, STORES, HANDLER) 1,
+#else
+#define I8080_OPCODE(OPCODE, MNEMONIC, LENGTH, CYCLES, TAKEN, READS, WRITES, ENDS, STORES, HANDLER) TAKEN,
+#endif
+#include "i8080_opcodes.h"
+#undef I8080_OPCODE
+};
+
+// Jumps, calls, returns, restarts, PCHL, HLT, IN and OUT
+static const uint8_t opcode_ends_block[256] = {
+#define I8080_OPCODE(OPCODE, MNEMONIC, LENGTH, CYCLES, TAKEN, READS, WRITES, ENDS, STORES, HANDLER) ENDS,
+#include "i8080_opcodes.h"
+#undef I8080_OPCODE
+};
+
+#ifdef I8080_SUPERINSTRUCTIONS
+// Superinstructions
+//
+// Each runs a sequence of handlers that BASIC runs often with one dispatch.
+// Only the last can branch, do I/O or write memory, so PC is only seen past
+// the whole sequence and a write over the block still stops it before the
+// next uop. At most one has an operand, which the others ignore.
+#define SUPERINSTRUCTION2(A, B, HA, HB) \
+  static void fused_##HA##_##HB(struct i8080 *cpu, uint operand) { \
+    HA(cpu, operand); \
+    HB(cpu, operand); \
+  }
+
+#define SUPERINSTRUCTION3(A, B, C, HA, HB, HC) \
+  static void fused_##HA##_##HB##_##HC(struct i8080 *cpu, uint operand) { \
+    HA(cpu, operand); \
+    HB(cpu, operand); \
+    HC(cpu, operand); \
+  }
+
+#include "i8080_superinstructions.h"
+
+#undef SUPERINSTRUCTION2
+#undef SUPERINSTRUCTION3
+
+struct superinstruction {
+  uint8_t length;
+  uint8_t opcodes[3];
+  i8080_op_handler handler;
+};
+
+#define SUPERINSTRUCTION2(A, B, HA, HB) {2, {A, B}, fused_##HA##_##HB},
+#define SUPERINSTRUCTION3(A, B, C, HA, HB, HC) {3, {A, B, C}, fused_##HA##_##HB##_##HC},
+
+static const struct superinstruction superinstructions[] = {
+#include "i8080_superinstructions.h"
+};
+
+#undef SUPERINSTRUCTION2
+#undef SUPERINSTRUCTION3
+
+#define SUPERINSTRUCTION_COUNT (sizeof(superinstructions) / sizeof(superinstructions[0]))
+
+// Returns how many instructions at addr the longest matching superinstruction
+// covers and sets handler to it, or returns 1 if none match. Only called for
+// opcodes that start one
+static uint match_superinstruction(struct i8080 *cpu, uint addr, i8080_op_handler *handler) {
+  uint8_t opcodes[3];
+
+  for (uint i=0;i<3;i++) {
+    opcodes[i] = i8080_read_byte(cpu, addr);
+    addr = (addr + opcode_length[opcodes[i]]) & 0xFFFF;
+  }
+
+  // Sorted by first opcode with triples first, so the first match is longest
+  uint first = cpu->block_cache->superinstructions[opcodes[0]] - 1;
+  for (uint i=first;i<SUPERINSTRUCTION_COUNT && superinstructions[i].opcodes[0] == opcodes[0];i++) {
+    const struct superinstruction *fused = &superinstructions[i];
+
+    if (memcmp(fused->opcodes, opcodes, fused->length) == 0) {
+      *handler = fused->handler;
+      return fused->length;
+    }
+  }
+
+  return 1;
+}
+#endif
+
+#ifdef I8080_FLAG_LIVENESS
+// Flag liveness
+//
+// Decoding works back from the end of each block to find instructions whose
+// flags are all written again before anything reads them, and decodes them
+// to the handlers below, which leave the flags alone. Flags are taken as
+// read after the block and after any instruction that writes memory, as a
+// write over the block's own code stops it there.
+#define DEAD_ADD(VAL) cpu->A += (VAL)
+#define DEAD_ADC(VAL) cpu->A += (VAL) + i8080_get_flag(cpu, FLAG_C)
+#define DEAD_SUB(VAL) cpu->A -= (VAL)
+#define DEAD_SBB(VAL) cpu->A -= (VAL) + i8080_get_flag(cpu, FLAG_C)
+#define DEAD_ANA(VAL) cpu->A &= (VAL)
+#define DEAD_XRA(VAL) cpu->A ^= (VAL)
+#define DEAD_ORA(VAL) cpu->A |= (VAL)
+#define DEAD_CMP(VAL)
+
+ALU_ROW(dead_add, DEAD_ADD) ALU_ROW(dead_adc, DEAD_ADC)
+ALU_ROW(dead_sub, DEAD_SUB) ALU_ROW(dead_sbb, DEAD_SBB)
+ALU_ROW(dead_ana, DEAD_ANA) ALU_ROW(dead_xra, DEAD_XRA)
+ALU_ROW(dead_ora, DEAD_ORA) ALU_ROW(dead_cmp, DEAD_CMP)
+
+#define DEAD_IMMEDIATE(NAME, OPERATION) \
+  static void dead_##NAME(struct i8080 *cpu, uint operand) { \
+    CYCLES(7); \
+    OPERATION(operand); \
+  }
+
+DEAD_IMMEDIATE(adi, DEAD_ADD) DEAD_IMMEDIATE(aci, DEAD_ADC)
+DEAD_IMMEDIATE(sui, DEAD_SUB) DEAD_IMMEDIATE(sbi, DEAD_SBB)
+DEAD_IMMEDIATE(ani, DEAD_ANA) DEAD_IMMEDIATE(xri, DEAD_XRA)
+DEAD_IMMEDIATE(ori, DEAD_ORA) DEAD_IMMEDIATE(cpi, DEAD_CMP)
+
+#define DEAD_INR_DCR(REG) \
+  static void op_dead_inr_##REG(struct i8080 *cpu, uint operand) { \
+    CYCLES(5); \
+    cpu->REG++; \
+  } \
+  static void op_dead_dcr_##REG(struct i8080 *cpu, uint operand) { \
+    CYCLES(5); \
+    cpu->REG--; \
+  }
+
+DEAD_INR_DCR(B) DEAD_INR_DCR(C) DEAD_INR_DCR(D) DEAD_INR_DCR(E)
+DEAD_INR_DCR(H) DEAD_INR_DCR(L) DEAD_INR_DCR(A)
+
+#define DEAD_DAD(NAME, PAIR) \
+  static void op_dead_dad_##NAME(struct i8080 *cpu, uint operand) { \
+    CYCLES(10); \
+    cpu->HL += cpu->PAIR; \
+  }
+
+DEAD_DAD(B, BC) DEAD_DAD(D, DE) DEAD_DAD(H, HL) DEAD_DAD(SP, SP)
+
+#define DEAD_ALU_ROW(NAME) \
+  op_##NAME##_B, op_##NAME##_C, op_##NAME##_D, op_##NAME##_E, \
+  op_##NAME##_H, op_##NAME##_L, op_##NAME##_M, op_##NAME##_A
+
+// Per opcode, the handler to decode to when none of its flags are live, or
+// NULL to keep the usual one. INR M and DCR M write memory, so are left out
+static const i8080_op_handler dead_flags_table[256] = {
+  [0x04] = op_dead_inr_B, op_dead_dcr_B, [0x09] = op_dead_dad_B,
+  [0x0C] = op_dead_inr_C, op_dead_dcr_C,
+  [0x14] = op_dead_inr_D, op_dead_dcr_D, [0x19] = op_dead_dad_D,
+  [0x1C] = op_dead_inr_E, op_dead_dcr_E,
+  [0x24] = op_dead_inr_H, op_dead_dcr_H, [0x29] = op_dead_dad_H,
+  [0x2C] = op_dead_inr_L, op_dead_dcr_L,
+  [0x39] = op_dead_dad_SP,
+  [0x3C] = op_dead_inr_A, op_dead_dcr_A,
+
+  [0x80] = DEAD_ALU_ROW(dead_add), DEAD_ALU_ROW(dead_adc),
+  DEAD_ALU_ROW(dead_sub), DEAD_ALU_ROW(dead_sbb),
+  DEAD_ALU_ROW(dead_ana), DEAD_ALU_ROW(dead_xra),
+  DEAD_ALU_ROW(dead_ora), DEAD_ALU_ROW(dead_cmp),
+
+  [0xC6] = dead_adi, [0xCE] = dead_aci, [0xD6] = dead_sui, [0xDE] = dead_sbi,
+  [0xE6] = dead_ani, [0xEE] = dead_xri, [0xF6] = dead_ori, [0xFE] = dead_cpi
+};
+
+static const uint8_t opcode_flags_read[256] = {
+#define I8080_OPCODE(OPCODE, MNEMONIC, LENGTH, CYCLES, TAKEN, READS, WRITES, ENDS, STORES, HANDLER) READS,
+#include "i8080_opcodes.h"
+#undef I8080_OPCODE
+};
+
+static const uint8_t opcode_flags_written[256] = {
+#define I8080_OPCODE(OPCODE, MNEMONIC, LENGTH, CYCLES, TAKEN, READS, WRITES, ENDS, STORES, HANDLER) WRITES,
+#include "i8080_opcodes.h"
+#undef I8080_OPCODE
+};
+
+// Instructions whose result goes through i8080_write_byte or i8080_write_word
+static const uint8_t opcode_writes_memory[256] = {
+#define I8080_OPCODE(OPCODE, MNEMONIC, LENGTH, CYCLES, TAKEN, READS, WRITES, ENDS, STORES, HANDLER) STORES,
+#include "i8080_opcodes.h"
+#undef I8080_OPCODE
+};
+
+// Swaps in the handlers that leave out dead flags, given the opcode of each
+// uop, or FUSED_UOP for superinstructions, which are left alone
+#define FUSED_UOP 0x100
+
+static void remove_dead_flags(struct i8080 *cpu, struct i8080_block *block, const uint16_t *opcodes) {
+  uint live = I8080_F_ALL;
+
+  for (int i=block->count-1;i>=0;i--) {
+    uint opcode = opcodes[i];
+
+    if (opcode == FUSED_UOP || opcode_writes_memory[opcode]) {
+      live = I8080_F_ALL;
+      continue;
+    }
+
+    uint written = opcode_flags_written[opcode];
+    if ((written & live) == 0 && dead_flags_table[opcode] != NULL) {
+      block->uops[i].handler = dead_flags_table[opcode];
+      cpu->block_cache->dead_flags++;
+    }
+
+    live = (live & ~written) | opcode_flags_read[opcode];
+  }
+}
+#endif
+
+static int is_code_page(struct i8080_block_cache *cache, uint addr) {
+  uint page = (addr & 0xFFFF) >> I8080_CODE_PAGE_SHIFT;
+  return cache->code_pages[page >> 3] & (1 << (page & 7));
+}
+
+static void set_code_page(struct i8080_block_cache *cache, uint addr) {
+  uint page = (addr & 0xFFFF) >> I8080_CODE_PAGE_SHIFT;
+  cache->code_pages[page >> 3] |= 1 << (page & 7);
+}
+
+void i8080_set_block_cache(struct i8080 *cpu, struct i8080_block_cache *cache) {
+  cpu->block_cache = cache;
+
+  if (cache != NULL) {
+    for (int i=0;i<I8080_BLOCK_CACHE_SIZE;i++) {
+      cache->blocks[i].count = 0;
+    }
+    for (uint i=0;i<sizeof(cache->code_pages);i++) {
+      cache->code_pages[i] = 0;
+    }
+    cache->longest = 0;
+#ifdef I8080_SUPERINSTRUCTIONS
+    for (int i=0;i<256;i++) {
+      cache->superinstructions[i] = 0;
+    }
+    for (int i=SUPERINSTRUCTION_COUNT-1;i>=0;i--) {
+      cache->superinstructions[superinstructions[i].opcodes[0]] = i + 1;
+    }
+#endif
+    cache->hits = 0;
+    cache->misses = 0;
+    cache->invalidations = 0;
+#ifdef I8080_FLAG_LIVENESS
+    cache->dead_flags = 0;
+#endif
+  }
+}
+
+void invalidate_code(struct i8080 *cpu, uint addr, uint data) {
+  struct i8080_block_cache *cache = cpu->block_cache;
+
+  if (!is_code_page(cache, addr) || i8080_read_byte(cpu, addr) == (data & 0xFF)) {
+    return;
+  }
+
+  // Only blocks starting less than the longest block back can hold addr. With
+  // superinstructions a uop can cover several instructions, so this is more
+  // than I8080_BLOCK_LENGTH instructions' worth
+  for (uint back=0;back<cache->longest;back++) {
+    uint pc = (addr - back) & 0xFFFF;
+    struct i8080_block *block = &cache->blocks[pc & (I8080_BLOCK_CACHE_SIZE - 1)];
+
+    if (block->count != 0 && block->pc == pc && back < block->length) {
+      block->count = 0;
+      cache->invalidations++;
+    }
+  }
+}
+
+static void decode_block(struct i8080 *cpu, struct i8080_block *block, uint pc) {
+  uint addr = pc;
+  uint count = 0;
+  uint cycles = 0;
+  uint opcode;
+#ifdef I8080_FLAG_LIVENESS
+  uint16_t opcodes[I8080_BLOCK_LENGTH];
+#endif
+
+  do {
+    struct i8080_uop *uop = &block->uops[count++];
+    uint instructions = 1;
+
+    opcode = i8080_read_byte(cpu, addr);
+    uop->handler = decoded_table[opcode];
+    uop->operand = 0;
+
+#ifdef I8080_SUPERINSTRUCTIONS
+    if (cpu->block_cache->superinstructions[opcode] != 0) {
+      instructions = match_superinstruction(cpu, addr, &uop->handler);
+    }
+#endif
+#ifdef I8080_FLAG_LIVENESS
+    opcodes[count - 1] = instructions == 1 ? opcode : FUSED_UOP;
+#endif
+
+    for (;;) {
+      uint length = opcode_length[opcode];
+      if (length == 2) {
+        uop->operand = i8080_read_byte(cpu, (addr + 1) & 0xFFFF);
+      } else if (length == 3) {
+        uop->operand = CONCAT(i8080_read_byte(cpu, (addr + 2) & 0xFFFF),
+                              i8080_read_byte(cpu, (addr + 1) & 0xFFFF));
+      }
+
+      cycles += opcode_cycles[opcode];
+
+      for (uint i=0;i<length;i++) {
+        set_code_page(cpu->block_cache, addr + i);
+      }
+
+      addr = (addr + length) & 0xFFFF;
+
+      if (--instructions == 0) {
+        break;
+      }
+      opcode = i8080_read_byte(cpu, addr);
+    }
+
+    uop->next_pc = addr;
+  } while (count < I8080_BLOCK_LENGTH && !opcode_ends_block[opcode]);
+
+  block->pc = pc;
+  block->length = (addr - pc) & 0xFFFF;
+  block->count = count;
+
+  if (block->length > cpu->block_cache->longest) {
+    cpu->block_cache->longest = block->length;
+  }
+  block->cycles = cycles;
+
+#ifdef I8080_FLAG_LIVENESS
+  remove_dead_flags(cpu, block, opcodes);
+#endif
+}
+
+static void run_blocks(struct i8080 *cpu) {
+  struct i8080_block_cache *cache = cpu->block_cache;
+
+  while ((int) (cpu->run_end - cpu->cyc) > 0) {
+    uint pc = cpu->PC;
+    struct i8080_block *block = &cache->blocks[pc & (I8080_BLOCK_CACHE_SIZE - 1)];
+
+    if (block->count != 0 && block->pc == pc) {
+      cache->hits++;
+    } else {
+      cache->misses++;
+      decode_block(cpu, block, pc);
+    }
+
+    // A budget too small for the whole block is left to the interpreter, as
+    // a uop can run several instructions. count drops to 0 if the block
+    // writes over its own code, and HLT and I/O only come last, so a block
+    // that fits runs without checks.
+    if ((int) (cpu->run_end - cpu->cyc) <= block->cycles) {
+      return;
+    }
+
+    for (uint i=0;i<block->count;i++) {
+      struct i8080_uop *uop = &block->uops[i];
+      cpu->PC = uop->next_pc;
+      uop->handler(cpu, uop->operand);
+    }
+  }
+}
+#endif
+
+#ifdef I8080_PRECOMPILED
+// Precompiled blocks
+//
+// The generated header holds a function per block, which returns 0 without
+// running if its guarded bytes have changed or it may not fit the budget,
+// and a bitmap of the addresses blocks start at. Counting the bits below an
+// address indexes its block in precompiled_blocks.
+static int granule_changed(struct i8080_precompiled *precompiled, uint granule) {
+  return precompiled->changed[granule >> 3] & (1 << (granule & 7));
+}
+
+static int precompiled_changed(struct i8080 *cpu, uint first, uint last) {
+  for (uint granule=first;granule<=last;granule++) {
+    if (granule_changed(cpu->precompiled, granule)) {
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+static int precompiled_enter(struct i8080 *cpu, uint first, uint last, uint cycles) {
+  return (int) (cpu->run_end - cpu->cyc) >= (int) cycles &&
+         !precompiled_changed(cpu, first, last);
+}
+
+#include I8080_PRECOMPILED
+
+static int precompiled_block(struct i8080 *cpu, uint pc) {
+  if (pc >= PRECOMPILED_SIZE) {
+    return 0;
+  }
+
+  uint32_t entries = precompiled_entries[pc >> 5];
+  uint32_t bit = (uint32_t) 1 << (pc & 31);
+
+  if (!(entries & bit)) {
+    return 0;
+  }
+
+  uint index = precompiled_ranks[pc >> 5] + __builtin_popcount(entries & (bit - 1));
+
+  return precompiled_blocks[index](cpu);
+}
+
+void i8080_set_precompiled(struct i8080 *cpu, struct i8080_precompiled *precompiled) {
+  cpu->precompiled = precompiled;
+
+  if (precompiled == NULL) {
+    return;
+  }
+
+  for (uint i=0;i<sizeof(precompiled->changed);i++) {
+    precompiled->changed[i] = 0;
+  }
+  precompiled->hits = 0;
+  precompiled->misses = 0;
+
+  uint granule_size = 1 << I8080_PRECOMPILED_GRANULE_SHIFT;
+  for (uint granule=0;granule*granule_size<PRECOMPILED_SIZE;granule++) {
+    uint32_t hash = 2166136261u;
+
+    for (uint addr=granule*granule_size;addr<(granule+1)*granule_size;addr++) {
+      if (addr < PRECOMPILED_SIZE && (precompiled_guarded[addr >> 3] & (1 << (addr & 7)))) {
+        hash = (hash ^ i8080_read_byte(cpu, addr)) * 16777619u;
+      }
+    }
+
+    if (hash != precompiled_hashes[granule]) {
+      precompiled->changed[granule >> 3] |= 1 << (granule & 7);
+    }
+  }
+}
+
+void guard_precompiled(struct i8080 *cpu, uint addr, uint data) {
+  if (addr >= PRECOMPILED_SIZE || !(precompiled_guarded[addr >> 3] & (1 << (addr & 7))) ||
+      i8080_read_byte(cpu, addr) == (data & 0xFF)) {
+    return;
+  }
+
+  uint granule = addr >> I8080_PRECOMPILED_GRANULE_SHIFT;
+  cpu->precompiled->changed[granule >> 3] |= 1 << (granule & 7);
+}
+
+static void run_precompiled(struct i8080 *cpu) {
+  struct i8080_precompiled *precompiled = cpu->precompiled;
+
+  while ((int) (cpu->run_end - cpu->cyc) > 0) {
+    if (precompiled_block(cpu, cpu->PC)) {
+      precompiled->hits++;
+    } else {
+      precompiled->misses++;
+      execute(cpu, next_byte(cpu));
+    }
+  }
+}
+#endif
+
+#if defined(I8080_PAGE_CACHE) || defined(I8080_LAZY_MEMORY)
+// Bytes of memory in a page, fewer in a last page cut short by memsize
+static uint page_bytes(struct i8080 *cpu, uint page) {
+#ifdef I8080_MEMORY_64K
+  return I8080_PAGE_SIZE;
+#else
+  size_t remaining = cpu->memsize - ((size_t) page << I8080_PAGE_SHIFT);
+  return remaining < I8080_PAGE_SIZE ? remaining : I8080_PAGE_SIZE;
+#endif
+}
+#endif
+
+#ifdef I8080_LAZY_MEMORY
+// Copies a page in from wherever its bytes have been read from so far
+void fill_in_page(struct i8080 *cpu, uint page) {
+  char *bytes = cpu->memory + (page << I8080_PAGE_SHIFT);
+
+  if (cpu->page_owners[page] == I8080_PAGE_IMAGE) {
+    memcpy(bytes, cpu->image + (page << I8080_PAGE_SHIFT), I8080_PAGE_SIZE);
+  } else {
+    memset(bytes, 0, page_bytes(cpu, page));
+  }
+  cpu->page_owners[page] = I8080_PAGE_MEMORY;
+}
+
+void i8080_clear_memory(struct i8080 *cpu) {
+  memset(cpu->page_owners, I8080_PAGE_ZERO, sizeof(cpu->page_owners));
+}
+
+void i8080_copy_memory(struct i8080 *cpu, uint addr, const void *data, size_t size) {
+  const char *bytes = data;
+
+  addr &= 0xFFFF;
+
+  while (size > 0 && IN_MEMORY(cpu, addr)) {
+    uint page = addr >> I8080_PAGE_SHIFT;
+    uint offset = addr & (I8080_PAGE_SIZE - 1);
+    size_t length = page_bytes(cpu, page) - offset;
+
+    if (length > size) {
+      length = size;
+    }
+    if (cpu->page_owners[page] != I8080_PAGE_MEMORY) {
+      fill_in_page(cpu, page);
+    }
+    memcpy(cpu->memory + addr, bytes, length);
+
+    addr = (addr + length) & 0xFFFF;
+    bytes += length;
+    size -= length;
+  }
+}
+
+void i8080_map_image(struct i8080 *cpu, const void *image, size_t size) {
+  size_t mapped = 0;
+
+  cpu->image = image;
+
+  while (mapped + I8080_PAGE_SIZE <= size && mapped < 0x10000 &&
+         IN_MEMORY(cpu, mapped + I8080_PAGE_SIZE - 1)) {
+    cpu->page_owners[mapped >> I8080_PAGE_SHIFT] = I8080_PAGE_IMAGE;
+    mapped += I8080_PAGE_SIZE;
+  }
+
+  if (mapped < 0x10000) {
+    i8080_copy_memory(cpu, mapped, cpu->image + mapped, size - mapped);
+  }
+}
+#endif
+
+#ifdef I8080_DIRTY_PAGES
+int i8080_page_dirty(struct i8080 *cpu, uint page) {
+  page &= I8080_PAGES - 1;
+  return (cpu->dirty_pages[page >> 3] >> (page & 7)) & 1;
+}
+
+uint i8080_count_dirty_pages(struct i8080 *cpu) {
+  uint count = 0;
+  for (uint i=0;i<sizeof(cpu->dirty_pages);i++) {
+    count += __builtin_popcount(cpu->dirty_pages[i]);
+  }
+  return count;
+}
+
+uint i8080_clear_dirty_pages(struct i8080 *cpu) {
+  memset(cpu->dirty_pages, 0, sizeof(cpu->dirty_pages));
+  return ++cpu->dirty_generation;
+}
+#endif
+
+#ifdef I8080_PAGE_CACHE
+static void write_back(struct i8080 *cpu, uint line) {
+  struct i8080_page_cache *cache = cpu->page_cache;
+  uint page = cache->tags[line];
+
+#ifdef I8080_LAZY_MEMORY
+  cpu->page_owners[page] = I8080_PAGE_MEMORY;
+#endif
+  memcpy(cpu->memory + (page << I8080_PAGE_SHIFT), cache->data[line], page_bytes(cpu, page));
+  cache->dirty[line] = 0;
+  cache->writebacks++;
+}
+
+static void fill_line(struct i8080 *cpu, uint line, uint page) {
+  struct i8080_page_cache *cache = cpu->page_cache;
+
+  const char *bytes = cpu->memory;
+
+  cache->tags[line] = page;
+#ifdef I8080_LAZY_MEMORY
+  if (cpu->page_owners[page] == I8080_PAGE_ZERO) {
+    memset(cache->data[line], 0, page_bytes(cpu, page));
     return;
   }
+  if (cpu->page_owners[page] == I8080_PAGE_IMAGE) {
+    bytes = cpu->image;
+  }
+#endif
+  memcpy(cache->data[line], bytes + (page << I8080_PAGE_SHIFT), page_bytes(cpu, page));
+}
+
+// The cached copy of a byte in memory, filling the less recently used line of
+// its pair on a miss
+uint8_t *cached_byte(struct i8080 *cpu, uint addr, int write) {
+  struct i8080_page_cache *cache = cpu->page_cache;
+  uint page = addr >> I8080_PAGE_SHIFT;
+  uint pair = page & (I8080_PAGE_CACHE_PAGES / 2 - 1);
+  uint line = pair * 2 + cache->recent[pair];
+
+  if (cache->tags[line] == page) {
+    cache->hits++;
+  } else if (cache->tags[line ^ 1] == page) {
+    line ^= 1;
+    cache->hits++;
+  } else {
+    line ^= 1;
+    if (cache->dirty[line]) {
+      write_back(cpu, line);
+    }
+    fill_line(cpu, line, page);
+    cache->misses++;
+  }
 
-  uint opcode = next_instruction_opcode(cpu);
+  cache->recent[pair] = line & 1;
+  cache->dirty[line] |= write;
+  return &cache->data[line][addr & (I8080_PAGE_SIZE - 1)];
+}
+
+void i8080_flush_page_cache(struct i8080 *cpu) {
+  if (cpu->page_cache == NULL) {
+    return;
+  }
+
+  for (uint line=0;line<I8080_PAGE_CACHE_PAGES;line++) {
+    if (cpu->page_cache->dirty[line]) {
+      write_back(cpu, line);
+    }
+  }
+}
+
+void i8080_set_page_cache(struct i8080 *cpu, struct i8080_page_cache *cache) {
+  i8080_flush_page_cache(cpu);
+  cpu->page_cache = cache;
+
+  if (cache != NULL) {
+    for (uint line=0;line<I8080_PAGE_CACHE_PAGES;line++) {
+      cache->tags[line] = 0xFFFF;
+      cache->dirty[line] = 0;
+      cache->recent[line / 2] = 0;
+    }
+    cache->hits = 0;
+    cache->misses = 0;
+    cache->writebacks = 0;
+  }
+}
+#endif
 
+void execute(struct i8080 *cpu, uint opcode) {
+#ifdef I8080_DISPATCH_TABLE
+  dispatch_table[opcode](cpu, 0);
+#else
   switch (opcode) {
     case 0x00: // NOP
     case 0x08: // NOP (alternate)
@@ -839,11 +2079,11 @@ void i8080_step(struct i8080 *cpu) {
       break;
 
     case 0x22: // SHLD a16
-      shld(cpu);
+      shld(cpu, next_word(cpu));
       break;
 
     case 0x2A: // LDHD a16
-      ldhd(cpu);
+      ldhd(cpu, next_word(cpu));
       break;
 
     case 0x2F: // CMA
@@ -950,11 +2190,11 @@ void i8080_step(struct i8080 *cpu) {
       break;
 
     case 0x32: // STA a16
-      sta(cpu);
+      sta(cpu, next_word(cpu));
       break;
 
     case 0x3A: // LDA a16
-      lda(cpu);
+      lda(cpu, next_word(cpu));
       break;
 
     case 0x40: // MOV B, B
@@ -1083,43 +2323,43 @@ void i8080_step(struct i8080 *cpu) {
       break;
 
     case 0xDB: // IN d8
-      in(cpu);
+      in(cpu, next_byte(cpu));
       break;
 
     case 0xD3: // OUT d8
-      out(cpu);
+      out(cpu, next_byte(cpu));
       break;
 
     case 0xC6: // ADI d8
-      adi(cpu);
+      adi(cpu, next_byte(cpu));
       break;
 
     case 0xD6: // SUI d8
-      sui(cpu);
+      sui(cpu, next_byte(cpu));
       break;
 
     case 0xE6: // ANI d8
-      ani(cpu);
+      ani(cpu, next_byte(cpu));
       break;
 
     case 0xF6: // ORI d8
-      ori(cpu);
+      ori(cpu, next_byte(cpu));
       break;
 
     case 0xCE: // ACI d8
-      aci(cpu);
+      aci(cpu, next_byte(cpu));
       break;
 
     case 0xDE: // SBI d8
-      sbi(cpu);
+      sbi(cpu, next_byte(cpu));
       break;
 
     case 0xEE: // XRI d8
-      xri(cpu);
+      xri(cpu, next_byte(cpu));
       break;
 
     case 0xFE: // CPI d8
-      cpi(cpu);
+      cpi(cpu, next_byte(cpu));
       break;
 
     case 0xA8: // XRA B
@@ -1249,4 +2489,116 @@ void i8080_step(struct i8080 *cpu) {
       fprintf(stderr, "Opcode not implemented 0x%x\n", opcode);
       exit(1);
   }
-}
\ No newline at end of file
+#endif
+}
+
+#ifdef I8080_TRACE
+// Called with PC still at the instruction about to run
+static void trace(struct i8080 *cpu) {
+  if (cpu->trace_handler == NULL) {
+    return;
+  }
+
+#ifndef I8080_NO_INTERRUPTS
+  if (cpu->pending_interrupt) {
+    cpu->trace_handler(cpu, cpu->PC, cpu->interrupt_opcode);
+    return;
+  }
+#endif
+  cpu->trace_handler(cpu, cpu->PC, i8080_read_byte(cpu, cpu->PC));
+}
+#endif
+
+void i8080_step(struct i8080 *cpu) {
+  if (cpu->halted) {
+    return;
+  }
+
+#ifdef I8080_TRACE
+  trace(cpu);
+#endif
+  execute(cpu, next_instruction_opcode(cpu));
+}
+
+struct i8080_exit i8080_run(struct i8080 *cpu, uint cycle_budget) {
+  uint start = cpu->cyc;
+
+  cpu->run_end = start + cycle_budget;
+  cpu->exit_reason = I8080_EXIT_BUDGET;
+
+#ifndef I8080_NO_INTERRUPTS
+  if (cpu->pending_interrupt) {
+#ifdef I8080_TRACE
+    trace(cpu);
+#endif
+    execute(cpu, next_instruction_opcode(cpu));
+  } else if (cpu->halted) {
+    stop_run(cpu, I8080_EXIT_HALT);
+  }
+#else
+  if (cpu->halted) {
+    stop_run(cpu, I8080_EXIT_HALT);
+  }
+#endif
+
+#ifdef I8080_TRACE
+  // Traced runs are interpreted, so every instruction is seen
+  if (cpu->trace_handler != NULL) {
+    while ((int) (cpu->run_end - cpu->cyc) > 0) {
+      trace(cpu);
+      execute(cpu, next_byte(cpu));
+    }
+  }
+#endif
+
+  // HLT, interrupt requests and i8080_yield end the run by pulling run_end
+  // back to the current cycle, so there is only one test per instruction
+#ifdef I8080_JIT
+  if (cpu->jit != NULL) {
+    i8080_jit_run(cpu);
+  }
+#endif
+
+#ifdef I8080_PRECOMPILED
+  if (cpu->precompiled != NULL) {
+    run_precompiled(cpu);
+  }
+#endif
+
+#ifdef I8080_BLOCK_CACHE
+  if (cpu->block_cache != NULL) {
+    run_blocks(cpu);
+  }
+#endif
+
+  while ((int) (cpu->run_end - cpu->cyc) > 0) {
+    execute(cpu, next_byte(cpu));
+  }
+
+  struct i8080_exit result = {cpu->exit_reason, cpu->cyc - start, cpu->exit_port};
+
+  return result;
+}
+
+// Opcode details
+const struct i8080_opcode i8080_opcodes[256] = {
+#define I8080_OPCODE(OPCODE, MNEMONIC, LENGTH, CYCLES, TAKEN, READS, WRITES, ENDS, STORES, HANDLER) \
+  {MNEMONIC, LENGTH, CYCLES, TAKEN, READS, WRITES, ENDS, STORES},
+#include "i8080_opcodes.h"
+#undef I8080_OPCODE
+};
+
+uint i8080_disassemble(struct i8080 *cpu, uint addr, char *buffer, size_t size) {
+  const struct i8080_opcode *opcode = &i8080_opcodes[i8080_read_byte(cpu, addr)];
+  uint operand = 0;
+
+  if (opcode->length == 2) {
+    operand = i8080_read_byte(cpu, addr + 1);
+  } else if (opcode->length == 3) {
+    operand = i8080_read_word(cpu, addr + 1);
+  }
+
+  snprintf(buffer, size, opcode->mnemonic, operand);
+
+  return opcode->length;
+}
@@ -0,0 +1,630 @@
+#include <stddef.h>
+
+#include "i8080_batch.h"
+#include "i8080_flags.h"
+#include "i8080_io.h"
+
+#define LANES I8080_BATCH_LANES
+
+#define REG_FLAGS 6
+#define REG_A 7
+
+#ifdef I8080_NO_CYCLES
+#define OPCODE_CYCLES(OPCODE, TAKEN) 1
+#else
+#define OPCODE_CYCLES(OPCODE, TAKEN) \
+  ((TAKEN) ? i8080_opcodes[OPCODE].taken_cycles : i8080_opcodes[OPCODE].cycles)
+#endif
+
+// The flag bit each pair of condition codes tests
+static const uint8_t condition_flags[4] = {I8080_F_Z, I8080_F_C, I8080_F_P, I8080_F_S};
+
+void i8080_batch_init(struct i8080_batch *batch) {
+  for (uint l=0;l<LANES;l++) {
+    for (uint r=0;r<8;r++) {
+      batch->reg[r][l] = 0;
+    }
+    batch->reg[REG_FLAGS][l] = 2;
+    batch->SP[l] = 0;
+    batch->PC[l] = 0;
+    batch->INTE[l] = 0;
+    batch->halted[l] = 1;
+    batch->cyc[l] = 0;
+    batch->memory[l] = NULL;
+    batch->io[l] = NULL;
+  }
+
+  batch->vector_steps = 0;
+  batch->scalar_steps = 0;
+}
+
+void i8080_batch_load(struct i8080_batch *batch, uint lane, struct i8080 *cpu) {
+  i8080_sync_flags(cpu);
+
+  batch->reg[0][lane] = cpu->B;
+  batch->reg[1][lane] = cpu->C;
+  batch->reg[2][lane] = cpu->D;
+  batch->reg[3][lane] = cpu->E;
+  batch->reg[4][lane] = cpu->H;
+  batch->reg[5][lane] = cpu->L;
+  batch->reg[REG_FLAGS][lane] = cpu->flags;
+  batch->reg[REG_A][lane] = cpu->A;
+  batch->SP[lane] = cpu->SP;
+  batch->PC[lane] = cpu->PC;
+  batch->INTE[lane] = cpu->INTE;
+  batch->halted[lane] = cpu->halted;
+  batch->cyc[lane] = cpu->cyc;
+  batch->memory[lane] = cpu->memory;
+  batch->io[lane] = cpu->io;
+}
+
+void i8080_batch_save(struct i8080_batch *batch, uint lane, struct i8080 *cpu) {
+  i8080_sync_flags(cpu);
+
+  cpu->B = batch->reg[0][lane];
+  cpu->C = batch->reg[1][lane];
+  cpu->D = batch->reg[2][lane];
+  cpu->E = batch->reg[3][lane];
+  cpu->H = batch->reg[4][lane];
+  cpu->L = batch->reg[5][lane];
+  cpu->flags = batch->reg[REG_FLAGS][lane];
+  cpu->A = batch->reg[REG_A][lane];
+  cpu->SP = batch->SP[lane];
+  cpu->PC = batch->PC[lane];
+  cpu->INTE = batch->INTE[lane];
+  cpu->halted = batch->halted[lane];
+  cpu->cyc = batch->cyc[lane];
+  cpu->memory = batch->memory[lane];
+  cpu->memsize = 0x10000;
+  i8080_set_io(cpu, batch->io[lane]);
+}
+
+// Runs one lane's instruction through the core
+static void scalar_step(struct i8080_batch *batch, struct i8080 *cpu, uint lane) {
+  i8080_batch_save(batch, lane, cpu);
+  i8080_step(cpu);
+  i8080_batch_load(batch, lane, cpu);
+
+  batch->scalar_steps++;
+}
+
+// The eight ALU operations, by bits 3 to 5 of the opcode, as perform_add,
+// perform_sub and the logical instructions work them out, with the flags
+// from i8080_flags.h. Returns the flags and leaves the new accumulator in
+// result.
+static inline uint alu(uint operation, uint a, uint b, uint flags, uint *result) {
+  uint carry_in = flags & I8080_F_C;
+  uint res, set;
+
+  switch (operation) {
+    case 0: // ADD
+    case 1: // ADC
+      res = a + b + (operation == 1 ? carry_in : 0);
+      set = i8080_add_flags(a, b, res);
+      *result = res & 0xFF;
+      break;
+    case 2: // SUB
+    case 3: // SBB
+    case 7: // CMP
+      b = ~b & 0xFF;
+      res = a + b + (operation == 3 && carry_in ? 0 : 1);
+      set = i8080_sub_flags(a, b, res);
+      *result = operation == 7 ? a : res & 0xFF;
+      break;
+    case 4: // ANA
+      res = a & b;
+      set = i8080_logic_flags(res, (a | b) & 0x08);
+      *result = res;
+      break;
+    case 5: // XRA
+      res = a ^ b;
+      set = i8080_logic_flags(res, 0);
+      *result = res;
+      break;
+    default: // ORA
+      res = a | b;
+      set = i8080_logic_flags(res, 0);
+      *result = res;
+      break;
+  }
+
+  return (flags & ~I8080_F_ALL) | set;
+}
+
+// Bytes after the opcode, for the lanes in the mask
+static void fetch_operands(struct i8080_batch *batch, const uint8_t *mask, uint length, uint16_t *operand) {
+  for (uint l=0;l<LANES;l++) {
+    operand[l] = 0;
+    if (mask[l]) {
+      uint8_t *memory = (uint8_t *) batch->memory[l];
+      uint16_t pc = batch->PC[l];
+
+      operand[l] = memory[(uint16_t) (pc + 1)];
+      if (length == 3) {
+        operand[l] |= memory[(uint16_t) (pc + 2)] << 8;
+      }
+    }
+  }
+}
+
+// Moves the lanes in the mask past an instruction that does not branch
+static void advance(struct i8080_batch *batch, uint opcode, const uint8_t *mask) {
+  uint length = i8080_opcodes[opcode].length;
+  uint cycles = OPCODE_CYCLES(opcode, 0);
+
+  for (uint l=0;l<LANES;l++) {
+    batch->PC[l] += mask[l] ? length : 0;
+    batch->cyc[l] += mask[l] ? cycles : 0;
+  }
+}
+
+static inline uint read_byte(struct i8080_batch *batch, uint lane, uint addr) {
+  return (uint8_t) batch->memory[lane][addr & 0xFFFF];
+}
+
+static inline void write_byte(struct i8080_batch *batch, uint lane, uint addr, uint data) {
+  batch->memory[lane][addr & 0xFFFF] = data;
+}
+
+static inline uint get_pair(struct i8080_batch *batch, uint pair, uint lane) {
+  if (pair == 3) {
+    return batch->SP[lane];
+  }
+
+  return (batch->reg[pair * 2][lane] << 8) | batch->reg[pair * 2 + 1][lane];
+}
+
+static inline void set_pair(struct i8080_batch *batch, uint pair, uint lane, uint value) {
+  if (pair == 3) {
+    batch->SP[lane] = value;
+  } else {
+    batch->reg[pair * 2][lane] = (value >> 8) & 0xFF;
+    batch->reg[pair * 2 + 1][lane] = value & 0xFF;
+  }
+}
+
+static inline void push_word(struct i8080_batch *batch, uint lane, uint value) {
+  uint16_t sp = batch->SP[lane];
+
+  write_byte(batch, lane, sp - 1, value >> 8);
+  write_byte(batch, lane, sp - 2, value);
+  batch->SP[lane] = sp - 2;
+}
+
+static inline uint pop_word(struct i8080_batch *batch, uint lane) {
+  uint16_t sp = batch->SP[lane];
+
+  batch->SP[lane] = sp + 2;
+  return read_byte(batch, lane, sp) | (read_byte(batch, lane, sp + 1) << 8);
+}
+
+// Whether a jump, call or return is taken. Opcodes with bit 0 set are
+// unconditional, and the others test a condition from bits 3 to 5.
+static inline uint condition_taken(uint opcode, uint flags) {
+  uint condition = (opcode >> 3) & 7;
+
+  return (opcode & 1) || ((flags & condition_flags[condition >> 1]) != 0) == (condition & 1);
+}
+
+// The group's register-only forms, which compile to vector code, and
+// memory forms, which load and store a lane at a time but still skip the
+// copy to and from a struct i8080. Returns 0 if the opcode has neither.
+static int vector_step(struct i8080_batch *batch, uint opcode, const uint8_t *mask) {
+  uint dst = (opcode >> 3) & 7;
+  uint src = opcode & 7;
+  uint pair = (opcode >> 4) & 3;
+  uint8_t *acc = batch->reg[REG_A];
+  uint8_t *flags = batch->reg[REG_FLAGS];
+  uint16_t operand[LANES];
+
+  if ((opcode & 0xC7) == 0x00) { // NOP
+    advance(batch, opcode, mask);
+
+  } else if ((opcode & 0xC0) == 0x40 && opcode != 0x76) { // MOV
+    uint8_t *to = batch->reg[dst];
+    uint8_t *from = batch->reg[src];
+
+    if (dst == 6) {
+      for (uint l=0;l<LANES;l++) {
+        if (mask[l]) {
+          write_byte(batch, l, get_pair(batch, 2, l), from[l]);
+        }
+      }
+    } else if (src == 6) {
+      for (uint l=0;l<LANES;l++) {
+        to[l] = mask[l] ? read_byte(batch, l, get_pair(batch, 2, l)) : to[l];
+      }
+    } else {
+      for (uint l=0;l<LANES;l++) {
+        to[l] = mask[l] ? from[l] : to[l];
+      }
+    }
+    advance(batch, opcode, mask);
+
+  } else if ((opcode & 0xC7) == 0x06) { // MVI
+    uint8_t *to = batch->reg[dst];
+
+    fetch_operands(batch, mask, 2, operand);
+    for (uint l=0;l<LANES;l++) {
+      if (dst == 6) {
+        if (mask[l]) {
+          write_byte(batch, l, get_pair(batch, 2, l), operand[l]);
+        }
+      } else {
+        to[l] = mask[l] ? operand[l] : to[l];
+      }
+    }
+    advance(batch, opcode, mask);
+
+  } else if ((opcode & 0xC6) == 0x04) { // INR, DCR
+    uint8_t *reg = batch->reg[dst];
+    uint decrement = opcode & 1;
+
+    for (uint l=0;l<LANES;l++) {
+      uint before = dst == 6 ? (mask[l] ? read_byte(batch, l, get_pair(batch, 2, l)) : 0) : reg[l];
+      uint after = (decrement ? before - 1 : before + 1) & 0xFF;
+      uint set = decrement ? i8080_dec_flags(before, after) : i8080_inc_flags(before, after);
+      uint f = (flags[l] & ~I8080_F_SZAP) | set;
+
+      if (dst == 6) {
+        if (mask[l]) {
+          write_byte(batch, l, get_pair(batch, 2, l), after);
+        }
+      } else {
+        reg[l] = mask[l] ? after : before;
+      }
+      flags[l] = mask[l] ? f : flags[l];
+    }
+    advance(batch, opcode, mask);
+
+  } else if ((opcode & 0xCF) == 0x01) { // LXI
+    fetch_operands(batch, mask, 3, operand);
+    for (uint l=0;l<LANES;l++) {
+      if (mask[l]) {
+        set_pair(batch, pair, l, operand[l]);
+      }
+    }
+    advance(batch, opcode, mask);
+
+  } else if ((opcode & 0xC7) == 0x03) { // INX, DCX
+    uint delta = (opcode & 0x08) ? 0xFFFF : 1;
+
+    if (pair == 3) {
+      for (uint l=0;l<LANES;l++) {
+        batch->SP[l] += mask[l] ? delta : 0;
+      }
+    } else {
+      uint8_t *hi = batch->reg[pair * 2];
+      uint8_t *lo = batch->reg[pair * 2 + 1];
+
+      for (uint l=0;l<LANES;l++) {
+        uint value = ((hi[l] << 8) | lo[l]) + delta;
+        hi[l] = mask[l] ? (value >> 8) & 0xFF : hi[l];
+        lo[l] = mask[l] ? value & 0xFF : lo[l];
+      }
+    }
+    advance(batch, opcode, mask);
+
+  } else if ((opcode & 0xCF) == 0x09) { // DAD
+    for (uint l=0;l<LANES;l++) {
+      if (mask[l]) {
+        uint value = get_pair(batch, 2, l) + get_pair(batch, pair, l);
+        set_pair(batch, 2, l, value);
+        flags[l] = (flags[l] & ~I8080_F_C) | ((value >> 16) & 1);
+      }
+    }
+    advance(batch, opcode, mask);
+
+  } else if ((opcode & 0xE7) == 0x02) { // STAX B, STAX D, LDAX B, LDAX D
+    for (uint l=0;l<LANES;l++) {
+      if (mask[l]) {
+        uint addr = get_pair(batch, pair, l);
+        if (opcode & 0x08) {
+          acc[l] = read_byte(batch, l, addr);
+        } else {
+          write_byte(batch, l, addr, acc[l]);
+        }
+      }
+    }
+    advance(batch, opcode, mask);
+
+  } else if (opcode == 0x22 || opcode == 0x2A || opcode == 0x32 || opcode == 0x3A) { // SHLD, LHLD, STA, LDA
+    fetch_operands(batch, mask, 3, operand);
+    for (uint l=0;l<LANES;l++) {
+      if (mask[l]) {
+        uint addr = operand[l];
+        switch (opcode) {
+          case 0x22:
+            write_byte(batch, l, addr, batch->reg[5][l]);
+            write_byte(batch, l, addr + 1, batch->reg[4][l]);
+            break;
+          case 0x2A:
+            batch->reg[5][l] = read_byte(batch, l, addr);
+            batch->reg[4][l] = read_byte(batch, l, addr + 1);
+            break;
+          case 0x32:
+            write_byte(batch, l, addr, acc[l]);
+            break;
+          default:
+            acc[l] = read_byte(batch, l, addr);
+            break;
+        }
+      }
+    }
+    advance(batch, opcode, mask);
+
+  } else if ((opcode & 0xE7) == 0x07) { // RLC, RRC, RAL, RAR
+    for (uint l=0;l<LANES;l++) {
+      uint a = acc[l];
+      uint carry = flags[l] & I8080_F_C;
+      uint res, carry_out;
+
+      switch (opcode) {
+        case 0x07: res = (a << 1) | (a >> 7); carry_out = a >> 7; break;
+        case 0x0F: res = (a >> 1) | (a << 7); carry_out = a & 1; break;
+        case 0x17: res = (a << 1) | carry; carry_out = a >> 7; break;
+        default: res = (a >> 1) | (carry << 7); carry_out = a & 1; break;
+      }
+
+      acc[l] = mask[l] ? res & 0xFF : acc[l];
+      flags[l] = mask[l] ? (flags[l] & ~I8080_F_C) | carry_out : flags[l];
+    }
+    advance(batch, opcode, mask);
+
+  } else if (opcode == 0x2F || opcode == 0x37 || opcode == 0x3F) { // CMA, STC, CMC
+    for (uint l=0;l<LANES;l++) {
+      if (opcode == 0x2F) {
+        acc[l] = mask[l] ? ~acc[l] : acc[l];
+      } else {
+        flags[l] = mask[l] ? (opcode == 0x37 ? flags[l] | I8080_F_C : flags[l] ^ I8080_F_C) : flags[l];
+      }
+    }
+    advance(batch, opcode, mask);
+
+  } else if ((opcode & 0xC0) == 0x80 || (opcode & 0xC7) == 0xC6) { // ALU
+    if ((opcode & 0xC0) == 0xC0) {
+      fetch_operands(batch, mask, 2, operand);
+    } else if (src == 6) {
+      for (uint l=0;l<LANES;l++) {
+        operand[l] = mask[l] ? read_byte(batch, l, get_pair(batch, 2, l)) : 0;
+      }
+    } else {
+      for (uint l=0;l<LANES;l++) {
+        operand[l] = batch->reg[src][l];
+      }
+    }
+
+    for (uint l=0;l<LANES;l++) {
+      uint result;
+      uint f = alu(dst, acc[l], operand[l], flags[l], &result);
+
+      acc[l] = mask[l] ? result : acc[l];
+      flags[l] = mask[l] ? f : flags[l];
+    }
+    advance(batch, opcode, mask);
+
+  } else if (opcode == 0xEB) { // XCHG
+    for (uint l=0;l<LANES;l++) {
+      uint8_t d = batch->reg[2][l], e = batch->reg[3][l];
+      uint8_t h = batch->reg[4][l], lo = batch->reg[5][l];
+
+      batch->reg[2][l] = mask[l] ? h : d;
+      batch->reg[3][l] = mask[l] ? lo : e;
+      batch->reg[4][l] = mask[l] ? d : h;
+      batch->reg[5][l] = mask[l] ? e : lo;
+    }
+    advance(batch, opcode, mask);
+
+  } else if ((opcode & 0xCB) == 0xC1) { // POP, PUSH
+    for (uint l=0;l<LANES;l++) {
+      if (!mask[l]) {
+        continue;
+      }
+
+      if (opcode & 0x04) {
+        push_word(batch, l, pair == 3 ? (acc[l] << 8) | flags[l] : get_pair(batch, pair, l));
+      } else if (pair == 3) {
+        uint value = pop_word(batch, l);
+        flags[l] = ((value & 0xFF) | 0x02) & 0xD7;
+        acc[l] = value >> 8;
+      } else {
+        set_pair(batch, pair, l, pop_word(batch, l));
+      }
+    }
+    advance(batch, opcode, mask);
+
+  } else if ((opcode & 0xC7) == 0xC2 || opcode == 0xC3 || opcode == 0xCB) { // Jcc, JMP
+    uint cycles = OPCODE_CYCLES(opcode, 1);
+
+    fetch_operands(batch, mask, 3, operand);
+    for (uint l=0;l<LANES;l++) {
+      uint16_t next = batch->PC[l] + 3;
+      uint16_t target = condition_taken(opcode, flags[l]) ? operand[l] : next;
+
+      batch->PC[l] = mask[l] ? target : batch->PC[l];
+      batch->cyc[l] += mask[l] ? cycles : 0;
+    }
+
+  } else if ((opcode & 0xC7) == 0xC4 || (opcode & 0xCF) == 0xCD) { // Ccc, CALL
+    fetch_operands(batch, mask, 3, operand);
+    for (uint l=0;l<LANES;l++) {
+      if (mask[l]) {
+        uint16_t next = batch->PC[l] + 3;
+        uint taken = condition_taken(opcode, flags[l]);
+
+        if (taken) {
+          push_word(batch, l, next);
+        }
+        batch->PC[l] = taken ? operand[l] : next;
+        batch->cyc[l] += OPCODE_CYCLES(opcode, taken);
+      }
+    }
+
+  } else if ((opcode & 0xC7) == 0xC0 || (opcode & 0xEF) == 0xC9) { // Rcc, RET
+    for (uint l=0;l<LANES;l++) {
+      if (mask[l]) {
+        uint taken = condition_taken(opcode, flags[l]);
+
+        batch->PC[l] = taken ? pop_word(batch, l) : (uint16_t) (batch->PC[l] + 1);
+        batch->cyc[l] += OPCODE_CYCLES(opcode, taken);
+      }
+    }
+
+  } else if (opcode == 0xE9 || opcode == 0xF9) { // PCHL, SPHL
+    for (uint l=0;l<LANES;l++) {
+      if (mask[l] && opcode == 0xE9) {
+        batch->PC[l] = get_pair(batch, 2, l) - 1;
+      } else if (mask[l]) {
+        batch->SP[l] = get_pair(batch, 2, l);
+      }
+    }
+    advance(batch, opcode, mask);
+
+  } else {
+    return 0;
+  }
+
+  return 1;
+}
+
+// Executes opcode for the lanes in the mask, through i8080_step a lane at
+// a time if it has no vector form
+static void step_group(struct i8080_batch *batch, uint opcode, const uint8_t *mask, uint count) {
+  if (vector_step(batch, opcode, mask)) {
+    batch->vector_steps += count;
+    return;
+  }
+
+  struct i8080 cpu;
+  i8080_reset(&cpu);
+
+  for (uint l=0;l<LANES;l++) {
+    if (mask[l]) {
+      scalar_step(batch, &cpu, l);
+    }
+  }
+}
+
+void i8080_batch_step(struct i8080_batch *batch) {
+  uint8_t opcode[LANES];
+  uint8_t pending[LANES];
+  uint8_t mask[LANES];
+
+  for (uint l=0;l<LANES;l++) {
+    pending[l] = !batch->halted[l];
+    opcode[l] = pending[l] ? batch->memory[l][batch->PC[l]] : 0;
+  }
+
+  for (uint first=0;first<LANES;first++) {
+    if (!pending[first]) {
+      continue;
+    }
+
+    uint op = opcode[first];
+    uint count = 0;
+
+    for (uint l=0;l<LANES;l++) {
+      mask[l] = pending[l] && opcode[l] == op;
+      pending[l] &= !mask[l];
+      count += mask[l];
+    }
+
+    step_group(batch, op, mask, count);
+  }
+}
+
+// Runs each lane on its own up to its end cycle
+static void run_lanes(struct i8080_batch *batch, const uint *end) {
+  struct i8080 cpu;
+  i8080_reset(&cpu);
+
+  for (uint l=0;l<LANES;l++) {
+    if (!batch->halted[l] && (int) (end[l] - batch->cyc[l]) > 0) {
+      i8080_batch_save(batch, l, &cpu);
+      while (!cpu.halted && (int) (end[l] - cpu.cyc) > 0) {
+        i8080_run(&cpu, end[l] - cpu.cyc);
+      }
+      i8080_batch_load(batch, l, &cpu);
+    }
+  }
+}
+
+// Lanes that have taken different branches come back together at the code
+// they share, so each pass steps only the lanes at the lowest PC. The lanes
+// ahead wait for the ones behind to catch up with them.
+uint i8080_batch_run(struct i8080_batch *batch, uint cycle_budget) {
+  uint8_t active[LANES];
+  uint8_t mask[LANES];
+  uint end[LANES];
+  uint running = 0;
+
+  for (uint l=0;l<LANES;l++) {
+    end[l] = batch->cyc[l] + cycle_budget;
+  }
+
+  uint groups = 0;
+  uint steps = 0;
+
+  for (;;) {
+    // Once the lanes have gone their own ways, stepping them in groups of
+    // one or two costs more than running each on its own
+    if (groups == I8080_BATCH_WINDOW) {
+      if (steps < groups * I8080_BATCH_MIN_GROUP) {
+        run_lanes(batch, end);
+        break;
+      }
+      groups = 0;
+      steps = 0;
+    }
+
+    // Lanes still to run sort after every PC
+    uint lowest = 0x10000;
+
+    for (uint l=0;l<LANES;l++) {
+      active[l] = !batch->halted[l] & ((int) (end[l] - batch->cyc[l]) > 0);
+      uint pc = active[l] ? batch->PC[l] : 0x10000;
+      lowest = pc < lowest ? pc : lowest;
+    }
+
+    if (lowest == 0x10000) {
+      break;
+    }
+
+    uint count = 0;
+    uint first = LANES;
+
+    for (uint l=0;l<LANES;l++) {
+      mask[l] = active[l] & (batch->PC[l] == lowest);
+      count += mask[l];
+    }
+
+    // Lanes at the same PC almost always hold the same code there, but each
+    // has its own memory, so check
+    uint op = 0;
+
+    for (uint l=0;l<LANES;l++) {
+      if (mask[l]) {
+        uint lane_op = (uint8_t) batch->memory[l][lowest];
+
+        if (first == LANES) {
+          first = l;
+          op = lane_op;
+        } else if (lane_op != op) {
+          mask[l] = 0;
+          count--;
+        }
+      }
+    }
+
+    step_group(batch, op, mask, count);
+
+    groups++;
+    steps += count;
+  }
+
+  for (uint l=0;l<LANES;l++) {
+    running += !batch->halted[l];
+  }
+
+  return running;
+}
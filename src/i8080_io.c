@@ -0,0 +1,48 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "i8080_io.h"
+
+static uint unmapped_input(struct i8080 *cpu, void *state, uint port) {
+  return 0x00;
+}
+
+static void unmapped_output(struct i8080 *cpu, void *state, uint port, uint data) {
+}
+
+void i8080_io_init(struct i8080_io *io) {
+  for (int i=0;i<256;i++) {
+    io->ports[i].input = unmapped_input;
+    io->ports[i].output = unmapped_output;
+    io->ports[i].state = NULL;
+  }
+}
+
+void i8080_io_map(struct i8080_io *io, struct i8080_device *device, uint first, uint last) {
+  if (first > last || last > 0xFF) {
+    fprintf(stderr, "Invalid ports 0x%x-0x%x\n", first, last);
+    exit(1);
+  }
+
+  for (uint port=first;port<=last;port++) {
+    io->ports[port].input = device->input != NULL ? device->input : unmapped_input;
+    io->ports[port].output = device->output != NULL ? device->output : unmapped_output;
+    io->ports[port].state = device->state;
+  }
+}
+
+void i8080_set_io(struct i8080 *cpu, struct i8080_io *io) {
+  cpu->io = io;
+  cpu->input_handler = io != NULL ? i8080_io_input : NULL;
+  cpu->output_handler = io != NULL ? i8080_io_output : NULL;
+}
+
+uint i8080_io_input(struct i8080 *cpu, uint port) {
+  struct i8080_port *entry = &cpu->io->ports[port & 0xFF];
+  return entry->input(cpu, entry->state, port & 0xFF);
+}
+
+void i8080_io_output(struct i8080 *cpu, uint port, uint data) {
+  struct i8080_port *entry = &cpu->io->ports[port & 0xFF];
+  entry->output(cpu, entry->state, port & 0xFF, data);
+}
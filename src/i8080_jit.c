@@ -0,0 +1,964 @@
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "i8080_jit.h"
+
+#if !defined(__x86_64__) || !defined(__linux__)
+#error "i8080_jit.c needs an x86-64 Linux host"
+#endif
+
+// Translation
+//
+// Each block is a native function taking the struct i8080 pointer. Guest
+// registers stay in the struct, and the 8080 flags byte has the same layout
+// as the x86 LAHF/SAHF byte, so ALU instructions run natively and store AH
+// as the new flags. Translated code keeps rbx as the CPU, r12 as guest
+// memory and r13 as the translator.
+//
+// Blocks end after anything that can change PC or do I/O, and before any
+// instruction left to the interpreter. Writes check a byte per 256-byte
+// guest page and only call into the core when the page holds translated
+// code, and a block that writes over itself stops after that instruction.
+//
+// The code buffer is never writable and executable at once. It is mapped
+// read and execute. Blocks are emitted into a scratch buffer, and only a
+// block that translates is copied in, with the host pages it lands on made
+// writable for the copy. Translated code only uses relative jumps within the
+// block and absolute addresses outside it, so it runs wherever it is copied.
+//
+// BASIC patches the immediate operands of its division loop and keeps a
+// variable in the operand of an MVI. A byte that keeps being written over
+// is treated as data: immediate operands read it from memory at run time,
+// any other instruction holding it is left to the interpreter, and writes
+// to it no longer drop blocks.
+
+#define CODE_BUFFER_SIZE (4 * 1024 * 1024)
+#define CODE_RESERVE (16 * 1024)
+
+#define MAX_BLOCKS 16384
+#define MAX_BLOCK_INSTRUCTIONS 32
+
+// Writes into translated code before a byte is treated as data
+#define VOLATILE_WRITES 2
+
+#define PAGE_SHIFT 8
+#define PAGES (0x10000 >> PAGE_SHIFT)
+
+struct jit_block {
+  uint16_t pc;
+  uint16_t length;
+  uint max_cycles;
+  int dead;
+  void (*code)(struct i8080 *);
+};
+
+// A block covers at most two pages, so has a link in each page's list
+struct jit_link {
+  struct jit_block *block;
+  struct jit_link *next;
+};
+
+struct i8080_jit {
+  // Read by translated code, code_pages must stay first
+  uint8_t code_pages[PAGES];
+  uint8_t invalidated;
+
+  struct jit_block *running;
+
+  struct jit_block *map[0x10000];
+  uint8_t code_writes[0x10000];
+  struct jit_link *page_links[PAGES];
+
+  struct jit_block blocks[MAX_BLOCKS];
+  struct jit_link links[MAX_BLOCKS * 2];
+  uint block_count;
+  uint link_count;
+
+  uint8_t *code;
+  uint8_t *code_free; // Next byte of code to fill
+  uintptr_t host_page_size;
+
+  // Where a block is emitted, and how far it has got
+  uint8_t scratch[CODE_RESERVE];
+  uint8_t *code_ptr;
+
+  // Cycles of the instructions emitted so far in this block
+  uint block_cycles;
+
+  struct i8080_jit_stats stats;
+};
+
+#define CPU_OFFSET(field) offsetof(struct i8080, field)
+
+_Static_assert(CPU_OFFSET(exit_port) < 128, "struct i8080 fields need 8-bit offsets");
+
+// Host registers
+#define AL 0
+#define CL 1
+#define DL 2
+#define AH 4
+
+#define EAX 0
+#define ECX 1
+#define EDX 2
+#define ESI 6
+
+// ModRM for [rbx + disp8]
+#define RBX_DISP8(reg) (0x43 | ((reg) << 3))
+
+#define EMIT(...) emit_bytes(jit, (const uint8_t[]) {__VA_ARGS__}, \
+                             sizeof((const uint8_t[]) {__VA_ARGS__}))
+
+static void emit_bytes(struct i8080_jit *jit, const uint8_t *bytes, size_t count) {
+  memcpy(jit->code_ptr, bytes, count);
+  jit->code_ptr += count;
+}
+
+static void emit32(struct i8080_jit *jit, uint32_t val) {
+  memcpy(jit->code_ptr, &val, 4);
+  jit->code_ptr += 4;
+}
+
+static void emit64(struct i8080_jit *jit, uint64_t val) {
+  memcpy(jit->code_ptr, &val, 8);
+  jit->code_ptr += 8;
+}
+
+// Opcode register fields to struct offsets, 6 is memory and has none
+static uint reg_offset(uint reg) {
+  return CPU_OFFSET(reg) + I8080_REG_INDEX(reg);
+}
+
+// Register pair fields, 3 is SP
+static uint pair_offset(uint reg_pair) {
+  return reg_pair == 3 ? CPU_OFFSET(SP) : CPU_OFFSET(pair) + reg_pair * 2;
+}
+
+#define A_OFFSET reg_offset(7)
+#define FLAGS_OFFSET CPU_OFFSET(flags)
+#define HL_OFFSET CPU_OFFSET(HL)
+
+// movzx ecx, word [rbx + offset]
+static void emit_load_address(struct i8080_jit *jit, uint offset) {
+  EMIT(0x0F, 0xB7, RBX_DISP8(ECX), offset);
+}
+
+// movzx reg, byte [r12 + rcx]
+static void emit_read(struct i8080_jit *jit, uint reg) {
+  EMIT(0x41, 0x0F, 0xB6, 0x04 | (reg << 3), 0x0C);
+}
+
+static void emit_call(struct i8080_jit *jit, void *function) {
+  EMIT(0x48, 0xB8);
+  emit64(jit, (uint64_t) (uintptr_t) function);
+  EMIT(0xFF, 0xD0);
+}
+
+static void write_byte(struct i8080 *cpu, uint addr, uint data) {
+  i8080_write_byte(cpu, addr, data);
+}
+
+// Writes dl to the address in ecx, through the core if the page holds code.
+// With I8080_DIRTY_PAGES the direct store marks the page dirty as the core
+// would
+static void emit_write(struct i8080_jit *jit) {
+  EMIT(0x89, 0xC8,                   // mov eax, ecx
+       0xC1, 0xE8, PAGE_SHIFT,       // shr eax, PAGE_SHIFT
+       0x41, 0x80, 0x7C, 0x05, 0x00, // cmp byte [r13 + rax], 0
+       0x00);
+#ifdef I8080_DIRTY_PAGES
+  EMIT(0x75, 0x0D,                   // jne slow
+       0x41, 0x88, 0x14, 0x0C,       // mov [r12 + rcx], dl
+       0x0F, 0xAB, 0x83);            // bts [rbx + dirty_pages], eax
+  emit32(jit, CPU_OFFSET(dirty_pages));
+#else
+  EMIT(0x75, 0x06,                   // jne slow
+       0x41, 0x88, 0x14, 0x0C);      // mov [r12 + rcx], dl
+#endif
+  EMIT(0xEB, 0x14,                   // jmp done
+       0x48, 0x89, 0xDF,             // slow: mov rdi, rbx
+       0x89, 0xCE,                   // mov esi, ecx
+       0x0F, 0xB6, 0xD2);            // movzx edx, dl
+  emit_call(jit, write_byte);        // done:
+}
+
+static void emit_epilogue(struct i8080_jit *jit) {
+  EMIT(0x41, 0x5D, 0x41, 0x5C, 0x5B, 0xC3); // pop r13, pop r12, pop rbx, ret
+}
+
+// Adds the cycles so far, sets PC unless pc is negative and returns
+static void emit_exit(struct i8080_jit *jit, int pc, uint extra_cycles) {
+  uint cycles = jit->block_cycles + extra_cycles;
+
+  if (cycles != 0) {
+    EMIT(0x81, RBX_DISP8(0), CPU_OFFSET(cyc));
+    emit32(jit, cycles);
+  }
+
+  if (pc >= 0) {
+    EMIT(0x66, 0xC7, RBX_DISP8(0), CPU_OFFSET(PC), pc & 0xFF, (pc >> 8) & 0xFF);
+  }
+
+  emit_epilogue(jit);
+}
+
+// Leaves the block at next_pc if a write just dropped it
+static void emit_check_invalidated(struct i8080_jit *jit, uint next_pc) {
+  EMIT(0x41, 0x80, 0xBD);        // cmp byte [r13 + disp32], 0
+  emit32(jit, offsetof(struct i8080_jit, invalidated));
+  EMIT(0x00, 0x74, 0x00);        // je over the exit
+  uint8_t *skip = jit->code_ptr;
+
+  emit_exit(jit, next_pc, 0);
+  skip[-1] = jit->code_ptr - skip;
+}
+
+// Pushes the bytes in the struct at hi and lo, or the value if they are
+// negative, high byte first as the interpreter does
+static void emit_push(struct i8080_jit *jit, int hi, int lo, uint val) {
+  for (int i=1;i>=0;i--) {
+    int offset = i ? hi : lo;
+
+    emit_load_address(jit, CPU_OFFSET(SP));
+    EMIT(0x83, 0xE9, 2 - i,                   // sub ecx, 2 - i
+         0x81, 0xE1, 0xFF, 0xFF, 0x00, 0x00); // and ecx, 0xFFFF
+    if (offset >= 0) {
+      EMIT(0x8A, RBX_DISP8(DL), offset);
+    } else {
+      EMIT(0xB2, (val >> (i * 8)) & 0xFF);
+    }
+    emit_write(jit);
+  }
+
+  EMIT(0x66, 0x83, 0x6B, CPU_OFFSET(SP), 0x02); // sub word [rbx + SP], 2
+}
+
+// Pops a word into ax
+static void emit_pop(struct i8080_jit *jit) {
+  emit_load_address(jit, CPU_OFFSET(SP));
+  EMIT(0x41, 0x0F, 0xB6, 0x14, 0x0C,   // movzx edx, byte [r12 + rcx]
+       0x66, 0xFF, 0xC1,               // inc cx
+       0x0F, 0xB7, 0xC9,               // movzx ecx, cx
+       0x41, 0x0F, 0xB6, 0x04, 0x0C,   // movzx eax, byte [r12 + rcx]
+       0xC1, 0xE0, 0x08,               // shl eax, 8
+       0x09, 0xD0,                     // or eax, edx
+       0x66, 0x83, 0x43, CPU_OFFSET(SP), 0x02); // add word [rbx + SP], 2
+}
+
+// Tests an opcode's condition field, returning where to patch the rel32
+// of a jump taken when the condition fails
+static uint8_t *emit_condition(struct i8080_jit *jit, uint opcode) {
+  static const uint8_t masks[] = {0x40, 0x01, 0x04, 0x80}; // Z, C, P, S
+  uint condition = (opcode >> 3) & 0x07;
+
+  EMIT(0xF6, RBX_DISP8(0), FLAGS_OFFSET, masks[condition >> 1]);
+  // Odd conditions need the flag set, so skip when it is clear
+  EMIT(0x0F, (condition & 1) ? 0x84 : 0x85);
+  emit32(jit, 0);
+
+  return jit->code_ptr;
+}
+
+static void patch_here(struct i8080_jit *jit, uint8_t *after_rel32) {
+  uint32_t rel = jit->code_ptr - after_rel32;
+  memcpy(after_rel32 - 4, &rel, 4);
+}
+
+// ALU operation in al with dl, flags to AH and then the struct
+static void emit_alu(struct i8080_jit *jit, uint operation) {
+  static const uint8_t x86_ops[] = {
+    0x00, 0x10, 0x28, 0x18, 0x20, 0x30, 0x08, 0x38 // ADD ADC SUB SBB AND XOR OR CMP
+  };
+
+  EMIT(0x8A, RBX_DISP8(AL), A_OFFSET);
+
+  if (operation == 1 || operation == 3) {
+    EMIT(0x8A, RBX_DISP8(AH), FLAGS_OFFSET, 0x9E); // Carry in through SAHF
+  } else if (operation == 4) {
+    EMIT(0x88, 0xC1,       // mov cl, al
+         0x08, 0xD1,       // or cl, dl
+         0x80, 0xE1, 0x08, // and cl, 0x08
+         0xD0, 0xE1);      // shl cl, 1
+  }
+
+  EMIT(x86_ops[operation], 0xD0, 0x9F); // op al, dl then LAHF
+
+  switch (operation) {
+    case 2: case 3: case 7:
+      // The 8080 auxiliary carry is the inverse of the x86 borrow
+      EMIT(0x80, 0xF4, 0x10);
+      break;
+    case 4:
+      EMIT(0x80, 0xE4, 0xEF, 0x08, 0xCC); // and ah, ~0x10, or ah, cl
+      break;
+    case 5: case 6:
+      EMIT(0x80, 0xE4, 0xEF);
+      break;
+  }
+
+  EMIT(0x88, RBX_DISP8(AH), FLAGS_OFFSET);
+  if (operation != 7) {
+    EMIT(0x88, RBX_DISP8(AL), A_OFFSET);
+  }
+}
+
+// INR or DCR on the byte in al, keeping the old carry
+static void emit_inr_dcr_al(struct i8080_jit *jit, int decrement) {
+  EMIT(0x8A, RBX_DISP8(AH), FLAGS_OFFSET, 0x9E, // mov ah, flags then SAHF
+       0xFE, decrement ? 0xC8 : 0xC0,           // inc/dec al
+       0x9F);
+  if (decrement) {
+    EMIT(0x80, 0xF4, 0x10);
+  }
+  EMIT(0x88, RBX_DISP8(AH), FLAGS_OFFSET);
+}
+
+// Reads a register or memory field into al or dl
+static void emit_get(struct i8080_jit *jit, uint host, uint reg) {
+  if (reg == 6) {
+    emit_load_address(jit, HL_OFFSET);
+    emit_read(jit, host);
+  } else {
+    EMIT(0x8A, RBX_DISP8(host), reg_offset(reg));
+  }
+}
+
+static int is_volatile(struct i8080_jit *jit, uint addr) {
+  return jit->code_writes[addr & 0xFFFF] >= VOLATILE_WRITES;
+}
+
+// Loads an immediate operand into a byte register, from memory if it is
+// written at run time
+static void emit_operand(struct i8080_jit *jit, uint reg, uint addr, uint val) {
+  if (is_volatile(jit, addr)) {
+    EMIT(0x41, 0x8A, 0x84 | (reg << 3), 0x24); // mov reg, [r12 + disp32]
+    emit32(jit, addr);
+  } else {
+    EMIT(0xB0 | reg, val);
+  }
+}
+
+// IN and OUT as the interpreter runs them, after the cycles are counted
+static void jit_in(struct i8080 *cpu, uint dev) {
+  if (cpu->input_handler != NULL) {
+    cpu->A = cpu->input_handler(cpu, dev);
+
+    if (cpu->exit_reason == I8080_EXIT_IO) {
+      cpu->exit_port = dev;
+    }
+  }
+}
+
+static void jit_out(struct i8080 *cpu, uint dev) {
+  if (cpu->output_handler != NULL) {
+    cpu->output_handler(cpu, dev, cpu->A);
+
+    if (cpu->exit_reason == I8080_EXIT_IO) {
+      cpu->exit_port = dev;
+    }
+  }
+}
+
+// Translates one instruction, returning 0 to leave it to the interpreter
+// and setting *ends to stop the block after it
+static int emit_instruction(struct i8080_jit *jit, uint8_t *memory, uint pc, uint *length, int *ends) {
+  uint opcode = memory[pc];
+  uint byte = memory[(pc + 1) & 0xFFFF];
+  uint word = byte | (memory[(pc + 2) & 0xFFFF] << 8);
+  uint cycles;
+
+  *ends = 0;
+  *length = 1;
+
+  if (opcode >= 0x40 && opcode < 0x80) {
+    // MOV, with 0x76 HLT left to the interpreter
+    uint dst = (opcode >> 3) & 0x07;
+    uint src = opcode & 0x07;
+
+    if (opcode == 0x76) {
+      return 0;
+    }
+
+    cycles = (dst == 6 || src == 6) ? 7 : 5;
+
+    if (dst == 6) {
+      EMIT(0x8A, RBX_DISP8(DL), reg_offset(src));
+      emit_load_address(jit, HL_OFFSET);
+      emit_write(jit);
+      jit->block_cycles += cycles;
+      emit_check_invalidated(jit, (pc + 1) & 0xFFFF);
+      return 1;
+    }
+
+    emit_get(jit, AL, src);
+    EMIT(0x88, RBX_DISP8(AL), reg_offset(dst));
+    jit->block_cycles += cycles;
+    return 1;
+  }
+
+  if (opcode >= 0x80 && opcode < 0xC0) {
+    emit_get(jit, DL, opcode & 0x07);
+    emit_alu(jit, (opcode >> 3) & 0x07);
+    jit->block_cycles += (opcode & 0x07) == 6 ? 7 : 4;
+    return 1;
+  }
+
+  uint reg = (opcode >> 3) & 0x07;
+  uint reg_pair = (opcode >> 4) & 0x03;
+
+  if (opcode < 0x40) {
+    switch (opcode & 0x0F) {
+      case 0x00: case 0x08: // NOP
+        jit->block_cycles += 4;
+        return 1;
+
+      case 0x01: // LXI
+        *length = 3;
+        EMIT(0x66, 0xC7, RBX_DISP8(0), pair_offset(reg_pair), word & 0xFF, word >> 8);
+        jit->block_cycles += 10;
+        return 1;
+
+      case 0x03: // INX
+        EMIT(0x66, 0xFF, RBX_DISP8(0), pair_offset(reg_pair));
+        jit->block_cycles += 5;
+        return 1;
+
+      case 0x0B: // DCX
+        EMIT(0x66, 0xFF, RBX_DISP8(1), pair_offset(reg_pair));
+        jit->block_cycles += 5;
+        return 1;
+
+      case 0x09: // DAD, carry from bit 16 into the flags
+        EMIT(0x0F, 0xB7, RBX_DISP8(EAX), HL_OFFSET,
+             0x0F, 0xB7, RBX_DISP8(ECX), pair_offset(reg_pair),
+             0x01, 0xC8,                         // add eax, ecx
+             0x66, 0x89, RBX_DISP8(EAX), HL_OFFSET,
+             0xC1, 0xE8, 0x10,                   // shr eax, 16
+             0x80, 0x63, FLAGS_OFFSET, 0xFE,     // and byte flags, ~1
+             0x08, RBX_DISP8(AL), FLAGS_OFFSET); // or flags, al
+        jit->block_cycles += 10;
+        return 1;
+
+      case 0x04: case 0x0C: // INR
+      case 0x05: case 0x0D: // DCR
+        if (reg == 6) {
+          emit_get(jit, AL, 6);
+          emit_inr_dcr_al(jit, opcode & 1);
+          EMIT(0x88, 0xC2); // mov dl, al
+          emit_load_address(jit, HL_OFFSET);
+          emit_write(jit);
+          jit->block_cycles += 10;
+          emit_check_invalidated(jit, (pc + 1) & 0xFFFF);
+        } else {
+          EMIT(0x8A, RBX_DISP8(AL), reg_offset(reg));
+          emit_inr_dcr_al(jit, opcode & 1);
+          EMIT(0x88, RBX_DISP8(AL), reg_offset(reg));
+          jit->block_cycles += 5;
+        }
+        return 1;
+
+      case 0x06: case 0x0E: // MVI
+        *length = 2;
+        if (reg == 6) {
+          emit_operand(jit, DL, (pc + 1) & 0xFFFF, byte);
+          emit_load_address(jit, HL_OFFSET);
+          emit_write(jit);
+          jit->block_cycles += 10;
+          emit_check_invalidated(jit, (pc + 2) & 0xFFFF);
+        } else {
+          emit_operand(jit, AL, (pc + 1) & 0xFFFF, byte);
+          EMIT(0x88, RBX_DISP8(AL), reg_offset(reg));
+          jit->block_cycles += 7;
+        }
+        return 1;
+
+      case 0x07: case 0x0F: // RLC, RRC, RAL, RAR only change the carry
+        if (opcode == 0x27 || opcode == 0x2F || opcode == 0x37 || opcode == 0x3F) {
+          break;
+        }
+        EMIT(0x8A, RBX_DISP8(AH), FLAGS_OFFSET, 0x9E,
+             0xD0, RBX_DISP8(reg), A_OFFSET, // rol, ror, rcl or rcr byte A, 1
+             0x9F,
+             0x88, RBX_DISP8(AH), FLAGS_OFFSET);
+        jit->block_cycles += 4;
+        return 1;
+    }
+
+    switch (opcode) {
+      case 0x02: case 0x12: // STAX
+        EMIT(0x8A, RBX_DISP8(DL), A_OFFSET);
+        emit_load_address(jit, pair_offset(reg_pair));
+        emit_write(jit);
+        jit->block_cycles += 7;
+        emit_check_invalidated(jit, (pc + 1) & 0xFFFF);
+        return 1;
+
+      case 0x0A: case 0x1A: // LDAX
+        emit_load_address(jit, pair_offset(reg_pair));
+        emit_read(jit, EAX);
+        EMIT(0x88, RBX_DISP8(AL), A_OFFSET);
+        jit->block_cycles += 7;
+        return 1;
+
+      case 0x22: // SHLD
+      case 0x2A: // LHLD
+        *length = 3;
+        if (word == 0xFFFF) {
+          return 0;
+        }
+        for (uint i=0;i<2;i++) {
+          EMIT(0xB9);
+          emit32(jit, word + i);
+          if (opcode == 0x22) {
+            EMIT(0x8A, RBX_DISP8(DL), reg_offset(5 - i));
+            emit_write(jit);
+          } else {
+            emit_read(jit, EAX);
+            EMIT(0x88, RBX_DISP8(AL), reg_offset(5 - i));
+          }
+        }
+        jit->block_cycles += 16;
+        if (opcode == 0x22) {
+          emit_check_invalidated(jit, (pc + 3) & 0xFFFF);
+        }
+        return 1;
+
+      case 0x32: // STA
+        *length = 3;
+        EMIT(0x8A, RBX_DISP8(DL), A_OFFSET, 0xB9);
+        emit32(jit, word);
+        emit_write(jit);
+        jit->block_cycles += 13;
+        emit_check_invalidated(jit, (pc + 3) & 0xFFFF);
+        return 1;
+
+      case 0x3A: // LDA
+        *length = 3;
+        EMIT(0xB9);
+        emit32(jit, word);
+        emit_read(jit, EAX);
+        EMIT(0x88, RBX_DISP8(AL), A_OFFSET);
+        jit->block_cycles += 13;
+        return 1;
+
+      case 0x2F: // CMA
+        EMIT(0xF6, RBX_DISP8(2), A_OFFSET);
+        jit->block_cycles += 4;
+        return 1;
+
+      case 0x37: // STC
+        EMIT(0x80, RBX_DISP8(1), FLAGS_OFFSET, 0x01);
+        jit->block_cycles += 4;
+        return 1;
+
+      case 0x3F: // CMC
+        EMIT(0x80, RBX_DISP8(6), FLAGS_OFFSET, 0x01);
+        jit->block_cycles += 4;
+        return 1;
+    }
+
+    // DAA
+    return 0;
+  }
+
+  // 0xC0 - 0xFF
+  switch (opcode & 0x07) {
+    case 0x00: // Conditional return
+    {
+      uint8_t *not_taken = emit_condition(jit, opcode);
+      emit_pop(jit);
+      EMIT(0x66, 0x89, RBX_DISP8(EAX), CPU_OFFSET(PC));
+      emit_exit(jit, -1, 11);
+      patch_here(jit, not_taken);
+      emit_exit(jit, (pc + 1) & 0xFFFF, 5);
+      *ends = 1;
+      return 1;
+    }
+
+    case 0x02: // Conditional jump
+    {
+      *length = 3;
+      uint8_t *not_taken = emit_condition(jit, opcode);
+      emit_exit(jit, word, 10);
+      patch_here(jit, not_taken);
+      emit_exit(jit, (pc + 3) & 0xFFFF, 10);
+      *ends = 1;
+      return 1;
+    }
+
+    case 0x04: // Conditional call
+    {
+      *length = 3;
+      uint8_t *not_taken = emit_condition(jit, opcode);
+      emit_push(jit, -1, -1, (pc + 3) & 0xFFFF);
+      emit_exit(jit, word, 17);
+      patch_here(jit, not_taken);
+      emit_exit(jit, (pc + 3) & 0xFFFF, 11);
+      *ends = 1;
+      return 1;
+    }
+
+    case 0x06: // ADI, ACI, SUI, SBI, ANI, XRI, ORI, CPI
+      *length = 2;
+      emit_operand(jit, DL, (pc + 1) & 0xFFFF, byte);
+      emit_alu(jit, reg);
+      jit->block_cycles += 7;
+      return 1;
+
+    case 0x07: // RST
+      emit_push(jit, -1, -1, (pc + 1) & 0xFFFF);
+      emit_exit(jit, opcode & 0x38, 11);
+      *ends = 1;
+      return 1;
+
+    case 0x01:
+      if (opcode == 0xE9) { // PCHL
+        EMIT(0x0F, 0xB7, RBX_DISP8(EAX), HL_OFFSET,
+             0x66, 0x89, RBX_DISP8(EAX), CPU_OFFSET(PC));
+        emit_exit(jit, -1, 5);
+        *ends = 1;
+      } else if (opcode == 0xF9) { // SPHL
+        EMIT(0x0F, 0xB7, RBX_DISP8(EAX), HL_OFFSET,
+             0x66, 0x89, RBX_DISP8(EAX), CPU_OFFSET(SP));
+        jit->block_cycles += 5;
+      } else if (opcode & 0x08) { // RET
+        emit_pop(jit);
+        EMIT(0x66, 0x89, RBX_DISP8(EAX), CPU_OFFSET(PC));
+        emit_exit(jit, -1, 11);
+        *ends = 1;
+      } else if (opcode == 0xF1) { // POP PSW
+        emit_pop(jit);
+        EMIT(0x0C, 0x02, // or al, 2
+             0x24, 0xD7, // and al, 0xD7
+             0x88, RBX_DISP8(AL), FLAGS_OFFSET,
+             0x88, RBX_DISP8(AH), A_OFFSET);
+        jit->block_cycles += 10;
+      } else { // POP
+        emit_pop(jit);
+        EMIT(0x66, 0x89, RBX_DISP8(EAX), pair_offset(reg_pair));
+        jit->block_cycles += 10;
+      }
+      return 1;
+
+    case 0x03:
+      switch (opcode) {
+        case 0xC3: case 0xCB: // JMP
+          *length = 3;
+          emit_exit(jit, word, 10);
+          *ends = 1;
+          return 1;
+
+        case 0xD3: // OUT
+        case 0xDB: // IN
+        {
+          *length = 2;
+          jit->block_cycles += 10;
+          EMIT(0x81, RBX_DISP8(0), CPU_OFFSET(cyc));
+          emit32(jit, jit->block_cycles);
+          jit->block_cycles = 0;
+          EMIT(0x66, 0xC7, RBX_DISP8(0), CPU_OFFSET(PC), (pc + 2) & 0xFF, ((pc + 2) >> 8) & 0xFF,
+               0x48, 0x89, 0xDF, // mov rdi, rbx
+               0xBE);            // mov esi, port
+          emit32(jit, byte);
+
+          emit_call(jit, opcode == 0xDB ? (void *) jit_in : (void *) jit_out);
+          emit_exit(jit, -1, 0);
+          *ends = 1;
+          return 1;
+        }
+
+        case 0xEB: // XCHG
+          EMIT(0x0F, 0xB7, RBX_DISP8(EAX), HL_OFFSET,
+               0x0F, 0xB7, RBX_DISP8(ECX), CPU_OFFSET(DE),
+               0x66, 0x89, RBX_DISP8(ECX), HL_OFFSET,
+               0x66, 0x89, RBX_DISP8(EAX), CPU_OFFSET(DE));
+          jit->block_cycles += 5;
+          return 1;
+
+        case 0xF3: // DI
+        case 0xFB: // EI
+          EMIT(0xC7, RBX_DISP8(0), CPU_OFFSET(INTE));
+          emit32(jit, opcode == 0xFB);
+          jit->block_cycles += 4;
+          return 1;
+      }
+
+      // XTHL
+      return 0;
+
+    case 0x05:
+      if (opcode & 0x08) { // CALL
+        *length = 3;
+        emit_push(jit, -1, -1, (pc + 3) & 0xFFFF);
+        emit_exit(jit, word, 17);
+        *ends = 1;
+      } else if (opcode == 0xF5) { // PUSH PSW
+        emit_push(jit, A_OFFSET, FLAGS_OFFSET, 0);
+        jit->block_cycles += 11;
+        emit_check_invalidated(jit, (pc + 1) & 0xFFFF);
+      } else { // PUSH
+        emit_push(jit, pair_offset(reg_pair) + 1, pair_offset(reg_pair), 0);
+        jit->block_cycles += 11;
+        emit_check_invalidated(jit, (pc + 1) & 0xFFFF);
+      }
+      return 1;
+  }
+
+  return 0;
+}
+
+// Only MVI and the immediate ALU instructions can have a volatile operand
+static int translatable(struct i8080_jit *jit, uint8_t *memory, uint pc) {
+  uint opcode = memory[pc];
+  uint length = i8080_opcodes[opcode].length;
+
+  if (is_volatile(jit, pc)) {
+    return 0;
+  }
+
+  if ((opcode & 0xC7) == 0x06 || (opcode & 0xC7) == 0xC6) {
+    return 1;
+  }
+
+  for (uint i=1;i<length;i++) {
+    if (is_volatile(jit, pc + i)) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+static void flush(struct i8080_jit *jit) {
+  memset(jit->code_pages, 0, sizeof(jit->code_pages));
+  memset(jit->map, 0, sizeof(jit->map));
+  memset(jit->page_links, 0, sizeof(jit->page_links));
+
+  jit->block_count = 0;
+  jit->link_count = 0;
+  jit->code_free = jit->code;
+}
+
+static void link_page(struct i8080_jit *jit, struct jit_block *block, uint page) {
+  struct jit_link *link = &jit->links[jit->link_count++];
+
+  link->block = block;
+  link->next = jit->page_links[page];
+  jit->page_links[page] = link;
+  jit->code_pages[page] = 1;
+}
+
+// Sets the protection of the host pages holding size bytes of code at start
+static void protect_code(struct i8080_jit *jit, uint8_t *start, size_t size, int protection) {
+  uintptr_t first = (uintptr_t) start & ~(jit->host_page_size - 1);
+  uintptr_t end = (uintptr_t) (start + size);
+
+  if (mprotect((void *) first, end - first, protection) != 0) {
+    perror("mprotect");
+    exit(1);
+  }
+}
+
+// Copies the emitted block into the code buffer, returning where it went
+static uint8_t *install_code(struct i8080_jit *jit) {
+  uint8_t *code = jit->code_free;
+  size_t size = jit->code_ptr - jit->scratch;
+
+  protect_code(jit, code, size, PROT_READ | PROT_WRITE);
+  memcpy(code, jit->scratch, size);
+  protect_code(jit, code, size, PROT_READ | PROT_EXEC);
+
+  jit->code_free += size;
+  return code;
+}
+
+static struct jit_block *translate(struct i8080_jit *jit, struct i8080 *cpu) {
+  if (jit->block_count == MAX_BLOCKS ||
+      jit->code_free + CODE_RESERVE > jit->code + CODE_BUFFER_SIZE) {
+    flush(jit);
+    jit->stats.flushes++;
+  }
+
+  uint8_t *memory = (uint8_t *) cpu->memory;
+  uint pc = cpu->PC;
+  uint count = 0;
+  uint max_cycles = 0;
+  int ends = 0;
+
+  jit->code_ptr = jit->scratch;
+
+  // push rbx, push r12, push r13, mov rbx, rdi, mov r12, [rbx + memory]
+  // and mov r13, jit
+  EMIT(0x53, 0x41, 0x54, 0x41, 0x55, 0x48, 0x89, 0xFB,
+       0x4C, 0x8B, 0x63, CPU_OFFSET(memory), 0x49, 0xBD);
+  emit64(jit, (uint64_t) (uintptr_t) jit);
+
+  jit->block_cycles = 0;
+
+  // Instructions running past 0xFFFF are left to the interpreter
+  while (!ends && count < MAX_BLOCK_INSTRUCTIONS && pc < 0xFFFD) {
+    uint length;
+    uint before = jit->block_cycles;
+    uint8_t *code = jit->code_ptr;
+
+    if (!translatable(jit, memory, pc) ||
+        !emit_instruction(jit, memory, pc, &length, &ends)) {
+      jit->code_ptr = code;
+      break;
+    }
+
+    // Exits add their own cycles, and no instruction that ends a block takes
+    // more than 17
+    max_cycles += ends ? 17 : jit->block_cycles - before;
+
+    pc += length;
+    count++;
+  }
+
+  if (count == 0) {
+    return NULL;
+  }
+
+  if (!ends) {
+    emit_exit(jit, pc, 0);
+  }
+
+  struct jit_block *block = &jit->blocks[jit->block_count++];
+  block->pc = cpu->PC;
+  block->length = pc - cpu->PC;
+  block->max_cycles = max_cycles;
+  block->dead = 0;
+  block->code = (void (*)(struct i8080 *)) install_code(jit);
+
+  uint first_page = block->pc >> PAGE_SHIFT;
+  uint last_page = (pc - 1) >> PAGE_SHIFT;
+  link_page(jit, block, first_page);
+  if (last_page != first_page) {
+    link_page(jit, block, last_page);
+  }
+
+  jit->map[block->pc] = block;
+  jit->stats.translations++;
+
+  return block;
+}
+
+void i8080_jit_run(struct i8080 *cpu) {
+  struct i8080_jit *jit = cpu->jit;
+
+  while ((int) (cpu->run_end - cpu->cyc) > 0) {
+    struct jit_block *block = jit->map[cpu->PC];
+
+    if (block == NULL) {
+      block = translate(jit, cpu);
+    }
+
+    // Blocks only run when they cannot overrun the budget
+    if (block == NULL || (int) (cpu->run_end - cpu->cyc) <= (int) block->max_cycles) {
+      i8080_step(cpu);
+      continue;
+    }
+
+    i8080_sync_flags(cpu);
+
+    jit->running = block;
+    jit->invalidated = 0;
+    block->code(cpu);
+    jit->running = NULL;
+  }
+}
+
+void i8080_jit_invalidate(struct i8080 *cpu, uint addr, uint data) {
+  struct i8080_jit *jit = cpu->jit;
+  uint page;
+  int hit = 0;
+
+  addr &= 0xFFFF;
+  page = addr >> PAGE_SHIFT;
+
+  if (!jit->code_pages[page] || is_volatile(jit, addr) ||
+      (cpu->memory[addr] & 0xFF) == (data & 0xFF)) {
+    return;
+  }
+
+  // Unlink the blocks holding addr, and any already dropped through the
+  // other page they covered
+  struct jit_link **link = &jit->page_links[page];
+  while (*link != NULL) {
+    struct jit_block *block = (*link)->block;
+
+    if (!block->dead && ((addr - block->pc) & 0xFFFF) < block->length) {
+      block->dead = 1;
+      jit->map[block->pc] = NULL;
+      jit->stats.invalidations++;
+      hit = 1;
+
+      if (block == jit->running) {
+        jit->invalidated = 1;
+      }
+    }
+
+    if (block->dead) {
+      *link = (*link)->next;
+    } else {
+      link = &(*link)->next;
+    }
+  }
+
+  jit->code_pages[page] = jit->page_links[page] != NULL;
+
+  if (hit) {
+    jit->code_writes[addr]++;
+  }
+}
+
+struct i8080_jit *i8080_jit_create(void) {
+  struct i8080_jit *jit = malloc(sizeof(struct i8080_jit));
+  if (jit == NULL) {
+    perror("malloc");
+    exit(1);
+  }
+
+  jit->code = mmap(NULL, CODE_BUFFER_SIZE, PROT_READ | PROT_EXEC,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (jit->code == MAP_FAILED) {
+    perror("mmap");
+    exit(1);
+  }
+
+  jit->host_page_size = sysconf(_SC_PAGESIZE);
+  jit->running = NULL;
+  jit->invalidated = 0;
+  memset(jit->code_writes, 0, sizeof(jit->code_writes));
+  memset(&jit->stats, 0, sizeof(jit->stats));
+  flush(jit);
+
+  return jit;
+}
+
+void i8080_jit_destroy(struct i8080_jit *jit) {
+  munmap(jit->code, CODE_BUFFER_SIZE);
+  free(jit);
+}
+
+void i8080_set_jit(struct i8080 *cpu, struct i8080_jit *jit) {
+  if (jit != NULL) {
+    if (cpu->memsize < 0x10000) {
+      fprintf(stderr, "The JIT needs 64K of memory\n");
+      exit(1);
+    }
+
+    flush(jit);
+    memset(jit->code_writes, 0, sizeof(jit->code_writes));
+  }
+
+  cpu->jit = jit;
+}
+
+struct i8080_jit_stats i8080_jit_get_stats(struct i8080_jit *jit) {
+  return jit->stats;
+}
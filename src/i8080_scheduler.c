@@ -0,0 +1,201 @@
+#include <stddef.h>
+
+#include "i8080_scheduler.h"
+
+#define SLOT_CYCLES ((uint64_t) 1 << I8080_WHEEL_SHIFT)
+#define SLOT(CYCLE) (((CYCLE) >> I8080_WHEEL_SHIFT) & (I8080_WHEEL_SLOTS - 1))
+
+#if I8080_WHEEL_SLOTS & (I8080_WHEEL_SLOTS - 1)
+#error "I8080_WHEEL_SLOTS must be a power of two"
+#endif
+
+void i8080_event_init(struct i8080_event *event, i8080_event_handler handler, void *state) {
+  event->handler = handler;
+  event->state = state;
+  event->deadline = 0;
+  event->pending = 0;
+  event->next = NULL;
+}
+
+void i8080_scheduler_init(struct i8080_scheduler *scheduler, struct i8080 *cpu) {
+  scheduler->cpu = cpu;
+  scheduler->now = 0;
+  scheduler->fired = 0;
+  scheduler->last_cyc = cpu->cyc;
+
+  for (int i=0;i<I8080_WHEEL_SLOTS;i++) {
+    scheduler->slots[i] = NULL;
+  }
+}
+
+// cyc wraps at 32 bits, which takes a little over half an hour at 2 MHz, so
+// the clock adds the cycles since it was last brought up to date
+static void update_clock(struct i8080_scheduler *scheduler) {
+  uint cyc = scheduler->cpu->cyc;
+
+  scheduler->now += cyc - scheduler->last_cyc;
+  scheduler->last_cyc = cyc;
+}
+
+uint64_t i8080_scheduler_now(struct i8080_scheduler *scheduler) {
+  update_clock(scheduler);
+  return scheduler->now;
+}
+
+static void unlink_event(struct i8080_scheduler *scheduler, struct i8080_event *event) {
+  struct i8080_event **link = &scheduler->slots[SLOT(event->deadline)];
+
+  while (*link != event) {
+    link = &(*link)->next;
+  }
+
+  *link = event->next;
+  event->next = NULL;
+  event->pending = 0;
+}
+
+void i8080_schedule(struct i8080_scheduler *scheduler, struct i8080_event *event, uint64_t delay) {
+  struct i8080 *cpu = scheduler->cpu;
+
+  if (event->pending) {
+    unlink_event(scheduler, event);
+  }
+
+  update_clock(scheduler);
+
+  event->deadline = scheduler->now + delay;
+  event->pending = 1;
+
+  uint slot = SLOT(event->deadline);
+  event->next = scheduler->slots[slot];
+  scheduler->slots[slot] = event;
+
+  // Pull the end of a run in progress back to the deadline, as HLT and
+  // i8080_yield do
+  int remaining = (int) (cpu->run_end - cpu->cyc);
+  if (remaining > 0 && delay < (uint) remaining) {
+    cpu->run_end = cpu->cyc + (uint) delay;
+  }
+}
+
+void i8080_cancel(struct i8080_scheduler *scheduler, struct i8080_event *event) {
+  if (event->pending) {
+    unlink_event(scheduler, event);
+  }
+}
+
+// Calls the events due by now, earliest first. Only the slots passed since
+// the last call can hold them, and handlers can schedule more, so the slots
+// are searched again after each call.
+static void fire_due(struct i8080_scheduler *scheduler) {
+  uint64_t turns = (scheduler->now >> I8080_WHEEL_SHIFT) - (scheduler->fired >> I8080_WHEEL_SHIFT);
+  uint count = turns >= I8080_WHEEL_SLOTS ? I8080_WHEEL_SLOTS : (uint) turns + 1;
+  uint first = SLOT(scheduler->fired);
+
+  for (;;) {
+    struct i8080_event **earliest = NULL;
+
+    for (uint i=0;i<count;i++) {
+      struct i8080_event **link = &scheduler->slots[(first + i) & (I8080_WHEEL_SLOTS - 1)];
+
+      for (;*link!=NULL;link=&(*link)->next) {
+        uint64_t deadline = (*link)->deadline;
+
+        if (deadline <= scheduler->now && (earliest == NULL || deadline < (*earliest)->deadline)) {
+          earliest = link;
+        }
+      }
+    }
+
+    if (earliest == NULL) {
+      break;
+    }
+
+    struct i8080_event *event = *earliest;
+    *earliest = event->next;
+    event->next = NULL;
+    event->pending = 0;
+
+    event->handler(event, event->state);
+  }
+
+  scheduler->fired = scheduler->now;
+}
+
+// Finds the earliest deadline by looking through the slots in turn from the
+// current one, only counting events due in this turn of the wheel, and
+// through every event if none are
+static int next_deadline(struct i8080_scheduler *scheduler, uint64_t *deadline) {
+  uint64_t slot_end = (scheduler->now | (SLOT_CYCLES - 1)) + 1;
+  uint first = SLOT(scheduler->now);
+  struct i8080_event *earliest = NULL;
+
+  for (uint i=0;i<I8080_WHEEL_SLOTS && earliest==NULL;i++) {
+    struct i8080_event *event = scheduler->slots[(first + i) & (I8080_WHEEL_SLOTS - 1)];
+
+    for (;event!=NULL;event=event->next) {
+      if (event->deadline < slot_end && (earliest == NULL || event->deadline < earliest->deadline)) {
+        earliest = event;
+      }
+    }
+
+    slot_end += SLOT_CYCLES;
+  }
+
+  for (uint i=0;i<I8080_WHEEL_SLOTS && earliest==NULL;i++) {
+    struct i8080_event *event = scheduler->slots[i];
+
+    for (;event!=NULL;event=event->next) {
+      if (earliest == NULL || event->deadline < earliest->deadline) {
+        earliest = event;
+      }
+    }
+  }
+
+  if (earliest == NULL) {
+    return 0;
+  }
+
+  *deadline = earliest->deadline;
+  return 1;
+}
+
+struct i8080_exit i8080_scheduler_run(struct i8080_scheduler *scheduler, uint max_cycles) {
+  update_clock(scheduler);
+  fire_due(scheduler);
+
+  uint budget = max_cycles;
+  uint64_t deadline;
+
+  if (next_deadline(scheduler, &deadline) && deadline - scheduler->now < budget) {
+    budget = (uint) (deadline - scheduler->now);
+  }
+
+  struct i8080_exit result = i8080_run(scheduler->cpu, budget);
+
+  update_clock(scheduler);
+
+  // Time still passes while halted
+  if (result.reason == I8080_EXIT_HALT && result.cycles < budget) {
+    scheduler->now += budget - result.cycles;
+  }
+
+  fire_due(scheduler);
+
+  return result;
+}
+
+void i8080_scheduler_skip(struct i8080_scheduler *scheduler, uint cycles) {
+  update_clock(scheduler);
+  fire_due(scheduler);
+
+  uint64_t end = scheduler->now + cycles;
+  uint64_t deadline;
+
+  while (next_deadline(scheduler, &deadline) && deadline <= end) {
+    scheduler->now = deadline;
+    fire_due(scheduler);
+  }
+
+  scheduler->now = end;
+}
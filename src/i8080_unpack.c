@@ -0,0 +1,78 @@
+#include <string.h>
+
+#include "i8080_unpack.h"
+
+// Adds the bytes extending a nibble of 15, returning 0 if they run past the
+// end
+static int extend(const uint8_t **in, const uint8_t *end, size_t *length) {
+  uint byte;
+
+  do {
+    if (*in >= end) {
+      return 0;
+    }
+    byte = *(*in)++;
+    *length += byte;
+  } while (byte == 255);
+
+  return 1;
+}
+
+size_t i8080_unpack(char *memory, size_t size, const uint8_t *packed, size_t packed_size) {
+  const uint8_t *in = packed;
+  const uint8_t *end = packed + packed_size;
+  char *out = memory;
+  char *out_end = memory + size;
+
+  while (in < end) {
+    uint token = *in++;
+    size_t literals = token >> 4;
+    size_t length = token & 15;
+
+    if (literals == 15 && !extend(&in, end, &literals)) {
+      return 0;
+    }
+    if (literals > (size_t) (end - in) || literals > (size_t) (out_end - out)) {
+      return 0;
+    }
+
+    memcpy(out, in, literals);
+    in += literals;
+    out += literals;
+
+    if (in == end) {
+      break;
+    }
+    if (end - in < 2) {
+      return 0;
+    }
+
+    size_t offset = in[0] | (in[1] << 8);
+    in += 2;
+
+    if (length == 15 && !extend(&in, end, &length)) {
+      return 0;
+    }
+    length += I8080_UNPACK_MIN_MATCH;
+
+    if (length > (size_t) (out_end - out) || offset > (size_t) (out - memory)) {
+      return 0;
+    }
+
+    if (offset == 0) {
+      memset(out, 0, length);
+      out += length;
+    } else if (offset >= length) {
+      memcpy(out, out - offset, length);
+      out += length;
+    } else {
+      // Overlapping, so each byte may be one just written
+      const char *from = out - offset;
+      while (length-- > 0) {
+        *out++ = *from++;
+      }
+    }
+  }
+
+  return out - memory;
+}
@@ -12,17 +12,53 @@
 #include "em_usb.h"
 
 #include "i8080.h"
+#include "i8080_io.h"
+#include "i8080_scheduler.h"
+#include "i8080_unpack.h"
 #include "audiomoth.h"
 #include "usbserial.h"
 
+#ifdef I8080_LAZY_MEMORY
 #include "basicdisk24k50.h"
+#else
+#include "basicdisk24k50_packed.h"
+#endif
 
-/* Sleep and LED constants */
+/* Sleep and LED constants, thresholds in emulated cycles */
 
 #define DEFAULT_WAIT_INTERVAL                   200
-#define LED_FLASH_THRESHOLD                     50000
-#define SWITCH_CHANGE_THRESHOLD                 200000
-#define LINE_PRINTER_THRESHOLD                  200000
+#define LED_FLASH_THRESHOLD                     350000
+#define SWITCH_CHANGE_THRESHOLD                 1400000
+#define LINE_PRINTER_THRESHOLD                  1400000
+#define DISK_WRITE_THRESHOLD                    200000
+
+/* Emulated cycles between switch checks and watchdog feeds, and most run between returns to the main loop */
+
+#define SWITCH_CHECK_INTERVAL                   20000
+#define WATCHDOG_INTERVAL                       20000
+#define SLICE_CYCLES                            20000
+
+/* Idle detection, with status polls closer than the gap in emulated cycles counting as a tight loop */
+
+#define IDLE_POLL_GAP                           100
+#define IDLE_POLL_THRESHOLD                     1000
+#define IDLE_SLEEP_INTERVAL                     5
+#define CYCLES_PER_MILLISECOND                  2000
+
+/* Speed governor, as a multiple of the authentic 2 MHz or 0 to run unthrottled, with the pacing interval in emulated cycles and the most the governor lets the emulator fall behind in milliseconds */
+
+#ifndef SPEED_MULTIPLE
+#define SPEED_MULTIPLE                          1
+#endif
+
+#define GOVERNOR_INTERVAL                       20000
+#define GOVERNOR_MAXIMUM_LAG                    100
+
+#if SPEED_MULTIPLE > 0
+#define TARGET_CYCLES_PER_MILLISECOND           (CYCLES_PER_MILLISECOND * SPEED_MULTIPLE)
+#else
+#define TARGET_CYCLES_PER_MILLISECOND           CYCLES_PER_MILLISECOND
+#endif
 
 /* USB CDC constants */
 
@@ -39,6 +75,10 @@
 
 #define LINE_PRINTER_BUFFER_SIZE                1024
 
+#define TELEPRINTER_BUFFER_SIZE                 256
+
+#define DISK_WRITE_QUEUE_SIZE                   16
+
 /* Disk controller status bits */
 
 #define DISK_STATUS_WRITE_CIRCUIT_READY         0x01
@@ -68,7 +108,15 @@
 
 static struct i8080 cpu;
 
-static volatile bool sendingToTeleprinter;
+static struct i8080_scheduler scheduler;
+
+#ifdef I8080_PRECOMPILED
+static struct i8080_precompiled precompiled;
+#endif
+
+#ifdef I8080_PAGE_CACHE
+static struct i8080_page_cache pageCache;
+#endif
 
 /* Disk state */
 
@@ -85,6 +133,21 @@ static char filename[FILE_NAME_BUFFER_LENGTH];
 
 static bool checkedExistence[MAX_NUMBER_OF_DISKS];
 
+/* Disk write queue, with sectors written by the guest held here until the SD card has time for them */
+
+typedef struct {
+    uint32_t disk;
+    uint32_t track;
+    uint32_t sector;
+    uint8_t data[DISK_SECTOR_SIZE];
+} diskWrite_t;
+
+static uint32_t diskWriteQueueReadIndex;
+
+static uint32_t diskWriteQueueWriteIndex;
+
+static diskWrite_t diskWriteQueue[DISK_WRITE_QUEUE_SIZE];
+
 /* Serial buffer */
 
 static volatile uint32_t serialBufferReadIndex;
@@ -99,6 +162,16 @@ static volatile uint32_t linePrinterBufferWriteIndex;
 
 static char linePrinterBuffer[LINE_PRINTER_BUFFER_SIZE];
 
+/* Teleprinter buffer, filled by the guest and emptied by the USB data sent callback */
+
+static volatile bool sendingToTeleprinter;
+
+static volatile uint32_t teleprinterBufferReadIndex;
+
+static volatile uint32_t teleprinterBufferWriteIndex;
+
+static char teleprinterBuffer[TELEPRINTER_BUFFER_SIZE];
+
 /* USB CDC state */
 
 STATIC_UBUF(usbRxBuffer, CDC_USB_BUF_SIZ);
@@ -199,11 +272,41 @@ static void stateChange(USBD_State_TypeDef oldState, USBD_State_TypeDef newState
 
 }
 
+/* Start sending the next run of the teleprinter buffer, from the main loop when nothing is being sent and from the data sent callback otherwise */
+
+static void sendToTeleprinter() {
+
+    uint32_t readIndex = teleprinterBufferReadIndex;
+
+    uint32_t writeIndex = teleprinterBufferWriteIndex;
+
+    uint32_t length = writeIndex >= readIndex ? writeIndex - readIndex : TELEPRINTER_BUFFER_SIZE - readIndex;
+
+    if (length > CDC_USB_BUF_SIZ) length = CDC_USB_BUF_SIZ;
+
+    if (length == 0) {
+
+        sendingToTeleprinter = false;
+
+        return;
+
+    }
+
+    memcpy(usbTxBuffer, teleprinterBuffer + readIndex, length);
+
+    teleprinterBufferReadIndex = (readIndex + length) % TELEPRINTER_BUFFER_SIZE;
+
+    sendingToTeleprinter = true;
+
+    USBD_Write(CDC_EP_DATA_IN, (void*)usbTxBuffer, length, UsbDataSent);
+
+}
+
 /* USB data sent and receive callbacks */
 
 static int UsbDataSent(USB_Status_TypeDef status, uint32_t xferred, uint32_t remaining) {
 
-    sendingToTeleprinter = false;
+    sendToTeleprinter();
 
     return USB_STATUS_OK;
 
@@ -273,7 +376,7 @@ inline void AudioMoth_timezoneRequested(int8_t *timezoneHours, int8_t *timezoneM
 
 /* Load and unload sector */
 
-static void checkAndCreateDiskImage() {
+static void checkAndCreateDiskImage(uint32_t disk) {
 
     bool exists = AudioMoth_doesFileExist(filename);
 
@@ -283,19 +386,21 @@ static void checkAndCreateDiskImage() {
 
         if (success == false) return;
 
-        memset(sectorBuffer, 0, DISK_SECTOR_SIZE);
+        uint8_t emptySector[DISK_SECTOR_SIZE];
+
+        memset(emptySector, 0, DISK_SECTOR_SIZE);
 
         for (uint32_t i = 0; i < DISK_NUMBER_OF_TRACKS; i += 1) {
 
             for (uint32_t j = 0; j < DISK_NUMBER_OF_SECTORS; j += 1) {
 
-                AudioMoth_writeToFile(sectorBuffer, DISK_SECTOR_SIZE);
+                AudioMoth_writeToFile(emptySector, DISK_SECTOR_SIZE);
 
             }
 
         }
 
-        checkedExistence[currentDisk] = true;
+        checkedExistence[disk] = true;
 
         AudioMoth_closeFile();
 
@@ -303,13 +408,41 @@ static void checkAndCreateDiskImage() {
 
 }
 
+static bool findQueuedSector() {
+
+    uint32_t index = diskWriteQueueWriteIndex;
+
+    while (index != diskWriteQueueReadIndex) {
+
+        index = (index + DISK_WRITE_QUEUE_SIZE - 1) % DISK_WRITE_QUEUE_SIZE;
+
+        diskWrite_t *write = &diskWriteQueue[index];
+
+        if (write->disk == currentDisk && write->track == currentTrack && write->sector == currentSector) {
+
+            memcpy(sectorBuffer, write->data, DISK_SECTOR_SIZE);
+
+            return true;
+
+        }
+
+    }
+
+    return false;
+
+}
+
 static void loadSector() {
 
+    /* A sector still waiting in the write queue is read back from there */
+
+    if (findQueuedSector()) return;
+
     AudioMoth_setRedLED(true);
 
     sprintf(filename, "DISK%02ld.DSK", currentDisk);
 
-    if (checkedExistence[currentDisk] == false) checkAndCreateDiskImage();
+    if (checkedExistence[currentDisk] == false) checkAndCreateDiskImage(currentDisk);
 
     bool success = AudioMoth_openFileToRead(filename);
 
@@ -325,124 +458,241 @@ static void loadSector() {
 
 }
 
+/* Write out the disk write queue, opening each disk image once for a run of sectors on the same disk */
+
+static struct i8080_event diskWriteFlushEvent;
+
+static void flushDiskWriteQueue() {
+
+    if (diskWriteFlushEvent.pending) i8080_cancel(&scheduler, &diskWriteFlushEvent);
+
+    if (diskWriteQueueReadIndex == diskWriteQueueWriteIndex) return;
+
+    AudioMoth_setRedLED(true);
+
+    while (diskWriteQueueReadIndex != diskWriteQueueWriteIndex) {
+
+        uint32_t disk = diskWriteQueue[diskWriteQueueReadIndex].disk;
+
+        sprintf(filename, "DISK%02ld.DSK", disk);
+
+        if (checkedExistence[disk] == false) checkAndCreateDiskImage(disk);
+
+        bool success = AudioMoth_openFileToEdit(filename);
+
+        while (diskWriteQueueReadIndex != diskWriteQueueWriteIndex && diskWriteQueue[diskWriteQueueReadIndex].disk == disk) {
+
+            diskWrite_t *write = &diskWriteQueue[diskWriteQueueReadIndex];
+
+            if (success) {
+
+                AudioMoth_seekInFile(write->track * DISK_TRACK_SIZE + write->sector * DISK_SECTOR_SIZE);
+
+                AudioMoth_writeToFile(write->data, DISK_SECTOR_SIZE);
+
+            }
+
+            diskWriteQueueReadIndex = (diskWriteQueueReadIndex + 1) % DISK_WRITE_QUEUE_SIZE;
+
+        }
+
+        if (success) AudioMoth_closeFile();
+
+    }
+
+    AudioMoth_setRedLED(false);
+
+}
+
+static void flushDiskWrites(struct i8080_event *event, void *state) {
+
+    flushDiskWriteQueue();
+
+}
+
 static void unloadSector() {
 
-    sprintf(filename, "DISK%02ld.DSK", currentDisk);
-  
-    if (checkedExistence[currentDisk] == false) checkAndCreateDiskImage();
+    uint32_t nextIndex = (diskWriteQueueWriteIndex + 1) % DISK_WRITE_QUEUE_SIZE;
 
-    bool success = AudioMoth_openFileToEdit(filename);
+    /* Only a full queue makes the guest wait for the SD card */
 
-    if (success == false) return;
+    if (nextIndex == diskWriteQueueReadIndex) flushDiskWriteQueue();
+
+    diskWrite_t *write = &diskWriteQueue[diskWriteQueueWriteIndex];
+
+    write->disk = currentDisk;
+
+    write->track = currentTrack;
+
+    write->sector = currentSector;
+
+    memcpy(write->data, sectorBuffer, DISK_SECTOR_SIZE);
+
+    diskWriteQueueWriteIndex = nextIndex;
+
+    if (diskWriteFlushEvent.pending == false) i8080_schedule(&scheduler, &diskWriteFlushEvent, DISK_WRITE_THRESHOLD);
+
+}
+
+/* Line printer buffer, shared by the line printer and the 0x31/0x33 printer, and written to the SD card a while after output starts */
+
+static struct i8080_event linePrinterFlushEvent;
+
+static void flushLinePrinter(struct i8080_event *event, void *state) {
 
     AudioMoth_setRedLED(true);
 
-    AudioMoth_seekInFile(currentTrack * DISK_TRACK_SIZE + currentSector * DISK_SECTOR_SIZE);
+    AudioMoth_appendFile("LINEPRINTER.TXT");
 
-    AudioMoth_writeToFile(sectorBuffer, DISK_SECTOR_SIZE);
+    AudioMoth_writeToFile(linePrinterBuffer, linePrinterBufferWriteIndex);
 
     AudioMoth_closeFile();
 
     AudioMoth_setRedLED(false);
 
+    linePrinterBufferWriteIndex = 0;
+
 }
 
-/* Intel 8080 IN and OUT handlers */
+static void writeToLinePrinter(char data) {
 
-uint handle_input(struct i8080 *cpu, uint device) {
+    linePrinterBuffer[linePrinterBufferWriteIndex++] = data;
 
-    if (device == 0x02) {
-        
-        return 0xFF;
-        
-    } else if (device == 0x10) {
+    if (linePrinterFlushEvent.pending == false) i8080_schedule(&scheduler, &linePrinterFlushEvent, LINE_PRINTER_THRESHOLD);
 
-        return (sendingToTeleprinter ? 0x00 : 0x02) | (serialBufferReadIndex == serialBufferWriteIndex ? 0x00 : 0x01);
+}
 
-    } else if (device == 0x11) {
+static void writeLinePrinterNewLine() {
 
-        if (serialBufferReadIndex == serialBufferWriteIndex) return 0x00;
+    writeToLinePrinter('\r');
 
-        uint8_t data = serialBuffer[serialBufferReadIndex];
-        
-        serialBufferReadIndex = (serialBufferReadIndex + 1) % SERIAL_BUFFER_SIZE;
+    writeToLinePrinter('\n');
 
-        return data;
+}
 
-    } else if (device == 0x08) {
+/* SIO device on ports 0x10 and 0x11, which ends the run once the guest is polling for input in a tight loop */
 
-        return ~(currentFlags) & 0xFF;
-        
-    } else if (device == 0x09) {
+typedef struct {
+    uint32_t lastPollCycles;
+    uint32_t idlePolls;
+    bool idle;
+} sioState_t;
 
-        if (currentFlags & DISK_STATUS_HEAD_LOADED) {
-        
-            /* Head loaded */
+static sioState_t sioState;
 
-            currentByte = 0;
+static uint sioInput(struct i8080 *cpu, void *state, uint port) {
 
-            currentSector += 1;
+    sioState_t *sio = state;
 
-            if (currentSector > DISK_NUMBER_OF_SECTORS - 1) currentSector = 0;
+    bool inputPending = serialBufferReadIndex != serialBufferWriteIndex;
 
-            return currentSector << 1;
+    if (port == 0x10) {
+
+        bool outputPending = teleprinterBufferReadIndex != teleprinterBufferWriteIndex;
+
+        bool outputFull = (teleprinterBufferWriteIndex + 1) % TELEPRINTER_BUFFER_SIZE == teleprinterBufferReadIndex;
+
+        if (outputPending && sendingToTeleprinter == false) sendToTeleprinter();
+
+        if (inputPending || outputPending || sendingToTeleprinter) {
+
+            sio->idlePolls = 0;
 
         } else {
 
-            /* Head not loaded */
+            sio->idlePolls = cpu->cyc - sio->lastPollCycles < IDLE_POLL_GAP ? sio->idlePolls + 1 : 0;
 
-            return 0x00;
-        
-        }
+            if (sio->idlePolls > IDLE_POLL_THRESHOLD) {
 
-    } else if (device == 0x0A) {
+                sio->idle = true;
 
-        if (currentByte >= DISK_SECTOR_SIZE) return 0x00;
+                i8080_yield(cpu);
 
-        if (currentByte == 0) loadSector();
+            }
 
-        uint8_t data = sectorBuffer[currentByte];
+        }
 
-        currentByte += 1;
+        sio->lastPollCycles = cpu->cyc;
 
-        return data;
+        return (outputFull ? 0x00 : 0x02) | (inputPending ? 0x01 : 0x00);
 
     }
 
-    return 0x00;
+    if (inputPending == false) return 0x00;
+
+    uint8_t data = serialBuffer[serialBufferReadIndex];
+    
+    serialBufferReadIndex = (serialBufferReadIndex + 1) % SERIAL_BUFFER_SIZE;
+
+    return data;
 
 }
 
-void handle_output(struct i8080 *cpu, uint device, uint data) {
+static void sioOutput(struct i8080 *cpu, void *state, uint port, uint data) {
 
-    static bool firstByte = false;
-    static bool secondByte = false;
+    if (port != 0x11) return;
 
-    if (device == 0x02) {
+    uint32_t nextIndex = (teleprinterBufferWriteIndex + 1) % TELEPRINTER_BUFFER_SIZE;
 
-        if (data == 0x01 || data == 0x02) {
+    /* Drop the character, as the USB write would while busy, if the guest ignores the status port */
 
-            linePrinterBuffer[linePrinterBufferWriteIndex++] = '\r';
+    if (nextIndex == teleprinterBufferReadIndex) return;
 
-            linePrinterBuffer[linePrinterBufferWriteIndex++] = '\n';
+    teleprinterBuffer[teleprinterBufferWriteIndex] = data & 0x7F;
 
-        }
+    teleprinterBufferWriteIndex = nextIndex;
+
+    if (sendingToTeleprinter == false) sendToTeleprinter();
+
+}
 
-    } else if (device == 0x03) {
+static struct i8080_device sioDevice = {&sioState, sioInput, sioOutput};
 
-        if (data == '\r' || data == '\n') {
+/* 88-DCDD disk controller on ports 0x08 to 0x0A */
 
-            linePrinterBuffer[linePrinterBufferWriteIndex++] = '\r';
+static uint diskInput(struct i8080 *cpu, void *state, uint port) {
 
-            linePrinterBuffer[linePrinterBufferWriteIndex++] = '\n';
+    if (port == 0x08) {
 
-        } else if (data != 0x11) {
+        return ~(currentFlags) & 0xFF;
+        
+    } else if (port == 0x09) {
 
-            linePrinterBuffer[linePrinterBufferWriteIndex++] = data;
+        if (currentFlags & DISK_STATUS_HEAD_LOADED) {
+        
+            /* Head loaded */
+
+            currentByte = 0;
+
+            currentSector += 1;
+
+            if (currentSector > DISK_NUMBER_OF_SECTORS - 1) currentSector = 0;
+
+            return currentSector << 1;
 
         }
 
-    } else if (device == 0x08) {
+        /* Head not loaded */
+
+        return 0x00;
+
+    }
+
+    if (currentByte >= DISK_SECTOR_SIZE) return 0x00;
+
+    if (currentByte == 0) loadSector();
+
+    uint8_t data = sectorBuffer[currentByte];
+
+    currentByte += 1;
+
+    return data;
+
+}
+
+static void diskOutput(struct i8080 *cpu, void *state, uint port, uint data) {
+
+    if (port == 0x08) {
 
         currentDisk = data & 0x0F;
 
@@ -462,7 +712,7 @@ void handle_output(struct i8080 *cpu, uint device, uint data) {
 
         }
 
-    } else if (device == 0x09) {
+    } else if (port == 0x09) {
 
         if (data & 0x01) {
 
@@ -514,7 +764,7 @@ void handle_output(struct i8080 *cpu, uint device, uint data) {
 
         }
 
-    } else if (device == 0x0A) {
+    } else {
 
         if (currentByte < DISK_SECTOR_SIZE) {
 
@@ -532,42 +782,321 @@ void handle_output(struct i8080 *cpu, uint device, uint data) {
 
         }
 
-    } else if (device == 0x11) {
+    }
+
+}
+
+static struct i8080_device diskDevice = {NULL, diskInput, diskOutput};
+
+/* Line printer on ports 0x02 and 0x03 */
+
+static uint linePrinterInput(struct i8080 *cpu, void *state, uint port) {
+
+    return port == 0x02 ? 0xFF : 0x00;
+
+}
+
+static void linePrinterOutput(struct i8080 *cpu, void *state, uint port, uint data) {
+
+    if (port == 0x02) {
+
+        if (data == 0x01 || data == 0x02) writeLinePrinterNewLine();
+
+    } else if (data == '\r' || data == '\n') {
+
+        writeLinePrinterNewLine();
+
+    } else if (data != 0x11) {
+
+        writeToLinePrinter(data);
+
+    }
+
+}
+
+static struct i8080_device linePrinterDevice = {NULL, linePrinterInput, linePrinterOutput};
 
-        sendingToTeleprinter = true;
+/* Printer on ports 0x31 and 0x33, whose characters follow a 0xBF 0xFF command */
 
-        usbTxBuffer[0] = data & 0x7F;
+typedef struct {
+    bool firstByte;
+    bool secondByte;
+} printerState_t;
+
+static printerState_t printerState;
+
+static void printerOutput(struct i8080 *cpu, void *state, uint port, uint data) {
 
-        USBD_Write(CDC_EP_DATA_IN, (void*)usbTxBuffer, 1, UsbDataSent);
+    printerState_t *printer = state;
 
-    } else if (device == 0x31) {
+    if (port == 0x31) {
 
         if (data == 0xE7 || data == 0xEF) {
 
-            linePrinterBuffer[linePrinterBufferWriteIndex++] = ' ';
+            writeToLinePrinter(' ');
 
-        } else if (data != 0xF3 && secondByte) {
+        } else if (data != 0xF3 && printer->secondByte) {
 
-            linePrinterBuffer[linePrinterBufferWriteIndex++] = ((~data) >> 1) & 0x7F;
+            writeToLinePrinter(((~data) >> 1) & 0x7F);
 
         }
 
-    } else if (device == 0x33) {
+    } else {
+
+        printer->secondByte = printer->firstByte && data == 0xFF;
+
+        printer->firstByte = data == 0xBF;
+
+        if (data == 0x7F) writeLinePrinterNewLine();
+
+    }
+
+}
+
+static struct i8080_device printerDevice = {&printerState, NULL, printerOutput};
+
+/* Intel 8080 port table */
+
+static struct i8080_io io;
+
+static void initialiseDevices() {
+
+    i8080_io_init(&io);
+
+    i8080_io_map(&io, &linePrinterDevice, 0x02, 0x03);
+
+    i8080_io_map(&io, &diskDevice, 0x08, 0x0A);
+
+    i8080_io_map(&io, &sioDevice, 0x10, 0x11);
+
+    i8080_io_map(&io, &printerDevice, 0x31, 0x31);
+
+    i8080_io_map(&io, &printerDevice, 0x33, 0x33);
+
+    sioState.lastPollCycles = 0;
 
-        secondByte = firstByte && data == 0xFF;
+    sioState.idlePolls = 0;
 
-        firstByte = data == 0xBF;
+    sioState.idle = false;
+
+    printerState.firstByte = false;
+
+    printerState.secondByte = false;
+
+    i8080_set_io(&cpu, &io);
+
+}
+
+/* Housekeeping events, scheduled in emulated cycles */
+
+typedef struct {
+    AM_switchPosition_t position;
+    uint32_t changeCycles;
+    bool changed;
+} switchState_t;
+
+static switchState_t switchState;
+
+static bool ledState;
+
+static struct i8080_event switchEvent;
+
+static struct i8080_event ledEvent;
+
+static struct i8080_event watchdogEvent;
+
+typedef struct {
+    uint64_t startMilliseconds;
+    uint64_t startCycles;
+    uint64_t sessionMilliseconds;
+    uint64_t sessionCycles;
+    uint64_t sleptMilliseconds;
+} governorState_t;
+
+static governorState_t governorState;
+
+static struct i8080_event governorEvent;
+
+static uint64_t getMilliseconds() {
+
+    uint32_t time, milliseconds;
+
+    AudioMoth_getTime(&time, &milliseconds);
+
+    return (uint64_t)time * 1000 + milliseconds;
+
+}
+
+static void checkSwitch(struct i8080_event *event, void *state) {
+
+    switchState_t *monitor = state;
+
+    AM_switchPosition_t currentSwitchPosition = AudioMoth_getSwitchPosition();
+
+    monitor->changeCycles = currentSwitchPosition != monitor->position ? monitor->changeCycles + SWITCH_CHECK_INTERVAL : 0;
+
+    if (monitor->changeCycles > SWITCH_CHANGE_THRESHOLD) {
+
+        monitor->position = currentSwitchPosition;
+
+        monitor->changed = true;
+
+        return;
+
+    }
+
+    i8080_schedule(&scheduler, event, SWITCH_CHECK_INTERVAL);
+
+}
+
+static void flashLED(struct i8080_event *event, void *state) {
+
+    ledState = !ledState;
+
+    AudioMoth_setGreenLED(ledState);
+
+    i8080_schedule(&scheduler, event, LED_FLASH_THRESHOLD);
+
+}
 
-        if (data == 0x7F) {
+static void feedWatchdog(struct i8080_event *event, void *state) {
 
-            linePrinterBuffer[linePrinterBufferWriteIndex++] = '\r';
+    AudioMoth_feedWatchdog();
 
-            linePrinterBuffer[linePrinterBufferWriteIndex++] = '\n';
+    i8080_schedule(&scheduler, event, WATCHDOG_INTERVAL);
+
+}
+
+static void governSpeed(struct i8080_event *event, void *state) {
+
+    governorState_t *governor = state;
+
+    uint64_t currentCycles = i8080_scheduler_now(&scheduler);
+
+    uint64_t currentMilliseconds = getMilliseconds();
+
+    uint64_t targetMilliseconds = (currentCycles - governor->startCycles) / TARGET_CYCLES_PER_MILLISECOND;
+
+    uint64_t elapsedMilliseconds = currentMilliseconds - governor->startMilliseconds;
+
+    if (targetMilliseconds > elapsedMilliseconds) {
+
+        /* Ahead of real time so write out any queued sectors, then sleep off what is left of the difference */
+
+        flushDiskWriteQueue();
+
+        elapsedMilliseconds = getMilliseconds() - governor->startMilliseconds;
+
+        if (targetMilliseconds > elapsedMilliseconds) {
+
+            uint32_t aheadMilliseconds = targetMilliseconds - elapsedMilliseconds;
+
+            AudioMoth_delay(aheadMilliseconds);
+
+            governor->sleptMilliseconds += aheadMilliseconds;
 
         }
 
+    } else if (elapsedMilliseconds > targetMilliseconds + GOVERNOR_MAXIMUM_LAG) {
+
+        /* Too far behind, after a slow SD card access say, so start pacing again from now rather than racing to catch up */
+
+        governor->startMilliseconds = currentMilliseconds;
+
+        governor->startCycles = currentCycles;
+
     }
 
+    i8080_schedule(&scheduler, event, GOVERNOR_INTERVAL);
+
+}
+
+static void writeSpeedReport() {
+
+    uint32_t sessionMilliseconds = getMilliseconds() - governorState.sessionMilliseconds;
+
+    uint64_t sessionCycles = i8080_scheduler_now(&scheduler) - governorState.sessionCycles;
+
+    if (sessionMilliseconds == 0) return;
+
+    uint32_t achievedSpeed = sessionCycles / sessionMilliseconds;
+
+    uint32_t sleepPercentage = 100 * governorState.sleptMilliseconds / sessionMilliseconds;
+
+    char report[256];
+
+    uint32_t length = SPEED_MULTIPLE > 0 ? sprintf(report, "Target %lu kHz, achieved %lu kHz over %lu ms, governor asleep %lu%%\r\n", (uint32_t)TARGET_CYCLES_PER_MILLISECOND, achievedSpeed, sessionMilliseconds, sleepPercentage) : sprintf(report, "Unthrottled, achieved %lu kHz over %lu ms\r\n", achievedSpeed, sessionMilliseconds);
+
+#ifdef I8080_PAGE_CACHE
+
+    /* Share of guest memory accesses served from internal RAM */
+
+    uint64_t accesses = (uint64_t)pageCache.hits + pageCache.misses;
+
+    uint32_t hitPermille = accesses > 0 ? 1000 * (uint64_t)pageCache.hits / accesses : 0;
+
+    length += sprintf(report + length, "Page cache hits %lu.%lu%%, %lu misses, %lu write backs\r\n", hitPermille / 10, hitPermille % 10, (uint32_t)pageCache.misses, (uint32_t)pageCache.writebacks);
+
+#endif
+
+#ifdef I8080_DIRTY_PAGES
+
+    /* Working set, as the pages the guest has written since reset */
+
+    length += sprintf(report + length, "Guest wrote %lu of %lu pages\r\n", (uint32_t)i8080_count_dirty_pages(&cpu), (uint32_t)I8080_PAGES);
+
+#endif
+
+    AudioMoth_appendFile("SPEED.TXT");
+
+    AudioMoth_writeToFile(report, length);
+
+    AudioMoth_closeFile();
+
+}
+
+static void initialiseEvents(AM_switchPosition_t switchPosition) {
+
+    i8080_scheduler_init(&scheduler, &cpu);
+
+    switchState.position = switchPosition;
+
+    switchState.changeCycles = 0;
+
+    switchState.changed = false;
+
+    ledState = false;
+
+    i8080_event_init(&switchEvent, checkSwitch, &switchState);
+
+    i8080_event_init(&ledEvent, flashLED, NULL);
+
+    i8080_event_init(&watchdogEvent, feedWatchdog, NULL);
+
+    i8080_event_init(&linePrinterFlushEvent, flushLinePrinter, NULL);
+
+    i8080_event_init(&diskWriteFlushEvent, flushDiskWrites, NULL);
+
+    i8080_event_init(&governorEvent, governSpeed, &governorState);
+
+    governorState.startMilliseconds = getMilliseconds();
+
+    governorState.startCycles = 0;
+
+    governorState.sessionMilliseconds = governorState.startMilliseconds;
+
+    governorState.sessionCycles = 0;
+
+    governorState.sleptMilliseconds = 0;
+
+    i8080_schedule(&scheduler, &switchEvent, SWITCH_CHECK_INTERVAL);
+
+    i8080_schedule(&scheduler, &ledEvent, LED_FLASH_THRESHOLD);
+
+    i8080_schedule(&scheduler, &watchdogEvent, WATCHDOG_INTERVAL);
+
+    if (SPEED_MULTIPLE > 0) i8080_schedule(&scheduler, &governorEvent, GOVERNOR_INTERVAL);
+
 }
 
 /* Clear terminal */
@@ -715,95 +1244,97 @@ int main(void) {
         
         cpu.memory = (char*)AM_EXTERNAL_SRAM_START_ADDRESS;
 
-        cpu.input_handler = handle_input;
-        
-        cpu.output_handler = handle_output;
+        initialiseDevices();
 
         serialBufferReadIndex = 0;
 
         serialBufferWriteIndex = 0;
 
+        teleprinterBufferReadIndex = 0;
+
+        teleprinterBufferWriteIndex = 0;
+
         sendingToTeleprinter = false;
 
-        /* Clear the memory */
+        diskWriteQueueReadIndex = 0;
 
-        memset(cpu.memory, 0, MEMORY_SIZE);
+        diskWriteQueueWriteIndex = 0;
 
-        /* Copy program to memory */
+#ifdef I8080_LAZY_MEMORY
 
-        memcpy(cpu.memory, basicdisk24k50, sizeof(basicdisk24k50));
+        /* Clear the memory and map the program in from flash, with each page only copied to the external SRAM on its first write */
 
-        /* Main loop */
+        i8080_clear_memory(&cpu);
 
-        bool ledState = false;
+        i8080_map_image(&cpu, basicdisk24k50, sizeof(basicdisk24k50));
 
-        uint32_t ledFlashCounter = 0;
+#else
 
-        uint32_t switchChangeCounter = 0;
+        /* Unpack program to memory, which writes its zeros too, and clear the rest */
 
-        uint32_t linePrinterCounter = 0;
+        size_t programSize = i8080_unpack(cpu.memory, MEMORY_SIZE, basicdisk24k50_packed, sizeof(basicdisk24k50_packed));
 
-        while (true) {
+        memset(cpu.memory + programSize, 0, MEMORY_SIZE - programSize);
 
-            /* Check switch positions */
+#endif
 
-            AM_switchPosition_t currentSwitchPosition = AudioMoth_getSwitchPosition();
+#ifdef I8080_PRECOMPILED
 
-            switchChangeCounter = currentSwitchPosition != switchPosition ? switchChangeCounter + 1 : 0;
-            
-            if (switchChangeCounter > SWITCH_CHANGE_THRESHOLD) {
+        /* Attach the precompiled blocks once memory holds their image */
 
-                switchPosition = currentSwitchPosition;
+        i8080_set_precompiled(&cpu, &precompiled);
 
-                break;
+#endif
 
-            }
+#ifdef I8080_PAGE_CACHE
 
-            /* Write lineprinter output */
+        /* Keep the pages in use in internal RAM in front of the external SRAM */
 
-            linePrinterCounter = linePrinterBufferWriteIndex > 0 ? linePrinterCounter + 1 : 0;
+        i8080_set_page_cache(&cpu, &pageCache);
 
-            if (linePrinterCounter > LINE_PRINTER_THRESHOLD) {
+#endif
 
-                AudioMoth_setRedLED(true);
+        /* Main loop */
 
-                AudioMoth_appendFile("LINEPRINTER.TXT");
+        initialiseEvents(switchPosition);
 
-                AudioMoth_writeToFile(linePrinterBuffer, linePrinterBufferWriteIndex);
+        while (switchState.changed == false) {
 
-                AudioMoth_closeFile();
+            /* Run the Intel 8080 up to the next event */
 
-                AudioMoth_setRedLED(false);
+            i8080_scheduler_run(&scheduler, SLICE_CYCLES);
 
-                linePrinterBufferWriteIndex = 0;
+            /* Sleep while the guest waits for input, moving emulated time on so events keep their pace */
 
-                linePrinterCounter = 0;
+            while (sioState.idle && switchState.changed == false) {
 
-            }
+                flushDiskWriteQueue();
 
-            /* Flash LED */
+                AudioMoth_delay(IDLE_SLEEP_INTERVAL);
 
-            ledFlashCounter += 1;
+                i8080_scheduler_skip(&scheduler, IDLE_SLEEP_INTERVAL * TARGET_CYCLES_PER_MILLISECOND);
 
-            if (ledFlashCounter > LED_FLASH_THRESHOLD) {
+                if (serialBufferReadIndex != serialBufferWriteIndex) {
 
-                ledState = !ledState;
+                    sioState.idlePolls = 0;
 
-                AudioMoth_setGreenLED(ledState);
+                    sioState.idle = false;
 
-                ledFlashCounter = 0;
+                }
 
             }
 
-            /* Perform Intel 8080 step */
+        }
 
-            i8080_step(&cpu);
+        switchPosition = switchState.position;
 
-            /* Feed watchdog */
+        /* Write out any sectors still queued */
 
-            AudioMoth_feedWatchdog();
+        flushDiskWriteQueue();
 
-        }
+        /* Record the speed achieved against the target */
+
+        writeSpeedReport();
 
         /* Turn off LED */
 